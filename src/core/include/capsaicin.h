@@ -29,6 +29,7 @@ THE SOFTWARE.
 #include <map>
 #include <string_view>
 #include <variant>
+#include <vector>
 
 namespace Capsaicin
 {
@@ -58,6 +59,22 @@ CAPSAICIN_EXPORT std::string_view GetCurrentRenderer() noexcept;
  */
 CAPSAICIN_EXPORT bool SetRenderer(std::string_view const &name) noexcept;
 
+/**
+ * Begins switching to the requested renderer asynchronously.
+ * The new renderer's techniques are created and initialised incrementally over subsequent frames while
+ * the current renderer continues to be rendered, then the swap is performed automatically during a later
+ * call to Render().
+ * @param name The name of the renderer to set (must be one of the options from GetRenderers()).
+ * @returns True if the switch was started (or the renderer is already active), False otherwise.
+ */
+CAPSAICIN_EXPORT bool SetRendererAsync(std::string_view const &name) noexcept;
+
+/**
+ * Check if an asynchronous renderer switch is currently in flight.
+ * @returns True if a new renderer is still being warmed up.
+ */
+CAPSAICIN_EXPORT bool GetRendererLoading() noexcept;
+
 /**
  * Gets the currently set scenes.
  * @returns The current scene name.
@@ -71,6 +88,21 @@ CAPSAICIN_EXPORT std::vector<std::string> GetCurrentScenes() noexcept;
  */
 CAPSAICIN_EXPORT bool SetScenes(std::vector<std::string> const &names) noexcept;
 
+/**
+ * Begins loading the requested scenes asynchronously.
+ * The scene files are imported on a background thread while the currently loaded scene (if any) continues
+ * to be rendered. The new scene is swapped in automatically during a later call to Render().
+ * @param names The names of the scene files.
+ * @returns True if the load was started (or the scenes are already loaded), False otherwise.
+ */
+CAPSAICIN_EXPORT bool SetScenesAsync(std::vector<std::string> const &names) noexcept;
+
+/**
+ * Check if an asynchronous scene load is currently in flight.
+ * @returns True if a background scene load has not yet completed.
+ */
+CAPSAICIN_EXPORT bool GetSceneLoading() noexcept;
+
 /**
  * Gets the list of cameras available in the current scene.
  * @returns The cameras list.
@@ -139,6 +171,17 @@ CAPSAICIN_EXPORT std::vector<std::string_view> GetAOVs() noexcept;
  */
 CAPSAICIN_EXPORT void Render() noexcept;
 
+/**
+ * Renders a batch of frames back to back without presenting, for headless/offscreen use.
+ * Initialize() can be passed a windowless context (see the width/height overload of gfxCreateContext())
+ * in which case no window or swapchain is required and no present overhead is paid per frame.
+ * @param frame_count    The number of frames to render.
+ * @param dump_aov       (Optional) AOV to dump once the final frame completes (empty for none).
+ * @param dump_file_path (Optional) Full pathname to the file to save the dumped AOV as.
+ */
+CAPSAICIN_EXPORT void RenderBatch(uint32_t frame_count, std::string_view const &dump_aov = "",
+    char const *dump_file_path = nullptr) noexcept;
+
 /**
  * Render UI elements related to current internal state
  * Must be called between ImGui::Begin() and ImGui::End().
@@ -165,6 +208,79 @@ CAPSAICIN_EXPORT double GetFrameTime() noexcept;
  */
 CAPSAICIN_EXPORT double GetAverageFrameTime() noexcept;
 
+/** Per-pass profiling results for a single component or render technique. */
+struct ProfileNode
+{
+    std::string_view name;    /**< The name of the timed scope */
+    float            gpuTime; /**< The GPU duration of the scope (ms) */
+    float            cpuTime; /**< The CPU duration of the scope (ms) */
+    std::vector<std::pair<std::string_view, float>>
+        children; /**< GPU durations of any named sub-passes within the scope (ms) */
+};
+
+/** Profiling results for a single rendered frame. */
+struct ProfileFrame
+{
+    uint32_t                 frameIndex; /**< The index of the profiled frame */
+    float                    frameTime;  /**< The total frame time (ms) */
+    std::vector<ProfileNode> nodes;      /**< The per-component/technique results in execution order */
+};
+
+/**
+ * Gets the profiling results for the most recently rendered frames.
+ * Results are kept in a ring buffer covering the last 256 rendered frames.
+ * @returns The profiled frames in increasing frame order.
+ */
+CAPSAICIN_EXPORT std::vector<ProfileFrame> GetProfileData() noexcept;
+
+/**
+ * Gets the profiling results for the most recently rendered frame only.
+ * Cheaper than GetProfileData() when sampling every frame.
+ * @returns The profiled frame (empty if nothing has been rendered yet).
+ */
+CAPSAICIN_EXPORT ProfileFrame GetLastProfileFrame() noexcept;
+
+/** Frame-time statistics calculated over a sliding window of the profiling history. */
+struct FrameStats
+{
+    uint32_t frameCount; /**< The number of frames the statistics actually cover */
+    float    average;    /**< The mean frame time (ms) */
+    float    p50;        /**< The median frame time (ms) */
+    float    p95;        /**< The 95th percentile frame time (ms) */
+    float    p99;        /**< The 99th percentile frame time (ms) */
+    float    max;        /**< The maximum frame time (ms) */
+};
+
+/**
+ * Gets frame-time statistics over the most recently rendered frames.
+ * Percentiles are calculated with the nearest-rank method over the profiling history ring, so the
+ * window is capped at the last 256 rendered frames.
+ * @param window The number of recent frames to cover (0 uses the full available history).
+ * @returns The calculated statistics (zeroed if nothing has been rendered yet).
+ */
+CAPSAICIN_EXPORT FrameStats GetFrameStats(uint32_t window = 0) noexcept;
+
+/**
+ * Sets the frame-time threshold above which a frame is recorded as a stutter event.
+ * @param thresholdMs The threshold (ms), 0 disables stutter tracking (default).
+ */
+CAPSAICIN_EXPORT void SetStutterThreshold(float thresholdMs) noexcept;
+
+/**
+ * Gets the frames that exceeded the stutter threshold, with their full technique breakdown.
+ * Events are kept in a ring buffer covering the last 64 stutters.
+ * @returns The offending frames in increasing frame order.
+ */
+CAPSAICIN_EXPORT std::vector<ProfileFrame> GetStutterEvents() noexcept;
+
+/**
+ * Saves the current profiling history to disk using the Chrome trace event format (chrome://tracing).
+ * Scope start times are reconstructed from pass durations as only durations are recorded.
+ * @param file_path Full pathname to the .json file to save as.
+ * @returns True if successful, False otherwise.
+ */
+CAPSAICIN_EXPORT bool DumpProfileTrace(char const *file_path) noexcept;
+
 /**
  * Check if the current scene has any usable animations.
  * @return True if animations are present, False otherwise.
@@ -202,6 +318,22 @@ CAPSAICIN_EXPORT void SetFixedFrameTime(double fixed_frame_time) noexcept;
  */
 CAPSAICIN_EXPORT bool GetFixedFrameRate() noexcept;
 
+/**
+ * Enable or disable pipelined scene updates.
+ * When enabled the next frame's CPU scene update (animation evaluation and change detection
+ * hashing) runs on a worker thread while the current frame executes on the GPU. Requires fixed
+ * frame rate playback to predict the next playback position; playback control changes take effect
+ * one frame later than usual while enabled.
+ * @param enabled True to overlap the CPU scene update with GPU execution.
+ */
+CAPSAICIN_EXPORT void SetPipelinedUpdate(bool enabled) noexcept;
+
+/**
+ * Query if pipelined scene updates are enabled.
+ * @return True if the CPU scene update is overlapped with GPU execution.
+ */
+CAPSAICIN_EXPORT bool GetPipelinedUpdate() noexcept;
+
 /**
  * Restart playback to start of animation.
  */
@@ -385,6 +517,26 @@ CAPSAICIN_EXPORT void ReloadShaders() noexcept;
  */
 CAPSAICIN_EXPORT void DumpAOVBuffer(char const *file_path, std::string_view const &aov) noexcept;
 
+/**
+ * Sets whether dumped EXR images are written using half-precision channel data.
+ * @param enable True to encode EXR channels as half floats.
+ */
+CAPSAICIN_EXPORT void SetDumpHalfPrecisionEXR(bool enable) noexcept;
+
+/**
+ * Sets whether negotiable float AOVs are narrowed to half precision.
+ * Only AOVs whose requesting techniques declared their format as a minimum are affected, exact
+ * format requests are always honoured. The current renderer is rebuilt asynchronously to apply.
+ * @param enable True to narrow negotiable AOVs to half precision.
+ */
+CAPSAICIN_EXPORT void SetHalfPrecisionAOVs(bool enable) noexcept;
+
+/**
+ * Gets whether negotiable float AOVs are narrowed to half precision.
+ * @returns True if half-precision AOVs are enabled.
+ */
+CAPSAICIN_EXPORT bool GetHalfPrecisionAOVs() noexcept;
+
 /**
  * Saves current camera attributes to disk.
  * @param file_path   Full pathname to the file to save as.
@@ -392,4 +544,29 @@ CAPSAICIN_EXPORT void DumpAOVBuffer(char const *file_path, std::string_view cons
  */
 CAPSAICIN_EXPORT void DumpCamera(char const *file_path, bool jittered) noexcept;
 
+/**
+ * Starts recording the per-frame camera state (including the jitter sequence).
+ * Any previously recorded or loaded camera path is discarded.
+ */
+CAPSAICIN_EXPORT void StartCameraPathRecording() noexcept;
+
+/**
+ * Stops recording and saves the recorded camera path to disk.
+ * @param file_path Full pathname to the file to save as.
+ * @returns True if successful, False otherwise.
+ */
+CAPSAICIN_EXPORT bool StopCameraPathRecording(char const *file_path) noexcept;
+
+/**
+ * Loads a camera path from disk and starts replaying it from its first frame.
+ * While replaying, the active camera and jitter sequence are driven bit-exactly from the file;
+ * combine with SetFixedFrameTime() for fully deterministic benchmark runs.
+ * @param file_path Full pathname to the file to load.
+ * @returns True if successful, False otherwise.
+ */
+CAPSAICIN_EXPORT bool StartCameraPathReplay(char const *file_path) noexcept;
+
+/** Stops any current camera path replay and returns control to the interactive camera. */
+CAPSAICIN_EXPORT void StopCameraPathReplay() noexcept;
+
 } // namespace Capsaicin
@@ -56,6 +56,18 @@ bool SetRenderer(std::string_view const &name) noexcept
     return false;
 }
 
+bool SetRendererAsync(std::string_view const &name) noexcept
+{
+    if (g_renderer != nullptr) return g_renderer->setRendererAsync(name);
+    return false;
+}
+
+bool GetRendererLoading() noexcept
+{
+    if (g_renderer != nullptr) return g_renderer->getRendererLoading();
+    return false;
+}
+
 std::vector<std::string> GetCurrentScenes() noexcept
 {
     if (g_renderer != nullptr) return g_renderer->getCurrentScenes();
@@ -68,6 +80,18 @@ bool SetScenes(std::vector<std::string> const &names) noexcept
     return false;
 }
 
+bool SetScenesAsync(std::vector<std::string> const &names) noexcept
+{
+    if (g_renderer != nullptr) return g_renderer->setScenesAsync(names);
+    return false;
+}
+
+bool GetSceneLoading() noexcept
+{
+    if (g_renderer != nullptr) return g_renderer->getSceneLoading();
+    return false;
+}
+
 std::vector<std::string_view> GetSceneCameras() noexcept
 {
     if (g_renderer != nullptr) return g_renderer->getSceneCameras();
@@ -133,6 +157,11 @@ void Render() noexcept
     if (g_renderer != nullptr) g_renderer->render();
 }
 
+void RenderBatch(uint32_t frame_count, std::string_view const &dump_aov, char const *dump_file_path) noexcept
+{
+    if (g_renderer != nullptr) g_renderer->renderBatch(frame_count, dump_aov, dump_file_path);
+}
+
 void RenderGUI(bool readOnly) noexcept
 {
     if (g_renderer != nullptr) g_renderer->renderGUI(readOnly);
@@ -184,6 +213,17 @@ void SetFixedFrameTime(double fixed_frame_time) noexcept
     if (g_renderer != nullptr) g_renderer->setFixedFrameTime(fixed_frame_time);
 }
 
+void SetPipelinedUpdate(bool enabled) noexcept
+{
+    if (g_renderer != nullptr) g_renderer->setPipelinedUpdate(enabled);
+}
+
+bool GetPipelinedUpdate() noexcept
+{
+    if (g_renderer != nullptr) return g_renderer->getPipelinedUpdate();
+    return false;
+}
+
 bool GetFixedFrameRate() noexcept
 {
     if (g_renderer != nullptr) return g_renderer->getFixedFrameRate();
@@ -312,4 +352,77 @@ void DumpCamera(char const *file_path, bool jittered) noexcept
     if (g_renderer != nullptr) g_renderer->dumpCamera(file_path, jittered);
 }
 
+std::vector<ProfileFrame> GetProfileData() noexcept
+{
+    if (g_renderer != nullptr) return g_renderer->getProfileData();
+    return {};
+}
+
+ProfileFrame GetLastProfileFrame() noexcept
+{
+    if (g_renderer != nullptr) return g_renderer->getLastProfileFrame();
+    return {};
+}
+
+FrameStats GetFrameStats(uint32_t window) noexcept
+{
+    if (g_renderer != nullptr) return g_renderer->getFrameStats(window);
+    return {};
+}
+
+void SetStutterThreshold(float thresholdMs) noexcept
+{
+    if (g_renderer != nullptr) g_renderer->setStutterThreshold(thresholdMs);
+}
+
+std::vector<ProfileFrame> GetStutterEvents() noexcept
+{
+    if (g_renderer != nullptr) return g_renderer->getStutterEvents();
+    return {};
+}
+
+bool DumpProfileTrace(char const *file_path) noexcept
+{
+    if (g_renderer != nullptr) return g_renderer->dumpProfileTrace(file_path);
+    return false;
+}
+
+void SetDumpHalfPrecisionEXR(bool enable) noexcept
+{
+    if (g_renderer != nullptr) g_renderer->setDumpHalfPrecisionEXR(enable);
+}
+
+void SetHalfPrecisionAOVs(bool enable) noexcept
+{
+    if (g_renderer != nullptr) g_renderer->setHalfPrecisionAOVs(enable);
+}
+
+bool GetHalfPrecisionAOVs() noexcept
+{
+    if (g_renderer != nullptr) return g_renderer->getHalfPrecisionAOVs();
+    return false;
+}
+
+void StartCameraPathRecording() noexcept
+{
+    if (g_renderer != nullptr) g_renderer->startCameraPathRecording();
+}
+
+bool StopCameraPathRecording(char const *file_path) noexcept
+{
+    if (g_renderer != nullptr) return g_renderer->stopCameraPathRecording(file_path);
+    return false;
+}
+
+bool StartCameraPathReplay(char const *file_path) noexcept
+{
+    if (g_renderer != nullptr) return g_renderer->startCameraPathReplay(file_path);
+    return false;
+}
+
+void StopCameraPathReplay() noexcept
+{
+    if (g_renderer != nullptr) g_renderer->stopCameraPathReplay();
+}
+
 } // namespace Capsaicin
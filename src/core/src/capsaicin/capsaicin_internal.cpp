@@ -25,17 +25,170 @@ THE SOFTWARE.
 #include "components/light_builder/light_builder.h"
 #include "hash_reduce.h"
 #include "render_technique.h"
+#include "scene_cache.h"
+#include "texture_compression.h"
 #include "thread_pool.h"
 
 #define _USE_MATH_DEFINES
+#include <algorithm>
 #include <chrono>
 #include <filesystem>
+#include <fstream>
 #include <gfx_imgui.h>
 #include <glm/gtc/matrix_transform.hpp>
 #include <math.h>
+#include <optional>
+#include <unordered_map>
+#include <unordered_set>
 
 namespace Capsaicin
 {
+static std::map<std::string, size_t> HashShaderSources(std::string const &shader_path) noexcept;
+
+/**
+ * Coalesce a list of dirty element indices into contiguous (first, count) ranges.
+ * Ranges separated by less than @merge_gap elements are merged, uploading a few unchanged elements
+ * is cheaper than issuing an extra copy command per small range.
+ * @tparam VECTOR Any vector-like container of uint32_t indices (e.g. @FrameVector).
+ * @param [in,out] indices The dirty element indices (sorted in place).
+ * @param merge_gap        The maximum gap between ranges that still gets merged.
+ * @returns The coalesced ranges.
+ */
+template<typename VECTOR>
+static std::vector<std::pair<uint32_t, uint32_t>> CoalesceDirtyRanges(
+    VECTOR &indices, uint32_t merge_gap) noexcept
+{
+    std::vector<std::pair<uint32_t, uint32_t>> ranges;
+    if (indices.empty())
+    {
+        return ranges;
+    }
+    std::sort(indices.begin(), indices.end());
+    ranges.emplace_back(indices[0], 1U);
+    for (size_t i = 1; i < indices.size(); ++i)
+    {
+        if (indices[i] == indices[i - 1])
+        {
+            continue;
+        }
+        auto &[first, count] = ranges.back();
+        if (indices[i] < first + count + merge_gap)
+        {
+            count = indices[i] - first + 1;
+        }
+        else
+        {
+            ranges.emplace_back(indices[i], 1U);
+        }
+    }
+    return ranges;
+}
+
+/**
+ * Combine the hot fields of an instance and its mesh into a packed per-instance record.
+ * @param instance The instance to pack.
+ * @param mesh     The mesh referenced by the instance.
+ * @returns The packed record.
+ */
+static InstancePacked PackInstance(Instance const &instance, Mesh const &mesh) noexcept
+{
+    InstancePacked packed  = {};
+    packed.vertex_offset_idx = mesh.vertex_offset_idx;
+    packed.index_offset_idx  = mesh.index_offset_idx;
+    packed.index_count       = mesh.index_count;
+    packed.material_index    = instance.material_index;
+    packed.transform_index   = instance.transform_index;
+    packed.mesh_index        = instance.mesh_index;
+    return packed;
+}
+
+/**
+ * Get the negotiation family of an AOV format.
+ * Formats in the same family share a channel layout at different precisions and can be substituted
+ * for one another during AOV format negotiation.
+ * @param format The format to query.
+ * @returns The family identifier (0 if the format is not negotiable).
+ */
+static uint32_t GetAOVFormatFamily(DXGI_FORMAT format) noexcept
+{
+    switch (format)
+    {
+    case DXGI_FORMAT_R16G16B16A16_FLOAT:
+    case DXGI_FORMAT_R32G32B32A32_FLOAT: return 1;
+    case DXGI_FORMAT_R16G16_FLOAT:
+    case DXGI_FORMAT_R32G32_FLOAT: return 2;
+    case DXGI_FORMAT_R16_FLOAT:
+    case DXGI_FORMAT_R32_FLOAT: return 3;
+    default: return 0;
+    }
+}
+
+/**
+ * Get the precision rank of an AOV format within its negotiation family.
+ * @param format The format to query.
+ * @returns The rank (higher values are wider formats).
+ */
+static uint32_t GetAOVFormatRank(DXGI_FORMAT format) noexcept
+{
+    switch (format)
+    {
+    case DXGI_FORMAT_R32G32B32A32_FLOAT:
+    case DXGI_FORMAT_R32G32_FLOAT:
+    case DXGI_FORMAT_R32_FLOAT: return 1;
+    default: return 0;
+    }
+}
+
+/**
+ * Negotiate the narrowest format satisfying two differing AOV format requests.
+ * @param first            The first requested format.
+ * @param first_precision  How strictly the first format must be honoured.
+ * @param second           The second requested format.
+ * @param second_precision How strictly the second format must be honoured.
+ * @returns The negotiated format (DXGI_FORMAT_UNKNOWN if the requests are incompatible).
+ */
+static DXGI_FORMAT NegotiateAOVFormat(DXGI_FORMAT first, AOV::Precision first_precision,
+    DXGI_FORMAT second, AOV::Precision second_precision) noexcept
+{
+    uint32_t const family = GetAOVFormatFamily(first);
+    if (family == 0 || family != GetAOVFormatFamily(second))
+    {
+        return DXGI_FORMAT_UNKNOWN;
+    }
+    uint32_t const first_rank  = GetAOVFormatRank(first);
+    uint32_t const second_rank = GetAOVFormatRank(second);
+    if (first_precision == AOV::Exact && second_precision == AOV::Exact)
+    {
+        // Two techniques demanded exact yet differing formats
+        return DXGI_FORMAT_UNKNOWN;
+    }
+    if (first_precision == AOV::Exact)
+    {
+        return first_rank >= second_rank ? first : DXGI_FORMAT_UNKNOWN;
+    }
+    if (second_precision == AOV::Exact)
+    {
+        return second_rank >= first_rank ? second : DXGI_FORMAT_UNKNOWN;
+    }
+    return first_rank >= second_rank ? first : second;
+}
+
+/**
+ * Get the half-precision member of an AOV format's negotiation family.
+ * @param format The format to narrow.
+ * @returns The narrowed format (unchanged if the format is not negotiable).
+ */
+static DXGI_FORMAT GetHalfPrecisionAOVFormat(DXGI_FORMAT format) noexcept
+{
+    switch (format)
+    {
+    case DXGI_FORMAT_R32G32B32A32_FLOAT: return DXGI_FORMAT_R16G16B16A16_FLOAT;
+    case DXGI_FORMAT_R32G32_FLOAT: return DXGI_FORMAT_R16G16_FLOAT;
+    case DXGI_FORMAT_R32_FLOAT: return DXGI_FORMAT_R16_FLOAT;
+    default: return format;
+    }
+}
+
 CapsaicinInternal::CapsaicinInternal() {}
 
 CapsaicinInternal::~CapsaicinInternal()
@@ -55,10 +208,20 @@ GfxScene CapsaicinInternal::getScene() const
 
 uint32_t CapsaicinInternal::getWidth() const
 {
-    return gfxGetBackBufferWidth(gfx_);
+    return buffer_width_ != 0 ? buffer_width_ : gfxGetBackBufferWidth(gfx_);
 }
 
 uint32_t CapsaicinInternal::getHeight() const
+{
+    return buffer_height_ != 0 ? buffer_height_ : gfxGetBackBufferHeight(gfx_);
+}
+
+uint32_t CapsaicinInternal::getDisplayWidth() const noexcept
+{
+    return gfxGetBackBufferWidth(gfx_);
+}
+
+uint32_t CapsaicinInternal::getDisplayHeight() const noexcept
 {
     return gfxGetBackBufferHeight(gfx_);
 }
@@ -113,6 +276,29 @@ bool CapsaicinInternal::getFixedFrameRate() const noexcept
     return play_fixed_framerate_;
 }
 
+void CapsaicinInternal::setPipelinedUpdate(bool enabled) noexcept
+{
+    if (!enabled)
+    {
+        syncPipelinedUpdate();
+    }
+    pipelined_update_enabled_ = enabled;
+}
+
+bool CapsaicinInternal::getPipelinedUpdate() const noexcept
+{
+    return pipelined_update_enabled_;
+}
+
+void CapsaicinInternal::syncPipelinedUpdate() noexcept
+{
+    if (pipelined_update_.valid())
+    {
+        pipelined_update_.get();
+        pipelined_update_ = {};
+    }
+}
+
 void CapsaicinInternal::restartPlayback() noexcept
 {
     play_time_ = 0.0;
@@ -209,6 +395,16 @@ bool CapsaicinInternal::getEnvironmentMapUpdated() const noexcept
     return environment_map_updated_;
 }
 
+bool CapsaicinInternal::getEnvironmentMapRecreated() const noexcept
+{
+    return environment_map_recreated_;
+}
+
+void CapsaicinInternal::queueEnvironmentMapUpdate() noexcept
+{
+    environment_map_update_queued_ = true;
+}
+
 std::vector<std::string_view> CapsaicinInternal::getAOVs() const noexcept
 {
     std::vector<std::string_view> aovs;
@@ -219,14 +415,68 @@ std::vector<std::string_view> CapsaicinInternal::getAOVs() const noexcept
     return aovs;
 }
 
+void CapsaicinInternal::setHalfPrecisionAOVs(bool enable) noexcept
+{
+    if (half_precision_aovs_ != enable)
+    {
+        half_precision_aovs_ = enable;
+        // AOV formats are baked when a renderer is built, rebuild the current renderer in the
+        // background so the new formats take effect without stalling presentation
+        if (!renderer_name_.empty())
+        {
+            setRendererAsync(renderer_name_);
+        }
+    }
+}
+
+bool CapsaicinInternal::getHalfPrecisionAOVs() const noexcept
+{
+    return half_precision_aovs_;
+}
+
+FrameGraph const &CapsaicinInternal::getFrameGraph() const noexcept
+{
+    return frame_graph_;
+}
+
+MemoryBudget &CapsaicinInternal::getMemoryBudget() noexcept
+{
+    return memory_budget_;
+}
+
+GPUStatistics &CapsaicinInternal::getGpuStatistics() noexcept
+{
+    return gpu_statistics_;
+}
+
+FrameArena &CapsaicinInternal::getFrameArena() noexcept
+{
+    return frame_arena_;
+}
+
 bool CapsaicinInternal::hasAOVBuffer(std::string_view const &aov) const noexcept
 {
+    if (renderer_warming_up_
+        && std::any_of(pending_renderer_state_->aov_buffers.cbegin(),
+            pending_renderer_state_->aov_buffers.cend(),
+            [aov](auto const &item) { return item.first == aov; }))
+        return true;
     return std::any_of(
         aov_buffers_.cbegin(), aov_buffers_.cend(), [aov](auto const &item) { return item.first == aov; });
 }
 
 GfxTexture CapsaicinInternal::getAOVBuffer(std::string_view const &aov) const noexcept
 {
+    if (renderer_warming_up_)
+    {
+        // Modules of a renderer being warmed up must resolve against the pending AOV set as both
+        // sets are alive until the swap
+        if (auto i = std::find_if(pending_renderer_state_->aov_buffers.cbegin(),
+                pending_renderer_state_->aov_buffers.cend(),
+                [aov](auto const &item) { return item.first == aov; });
+            i != pending_renderer_state_->aov_buffers.cend())
+            return i->second;
+    }
     if (auto i = std::find_if(aov_buffers_.cbegin(), aov_buffers_.cend(),
             [aov](auto const &item) { return item.first == aov; });
         i != aov_buffers_.end())
@@ -257,12 +507,25 @@ bool CapsaicinInternal::checkDebugViewAOV(std::string_view const &view) const no
 
 bool CapsaicinInternal::hasBuffer(std::string_view const &buffer) const noexcept
 {
+    if (renderer_warming_up_
+        && std::any_of(pending_renderer_state_->shared_buffers.cbegin(),
+            pending_renderer_state_->shared_buffers.cend(),
+            [buffer](auto const &item) { return item.first == buffer; }))
+        return true;
     return std::any_of(shared_buffers_.cbegin(), shared_buffers_.cend(),
         [buffer](auto const &item) { return item.first == buffer; });
 }
 
 GfxBuffer CapsaicinInternal::getBuffer(std::string_view const &buffer) const noexcept
 {
+    if (renderer_warming_up_)
+    {
+        if (auto i = std::find_if(pending_renderer_state_->shared_buffers.cbegin(),
+                pending_renderer_state_->shared_buffers.cend(),
+                [buffer](auto const &item) { return item.first == buffer; });
+            i != pending_renderer_state_->shared_buffers.cend())
+            return i->second;
+    }
     if (auto i = std::find_if(shared_buffers_.cbegin(), shared_buffers_.cend(),
             [buffer](auto const &item) { return item.first == buffer; });
         i != shared_buffers_.end())
@@ -273,6 +536,8 @@ GfxBuffer CapsaicinInternal::getBuffer(std::string_view const &buffer) const noe
 
 bool CapsaicinInternal::hasComponent(std::string_view const &component) const noexcept
 {
+    if (renderer_warming_up_ && pending_renderer_state_->components.contains(component))
+        return true;
     return std::any_of(components_.cbegin(), components_.cend(),
         [component](auto const &item) { return item.first == component; });
 }
@@ -280,6 +545,14 @@ bool CapsaicinInternal::hasComponent(std::string_view const &component) const no
 std::shared_ptr<Component> const &CapsaicinInternal::getComponent(
     std::string_view const &component) const noexcept
 {
+    if (renderer_warming_up_)
+    {
+        // Modules of a renderer being warmed up must resolve to the pending component instances as
+        // the current renderer's components are torn down on the swap
+        if (auto i = pending_renderer_state_->components.find(component);
+            i != pending_renderer_state_->components.cend())
+            return i->second;
+    }
     if (auto i = std::find_if(components_.cbegin(), components_.cend(),
             [component](auto const &item) { return item.first == component; });
         i != components_.end())
@@ -319,6 +592,61 @@ bool CapsaicinInternal::setRenderer(std::string_view const &name) noexcept
     return true;
 }
 
+bool CapsaicinInternal::setRendererAsync(std::string_view const &name) noexcept
+{
+    auto const renderers = RendererFactory::getNames();
+    auto       renderer =
+        std::find_if(renderers.cbegin(), renderers.cend(), [name](auto val) { return name == val; });
+    if (renderer == renderers.cend())
+    {
+        GFX_PRINTLN("Error: Requested invalid renderer: %s", name.data());
+        return false;
+    }
+    if (name == renderer_name_)
+    {
+        // Already active
+        return true;
+    }
+    if (pending_renderer_state_ != nullptr && pending_renderer_state_->name == name)
+    {
+        // Already warming up
+        return true;
+    }
+    if (!scene_ || renderer_ == nullptr)
+    {
+        // Without a loaded scene module initialisation is deferred until scene load anyway, so
+        // there is no stall to hide and the switch can be done synchronously
+        return setRenderer(name);
+    }
+
+    // Abandon any in-flight background switch as this request supersedes it
+    cancelPendingRenderer();
+
+    // Create the new renderer and all of its modules (techniques, components, shared buffers and
+    // AOVs) without touching the current renderer. Module initialisation (including shader
+    // compilation, the dominant cost of a renderer switch) is then amortised over subsequent frames
+    // by render() while the current renderer keeps presenting, and the swap happens atomically
+    // between frames once everything is ready
+    auto state = std::make_unique<PendingRendererState>();
+    if (!buildRendererModules(name, *state))
+    {
+        return false;
+    }
+
+    // Make the new renderer's option defaults visible so its modules can read them during warm-up.
+    // Values already set for options shared with the current renderer are kept
+    RenderOptionList newOptions = state->options;
+    options_.merge(std::move(newOptions));
+
+    pending_renderer_state_ = std::move(state);
+    return true;
+}
+
+bool CapsaicinInternal::getRendererLoading() const noexcept
+{
+    return pending_renderer_state_ != nullptr;
+}
+
 std::vector<std::string> const &CapsaicinInternal::getCurrentScenes() const noexcept
 {
     return scene_files_;
@@ -332,6 +660,289 @@ bool CapsaicinInternal::setScenes(std::vector<std::string> const &names) noexcep
         return true;
     }
 
+    // Abandon any in-flight background load as this request supersedes it
+    if (pending_scene_load_.valid())
+    {
+        pending_scene_load_.wait();
+        pending_scene_load_ = {};
+        gfxDestroyScene(pending_scene_);
+        pending_scene_ = {};
+        pending_scene_files_.clear();
+    }
+
+    // Create new blank scene and import synchronously
+    GfxScene newScene = createBlankScene();
+    if (!newScene)
+    {
+        return false;
+    }
+    if (!importScenes(newScene, names))
+    {
+        gfxDestroyScene(newScene);
+        return false;
+    }
+
+    return swapLoadedScenes(newScene, names);
+}
+
+bool CapsaicinInternal::setScenesAsync(std::vector<std::string> const &names) noexcept
+{
+    if (scene_files_ == names)
+    {
+        // Already loaded
+        return true;
+    }
+    if (pending_scene_load_.valid() && pending_scene_files_ == names)
+    {
+        // Already loading
+        return true;
+    }
+
+    // Abandon any in-flight background load as this request supersedes it
+    if (pending_scene_load_.valid())
+    {
+        pending_scene_load_.wait();
+        pending_scene_load_ = {};
+        gfxDestroyScene(pending_scene_);
+        pending_scene_ = {};
+        pending_scene_files_.clear();
+    }
+
+    // Create the staging scene on the calling thread so the default user camera is always at index 0,
+    // then import on a background thread. The old scene continues to be rendered until render()
+    // observes the completed import and swaps the new one in.
+    pending_scene_ = createBlankScene();
+    if (!pending_scene_)
+    {
+        return false;
+    }
+    pending_scene_files_ = names;
+    pending_scene_load_  = std::async(std::launch::async,
+         [this]() noexcept { return importScenes(pending_scene_, pending_scene_files_); });
+    return true;
+}
+
+bool CapsaicinInternal::getSceneLoading() const noexcept
+{
+    return pending_scene_load_.valid();
+}
+
+GfxScene CapsaicinInternal::createBlankScene() noexcept
+{
+    GfxScene scene = gfxCreateScene();
+    if (!scene)
+    {
+        return scene;
+    }
+
+    // Create default user camera
+    auto userCamera    = gfxSceneCreateCamera(scene);
+    userCamera->type   = kGfxCameraType_Perspective;
+    userCamera->eye    = {0.0f, 0.0f, -1.0f};
+    userCamera->center = {0.0f, 0.0f, 0.0f};
+    userCamera->up     = {0.0f, 1.0f, 0.0f};
+    userCamera->aspect = getWidth() / (float)getHeight();
+    userCamera->fovY   = DegreesToRadians(90.0f);
+    userCamera->nearZ  = 0.1f;
+    userCamera->farZ   = 1e4f;
+    GfxMetadata userCameraMeta;
+    userCameraMeta.object_name = "User";
+    gfxSceneSetCameraMetadata(scene, gfxSceneGetCameraHandle(scene, 0), userCameraMeta);
+    return scene;
+}
+
+/**
+ * Append the contents of an imported scene onto an existing scene.
+ * Copies the images, materials, meshes, instances, lights and cameras of the source scene into the
+ * destination scene, remapping any object references so they point at the copied objects. Animation
+ * (and skinning) data cannot be transferred through the public scene API, so files containing
+ * animations must be imported directly into the destination instead.
+ * @param scene  The destination scene to append onto.
+ * @param source The previously imported scene to copy from.
+ */
+static void MergeImportedScene(GfxScene scene, GfxScene source) noexcept
+{
+    // Copy the images while remembering how to redirect references to them
+    std::unordered_map<uint64_t, GfxConstRef<GfxImage>> imageRemap;
+    for (uint32_t i = 0; i < gfxSceneGetObjectCount<GfxImage>(source); ++i)
+    {
+        GfxConstRef<GfxImage> const sourceImage = gfxSceneGetObjectHandle<GfxImage>(source, i);
+        GfxRef<GfxImage> const      newImage    = gfxSceneCreateImage(scene);
+        *newImage                               = *sourceImage;
+        gfxSceneSetImageMetadata(scene, newImage, gfxSceneGetObjectMetadata<GfxImage>(source, sourceImage));
+        imageRemap.emplace((uint64_t)sourceImage, newImage);
+    }
+    auto const remapImage = [&imageRemap](GfxConstRef<GfxImage> const &image) noexcept {
+        auto const found = !!image ? imageRemap.find((uint64_t)image) : imageRemap.end();
+        return found != imageRemap.end() ? found->second : GfxConstRef<GfxImage>();
+    };
+
+    // Copy the materials, redirecting their texture maps at the copied images
+    std::unordered_map<uint64_t, GfxConstRef<GfxMaterial>> materialRemap;
+    for (uint32_t i = 0; i < gfxSceneGetObjectCount<GfxMaterial>(source); ++i)
+    {
+        GfxConstRef<GfxMaterial> const sourceMaterial = gfxSceneGetObjectHandle<GfxMaterial>(source, i);
+        GfxRef<GfxMaterial> const      newMaterial    = gfxSceneCreateMaterial(scene);
+        newMaterial->albedo                           = sourceMaterial->albedo;
+        newMaterial->albedo_map                       = remapImage(sourceMaterial->albedo_map);
+        newMaterial->emissivity                       = sourceMaterial->emissivity;
+        newMaterial->emissivity_map                   = remapImage(sourceMaterial->emissivity_map);
+        newMaterial->metallicity                      = sourceMaterial->metallicity;
+        newMaterial->metallicity_map                  = remapImage(sourceMaterial->metallicity_map);
+        newMaterial->roughness                        = sourceMaterial->roughness;
+        newMaterial->roughness_map                    = remapImage(sourceMaterial->roughness_map);
+        newMaterial->normal_map                       = remapImage(sourceMaterial->normal_map);
+        newMaterial->flags                            = sourceMaterial->flags;
+        gfxSceneSetMaterialMetadata(
+            scene, newMaterial, gfxSceneGetObjectMetadata<GfxMaterial>(source, sourceMaterial));
+        materialRemap.emplace((uint64_t)sourceMaterial, newMaterial);
+    }
+
+    // Copy the meshes
+    std::unordered_map<uint64_t, GfxConstRef<GfxMesh>> meshRemap;
+    for (uint32_t i = 0; i < gfxSceneGetObjectCount<GfxMesh>(source); ++i)
+    {
+        GfxConstRef<GfxMesh> const sourceMesh = gfxSceneGetObjectHandle<GfxMesh>(source, i);
+        GfxRef<GfxMesh> const      newMesh    = gfxSceneCreateMesh(scene);
+        newMesh->bounds_min                   = sourceMesh->bounds_min;
+        newMesh->bounds_max                   = sourceMesh->bounds_max;
+        newMesh->vertices                     = sourceMesh->vertices;
+        newMesh->indices                      = sourceMesh->indices;
+        gfxSceneSetMeshMetadata(scene, newMesh, gfxSceneGetObjectMetadata<GfxMesh>(source, sourceMesh));
+        meshRemap.emplace((uint64_t)sourceMesh, newMesh);
+    }
+
+    // Copy the instances, redirecting them at the copied meshes and materials
+    for (uint32_t i = 0; i < gfxSceneGetObjectCount<GfxInstance>(source); ++i)
+    {
+        GfxConstRef<GfxInstance> const sourceInstance = gfxSceneGetObjectHandle<GfxInstance>(source, i);
+        GfxRef<GfxInstance> const      newInstance    = gfxSceneCreateInstance(scene);
+        if (!!sourceInstance->mesh)
+        {
+            if (auto const found = meshRemap.find((uint64_t)sourceInstance->mesh);
+                found != meshRemap.end())
+            {
+                newInstance->mesh = found->second;
+            }
+        }
+        if (!!sourceInstance->material)
+        {
+            if (auto const found = materialRemap.find((uint64_t)sourceInstance->material);
+                found != materialRemap.end())
+            {
+                newInstance->material = found->second;
+            }
+        }
+        newInstance->transform = sourceInstance->transform;
+        gfxSceneSetInstanceMetadata(
+            scene, newInstance, gfxSceneGetObjectMetadata<GfxInstance>(source, sourceInstance));
+    }
+
+    // Copy the lights
+    for (uint32_t i = 0; i < gfxSceneGetObjectCount<GfxLight>(source); ++i)
+    {
+        GfxConstRef<GfxLight> const sourceLight = gfxSceneGetObjectHandle<GfxLight>(source, i);
+        GfxRef<GfxLight> const      newLight    = gfxSceneCreateLight(scene);
+        *newLight                               = *sourceLight;
+        gfxSceneSetLightMetadata(scene, newLight, gfxSceneGetObjectMetadata<GfxLight>(source, sourceLight));
+    }
+
+    // Copy the cameras; the caller re-resolves the active camera once all files are merged
+    for (uint32_t i = 0; i < gfxSceneGetCameraCount(source); ++i)
+    {
+        GfxConstRef<GfxCamera> const sourceCamera = gfxSceneGetCameraHandle(source, i);
+        GfxRef<GfxCamera> const      newCamera    = gfxSceneCreateCamera(scene);
+        *newCamera                                = *sourceCamera;
+        gfxSceneSetCameraMetadata(scene, newCamera, gfxSceneGetCameraMetadata(source, sourceCamera));
+    }
+}
+
+bool CapsaicinInternal::importScenes(GfxScene scene, std::vector<std::string> const &names) noexcept
+{
+    if (names.size() > 1)
+    {
+        // Import the files concurrently into separate staging scenes so file I/O, decode and mesh
+        // post-processing overlap across files, then merge the results in request order so object
+        // indices stay deterministic. std::async workers are used rather than the thread pool as
+        // the pool only supports a single active dispatch and must stay available to the importers
+        std::vector<GfxScene> stagingScenes(names.size());
+        for (auto &stagingScene : stagingScenes)
+        {
+            stagingScene = gfxCreateScene();
+        }
+        std::vector<std::future<GfxResult>> imports;
+        imports.reserve(names.size());
+        for (size_t i = 0; i < names.size(); ++i)
+        {
+            imports.emplace_back(std::async(std::launch::async, [&stagingScenes, &names, i]() noexcept {
+                return !!stagingScenes[i] ? gfxSceneImport(stagingScenes[i], names[i].c_str())
+                                          : kGfxResult_InternalError;
+            }));
+        }
+        bool success = true;
+        for (size_t i = 0; i < names.size(); ++i)
+        {
+            if (imports[i].get() != kGfxResult_NoError)
+            {
+                GFX_PRINT_ERROR(kGfxResult_InternalError,
+                    "Scene '%s' can't be loaded, clear the scene and abort.", names[i].c_str());
+                success = false;
+            }
+        }
+        for (size_t i = 0; i < names.size(); ++i)
+        {
+            if (success)
+            {
+                if (gfxSceneGetAnimationCount(stagingScenes[i]) == 0)
+                {
+                    MergeImportedScene(scene, stagingScenes[i]);
+                }
+                // Animation data cannot be copied between scenes, so animated files take the
+                // direct import path into the destination instead
+                else if (gfxSceneImport(scene, names[i].c_str()) != kGfxResult_NoError)
+                {
+                    GFX_PRINT_ERROR(kGfxResult_InternalError,
+                        "Scene '%s' can't be loaded, clear the scene and abort.", names[i].c_str());
+                    success = false;
+                }
+            }
+            gfxDestroyScene(stagingScenes[i]);
+        }
+        if (!success)
+        {
+            gfxSceneClear(scene);
+            return false;
+        }
+    }
+    else
+    {
+        // Load in scene based on current requested scene index
+        for (auto const &name : names)
+        {
+            if (gfxSceneImport(scene, name.c_str()) != kGfxResult_NoError)
+            {
+                GFX_PRINT_ERROR(kGfxResult_InternalError,
+                    "Scene '%s' can't be loaded, clear the scene and abort.", name.c_str());
+                gfxSceneClear(scene);
+                return false;
+            }
+        }
+    }
+
+    // Transcode eligible textures to block-compressed formats while still on the loading thread so
+    // the upload path sees ~4x smaller texture data
+    TextureCompression::TranscodeSceneTextures(scene, names);
+    return true;
+}
+
+bool CapsaicinInternal::swapLoadedScenes(GfxScene scene, std::vector<std::string> const &names) noexcept
+{
+    // Any renderer being warmed up was initialised against the outgoing scene so must be abandoned
+    cancelPendingRenderer();
+
+    // Wait for any in-flight pipelined update before replacing the scene it references
+    syncPipelinedUpdate();
+
     // Clear any pre-existing scene data
     bool initRequired = !!scene_;
     if (initRequired)
@@ -359,42 +970,11 @@ bool CapsaicinInternal::setScenes(std::vector<std::string> const &names) noexcep
         }
     }
     scene_updated_ = true;
-    // Create new blank scene
-    scene_ = gfxCreateScene();
-    if (!scene_)
-    {
-        return false;
-    }
-
-    // Create default user camera
-    auto userCamera    = gfxSceneCreateCamera(scene_);
-    userCamera->type   = kGfxCameraType_Perspective;
-    userCamera->eye    = {0.0f, 0.0f, -1.0f};
-    userCamera->center = {0.0f, 0.0f, 0.0f};
-    userCamera->up     = {0.0f, 1.0f, 0.0f};
-    userCamera->aspect = getWidth() / (float)getHeight();
-    userCamera->fovY   = DegreesToRadians(90.0f);
-    userCamera->nearZ  = 0.1f;
-    userCamera->farZ   = 1e4f;
-    GfxMetadata userCameraMeta;
-    userCameraMeta.object_name = "User";
-    gfxSceneSetCameraMetadata(scene_, gfxSceneGetCameraHandle(scene_, 0), userCameraMeta);
-
-    // Load in scene based on current requested scene index
-    for (auto const &name : names)
-    {
-        if (gfxSceneImport(scene_, name.c_str()) != kGfxResult_NoError)
-        {
-            GFX_PRINT_ERROR(kGfxResult_InternalError,
-                "Scene '%s' can't be loaded, clear the scene and abort.", name.c_str());
-            gfxSceneClear(scene_);
-            return false;
-        }
-    }
-
-    scene_files_ = names;
+    scene_         = scene;
+    scene_files_   = names;
 
     // Set up camera based on internal scene data
+    auto           userCamera  = gfxSceneGetCameraHandle(scene_, 0);
     uint32_t       cameraIndex = 0;
     const uint32_t cameraCount = gfxSceneGetCameraCount(scene_);
     if (cameraCount > 1)
@@ -467,11 +1047,12 @@ bool CapsaicinInternal::setScenes(std::vector<std::string> const &names) noexcep
         }
 
         // Reset flags as everything just got forced reset anyway
-        mesh_updated_            = false;
-        transform_updated_       = false;
-        environment_map_updated_ = false;
-        scene_updated_           = false;
-        camera_updated_          = false;
+        mesh_updated_              = false;
+        transform_updated_         = false;
+        environment_map_updated_   = false;
+        environment_map_recreated_ = false;
+        scene_updated_             = false;
+        camera_updated_            = false;
     }
 
     return true;
@@ -540,7 +1121,8 @@ bool CapsaicinInternal::setEnvironmentMap(std::string const &name) noexcept
         gfxDestroyTexture(gfx_, environment_buffer_);
         environment_buffer_ = {};
     }
-    environment_map_updated_ = true;
+    environment_map_updated_   = true;
+    environment_map_recreated_ = true;
 
     resetRenderState();
 
@@ -675,6 +1257,11 @@ bool CapsaicinInternal::setDebugView(std::string_view const &name) noexcept
     return true;
 }
 
+void CapsaicinInternal::setBackBufferWritten() noexcept
+{
+    back_buffer_written_ = true;
+}
+
 RenderOptionList const &CapsaicinInternal::getOptions() const noexcept
 {
     return options_;
@@ -747,25 +1334,45 @@ uint32_t CapsaicinInternal::getTriangleCount() const noexcept
 
 uint64_t CapsaicinInternal::getBvhDataSize() const noexcept
 {
-    uint64_t       bvh_data_size = gfxAccelerationStructureGetDataSize(gfx_, acceleration_structure_);
+    GfxAccelerationStructure const acceleration_structure = getAccelerationStructure();
+
+    uint64_t       bvh_data_size = gfxAccelerationStructureGetDataSize(gfx_, acceleration_structure);
     uint32_t const rt_primitive_count =
-        gfxAccelerationStructureGetRaytracingPrimitiveCount(gfx_, acceleration_structure_);
+        gfxAccelerationStructureGetRaytracingPrimitiveCount(gfx_, acceleration_structure);
 
     for (uint32_t i = 0; i < rt_primitive_count; ++i)
     {
         GfxRaytracingPrimitive const &rt_primitive =
-            gfxAccelerationStructureGetRaytracingPrimitives(gfx_, acceleration_structure_)[i];
+            gfxAccelerationStructureGetRaytracingPrimitives(gfx_, acceleration_structure)[i];
         bvh_data_size += gfxRaytracingPrimitiveGetDataSize(gfx_, rt_primitive);
     }
 
     return bvh_data_size;
 }
 
+uint64_t CapsaicinInternal::getBvhSharedDataSize() const noexcept
+{
+    uint64_t shared_data_size = 0;
+    for (auto const &[clone_index, owner_index] : rt_primitive_owners_)
+    {
+        if (owner_index < raytracing_primitives_.size())
+        {
+            shared_data_size += gfxRaytracingPrimitiveGetDataSize(gfx_, raytracing_primitives_[owner_index]);
+        }
+    }
+    return shared_data_size;
+}
+
 GfxBuffer CapsaicinInternal::getInstanceBuffer() const
 {
     return instance_buffer_;
 }
 
+GfxBuffer CapsaicinInternal::getInstancePackedBuffer() const
+{
+    return instance_packed_buffer_;
+}
+
 Instance const *CapsaicinInternal::getInstanceData() const
 {
     return instance_data_.data();
@@ -861,29 +1468,229 @@ GfxBuffer CapsaicinInternal::getMeshBuffer() const
     return mesh_buffer_;
 }
 
-Mesh const *CapsaicinInternal::getMeshData() const
-{
-    return mesh_data_.data();
-}
+Mesh const *CapsaicinInternal::getMeshData() const
+{
+    return mesh_data_.data();
+}
+
+GfxBuffer CapsaicinInternal::getIndexBuffer() const
+{
+    return index_buffer_;
+}
+
+uint32_t const *CapsaicinInternal::getIndexData() const
+{
+    if (index_data_.empty() && !mesh_data_.empty())
+    {
+        flattenGeometryData();
+    }
+    return index_data_.data();
+}
+
+GfxBuffer CapsaicinInternal::getVertexBuffer() const
+{
+    return vertex_buffer_;
+}
+
+Vertex const *CapsaicinInternal::getVertexData() const
+{
+    if (vertex_data_.empty() && !mesh_data_.empty())
+    {
+        flattenGeometryData();
+    }
+    return vertex_data_.data();
+}
+
+void CapsaicinInternal::flattenGeometryData() const
+{
+    GfxMesh const *meshes     = gfxSceneGetObjects<GfxMesh>(scene_);
+    uint32_t const mesh_count = gfxSceneGetObjectCount<GfxMesh>(scene_);
+
+    size_t index_count  = 0;
+    size_t vertex_count = 0;
+    for (uint32_t i = 0; i < mesh_count; ++i)
+    {
+        uint32_t const mesh_index = gfxSceneGetObjectHandle<GfxMesh>(scene_, i);
+        Mesh const    &mesh       = mesh_data_[mesh_index];
+        index_count  = std::max(index_count, (size_t)mesh.index_offset_idx + meshes[i].indices.size());
+        vertex_count = std::max(vertex_count, (size_t)mesh.vertex_offset_idx + meshes[i].vertices.size());
+    }
+
+    index_data_.resize(index_count);
+    vertex_data_.resize(vertex_count);
+
+    for (uint32_t i = 0; i < mesh_count; ++i)
+    {
+        uint32_t const mesh_index = gfxSceneGetObjectHandle<GfxMesh>(scene_, i);
+        Mesh const    &mesh       = mesh_data_[mesh_index];
+
+        for (size_t j = 0; j < meshes[i].indices.size(); ++j)
+        {
+            index_data_[(size_t)mesh.index_offset_idx + j] = meshes[i].indices[j];
+        }
+
+        for (size_t j = 0; j < meshes[i].vertices.size(); ++j)
+        {
+            Vertex vertex = {};
+
+            vertex.position = float4(meshes[i].vertices[j].position, 1.0f);
+            vertex.normal   = float4(meshes[i].vertices[j].normal, 0.0f);
+            vertex.uv       = float2(meshes[i].vertices[j].uv);
+
+            vertex_data_[(size_t)mesh.vertex_offset_idx + j] = vertex;
+        }
+    }
+
+    // Re-append the simplified detail level indices behind the base data. The clustering is
+    // deterministic so the regenerated lists land exactly on the index ranges recorded by
+    // generateMeshLODs().
+    if (!mesh_lod_table_.empty())
+    {
+        size_t lod_index_count = index_data_.size();
+        for (Mesh const &mesh : mesh_data_)
+        {
+            lod_index_count =
+                std::max(lod_index_count, (size_t)mesh.index_offset_idx + mesh.index_count);
+        }
+        index_data_.resize(lod_index_count);
+
+        std::vector<uint32_t> lod_indices;
+        for (size_t i = 0; i < mesh_lod_table_.size(); ++i)
+        {
+            for (uint32_t lod = 1; lod < kMeshLODCount; ++lod)
+            {
+                uint32_t const lod_mesh_index = mesh_lod_table_[i][lod];
+                if (lod_mesh_index == mesh_lod_table_[i][lod - 1])
+                {
+                    continue;
+                }
+
+                buildMeshLODIndices((uint32_t)i, kMeshLODGridResolutions[lod - 1], lod_indices);
+
+                Mesh const &lod_mesh = mesh_data_[lod_mesh_index];
+                GFX_ASSERT(lod_indices.size() == lod_mesh.index_count);
+                for (size_t j = 0; j < lod_indices.size(); ++j)
+                {
+                    index_data_[(size_t)lod_mesh.index_offset_idx + j] = lod_indices[j];
+                }
+            }
+        }
+    }
+}
+
+void CapsaicinInternal::generateMeshLODs()
+{
+    uint32_t const base_mesh_count = (uint32_t)mesh_data_.size();
+
+    mesh_lod_table_.clear();
+    mesh_lod_table_.resize(base_mesh_count);
+
+    // Simplify every mesh in parallel; each job writes its own index lists which are appended to the
+    // flattened arrays serially afterwards so the recorded offsets are stable
+    std::vector<std::array<std::vector<uint32_t>, kMeshLODCount - 1>> lod_indices(base_mesh_count);
+
+    ThreadPool().Dispatch(
+        [&](uint32_t i) noexcept {
+            Mesh const &mesh = mesh_data_[i];
+            if (mesh.index_count < 3 * kMeshLODMinTriangles)
+            {
+                return;
+            }
+            for (uint32_t lod = 1; lod < kMeshLODCount; ++lod)
+            {
+                std::vector<uint32_t> &indices = lod_indices[i][lod - 1];
+                buildMeshLODIndices(i, kMeshLODGridResolutions[lod - 1], indices);
+
+                // Drop levels that brought no meaningful reduction over the previous one
+                size_t const previous_count =
+                    lod == 1 ? mesh.index_count : lod_indices[i][lod - 2].size();
+                if (indices.size() * 10 >= previous_count * 9)
+                {
+                    indices.clear();
+                    break;
+                }
+            }
+        },
+        base_mesh_count, 1);
+
+    for (uint32_t i = 0; i < base_mesh_count; ++i)
+    {
+        mesh_lod_table_[i][0] = i;
+
+        for (uint32_t lod = 1; lod < kMeshLODCount; ++lod)
+        {
+            std::vector<uint32_t> const &indices = lod_indices[i][lod - 1];
+
+            if (indices.empty())
+            {
+                mesh_lod_table_[i][lod] = mesh_lod_table_[i][lod - 1];
+                continue;
+            }
+
+            Mesh lod_mesh = {};
 
-GfxBuffer CapsaicinInternal::getIndexBuffer() const
-{
-    return index_buffer_;
-}
+            lod_mesh.vertex_offset_idx = mesh_data_[i].vertex_offset_idx;
+            lod_mesh.index_offset_idx  = (uint32_t)index_data_.size();
+            lod_mesh.index_count       = (uint32_t)indices.size();
 
-uint32_t const *CapsaicinInternal::getIndexData() const
-{
-    return index_data_.data();
-}
+            mesh_lod_table_[i][lod] = (uint32_t)mesh_data_.size();
+            mesh_data_.push_back(lod_mesh);
 
-GfxBuffer CapsaicinInternal::getVertexBuffer() const
-{
-    return vertex_buffer_;
+            index_data_.insert(index_data_.end(), indices.begin(), indices.end());
+        }
+    }
 }
 
-Vertex const *CapsaicinInternal::getVertexData() const
+void CapsaicinInternal::buildMeshLODIndices(
+    uint32_t mesh_index, uint32_t grid_resolution, std::vector<uint32_t> &lod_indices) const
 {
-    return vertex_data_.data();
+    Mesh const     &mesh    = mesh_data_[mesh_index];
+    uint32_t const *indices = &index_data_[mesh.index_offset_idx];
+
+    float3 bounds_min(std::numeric_limits<float>::max());
+    float3 bounds_max(std::numeric_limits<float>::lowest());
+    for (uint32_t i = 0; i < mesh.index_count; ++i)
+    {
+        float3 const position =
+            float3(vertex_data_[(size_t)mesh.vertex_offset_idx + indices[i]].position);
+        bounds_min = glm::min(bounds_min, position);
+        bounds_max = glm::max(bounds_max, position);
+    }
+    float3 const extent = glm::max(bounds_max - bounds_min, float3(1e-5f));
+
+    // Snap every vertex onto a uniform grid over the mesh bounds; the first vertex landing in a cell
+    // represents it so the simplified triangles reuse existing vertices (and their attributes)
+    std::unordered_map<uint64_t, uint32_t> representatives;
+    representatives.reserve(mesh.index_count);
+
+    auto getRepresentative = [&](uint32_t index) -> uint32_t {
+        float3 const position =
+            float3(vertex_data_[(size_t)mesh.vertex_offset_idx + index].position);
+        glm::uvec3 const cell = glm::min(
+            glm::uvec3((position - bounds_min) / extent * (float)grid_resolution),
+            glm::uvec3(grid_resolution - 1));
+        uint64_t const key =
+            (uint64_t)cell.x | ((uint64_t)cell.y << 21) | ((uint64_t)cell.z << 42);
+        return representatives.try_emplace(key, index).first->second;
+    };
+
+    lod_indices.clear();
+    for (uint32_t i = 0; i + 2 < mesh.index_count; i += 3)
+    {
+        uint32_t const i0 = getRepresentative(indices[i + 0]);
+        uint32_t const i1 = getRepresentative(indices[i + 1]);
+        uint32_t const i2 = getRepresentative(indices[i + 2]);
+
+        // Triangles collapsing within a single cell are dropped
+        if (i0 == i1 || i1 == i2 || i2 == i0)
+        {
+            continue;
+        }
+
+        lod_indices.push_back(i0);
+        lod_indices.push_back(i1);
+        lod_indices.push_back(i2);
+    }
 }
 
 GfxBuffer const *CapsaicinInternal::getIndexBuffers() const
@@ -908,11 +1715,24 @@ uint32_t CapsaicinInternal::getVertexBufferCount() const
 
 GfxAccelerationStructure CapsaicinInternal::getAccelerationStructure() const
 {
+    // While a deferred rebuild is in flight the previous structure is the only complete one, the
+    // replacement is swapped in by processDeferredBlasBuilds() once its last BLAS batch has run
+    if (!!stale_acceleration_structure_)
+    {
+        return stale_acceleration_structure_;
+    }
     return acceleration_structure_;
 }
 
 std::pair<float3, float3> CapsaicinInternal::getSceneBounds() const
 {
+    // The full instance walk is only performed when the cached bounds have been invalidated by a
+    // transform or mesh update, a shrinking instance requires re-visiting every instance anyway
+    if (!scene_bounds_dirty_)
+    {
+        return scene_bounds_;
+    }
+
     // Calculate the scene bounds
     const uint32_t numInstance = gfxSceneGetObjectCount<GfxInstance>(getScene());
     float3         sceneMin(std::numeric_limits<float>::max());
@@ -927,13 +1747,50 @@ std::pair<float3, float3> CapsaicinInternal::getSceneBounds() const
         sceneMin                         = glm::min(sceneMin, minBounds);
         sceneMax                         = glm::max(sceneMax, maxBounds);
     }
-    return std::make_pair(sceneMin, sceneMax);
+    scene_bounds_       = std::make_pair(sceneMin, sceneMax);
+    scene_bounds_dirty_ = false;
+    return scene_bounds_;
 }
 
 GfxBuffer CapsaicinInternal::allocateConstantBuffer(uint64_t size)
 {
-    GfxBuffer     &constant_buffer_pool        = constant_buffer_pools_[gfxGetBackBufferIndex(gfx_)];
-    uint64_t const constant_buffer_pool_cursor = GFX_ALIGN(constant_buffer_pool_cursor_ + size, 256);
+    // Large transient allocations are serviced from dedicated power of 2 size-class buffers rather
+    // than the shared bump pool, so a technique toggling big per-frame buffers (e.g. reservoir
+    // counts changing with options) no longer forces the pool to regrow mid frame. A pooled buffer
+    // becomes reusable once the frame it was last handed out in has left the GPU.
+    if (size >= kLargeConstantBufferSize)
+    {
+        uint64_t size_class = kLargeConstantBufferSize;
+        while (size_class < size)
+        {
+            size_class <<= 1;
+        }
+
+        constant_buffer_large_frame_usage_ += size_class;
+        for (auto &i : large_constant_buffers_)
+        {
+            if (i.buffer.getSize() == size_class
+                && i.last_used_frame + kGfxConstant_BackBufferCount <= constant_buffer_frame_)
+            {
+                i.last_used_frame = constant_buffer_frame_;
+                return gfxCreateBufferRange(gfx_, i.buffer, 0, size);
+            }
+        }
+
+        // No reclaimed buffer of the right size class available, add a new one to the pool
+        GfxBuffer large_buffer = gfxCreateBuffer(gfx_, size_class, nullptr, kGfxCpuAccess_Write);
+
+        char buffer[256];
+        GFX_SNPRINTF(buffer, sizeof(buffer), "Capsaicin_LargeConstantBuffer%u",
+            (uint32_t)large_constant_buffers_.size());
+        large_buffer.setName(buffer);
+
+        large_constant_buffers_.push_back({large_buffer, constant_buffer_frame_});
+        return gfxCreateBufferRange(gfx_, large_buffer, 0, size);
+    }
+
+    GfxBuffer &constant_buffer_pool        = constant_buffer_pools_[gfxGetBackBufferIndex(gfx_)];
+    uint64_t   constant_buffer_pool_cursor = GFX_ALIGN(constant_buffer_pool_cursor_ + size, 256);
 
     if (constant_buffer_pool_cursor >= constant_buffer_pool.getSize())
     {
@@ -949,16 +1806,91 @@ GfxBuffer CapsaicinInternal::allocateConstantBuffer(uint64_t size)
         GFX_SNPRINTF(buffer, sizeof(buffer), "Capsaicin_ConstantBufferPool%u", gfxGetBackBufferIndex(gfx_));
 
         constant_buffer_pool.setName(buffer);
+
+        // Allocations made earlier this frame keep the old pool alive through their ranges, so the
+        // replacement pool can be filled from the start instead of continuing the old cursor
+        constant_buffer_pool_cursor_ = 0;
+        constant_buffer_pool_cursor  = GFX_ALIGN(size, 256);
+        ++constant_buffer_growth_count_;
     }
 
     GfxBuffer constant_buffer =
         gfxCreateBufferRange(gfx_, constant_buffer_pool, constant_buffer_pool_cursor_, size);
 
+    constant_buffer_frame_usage_ += constant_buffer_pool_cursor - constant_buffer_pool_cursor_;
     constant_buffer_pool_cursor_ = constant_buffer_pool_cursor;
 
     return constant_buffer;
 }
 
+uint32_t CapsaicinInternal::registerConstantBlock(std::string_view const &name, uint64_t size, uint32_t stride)
+{
+    for (uint32_t i = 0; i < (uint32_t)constant_blocks_.size(); ++i)
+    {
+        if (constant_blocks_[i].name == name)
+        {
+            GFX_ASSERT(constant_blocks_[i].size == size);
+            return i;
+        }
+    }
+
+    ConstantBlock block;
+    block.name   = name;
+    block.offset = constant_block_arena_size_;
+    block.size   = size;
+    block.stride = stride;
+    constant_blocks_.push_back(std::move(block));
+
+    // Blocks are bound as constant buffers, so each one must start on a 256B boundary
+    constant_block_arena_size_ += GFX_ALIGN(size, 256);
+
+    // The current arenas no longer cover every registered block; rebuild them on next use
+    for (uint32_t i = 0; i < kGfxConstant_BackBufferCount; ++i)
+    {
+        for (ConstantBlock &registered_block : constant_blocks_)
+        {
+            gfxDestroyBuffer(gfx_, registered_block.buffers[i]);
+            registered_block.buffers[i] = {};
+        }
+        gfxDestroyBuffer(gfx_, constant_block_arenas_[i]);
+        constant_block_arenas_[i] = {};
+    }
+
+    return (uint32_t)constant_blocks_.size() - 1;
+}
+
+CapsaicinInternal::ConstantBlock &CapsaicinInternal::ensureConstantBlock(uint32_t constant_block)
+{
+    GFX_ASSERT(constant_block < constant_blocks_.size());
+    ConstantBlock &block        = constant_blocks_[constant_block];
+    uint32_t const buffer_index = gfxGetBackBufferIndex(gfx_);
+
+    GfxBuffer &arena = constant_block_arenas_[buffer_index];
+    if (!arena)
+    {
+        arena = gfxCreateBuffer(
+            gfx_, GFX_ALIGN(constant_block_arena_size_, 65536), nullptr, kGfxCpuAccess_Write);
+
+        char buffer[256];
+        GFX_SNPRINTF(buffer, sizeof(buffer), "Capsaicin_FrameConstantsArena%u", buffer_index);
+
+        arena.setName(buffer);
+    }
+
+    if (!block.buffers[buffer_index])
+    {
+        block.buffers[buffer_index] = gfxCreateBufferRange(gfx_, arena, block.offset, block.size);
+        block.buffers[buffer_index].setStride(block.stride);
+    }
+
+    return block;
+}
+
+GfxBuffer CapsaicinInternal::getConstantBlockBuffer(uint32_t constant_block)
+{
+    return ensureConstantBlock(constant_block).buffers[gfxGetBackBufferIndex(gfx_)];
+}
+
 void CapsaicinInternal::initialize(GfxContext gfx, ImGuiContext *imgui_context)
 {
     if (!gfx)
@@ -979,6 +1911,8 @@ void CapsaicinInternal::initialize(GfxContext gfx, ImGuiContext *imgui_context)
         anisotropic_sampler_ = gfxCreateSamplerState(
             gfx, D3D12_FILTER_ANISOTROPIC, D3D12_TEXTURE_ADDRESS_MODE_WRAP, D3D12_TEXTURE_ADDRESS_MODE_WRAP);
     }
+    memory_budget_.initialise(gfx);
+    gpu_statistics_.initialise(gfx);
     shader_path_ = "src/core/src/";
     // Check if shader source can be found
     std::error_code ec;
@@ -997,6 +1931,7 @@ void CapsaicinInternal::initialize(GfxContext gfx, ImGuiContext *imgui_context)
         GFX_PRINTLN("Could not find directory containing shader source files");
         return;
     }
+    shader_source_hashes_ = HashShaderSources(shader_path_);
 
     sbt_stride_in_entries_[kGfxShaderGroupType_Raygen]   = 1;
     sbt_stride_in_entries_[kGfxShaderGroupType_Miss]     = 2;
@@ -1036,16 +1971,88 @@ void CapsaicinInternal::initialize(GfxContext gfx, ImGuiContext *imgui_context)
     dump_copy_to_buffer_kernel_ =
         gfxCreateComputeKernel(gfx, dump_copy_to_buffer_program_, "CopyAOVToBuffer");
 
-    buffer_width_  = gfxGetBackBufferWidth(gfx);
-    buffer_height_ = gfxGetBackBufferHeight(gfx);
+    batch_clear_program_ = gfxCreateProgram(gfx, "capsaicin/batch_clear_aovs", shader_path_.c_str());
+    batch_clear_kernel_  = gfxCreateComputeKernel(gfx, batch_clear_program_, "BatchClear");
+    batch_backup_kernel_ = gfxCreateComputeKernel(gfx, batch_clear_program_, "BatchBackup");
+
+    update_vertices_program_ = gfxCreateProgram(gfx, "capsaicin/update_vertices", shader_path_.c_str());
+    update_vertices_kernel_  = gfxCreateComputeKernel(gfx, update_vertices_program_, "UpdateVertices");
+
+    buffer_width_   = gfxGetBackBufferWidth(gfx);
+    buffer_height_  = gfxGetBackBufferHeight(gfx);
+    display_width_  = buffer_width_;
+    display_height_ = buffer_height_;
 
     ImGui::SetCurrentContext(imgui_context);
 
     gfx_ = gfx;
 }
 
+void CapsaicinInternal::processDeferredBlasBuilds(uint64_t triangle_budget)
+{
+    if (pending_blas_builds_.empty())
+    {
+        return;
+    }
+
+    {
+        GfxCommandEvent const command_event(gfx_, "DeferredBlasBuilds");
+
+        while (!pending_blas_builds_.empty() && triangle_budget > 0)
+        {
+            PendingBlasBuild const build = pending_blas_builds_.back();
+            pending_blas_builds_.pop_back();
+
+            GfxBuffer index_buffer =
+                gfxCreateBufferRange<uint32_t>(gfx_, index_buffer_, build.index_offset, build.index_count);
+            GfxBuffer vertex_buffer =
+                gfxCreateBufferRange<Vertex>(gfx_, vertex_buffer_, build.vertex_offset, build.vertex_count);
+
+            gfxRaytracingPrimitiveBuild(gfx_, raytracing_primitives_[build.instance_index], index_buffer,
+                vertex_buffer, 0, build.build_flags);
+
+            gfxDestroyBuffer(gfx_, index_buffer);
+            gfxDestroyBuffer(gfx_, vertex_buffer);
+
+            triangle_budget -= GFX_MIN(triangle_budget, (uint64_t)(build.index_count / 3));
+        }
+    }
+
+    if (!pending_blas_builds_.empty())
+    {
+        return; // keep tracing the stale structure until every BLAS is in place
+    }
+
+    // Finalise the new structure and retire the stale one; destroying the stale acceleration
+    // structure also releases its raytracing primitives
+    {
+        GfxCommandEvent const command_event(gfx_, "BuildDeferredTLAS");
+
+        gfxAccelerationStructureUpdate(gfx_, acceleration_structure_);
+    }
+    gfxDestroyAccelerationStructure(gfx_, stale_acceleration_structure_);
+    stale_acceleration_structure_ = {};
+    stale_raytracing_primitives_.clear();
+
+    // Signal consumers (shader binding tables, light lists) to refresh against the swapped structure
+    mesh_updated_      = true;
+    transform_updated_ = true;
+}
+
 void CapsaicinInternal::render()
 {
+    // Release all frame-local arena allocations made during the previous frame
+    frame_arena_.reset();
+
+    // Collect the background scene update kicked off at the end of the previous frame (it ran
+    // while that frame executed on the GPU); whether its results can be used is decided below
+    std::optional<PipelinedUpdate> precomputed_update;
+    if (pipelined_update_.valid())
+    {
+        precomputed_update = pipelined_update_.get();
+        pipelined_update_  = {};
+    }
+
     // Update current frame time
     auto const previousTime = current_time_;
     auto       wallTime     = std::chrono::duration_cast<std::chrono::microseconds>(
@@ -1053,6 +2060,27 @@ void CapsaicinInternal::render()
     current_time_ = static_cast<double>(wallTime.count()) / 1000000.0;
     frame_time_   = current_time_ - previousTime;
 
+    // Swap in any background scene load that has completed, the old scene keeps rendering until then
+    if (pending_scene_load_.valid()
+        && pending_scene_load_.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
+    {
+        bool const loaded   = pending_scene_load_.get();
+        pending_scene_load_ = {};
+        if (!loaded || !swapLoadedScenes(pending_scene_, pending_scene_files_))
+        {
+            gfxDestroyScene(pending_scene_);
+        }
+        pending_scene_ = {};
+        pending_scene_files_.clear();
+    }
+
+    // Step any in-flight background renderer switch, the current renderer keeps presenting until
+    // every pending module has been initialised and then the swap is performed between frames
+    if (pending_renderer_state_ != nullptr && stepRendererWarmup())
+    {
+        swapPendingRenderer();
+    }
+
     // Check if manual frame increment/decrement has been applied
     bool manual_play = play_time_ != play_time_old_;
 
@@ -1062,16 +2090,45 @@ void CapsaicinInternal::render()
         mesh_updated_      = false;
         transform_updated_ = false;
 
+        // Raise the environment-map-updated flag if a technique regenerated the environment buffer
+        // last frame, so consumers that ran before it (IBL prefiltering, light building) catch up
+        if (environment_map_update_queued_)
+        {
+            environment_map_updated_        = true;
+            environment_map_update_queued_ = false;
+        }
+
         frameGraph.addValue(static_cast<float>(frame_time_));
 
         constant_buffer_pool_cursor_ = 0;
-        was_resized_ =
-            (buffer_width_ != gfxGetBackBufferWidth(gfx_) || buffer_height_ != gfxGetBackBufferHeight(gfx_));
-        buffer_width_  = gfxGetBackBufferWidth(gfx_);
-        buffer_height_ = gfxGetBackBufferHeight(gfx_);
+        ++constant_buffer_frame_;
+        constant_buffer_last_usage_ = constant_buffer_frame_usage_;
+        constant_buffer_peak_usage_ = std::max(constant_buffer_peak_usage_, constant_buffer_frame_usage_);
+        constant_buffer_frame_usage_       = 0;
+        constant_buffer_large_last_usage_  = constant_buffer_large_frame_usage_;
+        constant_buffer_large_frame_usage_ = 0;
+        // Resolve the internal render resolution. When the TAA temporal upscaler is active the AOVs
+        // and lighting are produced at a reduced resolution in the top-left region of the (display
+        // sized) buffers and TAA reconstructs the display resolution output
+        float render_scale = 1.0f;
+        if (hasOption<float>("taa_render_scale") && hasOption<bool>("taa_enable")
+            && getOption<bool>("taa_enable"))
+        {
+            render_scale = glm::clamp(getOption<float>("taa_render_scale"), 0.5f, 1.0f);
+        }
+        display_width_  = gfxGetBackBufferWidth(gfx_);
+        display_height_ = gfxGetBackBufferHeight(gfx_);
+        uint32_t const render_width =
+            GFX_MAX((uint32_t)ceilf((float)display_width_ * render_scale), 1u);
+        uint32_t const render_height =
+            GFX_MAX((uint32_t)ceilf((float)display_height_ * render_scale), 1u);
+        was_resized_   = (buffer_width_ != render_width || buffer_height_ != render_height);
+        buffer_width_  = render_width;
+        buffer_height_ = render_height;
 
         // Run the animations
-        bool animation = false;
+        bool animation          = false;
+        bool update_precomputed = false;
         if (!play_paused_ || manual_play)
         {
             if (!play_paused_)
@@ -1088,23 +2145,58 @@ void CapsaicinInternal::render()
             play_time_old_                 = play_time_;
             uint32_t const animation_count = gfxSceneGetAnimationCount(scene_);
             animation                      = animation_count > 0;
-            for (uint32_t animation_index = 0; animation_index < animation_count; ++animation_index)
+            if (precomputed_update && precomputed_update->play_time == play_time_ && !scene_updated_)
             {
-                GfxConstRef<GfxAnimation> animation_ref = gfxSceneGetAnimationHandle(scene_, animation_index);
-                float const animation_length            = gfxSceneGetAnimationLength(scene_, animation_ref);
-                float       time_in_seconds             = (float)fmod(play_time_, (double)animation_length);
-                // Handle negative playback times
-                time_in_seconds =
-                    (time_in_seconds >= 0.0f) ? time_in_seconds : animation_length + time_in_seconds;
-                gfxSceneApplyAnimation(scene_, animation_ref, time_in_seconds);
+                // The background update already advanced the scene to this frame's playback
+                // position while the previous frame executed on the GPU, so the animations and
+                // the change detection hashes below come for free
+                update_precomputed = animation;
+            }
+            else
+            {
+                for (uint32_t animation_index = 0; animation_index < animation_count; ++animation_index)
+                {
+                    GfxConstRef<GfxAnimation> animation_ref =
+                        gfxSceneGetAnimationHandle(scene_, animation_index);
+                    float const animation_length = gfxSceneGetAnimationLength(scene_, animation_ref);
+                    float       time_in_seconds  = (float)fmod(play_time_, (double)animation_length);
+                    // Handle negative playback times
+                    time_in_seconds =
+                        (time_in_seconds >= 0.0f) ? time_in_seconds : animation_length + time_in_seconds;
+                    gfxSceneApplyAnimation(scene_, animation_ref, time_in_seconds);
+                }
             }
         }
 
         // Calculate the camera matrices for this frame
         {
+            // Drive the camera from the loaded path while replaying
+            if (camera_path_replaying_ && !camera_path_.empty())
+            {
+                CameraPathFrame const &path_frame =
+                    camera_path_[std::min(camera_path_position_, (uint32_t)camera_path_.size() - 1)];
+                camera_path_position_ = std::min(camera_path_position_ + 1, (uint32_t)camera_path_.size());
+                if (auto camera_ref = getSceneCamera(); camera_ref)
+                {
+                    camera_ref->eye    = path_frame.eye;
+                    camera_ref->center = path_frame.center;
+                    camera_ref->up     = path_frame.up;
+                    camera_ref->aspect = path_frame.aspect;
+                    camera_ref->fovY   = path_frame.fovY;
+                    camera_ref->nearZ  = path_frame.nearZ;
+                    camera_ref->farZ   = path_frame.farZ;
+                }
+                jitter_frame_index_ = path_frame.jitterIndex;
+            }
+
             uint32_t const jitter_index = jitter_frame_index_ != ~0 ? jitter_frame_index_ : frame_index_;
 
             auto const &camera = getCamera();
+            if (camera_path_recording_)
+            {
+                camera_path_.push_back({camera.eye, camera.center, camera.up, camera.aspect, camera.fovY,
+                    camera.nearZ, camera.farZ, jitter_index});
+            }
             for (uint32_t i = 0; i < 2; ++i)
             {
                 camera_jitter_x_ =
@@ -1148,21 +2240,29 @@ void CapsaicinInternal::render()
 
         // Update the scene history
         {
-            for (size_t i = 0; i < prev_transform_data_.size(); ++i)
-            {
-                prev_transform_data_[i] = transform_data_[i];
-            }
-
-            if (!prev_transform_data_.empty())
+            // Only the transforms changed by the previous frame's update differ from the history
+            // buffer, so only those ranges need copying across. The ranges are dropped unused if
+            // the scene was swapped as the history buffer gets fully rebuilt this frame anyway
+            bool const ranges_valid =
+                std::ranges::all_of(transform_dirty_ranges_, [&](auto const &range) {
+                    return (size_t)range.first + range.second <= prev_transform_data_.size()
+                        && (size_t)range.first + range.second <= transform_data_.size();
+                });
+
+            if (!transform_dirty_ranges_.empty() && ranges_valid)
             {
                 GfxCommandEvent const command_event(gfx_, "UpdatePreviousTranforms");
-                GfxBuffer             prev_transform_buffer =
-                    allocateConstantBuffer<glm::mat4x3>((uint32_t)prev_transform_data_.size());
-                memcpy(gfxBufferGetData(gfx_, prev_transform_buffer), prev_transform_data_.data(),
-                    prev_transform_data_.size() * sizeof(glm::mat4x3));
-                gfxCommandCopyBuffer(gfx_, prev_transform_buffer_, prev_transform_buffer);
-                gfxDestroyBuffer(gfx_, prev_transform_buffer);
+                for (auto const &[first, count] : transform_dirty_ranges_)
+                {
+                    for (uint32_t i = first; i < first + count; ++i)
+                    {
+                        prev_transform_data_[i] = transform_data_[i];
+                    }
+                }
+                uploadBufferRanges<glm::mat4x3>(
+                    prev_transform_buffer_, prev_transform_data_.data(), transform_dirty_ranges_);
             }
+            transform_dirty_ranges_.clear();
         }
 
         // Update the AOV history
@@ -1173,6 +2273,32 @@ void CapsaicinInternal::render()
             {
                 gfxCommandCopyTexture(gfx_, i.second, i.first);
             }
+
+            // Batch the UAV-compatible backups into shared dispatches
+            constexpr uint32_t const batch_size = 8;
+            for (size_t offset = 0; offset < aov_batch_backup_buffers_.size(); offset += batch_size)
+            {
+                uint32_t const batch_count =
+                    (uint32_t)std::min((size_t)batch_size, aov_batch_backup_buffers_.size() - offset);
+                GfxTexture src_buffers[batch_size];
+                GfxTexture dst_buffers[batch_size];
+                for (uint32_t i = 0; i < batch_size; ++i)
+                {
+                    // Pad the tail with the first entry so all descriptors stay valid
+                    auto const &backup = aov_batch_backup_buffers_[offset + std::min(i, batch_count - 1)];
+                    src_buffers[i]     = backup.first;
+                    dst_buffers[i]     = backup.second;
+                }
+                uint32_t const buffer_dimensions[] = {buffer_width_, buffer_height_};
+                gfxProgramSetParameter(gfx_, batch_clear_program_, "g_BufferDimensions", buffer_dimensions);
+                gfxProgramSetParameter(gfx_, batch_clear_program_, "g_BatchCount", batch_count);
+                gfxProgramSetParameter(
+                    gfx_, batch_clear_program_, "g_BackupSrcBuffers", src_buffers, batch_size);
+                gfxProgramSetParameter(
+                    gfx_, batch_clear_program_, "g_BackupDstBuffers", dst_buffers, batch_size);
+                gfxCommandBindKernel(gfx_, batch_backup_kernel_);
+                gfxCommandDispatch(gfx_, (buffer_width_ + 7) / 8, (buffer_height_ + 7) / 8, 1);
+            }
         }
 
         // Clear our AOVs
@@ -1186,6 +2312,27 @@ void CapsaicinInternal::render()
                     gfxCommandClearTexture(gfx_, i);
                 }
 
+                // Batch the UAV-compatible clears into shared dispatches
+                constexpr uint32_t const batch_size = 8;
+                for (size_t offset = 0; offset < aov_batch_clear_buffers_.size(); offset += batch_size)
+                {
+                    uint32_t const batch_count =
+                        (uint32_t)std::min((size_t)batch_size, aov_batch_clear_buffers_.size() - offset);
+                    GfxTexture clear_buffers[batch_size];
+                    for (uint32_t i = 0; i < batch_size; ++i)
+                    {
+                        clear_buffers[i] = aov_batch_clear_buffers_[offset + std::min(i, batch_count - 1)];
+                    }
+                    uint32_t const buffer_dimensions[] = {buffer_width_, buffer_height_};
+                    gfxProgramSetParameter(
+                        gfx_, batch_clear_program_, "g_BufferDimensions", buffer_dimensions);
+                    gfxProgramSetParameter(gfx_, batch_clear_program_, "g_BatchCount", batch_count);
+                    gfxProgramSetParameter(
+                        gfx_, batch_clear_program_, "g_ClearBuffers", clear_buffers, batch_size);
+                    gfxCommandBindKernel(gfx_, batch_clear_kernel_);
+                    gfxCommandDispatch(gfx_, (buffer_width_ + 7) / 8, (buffer_height_ + 7) / 8, 1);
+                }
+
                 if (!debug_view_.empty() && debug_view_ != "None")
                 {
                     gfxCommandClearTexture(gfx_, getAOVBuffer("Debug"));
@@ -1200,11 +2347,126 @@ void CapsaicinInternal::render()
             }
         }
 
-        // Check whether we need to re-build our acceleration structure
-        size_t mesh_hash = mesh_hash_;
+        // Check whether we need to re-build our acceleration structure. Each mesh is hashed once
+        // (in parallel) and the per-mesh hashes both feed the combined scene hash and identify
+        // which meshes deformed below, instead of hashing all vertex data a second time inside the
+        // update path
+        size_t              mesh_hash = mesh_hash_;
+        std::vector<size_t> mesh_hashes;
         if (frame_index_ == 0 || animation)
-            mesh_hash =
-                HashReduce(gfxSceneGetObjects<GfxMesh>(scene_), gfxSceneGetObjectCount<GfxMesh>(scene_));
+        {
+            if (update_precomputed)
+            {
+                mesh_hash   = precomputed_update->mesh_hash;
+                mesh_hashes = std::move(precomputed_update->mesh_hashes);
+            }
+            else
+            {
+                GfxMesh const *meshes     = gfxSceneGetObjects<GfxMesh>(scene_);
+                uint32_t const mesh_count = gfxSceneGetObjectCount<GfxMesh>(scene_);
+                mesh_hashes.resize(mesh_count);
+                ThreadPool().Dispatch(
+                    [&](uint32_t i) { mesh_hashes[i] = std::hash<GfxMesh> {}(meshes[i]); }, mesh_count, 1);
+                mesh_hash = 0x12345678u;
+                for (size_t const mesh_hash_i : mesh_hashes)
+                {
+                    HashCombine(mesh_hash, mesh_hash_i);
+                }
+            }
+        }
+
+        // If mesh data changed but topology did not (vertex/index counts are stable) then only vertex
+        // data has deformed and the affected BLASes can be refit in place, which is far cheaper than
+        // rebuilding the whole scene below.
+        if (mesh_hash != mesh_hash_)
+        {
+            GfxMesh const *changed_meshes     = gfxSceneGetObjects<GfxMesh>(scene_);
+            uint32_t const changed_mesh_count = gfxSceneGetObjectCount<GfxMesh>(scene_);
+
+            std::vector<size_t> mesh_shape_hashes(changed_mesh_count);
+            for (uint32_t i = 0; i < changed_mesh_count; ++i)
+            {
+                size_t shape_hash = 0x12345678u;
+                HashCombine(shape_hash, changed_meshes[i].vertices.size());
+                HashCombine(shape_hash, changed_meshes[i].indices.size());
+                mesh_shape_hashes[i] = shape_hash;
+            }
+
+            if (!mesh_data_.empty() && !raytracing_primitives_.empty() && pending_blas_builds_.empty()
+                && mesh_shape_hashes == mesh_shape_hashes_)
+            {
+                GfxCommandEvent const command_event(gfx_, "RefitScene");
+                mesh_updated_ = true;
+
+                // Re-upload the vertex ranges of the deformed meshes
+                std::vector<bool> dirty_meshes(mesh_data_.size(), false);
+                for (uint32_t i = 0; i < changed_mesh_count; ++i)
+                {
+                    if (mesh_hashes[i] == mesh_hashes_[i])
+                    {
+                        continue;
+                    }
+                    uint32_t const mesh_index = gfxSceneGetObjectHandle<GfxMesh>(scene_, i);
+                    Mesh const    &mesh       = mesh_data_[mesh_index];
+                    dirty_meshes[mesh_index]  = true;
+
+                    // Upload the raw source vertices with a single copy and expand them into the
+                    // shared vertex buffer region on the GPU, replacing the per-vertex CPU
+                    // conversion loop. The BLAS refits below source the expanded vertices directly
+                    // from the shared vertex buffer so no further CPU round-trip is needed
+                    uint32_t const vertex_count  = (uint32_t)changed_meshes[i].vertices.size();
+                    GfxBuffer      upload_buffer = gfxCreateBuffer<GfxVertex>(
+                        gfx_, vertex_count, changed_meshes[i].vertices.data());
+
+                    gfxProgramSetParameter(gfx_, update_vertices_program_, "g_VertexCount", vertex_count);
+                    gfxProgramSetParameter(
+                        gfx_, update_vertices_program_, "g_VertexOffset", mesh.vertex_offset_idx);
+                    gfxProgramSetParameter(
+                        gfx_, update_vertices_program_, "g_SourceVertexBuffer", upload_buffer);
+                    gfxProgramSetParameter(gfx_, update_vertices_program_, "g_VertexBuffer", vertex_buffer_);
+
+                    uint32_t const *num_threads = gfxKernelGetNumThreads(gfx_, update_vertices_kernel_);
+                    gfxCommandBindKernel(gfx_, update_vertices_kernel_);
+                    gfxCommandDispatch(gfx_, (vertex_count + num_threads[0] - 1) / num_threads[0], 1, 1);
+
+                    gfxDestroyBuffer(gfx_, upload_buffer);
+                }
+
+                // Refit the BLAS of every instance referencing a deformed mesh
+                GfxInstance const *refit_instances = gfxSceneGetObjects<GfxInstance>(scene_);
+                uint32_t const refit_instance_count = gfxSceneGetObjectCount<GfxInstance>(scene_);
+                for (uint32_t i = 0; i < refit_instance_count; ++i)
+                {
+                    if (!refit_instances[i].mesh)
+                    {
+                        continue;
+                    }
+                    uint32_t const mesh_index = (uint32_t)refit_instances[i].mesh;
+                    if (mesh_index < dirty_meshes.size() && dirty_meshes[mesh_index])
+                    {
+                        uint32_t const instance_index = gfxSceneGetObjectHandle<GfxInstance>(scene_, i);
+                        // Instances sharing a BLAS are covered by the owning instance's refit
+                        if (instance_index < raytracing_primitives_.size()
+                            && !rt_primitive_owners_.contains(instance_index))
+                        {
+                            gfxRaytracingPrimitiveUpdate(gfx_, raytracing_primitives_[instance_index]);
+                        }
+                    }
+                }
+
+                gfxAccelerationStructureUpdate(gfx_, acceleration_structure_);
+
+                // Drop any resident CPU vertex copy so a later getVertexData() re-flattens the
+                // deformed data instead of returning stale vertices
+                vertex_data_.clear();
+                vertex_data_.shrink_to_fit();
+
+                mesh_hash_ = mesh_hash; // handled, skip the full rebuild below
+            }
+
+            mesh_hashes_       = std::move(mesh_hashes);
+            mesh_shape_hashes_ = std::move(mesh_shape_hashes);
+        }
 
         if (mesh_hash != mesh_hash_)
         {
@@ -1215,6 +2477,7 @@ void CapsaicinInternal::render()
             index_data_.clear();
             vertex_data_.clear();
             instance_data_.clear();
+            instance_packed_data_.clear();
             material_data_.clear();
             transform_data_.clear();
 
@@ -1222,6 +2485,7 @@ void CapsaicinInternal::render()
             gfxDestroyBuffer(gfx_, index_buffer_);
             gfxDestroyBuffer(gfx_, vertex_buffer_);
             gfxDestroyBuffer(gfx_, instance_buffer_);
+            gfxDestroyBuffer(gfx_, instance_packed_buffer_);
             gfxDestroyBuffer(gfx_, material_buffer_);
             gfxDestroyBuffer(gfx_, transform_buffer_);
 
@@ -1231,12 +2495,45 @@ void CapsaicinInternal::render()
             }
 
             texture_atlas_.clear();
+            texture_stream_queue_.clear();
+            mesh_lod_table_.clear();
+            instance_lods_.clear();
+
+            // Runtime rebuilds keep the previous acceleration structure alive and traceable while
+            // the replacement BLASes are built over the following frames in budgeted batches, so
+            // geometry edits no longer stall the frame on a full synchronous build. The initial
+            // scene build stays synchronous as there is nothing to keep rendering with.
+            bool const defer_builds = frame_index_ != 0 && !!acceleration_structure_;
+            pending_blas_builds_.clear();
+            if (defer_builds && !stale_acceleration_structure_)
+            {
+                stale_acceleration_structure_ = acceleration_structure_;
+                stale_raytracing_primitives_  = std::move(raytracing_primitives_);
+            }
+            else
+            {
+                // Either the first build or a rebuild superseding one still in flight; in the
+                // latter case the stale structure stays the rendered one and the in-progress
+                // structure is discarded along with its unbuilt primitives
+                gfxDestroyAccelerationStructure(gfx_, acceleration_structure_);
+            }
             raytracing_primitives_.clear();
+            rt_primitive_owners_.clear();
 
-            gfxDestroyAccelerationStructure(gfx_, acceleration_structure_);
+            // Try to source the flattened arrays from the binary scene cache so re-runs skip the
+            // flatten entirely. The cache is keyed by the source files so object handles match those
+            // assigned by the (deterministic) import.
+            SceneCache::View scene_cache;
+            bool const       cache_loaded = frame_index_ == 0 && !scene_files_.empty()
+                                   && SceneCache::Load(scene_files_, scene_cache);
 
             GfxMaterial const *materials      = gfxSceneGetObjects<GfxMaterial>(scene_);
-            uint32_t const     material_count = gfxSceneGetObjectCount<GfxMaterial>(scene_);
+            uint32_t const     material_count = cache_loaded ? 0 : gfxSceneGetObjectCount<GfxMaterial>(scene_);
+
+            if (cache_loaded)
+            {
+                material_data_.assign(scene_cache.materials, scene_cache.materials + scene_cache.material_count);
+            }
 
             for (uint32_t i = 0; i < material_count; ++i)
             {
@@ -1287,9 +2584,27 @@ void CapsaicinInternal::render()
                 DXGI_FORMAT    format         = image_ref->format;
                 uint32_t       image_width    = image_ref->width;
                 uint32_t       image_height   = image_ref->height;
-                uint32_t const image_mips     = gfxCalculateMipCount(image_width, image_height);
                 uint32_t const image_channels = image_ref->channel_count;
 
+                // Large uncompressed textures initially get a low-resolution placeholder so scene load
+                // does not stall uploading every texel; the full-resolution data is streamed in over
+                // the following frames under a per-frame budget (see StreamTextures below)
+                bool const streamed = image_width != 0 && image_height != 0
+                                   && !gfxImageIsFormatCompressed(*image_ref)
+                                   && GFX_MAX(image_width, image_height) > kTextureStreamingPlaceholderSize;
+                uint32_t stream_shift = 0;
+                if (streamed)
+                {
+                    while ((GFX_MAX(image_width, image_height) >> stream_shift)
+                           > kTextureStreamingPlaceholderSize)
+                    {
+                        ++stream_shift;
+                    }
+                    image_width  = GFX_MAX(image_width >> stream_shift, 1u);
+                    image_height = GFX_MAX(image_height >> stream_shift, 1u);
+                }
+                uint32_t const image_mips = gfxCalculateMipCount(image_width, image_height);
+
                 texture = gfxCreateTexture2D(gfx_, image_width, image_height, format, image_mips);
                 texture.setName(gfxSceneGetObjectMetadata<GfxImage>(scene_, image_ref).getObjectName());
 
@@ -1297,6 +2612,33 @@ void CapsaicinInternal::render()
                 {
                     gfxCommandClearTexture(gfx_, texture);
                 }
+                else if (streamed)
+                {
+                    // Point-subsample the top mip into the placeholder resolution
+                    uint32_t const texel_size = image_channels * image_ref->bytes_per_channel;
+                    std::vector<uint8_t> placeholder((size_t)image_width * image_height * texel_size);
+                    uint8_t const       *image_data = image_ref->data.data();
+                    for (uint32_t y = 0; y < image_height; ++y)
+                    {
+                        for (uint32_t x = 0; x < image_width; ++x)
+                        {
+                            size_t const source =
+                                (((size_t)y << stream_shift) * image_ref->width
+                                    + ((size_t)x << stream_shift))
+                                * texel_size;
+                            memcpy(&placeholder[((size_t)y * image_width + x) * texel_size],
+                                &image_data[source], texel_size);
+                        }
+                    }
+
+                    GfxBuffer texture_data =
+                        gfxCreateBuffer(gfx_, placeholder.size(), placeholder.data(), kGfxCpuAccess_Write);
+                    gfxCommandCopyBufferToTexture(gfx_, texture, texture_data);
+                    gfxCommandGenerateMips(gfx_, texture);
+                    gfxDestroyBuffer(gfx_, texture_data);
+
+                    texture_stream_queue_.push_back({image_ref, image_index});
+                }
                 else
                 {
                     uint8_t const *image_data = image_ref->data.data();
@@ -1321,7 +2663,14 @@ void CapsaicinInternal::render()
                 }
             }
             GfxMesh const *meshes     = gfxSceneGetObjects<GfxMesh>(scene_);
-            uint32_t const mesh_count = gfxSceneGetObjectCount<GfxMesh>(scene_);
+            uint32_t const mesh_count = cache_loaded ? 0 : gfxSceneGetObjectCount<GfxMesh>(scene_);
+
+            if (cache_loaded)
+            {
+                mesh_data_.assign(scene_cache.meshes, scene_cache.meshes + scene_cache.mesh_count);
+                index_data_.assign(scene_cache.indices, scene_cache.indices + scene_cache.index_count);
+                vertex_data_.assign(scene_cache.vertices, scene_cache.vertices + scene_cache.vertex_count);
+            }
 
             for (uint32_t i = 0; i < mesh_count; ++i)
             {
@@ -1354,6 +2703,16 @@ void CapsaicinInternal::render()
                 }
             }
 
+            if (!cache_loaded && frame_index_ == 0 && !scene_files_.empty())
+            {
+                // Write out the freshly flattened arrays so subsequent runs can skip the parse
+                SceneCache::Save(scene_files_, mesh_data_, index_data_, vertex_data_, material_data_);
+            }
+
+            // Generate the simplified detail levels behind the base data. This runs after the cache
+            // save so the cache only ever holds base geometry; the levels regenerate quickly from it
+            generateMeshLODs();
+
             mesh_buffer_  = gfxCreateBuffer<Mesh>(gfx_, (uint32_t)mesh_data_.size(), mesh_data_.data());
             index_buffer_ = gfxCreateBuffer<uint32_t>(gfx_, (uint32_t)index_data_.size(), index_data_.data());
             vertex_buffer_ =
@@ -1375,6 +2734,10 @@ void CapsaicinInternal::render()
             GfxInstance const *instances      = gfxSceneGetObjects<GfxInstance>(scene_);
             uint32_t const     instance_count = gfxSceneGetObjectCount<GfxInstance>(scene_);
 
+            // First instance seen with a given (mesh, build flags) combination, later ones share
+            // its BLAS through an instanced primitive instead of building an identical copy
+            std::map<uint64_t, uint32_t> blas_owners;
+
             for (uint32_t i = 0; i < instance_count; ++i)
             {
                 Instance instance = {};
@@ -1417,13 +2780,6 @@ void CapsaicinInternal::render()
 
                 GfxRaytracingPrimitive &rt_mesh = raytracing_primitives_[instance_index];
 
-                rt_mesh = gfxCreateRaytracingPrimitive(gfx_, acceleration_structure_);
-
-                GfxBuffer index_buffer =
-                    gfxCreateBufferRange<uint32_t>(gfx_, index_buffer_, mesh.index_offset_idx, index_count);
-                GfxBuffer vertex_buffer =
-                    gfxCreateBufferRange<Vertex>(gfx_, vertex_buffer_, mesh.vertex_offset_idx, vertex_count);
-
                 uint32_t non_opaque =
                     !material_ref
                             || (material_ref->albedo.w >= 1.0f
@@ -1433,23 +2789,96 @@ void CapsaicinInternal::render()
                         ? kGfxBuildRaytracingPrimitiveFlag_Opaque
                         : 0;
 
-                gfxRaytracingPrimitiveBuild(gfx_, rt_mesh, index_buffer, vertex_buffer, 0, non_opaque);
+                // Replicated geometry shares one BLAS: the first occurrence builds it and every
+                // later one references it through an instanced primitive, which costs a TLAS entry
+                // instead of a duplicate BLAS. On instance-heavy scenes this removes the bulk of
+                // the acceleration structure memory reported by getBvhDataSize().
+                uint64_t const blas_key = ((uint64_t)instance.mesh_index << 1) | (non_opaque != 0 ? 1u : 0u);
+                auto const     blas_owner = blas_owners.find(blas_key);
+                bool const     shared_blas = blas_owner != blas_owners.end();
+
+                if (shared_blas)
+                {
+                    rt_mesh = gfxCreateRaytracingPrimitiveInstance(
+                        gfx_, raytracing_primitives_[blas_owner->second]);
+                    rt_primitive_owners_[instance_index] = blas_owner->second;
+
+                    // The shared BLAS is pinned at full detail as a per-instance detail swap would
+                    // rebuild the geometry under every sharer
+                    instance_lods_[blas_owner->second].locked = true;
+                }
+                else
+                {
+                    rt_mesh = gfxCreateRaytracingPrimitive(gfx_, acceleration_structure_);
+                    blas_owners.emplace(blas_key, instance_index);
+                }
+
+                if (instance_index >= instance_lods_.size())
+                {
+                    instance_lods_.resize((size_t)instance_index + 1);
+                }
+
+                // Emissive instances are pinned at full detail so the area lights built from their
+                // triangles always match the traced geometry
+                bool const emissive = material_ref && gfxMaterialIsEmissive(*material_ref);
+
+                instance_lods_[instance_index] = {
+                    instance.mesh_index, 0, non_opaque, !mesh_ref || emissive || shared_blas};
+
+                if (shared_blas)
+                {
+                    // Nothing to build, the primitive references the owning instance's BLAS
+                }
+                else if (defer_builds)
+                {
+                    pending_blas_builds_.push_back({instance_index, mesh.index_offset_idx, index_count,
+                        mesh.vertex_offset_idx, vertex_count, non_opaque});
+                }
+                else
+                {
+                    GfxBuffer index_buffer = gfxCreateBufferRange<uint32_t>(
+                        gfx_, index_buffer_, mesh.index_offset_idx, index_count);
+                    GfxBuffer vertex_buffer = gfxCreateBufferRange<Vertex>(
+                        gfx_, vertex_buffer_, mesh.vertex_offset_idx, vertex_count);
+
+                    gfxRaytracingPrimitiveBuild(gfx_, rt_mesh, index_buffer, vertex_buffer, 0, non_opaque);
+
+                    gfxDestroyBuffer(gfx_, index_buffer);
+                    gfxDestroyBuffer(gfx_, vertex_buffer);
+                }
 
                 glm::mat4 const row_major_transform = glm::transpose(instances[i].transform);
 
                 gfxRaytracingPrimitiveSetTransform(gfx_, rt_mesh, &row_major_transform[0][0]);
                 gfxRaytracingPrimitiveSetInstanceID(gfx_, rt_mesh, instance_index);
+
+                // Partition the top level structure by alpha mode so rays that only need the
+                // opaque geometry can exclude the any-hit carrying instances with their mask
+                gfxRaytracingPrimitiveSetInstanceMask(gfx_, rt_mesh,
+                    non_opaque != 0 ? INSTANCE_INCLUSION_MASK_ALPHA_TESTED
+                                    : INSTANCE_INCLUSION_MASK_OPAQUE);
+
                 gfxRaytracingPrimitiveSetInstanceContributionToHitGroupIndex(
                     gfx_, rt_mesh, instance_index * sbt_stride_in_entries_[kGfxShaderGroupType_Hit]);
-
-                gfxDestroyBuffer(gfx_, index_buffer);
-                gfxDestroyBuffer(gfx_, vertex_buffer);
             }
 
             instance_buffer_ =
                 gfxCreateBuffer<Instance>(gfx_, (uint32_t)instance_data_.size(), instance_data_.data());
             instance_buffer_.setName("Capsaicin_InstanceBuffer");
 
+            // Build the packed per-instance records so hit shaders can resolve an instance with a
+            // single fetch instead of dependent instance->mesh reads
+            instance_packed_data_.resize(instance_data_.size());
+            for (size_t i = 0; i < instance_data_.size(); ++i)
+            {
+                instance_packed_data_[i] =
+                    PackInstance(instance_data_[i], mesh_data_[instance_data_[i].mesh_index]);
+            }
+
+            instance_packed_buffer_ = gfxCreateBuffer<InstancePacked>(
+                gfx_, (uint32_t)instance_packed_data_.size(), instance_packed_data_.data());
+            instance_packed_buffer_.setName("Capsaicin_InstancePackedBuffer");
+
             transform_buffer_ =
                 gfxCreateBuffer<glm::mat4x3>(gfx_, (uint32_t)transform_data_.size(), transform_data_.data());
             transform_buffer_.setName("Capsaicin_TransformBuffer");
@@ -1465,7 +2894,20 @@ void CapsaicinInternal::render()
                 gfx_, (uint32_t)prev_transform_data_.size(), prev_transform_data_.data());
             prev_transform_buffer_.setName("Capsaicin_PrevTransformBuffer");
 
-            gfxAccelerationStructureUpdate(gfx_, acceleration_structure_);
+            if (!defer_builds)
+            {
+                gfxAccelerationStructureUpdate(gfx_, acceleration_structure_);
+            }
+
+            // The GPU geometry buffers and acceleration structure are now built so the flattened CPU
+            // copies are no longer needed; release their heap storage to avoid doubling the geometry
+            // footprint on large scenes. getIndexData()/getVertexData() re-flatten on demand should
+            // anything still need CPU access. mesh_data_ stays resident as it is small and consumed
+            // every frame.
+            index_data_.clear();
+            index_data_.shrink_to_fit();
+            vertex_data_.clear();
+            vertex_data_.shrink_to_fit();
 
             mesh_hash_ = mesh_hash;
         }
@@ -1475,17 +2917,21 @@ void CapsaicinInternal::render()
 
         // Check whether we need to re-build our transform data
         size_t transform_hash = transform_hash_;
-        if (frame_index_ == 0 || animation) transform_hash = HashReduce(instances, instance_count);
+        if (frame_index_ == 0 || animation)
+        {
+            transform_hash =
+                update_precomputed ? precomputed_update->transform_hash : HashReduce(instances, instance_count);
+        }
 
         if (transform_hash != transform_hash_ || mesh_updated_)
         {
-            transform_updated_ = true;
-            transform_hash_    = transform_hash;
+            transform_updated_  = true;
+            scene_bounds_dirty_ = true; // instance bounds are rewritten below
+            transform_hash_     = transform_hash;
 
-            // Update our transforms
-            GfxBuffer transform_buffer =
-                allocateConstantBuffer<glm::mat4x3>((uint32_t)transform_data_.size());
-            glm::mat4x3 *transform_data = (glm::mat4x3 *)gfxBufferGetData(gfx_, transform_buffer);
+            // Update our transforms, tracking which ones changed so only the dirty ranges of the
+            // GPU buffers need uploading
+            FrameVector<uint32_t> dirty_transforms(frame_arena_);
 
             for (uint32_t i = 0; i < instance_count; ++i)
             {
@@ -1501,8 +2947,21 @@ void CapsaicinInternal::render()
 
                 Instance const &instance = instance_data_[instance_index];
 
-                transform_data[instance.transform_index]  = instances[i].transform;
+                // Only touch the TLAS instance descriptor of instances that actually moved so static
+                // geometry is left alone when a handful of instances animate
+                bool const instance_moved =
+                    mesh_updated_
+                    || memcmp(&transform_data_[instance.transform_index], &instances[i].transform,
+                           sizeof(glm::mat4x3))
+                           != 0;
+
+                if (!instance_moved)
+                {
+                    continue;
+                }
+
                 transform_data_[instance.transform_index] = instances[i].transform;
+                dirty_transforms.push_back(instance.transform_index);
 
                 if (instances[i].mesh)
                 {
@@ -1516,42 +2975,242 @@ void CapsaicinInternal::render()
 
                 gfxRaytracingPrimitiveSetTransform(
                     gfx_, raytracing_primitives_[instance_index], &row_major_transform[0][0]);
+
+                // While a deferred rebuild is in flight the previous structure is still the one
+                // being traced, so moved instances also update their entry there instead of
+                // freezing until the swap
+                if (instance_index < stale_raytracing_primitives_.size())
+                {
+                    gfxRaytracingPrimitiveSetTransform(
+                        gfx_, stale_raytracing_primitives_[instance_index], &row_major_transform[0][0]);
+                }
             }
 
+            // The coalesced ranges are kept around so the next frame's history upload only copies
+            // the same regions into the previous transforms buffer
+            transform_dirty_ranges_ = CoalesceDirtyRanges(dirty_transforms, 64);
+
             // Update our acceleration structure
             {
                 GfxCommandEvent const command_event(gfx_, "UpdateTLAS");
 
-                gfxCommandCopyBuffer(gfx_, transform_buffer_, transform_buffer);
-                gfxAccelerationStructureUpdate(gfx_, acceleration_structure_);
-                gfxDestroyBuffer(gfx_, transform_buffer);
+                uploadBufferRanges<glm::mat4x3>(
+                    transform_buffer_, transform_data_.data(), transform_dirty_ranges_);
+                // The in-progress structure cannot be refit over unbuilt BLASes, the stale one
+                // carries the moved instances until the swap
+                gfxAccelerationStructureUpdate(gfx_,
+                    !!stale_acceleration_structure_ ? stale_acceleration_structure_
+                                                    : acceleration_structure_);
             }
 
-            // Set up our instance indirection table
-            instance_id_data_.resize(gfxSceneGetObjectCount<GfxInstance>(scene_));
+            // Set up our instance indirection table. The indirection only changes when instances
+            // are added or removed (not when they move), so pure transform updates upload nothing
+            std::vector<uint32_t> instance_ids(gfxSceneGetObjectCount<GfxInstance>(scene_));
 
-            for (size_t i = 0; i < instance_id_data_.size(); ++i)
+            for (size_t i = 0; i < instance_ids.size(); ++i)
             {
-                instance_id_data_[i] = gfxSceneGetObjectHandle<GfxInstance>(scene_, (uint32_t)i);
+                instance_ids[i] = gfxSceneGetObjectHandle<GfxInstance>(scene_, (uint32_t)i);
             }
 
-            GfxBuffer instance_id_buffer =
-                allocateConstantBuffer<uint32_t>((uint32_t)instance_id_data_.size());
-            memcpy(gfxBufferGetData(gfx_, instance_id_buffer), instance_id_data_.data(),
-                instance_id_data_.size() * sizeof(uint32_t));
-
-            if (!instance_id_buffer_ || instance_id_buffer.getSize() != instance_id_buffer_.getSize())
+            if (!instance_id_buffer_
+                || instance_ids.size() * sizeof(uint32_t) != instance_id_buffer_.getSize())
             {
                 gfxDestroyBuffer(gfx_, instance_id_buffer_);
-                instance_id_buffer_ = gfxCreateBuffer<uint32_t>(gfx_, (uint32_t)instance_id_data_.size());
+                instance_id_buffer_ = gfxCreateBuffer<uint32_t>(gfx_, (uint32_t)instance_ids.size());
                 instance_id_buffer_.setName("Capsaicin_InstanceIDBuffer");
             }
 
+            std::vector<std::pair<uint32_t, uint32_t>> id_ranges;
+            if (instance_id_data_.size() != instance_ids.size())
+            {
+                id_ranges.emplace_back(0U, (uint32_t)instance_ids.size());
+            }
+            else
+            {
+                FrameVector<uint32_t> dirty_ids(frame_arena_);
+                for (uint32_t i = 0; i < (uint32_t)instance_ids.size(); ++i)
+                {
+                    if (instance_ids[i] != instance_id_data_[i])
+                    {
+                        dirty_ids.push_back(i);
+                    }
+                }
+                id_ranges = CoalesceDirtyRanges(dirty_ids, 64);
+            }
+            instance_id_data_ = std::move(instance_ids);
+
             // Update our instance table
+            if (!id_ranges.empty())
             {
                 GfxCommandEvent const command_event(gfx_, "UpdateInstanceTable");
-                gfxCommandCopyBuffer(gfx_, instance_id_buffer_, instance_id_buffer);
-                gfxDestroyBuffer(gfx_, instance_id_buffer);
+                uploadBufferRanges<uint32_t>(instance_id_buffer_, instance_id_data_.data(), id_ranges);
+            }
+        }
+
+        // Distance based LOD selection: instances covering little of the screen swap to one of the
+        // simplified detail levels generated at scene build, shrinking both their raster draws and
+        // their BLAS footprint. Paused while a deferred rebuild is in flight as the level swaps
+        // rebuild BLASes of the structure still being assembled
+        if (!mesh_lod_table_.empty() && pending_blas_builds_.empty())
+        {
+            float3 const          camera_eye   = getCamera().eye;
+            bool                  lods_changed = false;
+            FrameVector<uint32_t> dirty_instances(frame_arena_);
+
+            for (uint32_t i = 0; i < instance_count; ++i)
+            {
+                uint32_t const instance_index = gfxSceneGetObjectHandle<GfxInstance>(scene_, i);
+
+                if (instance_index >= instance_lods_.size()
+                    || instance_index >= raytracing_primitives_.size())
+                {
+                    continue;
+                }
+
+                InstanceLOD &lod_state = instance_lods_[instance_index];
+
+                if (lod_state.locked || lod_state.base_mesh_index >= mesh_lod_table_.size())
+                {
+                    continue;
+                }
+
+                std::array<uint32_t, kMeshLODCount> const &levels =
+                    mesh_lod_table_[lod_state.base_mesh_index];
+
+                if (levels[kMeshLODCount - 1] == levels[0])
+                {
+                    continue; // the mesh has no simplified levels
+                }
+
+                float3 const center =
+                    0.5f * (instance_min_bounds_[instance_index] + instance_max_bounds_[instance_index]);
+                float const radius =
+                    0.5f
+                    * glm::length(instance_max_bounds_[instance_index] - instance_min_bounds_[instance_index]);
+                float const distance = glm::length(center - camera_eye);
+                float const coverage = radius / GFX_MAX(distance, radius);
+
+                uint32_t detail_level = 0;
+                for (uint32_t level = 0; level + 1 < kMeshLODCount; ++level)
+                {
+                    // 10% hysteresis around each threshold so borderline instances don't flicker
+                    float const threshold =
+                        kMeshLODThresholds[level] * (lod_state.current_lod > level ? 1.1f : 0.9f);
+                    if (coverage < threshold)
+                    {
+                        detail_level = level + 1;
+                    }
+                }
+
+                if (detail_level == lod_state.current_lod)
+                {
+                    continue;
+                }
+
+                uint32_t const lod_mesh_index = levels[detail_level];
+
+                lod_state.current_lod = detail_level;
+
+                if (instance_data_[instance_index].mesh_index == lod_mesh_index)
+                {
+                    continue; // the new level shares the previous one's geometry
+                }
+
+                instance_data_[instance_index].mesh_index = lod_mesh_index;
+                lods_changed                              = true;
+                dirty_instances.push_back(instance_index);
+
+                // Rebuild the BLAS over the selected level's index range (the vertices are shared)
+                Mesh const &mesh = mesh_data_[lod_mesh_index];
+
+                // Keep the packed record in sync with the swapped detail level
+                instance_packed_data_[instance_index] =
+                    PackInstance(instance_data_[instance_index], mesh);
+
+                uint32_t const vertex_count =
+                    instances[i].mesh ? (uint32_t)instances[i].mesh->vertices.size() : 0;
+
+                GfxBuffer index_buffer = gfxCreateBufferRange<uint32_t>(
+                    gfx_, index_buffer_, mesh.index_offset_idx, mesh.index_count);
+                GfxBuffer vertex_buffer =
+                    gfxCreateBufferRange<Vertex>(gfx_, vertex_buffer_, mesh.vertex_offset_idx, vertex_count);
+
+                gfxRaytracingPrimitiveBuild(gfx_, raytracing_primitives_[instance_index], index_buffer,
+                    vertex_buffer, 0, lod_state.build_flags);
+
+                glm::mat4 const row_major_transform = glm::transpose(instances[i].transform);
+
+                gfxRaytracingPrimitiveSetTransform(
+                    gfx_, raytracing_primitives_[instance_index], &row_major_transform[0][0]);
+
+                gfxDestroyBuffer(gfx_, index_buffer);
+                gfxDestroyBuffer(gfx_, vertex_buffer);
+            }
+
+            if (lods_changed)
+            {
+                GfxCommandEvent const command_event(gfx_, "UpdateMeshLODs");
+
+                // Re-upload only the instance entries whose mesh index was swapped and refit the
+                // TLAS over the rebuilt BLASes
+                std::vector<std::pair<uint32_t, uint32_t>> const instance_ranges =
+                    CoalesceDirtyRanges(dirty_instances, 64);
+                uploadBufferRanges<Instance>(instance_buffer_, instance_data_.data(), instance_ranges);
+                uploadBufferRanges<InstancePacked>(
+                    instance_packed_buffer_, instance_packed_data_.data(), instance_ranges);
+
+                gfxAccelerationStructureUpdate(gfx_, acceleration_structure_);
+            }
+        }
+
+        // Advance any deferred acceleration structure rebuild by one budgeted BLAS batch; the
+        // frame keeps tracing the previous structure until the last batch swaps the new one in
+        processDeferredBlasBuilds(kDeferredBlasTrianglesPerFrame);
+
+        // Upload the full-resolution data of any textures still represented by their low-resolution
+        // placeholders, bounded per frame so streaming cannot hitch the frame it lands on
+        if (!texture_stream_queue_.empty())
+        {
+            GfxCommandEvent const command_event(gfx_, "StreamTextures");
+
+            uint64_t budget = kTextureStreamingBytesPerFrame;
+            while (!texture_stream_queue_.empty() && budget > 0)
+            {
+                auto const [image_ref, image_index] = texture_stream_queue_.front();
+                texture_stream_queue_.pop_front();
+
+                uint32_t const image_width  = image_ref->width;
+                uint32_t const image_height = image_ref->height;
+                uint32_t const image_mips   = gfxCalculateMipCount(image_width, image_height);
+
+                GfxTexture texture =
+                    gfxCreateTexture2D(gfx_, image_width, image_height, image_ref->format, image_mips);
+                texture.setName(gfxSceneGetObjectMetadata<GfxImage>(scene_, image_ref).getObjectName());
+
+                uint64_t texture_size = (uint64_t)image_width * image_height * image_ref->channel_count
+                                      * image_ref->bytes_per_channel;
+                bool const mips = (image_ref->flags & kGfxImageFlag_HasMipLevels) != 0;
+                if (mips)
+                {
+                    texture_size += texture_size / 3;
+                }
+                texture_size = GFX_MIN(texture_size, (uint64_t)image_ref->data.size());
+
+                GfxBuffer texture_data =
+                    gfxCreateBuffer(gfx_, texture_size, image_ref->data.data(), kGfxCpuAccess_Write);
+                gfxCommandCopyBufferToTexture(gfx_, texture, texture_data);
+                if (!mips)
+                {
+                    gfxCommandGenerateMips(gfx_, texture);
+                }
+                gfxDestroyBuffer(gfx_, texture_data);
+
+                // The placeholder may still be referenced by in-flight frames, gfx defers the actual
+                // release until those have retired
+                gfxDestroyTexture(gfx_, texture_atlas_[image_index]);
+                texture_atlas_[image_index] = texture;
+
+                budget -= GFX_MIN(budget, texture_size);
             }
         }
 
@@ -1559,45 +3218,137 @@ void CapsaicinInternal::render()
         gfxCommandBindIndexBuffer(gfx_, index_buffer_);
         gfxCommandBindVertexBuffer(gfx_, vertex_buffer_);
 
+        // Components and render techniques that declare async compute affinity are recorded as
+        // contiguous fenced regions so the whole region can be submitted on a compute queue and
+        // overlapped with surrounding direct queue work (e.g. light grid builds alongside the
+        // visibility buffer raster pass) once the gfx layer exposes one. Until then the grouping
+        // still keeps those dispatches free of interleaved raster work on the single direct queue.
+        std::optional<GfxCommandEvent> async_region;
+
         // Update the components
         for (auto const &component : components_)
         {
             component.second->setGfxContext(gfx_);
             component.second->resetQueries();
+            if (component.second->getQueueAffinity() == QueueAffinity::AsyncCompute)
+            {
+                if (!async_region)
+                {
+                    async_region.emplace(gfx_, "AsyncCompute");
+                }
+            }
+            else
+            {
+                async_region.reset();
+            }
             {
                 Component::TimedSection const timed_section(*component.second, component.second->getName());
                 component.second->run(*this);
             }
         }
+        async_region.reset();
+
+        // Run the techniques' CPU-side frame preparation in parallel ahead of any recording.
+        // prepare() implementations only build technique-owned CPU data so they can spread across
+        // the thread pool while the single gfx recording context stays untouched
+        if (!render_techniques_.empty())
+        {
+            ThreadPool().Dispatch(
+                [&](uint32_t i) { render_techniques_[i]->prepare(*this); },
+                (uint32_t)render_techniques_.size(), 1);
+        }
+
+        // A technique that outputs directly into the back buffer re-raises this during the loop
+        back_buffer_written_ = false;
 
         // Execute our render techniques
+        // The frame graph packs consecutive techniques with no declared data dependency into
+        // groups; every member of a group is independent of every other member so no barriers are
+        // required between them and their recording could be parallelised. Groups with more than
+        // one member are marked so captures show where the graph found exploitable independence.
+        std::optional<GfxCommandEvent> group_region;
+        uint32_t                       technique_index = 0;
         for (auto const &render_technique : render_techniques_)
         {
             render_technique->setGfxContext(gfx_);
             render_technique->resetQueries();
+            if (frame_graph_.isGroupStart(technique_index))
+            {
+                // Close any open regions first so the command events stay correctly nested
+                async_region.reset();
+                group_region.reset();
+                if (frame_graph_.getGroupSize(frame_graph_.getGroup(technique_index)) > 1)
+                {
+                    group_region.emplace(gfx_, "IndependentTechniques");
+                }
+            }
+            if (render_technique->getQueueAffinity() == QueueAffinity::AsyncCompute)
+            {
+                if (!async_region)
+                {
+                    async_region.emplace(gfx_, "AsyncCompute");
+                }
+            }
+            else
+            {
+                async_region.reset();
+            }
             {
                 RenderTechnique::TimedSection const timed_section(
                     *render_technique, render_technique->getName());
                 render_technique->render(*this);
             }
+            ++technique_index;
+        }
+        async_region.reset();
+        group_region.reset();
+
+        // Record this frame's profiling results
+        gatherProfileData();
+
+        // Refresh the video memory accounting and apply budget pressure
+        {
+            memory_budget_.report("Acceleration Structure", getBvhDataSize());
+            memory_budget_.report("Geometry", index_buffer_.getSize() + vertex_buffer_.getSize());
+            uint64_t texture_size = 0;
+            for (auto const &texture : texture_atlas_)
+            {
+                texture_size += MemoryBudget::GetTextureSize(texture);
+            }
+            memory_budget_.report("Texture Atlas", texture_size);
+            uint64_t aov_size = 0;
+            for (auto const &aov : aov_buffers_)
+            {
+                aov_size += MemoryBudget::GetTextureSize(aov.second);
+            }
+            memory_budget_.report("AOVs", aov_size);
+            memory_budget_.update();
         }
 
+        // Stream the registered GPU statistics counters into their readback ring
+        gpu_statistics_.update();
+
         // We've completed a new frame
         ++frame_index_;
 
         // Reset remaining update flags
-        environment_map_updated_ = false;
-        scene_updated_           = false;
-        camera_updated_          = false;
+        environment_map_updated_   = false;
+        environment_map_recreated_ = false;
+        scene_updated_             = false;
+        camera_updated_            = false;
     }
 
     // Show debug visualizations if requested or blit kAOV_Color
     if (debug_view_.empty() || debug_view_ == "None")
     {
-        const GfxCommandEvent command_event(gfx_, "Blit");
-        gfxProgramSetParameter(gfx_, blit_program_, "ColorBuffer", getAOVBuffer("Color"));
-        gfxCommandBindKernel(gfx_, blit_kernel_);
-        gfxCommandDraw(gfx_, 3);
+        // Skipped if a render technique already wrote the back buffer (e.g. fused tone map + blit)
+        if (!back_buffer_written_)
+        {
+            const GfxCommandEvent command_event(gfx_, "Blit");
+            gfxProgramSetParameter(gfx_, blit_program_, "ColorBuffer", getAOVBuffer("Color"));
+            gfxCommandBindKernel(gfx_, blit_kernel_);
+            gfxCommandDraw(gfx_, 3);
+        }
     }
     else
     {
@@ -1679,21 +3430,31 @@ void CapsaicinInternal::render()
         }
     }
 
-    ThreadPool().Dispatch(
-        [&](uint32_t buffer_index) {
-            auto const &[dump_buffer, dump_buffer_width, dump_buffer_height, dump_file_path,
-                dump_frame_index] = dump_in_flight_buffers_[buffer_index];
-            saveImage(dump_buffer, dump_buffer_width, dump_buffer_height, dump_file_path.c_str());
-        },
-        dump_available_buffer_count, 1);
-
+    // Hand available buffers off to background encode jobs, the render thread only fences.
+    // The readback buffer stays alive until its encode completes and is released below.
     for (uint32_t available_buffer_index = 0; available_buffer_index < dump_available_buffer_count;
          available_buffer_index++)
     {
-        gfxDestroyBuffer(gfx_, std::get<0>(dump_in_flight_buffers_.front()));
+        auto const &[dump_buffer, dump_buffer_width, dump_buffer_height, dump_file_path,
+            dump_frame_index] = dump_in_flight_buffers_.front();
+        dump_encode_jobs_.emplace_back(dump_buffer,
+            std::async(std::launch::async,
+                [this, dump_buffer, dump_buffer_width, dump_buffer_height,
+                    file_path = std::string(dump_file_path)] {
+                    saveImage(dump_buffer, dump_buffer_width, dump_buffer_height, file_path.c_str());
+                }));
         dump_in_flight_buffers_.pop_front();
     }
 
+    // Release the buffers of any completed encodes
+    while (!dump_encode_jobs_.empty()
+           && dump_encode_jobs_.front().second.wait_for(std::chrono::seconds(0))
+                  == std::future_status::ready)
+    {
+        gfxDestroyBuffer(gfx_, dump_encode_jobs_.front().first);
+        dump_encode_jobs_.pop_front();
+    }
+
     // Dump cameras
     ThreadPool().Dispatch(
         [&](uint32_t camera_index) {
@@ -1704,6 +3465,190 @@ void CapsaicinInternal::render()
         (uint32_t)dump_camera_requests_.size(), 1);
 
     dump_camera_requests_.clear();
+
+    // Kick off the next frame's CPU scene update so it overlaps this frame's GPU execution and
+    // present. Only fixed frame rate playback is predictable enough to advance the animations
+    // ahead of time; the task touches the CPU-side scene and no gfx device objects, and is joined
+    // at the start of the next frame (or discarded if the prediction turns out wrong)
+    if (pipelined_update_enabled_ && !play_paused_ && !render_paused_ && play_fixed_framerate_
+        && gfxSceneGetAnimationCount(scene_) > 0)
+    {
+        double const next_play_time =
+            play_time_ + play_fixed_frame_time_ * play_speed_ * (!play_rewind_ ? 1.0 : -1.0);
+        pipelined_update_ = std::async(std::launch::async, [this, next_play_time]() noexcept {
+            PipelinedUpdate update;
+            update.play_time               = next_play_time;
+            uint32_t const animation_count = gfxSceneGetAnimationCount(scene_);
+            update.animation               = animation_count > 0;
+            for (uint32_t animation_index = 0; animation_index < animation_count; ++animation_index)
+            {
+                GfxConstRef<GfxAnimation> animation_ref = gfxSceneGetAnimationHandle(scene_, animation_index);
+                float const animation_length            = gfxSceneGetAnimationLength(scene_, animation_ref);
+                float       time_in_seconds = (float)fmod(next_play_time, (double)animation_length);
+                // Handle negative playback times
+                time_in_seconds =
+                    (time_in_seconds >= 0.0f) ? time_in_seconds : animation_length + time_in_seconds;
+                gfxSceneApplyAnimation(scene_, animation_ref, time_in_seconds);
+            }
+            GfxMesh const *meshes     = gfxSceneGetObjects<GfxMesh>(scene_);
+            uint32_t const mesh_count = gfxSceneGetObjectCount<GfxMesh>(scene_);
+            update.mesh_hashes.resize(mesh_count);
+            for (uint32_t i = 0; i < mesh_count; ++i)
+            {
+                update.mesh_hashes[i] = std::hash<GfxMesh> {}(meshes[i]);
+            }
+            update.mesh_hash = 0x12345678u;
+            for (size_t const mesh_hash_i : update.mesh_hashes)
+            {
+                HashCombine(update.mesh_hash, mesh_hash_i);
+            }
+            update.transform_hash = HashReduce(
+                gfxSceneGetObjects<GfxInstance>(scene_), gfxSceneGetObjectCount<GfxInstance>(scene_));
+            return update;
+        });
+    }
+}
+
+void CapsaicinInternal::renderBatch(
+    uint32_t frame_count, std::string_view const &dump_aov, char const *dump_file_path)
+{
+    for (uint32_t frame = 0; frame < frame_count; ++frame)
+    {
+        render();
+        gfxFrame(gfx_, false); // kick the frame without waiting on any swapchain
+    }
+
+    if (dump_file_path != nullptr && !dump_aov.empty() && hasAOVBuffer(dump_aov))
+    {
+        dumpAOVBuffer(dump_file_path, dump_aov);
+
+        // Run enough extra frames for the readback to age past the back-buffer fence
+        for (uint32_t frame = 0; frame < kGfxConstant_BackBufferCount + 2; ++frame)
+        {
+            render();
+            gfxFrame(gfx_, false);
+        }
+    }
+
+    gfxFinish(gfx_); // flush & sync
+
+    // Wait out any background encodes so results are on disk when we return
+    while (!dump_encode_jobs_.empty())
+    {
+        dump_encode_jobs_.front().second.wait();
+        gfxDestroyBuffer(gfx_, dump_encode_jobs_.front().first);
+        dump_encode_jobs_.pop_front();
+    }
+}
+
+void CapsaicinInternal::gatherProfileData() noexcept
+{
+    ProfileFrame frame;
+    frame.frameIndex = frame_index_;
+    frame.frameTime  = (float)(frame_time_ * 1000.0);
+
+    auto const gatherNode = [&](Timeable &timeable) {
+        uint32_t const timestamp_query_count = timeable.getTimestampQueryCount();
+        if (!timestamp_query_count)
+        {
+            return; // no profiling info available
+        }
+        auto const  &timestamp_queries = timeable.getTimestampQueries();
+        ProfileNode &node              = frame.nodes.emplace_back();
+        node.name                      = timeable.getName();
+        node.gpuTime                   = gfxTimestampQueryGetDuration(gfx_, timestamp_queries[0].query);
+        node.cpuTime                   = timestamp_queries[0].cpuTime;
+        for (uint32_t i = 1; i < timestamp_query_count; ++i)
+        {
+            node.children.emplace_back(
+                timestamp_queries[i].name, gfxTimestampQueryGetDuration(gfx_, timestamp_queries[i].query));
+        }
+    };
+    for (auto const &component : components_)
+    {
+        gatherNode(*component.second);
+    }
+    for (auto const &render_technique : render_techniques_)
+    {
+        gatherNode(*render_technique);
+    }
+
+    // Log the full breakdown of any frame that broke the stutter threshold
+    if (stutter_threshold_ > 0.0f && frame.frameTime > stutter_threshold_)
+    {
+        stutter_events_.push_back(frame);
+        while (stutter_events_.size() > kStutterEventLogSize)
+        {
+            stutter_events_.pop_front();
+        }
+    }
+
+    profile_history_.push_back(std::move(frame));
+    while (profile_history_.size() > kProfileHistorySize)
+    {
+        profile_history_.pop_front();
+    }
+}
+
+std::vector<ProfileFrame> CapsaicinInternal::getProfileData() const noexcept
+{
+    return std::vector<ProfileFrame>(profile_history_.begin(), profile_history_.end());
+}
+
+ProfileFrame CapsaicinInternal::getLastProfileFrame() const noexcept
+{
+    return !profile_history_.empty() ? profile_history_.back() : ProfileFrame {};
+}
+
+FrameStats CapsaicinInternal::getFrameStats(uint32_t window) const noexcept
+{
+    FrameStats stats = {};
+    if (profile_history_.empty())
+    {
+        return stats;
+    }
+
+    uint32_t const frame_count = (window == 0)
+                                   ? (uint32_t)profile_history_.size()
+                                   : std::min(window, (uint32_t)profile_history_.size());
+
+    std::vector<float> frame_times;
+    frame_times.reserve(frame_count);
+    double running_total = 0.0;
+    for (auto it = profile_history_.end() - frame_count; it != profile_history_.end(); ++it)
+    {
+        frame_times.push_back(it->frameTime);
+        running_total += (double)it->frameTime;
+    }
+    std::sort(frame_times.begin(), frame_times.end());
+
+    // Nearest-rank percentiles over the sorted window
+    auto const percentile = [&](double p) {
+        uint32_t const rank = (uint32_t)ceil(p * (double)frame_count);
+        return frame_times[std::max(rank, 1u) - 1];
+    };
+
+    stats.frameCount = frame_count;
+    stats.average    = (float)(running_total / (double)frame_count);
+    stats.p50        = percentile(0.50);
+    stats.p95        = percentile(0.95);
+    stats.p99        = percentile(0.99);
+    stats.max        = frame_times.back();
+    return stats;
+}
+
+void CapsaicinInternal::setStutterThreshold(float thresholdMs) noexcept
+{
+    stutter_threshold_ = thresholdMs;
+    if (thresholdMs <= 0.0f)
+    {
+        stutter_events_.clear();
+    }
+}
+
+std::vector<ProfileFrame> CapsaicinInternal::getStutterEvents() const noexcept
+{
+    return std::vector<ProfileFrame>(stutter_events_.begin(), stutter_events_.end());
 }
 
 void CapsaicinInternal::renderGUI(bool readOnly)
@@ -1731,8 +3676,18 @@ void CapsaicinInternal::renderGUI(bool readOnly)
     ImGui::Text("  Delta Light Count       :  %u", deltaLightCount);
     ImGui::Text("  Environment Light Count :  %u", envLightCount);
     ImGui::Text("BVH Data Size             :  %.1f MiB", bvhDataSize / (1024.0 * 1024.0));
+    if (uint64_t const bvhSharedDataSize = getBvhSharedDataSize(); bvhSharedDataSize > 0)
+    {
+        ImGui::Text("  Shared BLAS Savings     :  %.1f MiB (%u instanced)",
+            bvhSharedDataSize / (1024.0 * 1024.0), (uint32_t)rt_primitive_owners_.size());
+    }
     ImGui::Text("Render Resolution         :  %ux%u", getWidth(), getHeight());
 
+    if (ImGui::CollapsingHeader("Memory"))
+    {
+        memory_budget_.renderGUI();
+    }
+
     if (!readOnly)
     {
         // Display renderer specific options
@@ -1826,6 +3781,12 @@ void CapsaicinInternal::renderGUI(bool readOnly)
             graphName.c_str(), 0.0f, FLT_MAX, ImVec2(150, 20));
         ImGui::PopID();
 
+        if (FrameStats const frameStats = getFrameStats(0); frameStats.frameCount > 1)
+        {
+            ImGui::Text("p50 %.2fms   p95 %.2fms   p99 %.2fms   max %.2fms", frameStats.p50,
+                frameStats.p95, frameStats.p99, frameStats.max);
+        }
+
         ImGui::PushID("Frame");
         text            = "Frame";
         additionalSpace = maxStringSize > text.size() ? maxStringSize - text.size() : 0;
@@ -1842,6 +3803,25 @@ void CapsaicinInternal::renderGUI(bool readOnly)
         ImGui::SameLine();
         ImGui::Text(std::to_string(frame_index_).c_str());
         ImGui::PopID();
+
+        // Constant allocator statistics used for sizing the per-frame pools
+        ImGui::Separator();
+        uint64_t large_pool_bytes = 0;
+        for (auto const &i : large_constant_buffers_)
+        {
+            large_pool_bytes += i.buffer.getSize();
+        }
+        ImGui::Text("Constant pool       : %.2f KiB/frame (peak %.2f KiB, %u regrows)",
+            (double)constant_buffer_last_usage_ / 1024.0, (double)constant_buffer_peak_usage_ / 1024.0,
+            constant_buffer_growth_count_);
+        ImGui::Text("Large allocations   : %.2f MiB/frame (%u pooled buffers, %.2f MiB)",
+            (double)constant_buffer_large_last_usage_ / (1024.0 * 1024.0),
+            (uint32_t)large_constant_buffers_.size(), (double)large_pool_bytes / (1024.0 * 1024.0));
+        if (!texture_stream_queue_.empty())
+        {
+            ImGui::Text(
+                "Texture streaming   : %u textures pending", (uint32_t)texture_stream_queue_.size());
+        }
     }
 
     if (!readOnly)
@@ -1876,6 +3856,22 @@ void CapsaicinInternal::terminate()
 {
     gfxFinish(gfx_); // flush & sync
 
+    // Wait for any in-flight pipelined update before tearing down the scene it references
+    syncPipelinedUpdate();
+
+    // Abandon any in-flight background scene load
+    if (pending_scene_load_.valid())
+    {
+        pending_scene_load_.wait();
+        pending_scene_load_ = {};
+        gfxDestroyScene(pending_scene_);
+        pending_scene_ = {};
+        pending_scene_files_.clear();
+    }
+
+    // Abandon any in-flight background renderer switch
+    cancelPendingRenderer();
+
     // Dump remaining buffers, they are all available after gfxFinish
     ThreadPool().Dispatch(
         [&](uint32_t buffer_index) {
@@ -1891,6 +3887,14 @@ void CapsaicinInternal::terminate()
         dump_in_flight_buffers_.pop_front();
     }
 
+    // Wait on any background encodes that still reference their readback buffer
+    while (!dump_encode_jobs_.empty())
+    {
+        dump_encode_jobs_.front().second.wait();
+        gfxDestroyBuffer(gfx_, dump_encode_jobs_.front().first);
+        dump_encode_jobs_.pop_front();
+    }
+
     gfxDestroyKernel(gfx_, blit_kernel_);
     gfxDestroyProgram(gfx_, blit_program_);
     gfxDestroyKernel(gfx_, debug_depth_kernel_);
@@ -1898,6 +3902,11 @@ void CapsaicinInternal::terminate()
     gfxDestroyProgram(gfx_, convolve_ibl_program_);
     gfxDestroyKernel(gfx_, dump_copy_to_buffer_kernel_);
     gfxDestroyProgram(gfx_, dump_copy_to_buffer_program_);
+    gfxDestroyKernel(gfx_, batch_clear_kernel_);
+    gfxDestroyKernel(gfx_, batch_backup_kernel_);
+    gfxDestroyProgram(gfx_, batch_clear_program_);
+    gfxDestroyKernel(gfx_, update_vertices_kernel_);
+    gfxDestroyProgram(gfx_, update_vertices_program_);
 
     gfxDestroyBuffer(gfx_, camera_matrices_buffer_[0]);
     gfxDestroyBuffer(gfx_, camera_matrices_buffer_[1]);
@@ -1905,6 +3914,7 @@ void CapsaicinInternal::terminate()
     gfxDestroyBuffer(gfx_, index_buffer_);
     gfxDestroyBuffer(gfx_, vertex_buffer_);
     gfxDestroyBuffer(gfx_, instance_buffer_);
+    gfxDestroyBuffer(gfx_, instance_packed_buffer_);
     gfxDestroyBuffer(gfx_, material_buffer_);
     gfxDestroyBuffer(gfx_, transform_buffer_);
     gfxDestroyBuffer(gfx_, instance_id_buffer_);
@@ -1918,6 +3928,11 @@ void CapsaicinInternal::terminate()
     gfxDestroySamplerState(gfx_, anisotropic_sampler_);
 
     gfxDestroyAccelerationStructure(gfx_, acceleration_structure_);
+    gfxDestroyAccelerationStructure(gfx_, stale_acceleration_structure_);
+    stale_acceleration_structure_ = {};
+    stale_raytracing_primitives_.clear();
+    pending_blas_builds_.clear();
+    rt_primitive_owners_.clear();
 
     for (auto &i : aov_buffers_)
     {
@@ -1926,6 +3941,14 @@ void CapsaicinInternal::terminate()
     aov_buffers_.clear();
     aov_backup_buffers_.clear();
     aov_clear_buffers_.clear();
+    aov_batch_clear_buffers_.clear();
+    aov_batch_backup_buffers_.clear();
+
+    for (auto &i : aov_texture_pool_)
+    {
+        gfxDestroyTexture(gfx_, i.second);
+    }
+    aov_texture_pool_.clear();
 
     debug_views_.clear();
 
@@ -1940,6 +3963,7 @@ void CapsaicinInternal::terminate()
         gfxDestroyTexture(gfx_, texture);
     }
     texture_atlas_.clear();
+    texture_stream_queue_.clear();
 
     for (GfxBuffer const &constant_buffer_pool : constant_buffer_pools_)
     {
@@ -1947,28 +3971,230 @@ void CapsaicinInternal::terminate()
     }
     memset(constant_buffer_pools_, 0, sizeof(constant_buffer_pools_));
 
+    for (auto const &large_constant_buffer : large_constant_buffers_)
+    {
+        gfxDestroyBuffer(gfx_, large_constant_buffer.buffer);
+    }
+    large_constant_buffers_.clear();
+
+    for (ConstantBlock const &constant_block : constant_blocks_)
+    {
+        for (GfxBuffer const &buffer : constant_block.buffers)
+        {
+            gfxDestroyBuffer(gfx_, buffer);
+        }
+    }
+    constant_blocks_.clear();
+    for (GfxBuffer const &constant_block_arena : constant_block_arenas_)
+    {
+        gfxDestroyBuffer(gfx_, constant_block_arena);
+    }
+    memset(constant_block_arenas_, 0, sizeof(constant_block_arenas_));
+    constant_block_arena_size_ = 0;
+
+    memory_budget_.clearPressureCallbacks(); // the registered owners are about to be destroyed
     render_techniques_.clear();
     components_.clear();
+    component_table_.clear();
     renderer_ = nullptr;
+    gpu_statistics_.terminate();
+    memory_budget_.terminate();
 
     gfxDestroyScene(scene_);
     scene_ = {};
 }
 
+/**
+ * Hashes the sizes and timestamps of all shader source files below the given directory.
+ * @param shader_path Root directory of the shader source tree.
+ * @returns A map from the file path (relative to the shader root, forward slashes) to its hash.
+ */
+static std::map<std::string, size_t> HashShaderSources(std::string const &shader_path) noexcept
+{
+    std::map<std::string, size_t> hashes;
+    std::error_code               ec;
+    for (auto const &entry : std::filesystem::recursive_directory_iterator(shader_path, ec))
+    {
+        if (!entry.is_regular_file(ec))
+        {
+            continue;
+        }
+        auto const extension = entry.path().extension();
+        if (extension != ".hlsl" && extension != ".comp" && extension != ".frag" && extension != ".vert"
+            && extension != ".geom" && extension != ".rt" && extension != ".h" && extension != ".inl")
+        {
+            continue;
+        }
+        size_t hash = 0x12345678u;
+        HashCombine(hash, (uint64_t)entry.file_size(ec));
+        HashCombine(hash, (uint64_t)entry.last_write_time(ec).time_since_epoch().count());
+        hashes.emplace(std::filesystem::relative(entry.path(), shader_path, ec).generic_string(), hash);
+    }
+    return hashes;
+}
+
+/**
+ * Parses the files included by a shader source file.
+ * Include paths are resolved against the directory of the including file and against the shader
+ * root, matching the search order used during compilation.
+ * @param shader_path  Root directory of the shader source tree.
+ * @param file         Path of the file to parse (relative to the shader root).
+ * @param shader_files All known shader files (relative to the shader root).
+ * @returns The included files (relative to the shader root).
+ */
+static std::vector<std::string> ParseShaderIncludes(std::string const &shader_path,
+    std::string const &file, std::map<std::string, size_t> const &shader_files) noexcept
+{
+    std::vector<std::string> includes;
+    std::ifstream            source(std::filesystem::path(shader_path) / file);
+    if (!source.is_open())
+    {
+        return includes;
+    }
+    std::string line;
+    while (std::getline(source, line))
+    {
+        size_t cursor = line.find_first_not_of(" \t");
+        if (cursor == std::string::npos || line[cursor] != '#')
+        {
+            continue;
+        }
+        cursor = line.find_first_not_of(" \t", cursor + 1);
+        if (cursor == std::string::npos || line.compare(cursor, 7, "include") != 0)
+        {
+            continue;
+        }
+        size_t const begin = line.find('"', cursor + 7);
+        size_t const end   = (begin != std::string::npos) ? line.find('"', begin + 1) : std::string::npos;
+        if (end == std::string::npos)
+        {
+            continue;
+        }
+        std::string const included = line.substr(begin + 1, end - begin - 1);
+
+        std::error_code ec;
+        auto const      relative =
+            (std::filesystem::path(file).parent_path() / included).lexically_normal().generic_string();
+        if (shader_files.find(relative) != shader_files.end())
+        {
+            includes.push_back(relative);
+        }
+        else if (auto const rooted = std::filesystem::path(included).lexically_normal().generic_string();
+                 shader_files.find(rooted) != shader_files.end())
+        {
+            includes.push_back(rooted);
+        }
+    }
+    return includes;
+}
+
 void CapsaicinInternal::reloadShaders() noexcept
 {
-    // Instead of just recompiling kernels we re-initialise all component/techniques. This has the side effect
-    // of not only recompiling kernels but also re-initialising old data that may no longer contain correct
-    // values
-    gfxFinish(gfx_); // flush & sync
+    // Determine which shader source files actually changed since the last compile, the driver-level
+    // shader cache cannot help here as re-initialisation also resets technique data
+    auto shader_source_hashes = HashShaderSources(shader_path_);
+
+    std::vector<std::string> changed_files;
+    for (auto const &[file, hash] : shader_source_hashes)
+    {
+        auto const previous = shader_source_hashes_.find(file);
+        if (previous == shader_source_hashes_.end() || previous->second != hash)
+        {
+            changed_files.push_back(file);
+        }
+    }
+    for (auto const &[file, hash] : shader_source_hashes_)
+    {
+        if (shader_source_hashes.find(file) == shader_source_hashes.end())
+        {
+            changed_files.push_back(file); // deleted files also dirty their includers
+        }
+    }
+    if (changed_files.empty())
+    {
+        return;
+    }
+    shader_source_hashes_ = std::move(shader_source_hashes);
 
-    // Reset the component/techniques
+    // Expand the changed set over the include graph so that a change to a shared header (math/,
+    // geometry/, ...) dirties every file that transitively includes it
+    std::map<std::string, std::vector<std::string>> includers;
+    for (auto const &[file, hash] : shader_source_hashes_)
+    {
+        for (auto const &included : ParseShaderIncludes(shader_path_, file, shader_source_hashes_))
+        {
+            includers[included].push_back(file);
+        }
+    }
+    std::unordered_set<std::string> dirty_files;
+    while (!changed_files.empty())
+    {
+        std::string const file = std::move(changed_files.back());
+        changed_files.pop_back();
+        if (!dirty_files.insert(file).second)
+        {
+            continue;
+        }
+        if (auto const i = includers.find(file); i != includers.end())
+        {
+            changed_files.insert(changed_files.end(), i->second.begin(), i->second.end());
+        }
+    }
+
+    // A component/technique is only affected if one of its declared shader directories contains a
+    // dirty file, anything else keeps its current kernels and GPU state (e.g. hash-grid contents)
+    auto const isAffected = [&dirty_files](ShaderDirectoryList const &directories) {
+        for (auto const &directory : directories)
+        {
+            if (directory.empty())
+            {
+                return !dirty_files.empty();
+            }
+            for (auto const &file : dirty_files)
+            {
+                if (file.size() > directory.size() && file.starts_with(directory)
+                    && file[directory.size()] == '/')
+                {
+                    return true;
+                }
+            }
+        }
+        return false;
+    };
+
+    std::vector<Component *>       affected_components;
+    std::vector<RenderTechnique *> affected_techniques;
     for (auto const &i : components_)
     {
-        i.second->setGfxContext(gfx_);
-        i.second->terminate();
+        if (isAffected(i.second->getShaderDirectories()))
+        {
+            affected_components.push_back(i.second.get());
+        }
     }
     for (auto const &i : render_techniques_)
+    {
+        if (isAffected(i->getShaderDirectories()))
+        {
+            affected_techniques.push_back(i.get());
+        }
+    }
+    if (affected_components.empty() && affected_techniques.empty())
+    {
+        return; // the changed files are not used by the active renderer
+    }
+
+    // Instead of just recompiling kernels we re-initialise the affected component/techniques. This
+    // has the side effect of not only recompiling kernels but also re-initialising old data that
+    // may no longer contain correct values
+    gfxFinish(gfx_); // flush & sync
+
+    // Reset the affected component/techniques
+    for (auto const &i : affected_components)
+    {
+        i->setGfxContext(gfx_);
+        i->terminate();
+    }
+    for (auto const &i : affected_techniques)
     {
         i->setGfxContext(gfx_);
         i->terminate();
@@ -1976,15 +4202,15 @@ void CapsaicinInternal::reloadShaders() noexcept
 
     resetRenderState();
 
-    // Re-initialise the components/techniques
-    for (auto const &i : components_)
+    // Re-initialise the affected components/techniques
+    for (auto const &i : affected_components)
     {
-        if (!i.second->init(*this))
+        if (!i->init(*this))
         {
-            GFX_PRINTLN("Error: Failed to initialise component: %s", i.first.data());
+            GFX_PRINTLN("Error: Failed to initialise component: %s", i->getName().data());
         }
     }
-    for (auto const &i : render_techniques_)
+    for (auto const &i : affected_techniques)
     {
         if (!i->init(*this))
         {
@@ -1993,8 +4219,24 @@ void CapsaicinInternal::reloadShaders() noexcept
     }
 }
 
+GfxTexture CapsaicinInternal::acquireAOVTexture(DXGI_FORMAT format) noexcept
+{
+    if (auto i = std::find_if(aov_texture_pool_.begin(), aov_texture_pool_.end(),
+            [format](auto const &item) { return item.first == format; });
+        i != aov_texture_pool_.end())
+    {
+        GfxTexture texture = i->second;
+        aov_texture_pool_.erase(i);
+        return texture;
+    }
+    return gfxCreateTexture2D(gfx_, format);
+}
+
 void CapsaicinInternal::setupRenderTechniques(std::string_view const &name) noexcept
 {
+    // Any in-flight background renderer switch is superseded by this synchronous one
+    cancelPendingRenderer();
+
     // Clear any existing AOVs
     for (auto &i : aov_buffers_)
     {
@@ -2002,25 +4244,32 @@ void CapsaicinInternal::setupRenderTechniques(std::string_view const &name) noex
     }
 
     // Delete any existing render techniques
+    memory_budget_.clearPressureCallbacks(); // the registered owners are about to be destroyed
     render_techniques_.clear();
+    frame_graph_.clear();
 
     gfxFinish(gfx_); // flush & sync
 
     // Delete old AOVS, debug views and buffers
     options_.clear();
     components_.clear();
+    component_table_.clear();
     for (auto &i : shared_buffers_)
     {
         gfxDestroyBuffer(gfx_, i.second);
     }
     shared_buffers_.clear();
+    // Retire the old AOV allocations into the pool instead of destroying them so the new renderer
+    // can alias the same memory for AOVs of matching format
     for (auto &i : aov_buffers_)
     {
-        gfxDestroyTexture(gfx_, i.second);
+        aov_texture_pool_.emplace_back(i.second.getFormat(), i.second);
     }
     aov_buffers_.clear();
     aov_backup_buffers_.clear();
     aov_clear_buffers_.clear();
+    aov_batch_clear_buffers_.clear();
+    aov_batch_backup_buffers_.clear();
     debug_views_.clear();
     debug_views_.emplace_back("None", nullptr);
     debug_view_    = "None";
@@ -2028,29 +4277,71 @@ void CapsaicinInternal::setupRenderTechniques(std::string_view const &name) noex
     renderer_      = nullptr;
     resetPlaybackState();
 
-    // Create the new renderer
-    renderer_ = RendererFactory::make(name);
-    if (renderer_)
+    // Create the new renderer and all of its modules
+    auto state = std::make_unique<PendingRendererState>();
+    if (!buildRendererModules(name, *state))
     {
-        render_techniques_ = std::move(renderer_->setupRenderTechniques(options_));
-        renderer_name_     = name;
+        return;
     }
-    else
+    adoptRendererModules(*state);
+
+    // If no scene currently loaded then delay initialisation till scene load
+    if (!!scene_)
+    {
+        // Initialise all components
+        for (auto const &i : components_)
+        {
+            i.second->setGfxContext(gfx_);
+            if (!i.second->init(*this))
+            {
+                GFX_PRINTLN("Error: Failed to initialise component: %s", i.first.data());
+            }
+        }
+
+        // Initialise all render techniques
+        for (auto const &i : render_techniques_)
+        {
+            i->setGfxContext(gfx_);
+            if (!i->init(*this))
+            {
+                GFX_PRINTLN("Error: Failed to initialise render technique: %s", i->getName().data());
+            }
+        }
+
+        // Reset flags as everything just got forced reset anyway
+        mesh_updated_              = false;
+        transform_updated_         = false;
+        environment_map_updated_   = false;
+        environment_map_recreated_ = false;
+        scene_updated_             = false;
+        camera_updated_            = false;
+    }
+}
+
+bool CapsaicinInternal::buildRendererModules(
+    std::string_view const &name, PendingRendererState &state) noexcept
+{
+    // Create the new renderer
+    state.renderer = RendererFactory::make(name);
+    if (!state.renderer)
     {
         GFX_PRINTLN("Error: Unknown renderer requested: %s", name.data());
-        return;
+        return false;
     }
+    state.name              = name;
+    state.render_techniques = std::move(state.renderer->setupRenderTechniques(state.options));
+    state.debug_views_list.emplace_back("None", nullptr);
 
     {
         // Get render technique options
-        for (auto const &i : render_techniques_)
+        for (auto const &i : state.render_techniques)
         {
-            options_.merge(i->getRenderOptions());
+            state.options.merge(i->getRenderOptions());
         }
 
         // Get requested components
         std::vector<std::string_view> requestedComponents;
-        for (auto const &i : render_techniques_)
+        for (auto const &i : state.render_techniques)
         {
             for (auto &j : i->getComponents())
             {
@@ -2070,7 +4361,7 @@ void CapsaicinInternal::setupRenderTechniques(std::string_view const &name) noex
             auto component = ComponentFactory::make(i);
             if (component)
             {
-                components_.try_emplace(i, std::move(component));
+                state.components.try_emplace(i, std::move(component));
             }
             else
             {
@@ -2084,9 +4375,9 @@ void CapsaicinInternal::setupRenderTechniques(std::string_view const &name) noex
             std::vector<std::string_view> newRequestedComponents;
             for (auto const &i : requestedComponents)
             {
-                for (auto &j : components_[i]->getComponents())
+                for (auto &j : state.components[i]->getComponents())
                 {
-                    if (!components_.contains(j)
+                    if (!state.components.contains(j)
                         && std::find(newRequestedComponents.cbegin(), newRequestedComponents.cend(), j)
                                == newRequestedComponents.cend())
                     {
@@ -2108,7 +4399,7 @@ void CapsaicinInternal::setupRenderTechniques(std::string_view const &name) noex
                 auto component = ComponentFactory::make(i);
                 if (component)
                 {
-                    components_.try_emplace(i, std::move(component));
+                    state.components.try_emplace(i, std::move(component));
                 }
                 else
                 {
@@ -2118,28 +4409,21 @@ void CapsaicinInternal::setupRenderTechniques(std::string_view const &name) noex
             std::swap(newRequestedComponents, requestedComponents);
         }
 
-        // Get component options
-        for (auto const &i : components_)
+        // Build the dense type-identifier-indexed component table used for frame-time lookups
+        state.component_table.clear();
+        state.component_table.resize(ComponentFactory::GetTypeCount());
+        for (auto const &i : state.components)
         {
-            options_.merge(i.second->getRenderOptions());
+            if (uint32_t const type_id = ComponentFactory::GetTypeId(i.first); type_id != UINT32_MAX)
+            {
+                state.component_table[type_id] = i.second;
+            }
         }
 
-        // Update render options based on passed in settings
-        // Loop through and update to any values stored in passed in render settings
-        for (auto &i : options_)
+        // Get component options
+        for (auto const &i : state.components)
         {
-            if (auto j = options_.find(i.first); j != options_.end())
-            {
-                if (j->second.index() == i.second.index())
-                {
-                    i.second = j->second;
-                }
-            }
-            else
-            {
-                // Update user version with required changed options
-                options_.emplace(i.first, i.second);
-            }
+            state.options.merge(i.second->getRenderOptions());
         }
     }
 
@@ -2152,7 +4436,7 @@ void CapsaicinInternal::setupRenderTechniques(std::string_view const &name) noex
 
         using bufferList = std::unordered_map<std::string_view, BufferParams>;
         bufferList requestedBuffers;
-        for (auto const &i : render_techniques_)
+        for (auto const &i : state.render_techniques)
         {
             for (auto &j : i->getBuffers())
             {
@@ -2164,7 +4448,7 @@ void CapsaicinInternal::setupRenderTechniques(std::string_view const &name) noex
                 }
             }
         }
-        for (auto const &i : components_)
+        for (auto const &i : state.components)
         {
             for (auto &j : i.second->getBuffers())
             {
@@ -2186,11 +4470,11 @@ void CapsaicinInternal::setupRenderTechniques(std::string_view const &name) noex
             bufferName += i.first;
             bufferName += "Buffer";
             buffer.setName(bufferName.c_str());
-            shared_buffers_.emplace_back(i.first, buffer);
+            state.shared_buffers.emplace_back(i.first, buffer);
         }
 
         // Initialise the Buffers
-        for (auto &i : shared_buffers_)
+        for (auto &i : state.shared_buffers)
         {
             gfxCommandClearBuffer(gfx_, i.second);
         }
@@ -2202,13 +4486,14 @@ void CapsaicinInternal::setupRenderTechniques(std::string_view const &name) noex
         {
             DXGI_FORMAT      format;
             AOV::Flags       flags;
-            std::string_view backup = std::string_view();
+            std::string_view backup    = std::string_view();
+            AOV::Precision   precision = AOV::Exact;
         };
 
         // We use 3 main default AOVs that are always available
         using aovList             = std::unordered_map<std::string_view, AOVParams>;
         const aovList defaultAOVs = {
-            {"Color", {DXGI_FORMAT_R16G16B16A16_FLOAT, AOV::Accumulate}},
+            {"Color", {DXGI_FORMAT_R16G16B16A16_FLOAT, AOV::Accumulate, std::string_view(), AOV::AtLeast}},
         };
         const aovList defaultOptionalAOVs = {
             {"Depth",         {DXGI_FORMAT_D32_FLOAT, AOV::Clear}},
@@ -2217,7 +4502,7 @@ void CapsaicinInternal::setupRenderTechniques(std::string_view const &name) noex
         aovList                                                requestedAOVs = defaultAOVs;
         std::unordered_map<std::string_view, std::string_view> backupAOVs;
         aovList                                                optionalAOVs;
-        for (auto const &i : render_techniques_)
+        for (auto const &i : state.render_techniques)
         {
             for (auto &j : i->getAOVs())
             {
@@ -2254,7 +4539,7 @@ void CapsaicinInternal::setupRenderTechniques(std::string_view const &name) noex
                     }
                     // Check if AOV is one of the optional default ones and add it using default values if not
                     // supplied
-                    AOVParams newParams = AOVParams {j.format, j.flags, j.backup_name};
+                    AOVParams newParams = AOVParams {j.format, j.flags, j.backup_name, j.precision};
                     if (auto const k = defaultOptionalAOVs.find(j.name); k != defaultOptionalAOVs.end())
                     {
                         if (newParams.format == DXGI_FORMAT_UNKNOWN)
@@ -2300,12 +4585,27 @@ void CapsaicinInternal::setupRenderTechniques(std::string_view const &name) noex
                     // Update existing format if it doesn't have one
                     if (found->second.format == DXGI_FORMAT_UNKNOWN)
                     {
-                        found->second.format = j.format;
+                        found->second.format    = j.format;
+                        found->second.precision = j.precision;
                     }
-                    // Validate that requested values match the existing ones
+                    // Negotiate the narrowest format satisfying both requested minimum precisions
                     else if (found->second.format != j.format && j.format != DXGI_FORMAT_UNKNOWN)
                     {
-                        GFX_PRINTLN("Error: Requested AOV with different formats: %s", j.name.data());
+                        if (DXGI_FORMAT const negotiated = NegotiateAOVFormat(
+                                found->second.format, found->second.precision, j.format, j.precision);
+                            negotiated != DXGI_FORMAT_UNKNOWN)
+                        {
+                            found->second.format = negotiated;
+                        }
+                        else
+                        {
+                            GFX_PRINTLN("Error: Requested AOV with different formats: %s", j.name.data());
+                        }
+                    }
+                    // An exact request pins the format against the global half-precision override
+                    if (j.precision == AOV::Exact && j.format != DXGI_FORMAT_UNKNOWN)
+                    {
+                        found->second.precision = AOV::Exact;
                     }
                     if (((j.flags & AOV::Clear) && (found->second.flags & AOV::Accumulate))
                         || ((j.flags & AOV::Accumulate) && (found->second.flags & AOV::Clear)))
@@ -2347,12 +4647,27 @@ void CapsaicinInternal::setupRenderTechniques(std::string_view const &name) noex
                 // Update existing format if it doesn't have one
                 if (j->second.format == DXGI_FORMAT_UNKNOWN)
                 {
-                    j->second.format = i.second.format;
+                    j->second.format    = i.second.format;
+                    j->second.precision = i.second.precision;
                 }
-                // Validate that requested values match the existing ones
+                // Negotiate the narrowest format satisfying both requested minimum precisions
                 else if (i.second.format != j->second.format && i.second.format != DXGI_FORMAT_UNKNOWN)
                 {
-                    GFX_PRINTLN("Error: Requested AOV with different formats: %s", i.first.data());
+                    if (DXGI_FORMAT const negotiated = NegotiateAOVFormat(
+                            j->second.format, j->second.precision, i.second.format, i.second.precision);
+                        negotiated != DXGI_FORMAT_UNKNOWN)
+                    {
+                        j->second.format = negotiated;
+                    }
+                    else
+                    {
+                        GFX_PRINTLN("Error: Requested AOV with different formats: %s", i.first.data());
+                    }
+                }
+                // An exact request pins the format against the global half-precision override
+                if (i.second.precision == AOV::Exact && i.second.format != DXGI_FORMAT_UNKNOWN)
+                {
+                    j->second.precision = AOV::Exact;
                 }
                 if (((i.second.flags & AOV::Clear) && (j->second.flags & AOV::Accumulate))
                     || ((i.second.flags & AOV::Accumulate) && (j->second.flags & AOV::Clear)))
@@ -2385,56 +4700,83 @@ void CapsaicinInternal::setupRenderTechniques(std::string_view const &name) noex
             }
         }
 
+        // Narrow negotiable float AOVs to the half-precision member of their format family unless
+        // some technique demanded the exact wider format. Colour/irradiance style AOVs dominate
+        // bandwidth at high resolutions so this trades precision for roughly half the traffic
+        if (half_precision_aovs_)
+        {
+            for (auto &i : requestedAOVs)
+            {
+                if (i.second.precision == AOV::AtLeast)
+                {
+                    i.second.format = GetHalfPrecisionAOVFormat(i.second.format);
+                }
+            }
+        }
+
         // Create all requested AOVs
         for (auto &i : requestedAOVs)
         {
             // Create new texture
-            GfxTexture  texture    = gfxCreateTexture2D(gfx_, i.second.format);
+            GfxTexture  texture    = acquireAOVTexture(i.second.format);
             std::string bufferName = "Capsaicin_";
             bufferName += i.first;
             bufferName += "AOV";
             texture.setName(bufferName.c_str());
-            aov_buffers_.emplace_back(i.first, texture);
+            state.aov_buffers.emplace_back(i.first, texture);
+
+            // UAV-compatible float4 formats can have their per-frame clears/backups batched into
+            // shared compute dispatches, other formats (e.g. depth) go through the per-texture path
+            bool const batchable = i.second.format == DXGI_FORMAT_R16G16B16A16_FLOAT
+                                || i.second.format == DXGI_FORMAT_R32G32B32A32_FLOAT;
 
             // Add to backup list
             if (!i.second.backup.empty())
             {
                 // Create new backup texture
-                GfxTexture texture2 = gfxCreateTexture2D(gfx_, i.second.format);
+                GfxTexture texture2 = acquireAOVTexture(i.second.format);
                 texture2.setName(i.second.backup.data());
-                aov_backup_buffers_.emplace_back(std::make_pair(texture, texture2));
+                (batchable ? state.aov_batch_backup_buffers : state.aov_backup_buffers)
+                    .emplace_back(std::make_pair(texture, texture2));
 
-                aov_buffers_.emplace_back(i.second.backup, texture2);
+                state.aov_buffers.emplace_back(i.second.backup, texture2);
             }
 
             // Add to clear list
             if (i.second.flags & AOV::Clear)
             {
-                aov_clear_buffers_.emplace_back(texture);
+                (batchable ? state.aov_batch_clear_buffers : state.aov_clear_buffers).emplace_back(texture);
             }
 
             // Add the AOV as a debug view (Using false to differentiate as AOV)
-            if (i.first != "Color" && i.first != "Debug") debug_views_.emplace_back(i.first, false);
+            if (i.first != "Color" && i.first != "Debug") state.debug_views_list.emplace_back(i.first, false);
         }
 
         // Initialise the AOVs
-        for (auto &i : aov_buffers_)
+        for (auto &i : state.aov_buffers)
         {
             gfxCommandClearTexture(gfx_, i.second);
         }
+
+        // Release any retired allocations the new renderer had no use for
+        for (auto &i : aov_texture_pool_)
+        {
+            gfxDestroyTexture(gfx_, i.second);
+        }
+        aov_texture_pool_.clear();
     }
 
     {
         // Get debug views
-        for (auto const &i : render_techniques_)
+        for (auto const &i : state.render_techniques)
         {
             for (auto &j : i->getDebugViews())
             {
                 auto k = std::find_if(
-                    debug_views_.begin(), debug_views_.end(), [j](auto val) { return val.first == j; });
-                if (k == debug_views_.end())
+                    state.debug_views_list.begin(), state.debug_views_list.end(), [j](auto val) { return val.first == j; });
+                if (k == state.debug_views_list.end())
                 {
-                    debug_views_.emplace_back(std::move(j), true);
+                    state.debug_views_list.emplace_back(std::move(j), true);
                 }
                 else if (!k->second)
                 {
@@ -2448,39 +4790,148 @@ void CapsaicinInternal::setupRenderTechniques(std::string_view const &name) noex
             }
         }
     }
+    return true;
+}
 
-    // If no scene currently loaded then delay initialisation till scene load
-    if (!!scene_)
+void CapsaicinInternal::adoptRendererModules(PendingRendererState &state) noexcept
+{
+    renderer_          = std::move(state.renderer);
+    renderer_name_     = state.name;
+    render_techniques_ = std::move(state.render_techniques);
+    // Build the dependency graph from the techniques' declared AOV/buffer accesses so that
+    // independent techniques can be identified during rendering
+    frame_graph_.build(render_techniques_);
+    components_      = std::move(state.components);
+    component_table_ = std::move(state.component_table);
+
+    // Carry over any values already set for options shared with the previous renderer
+    for (auto &i : state.options)
     {
-        // Initialise all components
-        for (auto const &i : components_)
+        if (auto j = options_.find(i.first); j != options_.end() && j->second.index() == i.second.index())
         {
-            i.second->setGfxContext(gfx_);
-            if (!i.second->init(*this))
+            i.second = j->second;
+        }
+    }
+    options_ = std::move(state.options);
+
+    shared_buffers_           = std::move(state.shared_buffers);
+    aov_buffers_              = std::move(state.aov_buffers);
+    aov_backup_buffers_       = std::move(state.aov_backup_buffers);
+    aov_clear_buffers_        = std::move(state.aov_clear_buffers);
+    aov_batch_clear_buffers_  = std::move(state.aov_batch_clear_buffers);
+    aov_batch_backup_buffers_ = std::move(state.aov_batch_backup_buffers);
+    debug_views_              = std::move(state.debug_views_list);
+}
+
+bool CapsaicinInternal::stepRendererWarmup() noexcept
+{
+    auto        &state          = *pending_renderer_state_;
+    size_t const componentCount = state.components.size();
+    size_t const moduleCount    = componentCount + state.render_techniques.size();
+    if (state.warmup_index < moduleCount)
+    {
+        // Initialise a single module per frame (components first as techniques may depend on them)
+        // so the current renderer keeps presenting while the new one warms up. Shader compilation is
+        // the dominant cost of a renderer switch and happens inside init(). The warming flag makes
+        // resource lookups performed by the module resolve against the pending state
+        renderer_warming_up_ = true;
+        if (state.warmup_index < componentCount)
+        {
+            auto const i =
+                std::next(state.components.begin(), static_cast<ptrdiff_t>(state.warmup_index));
+            i->second->setGfxContext(gfx_);
+            if (!i->second->init(*this))
             {
-                GFX_PRINTLN("Error: Failed to initialise component: %s", i.first.data());
+                GFX_PRINTLN("Error: Failed to initialise component: %s", i->first.data());
             }
         }
-
-        // Initialise all render techniques
-        for (auto const &i : render_techniques_)
+        else
         {
+            auto const &i = state.render_techniques[state.warmup_index - componentCount];
             i->setGfxContext(gfx_);
             if (!i->init(*this))
             {
                 GFX_PRINTLN("Error: Failed to initialise render technique: %s", i->getName().data());
             }
         }
+        renderer_warming_up_ = false;
+        ++state.warmup_index;
+    }
+    return state.warmup_index >= moduleCount;
+}
 
-        // Reset flags as everything just got forced reset anyway
-        mesh_updated_            = false;
-        transform_updated_       = false;
-        environment_map_updated_ = false;
-        scene_updated_           = false;
-        camera_updated_          = false;
+void CapsaicinInternal::swapPendingRenderer() noexcept
+{
+    auto const state = std::move(pending_renderer_state_);
+
+    // Retire the previous renderer. This mirrors the teardown in setupRenderTechniques() except that
+    // the new AOVs already exist (both sets were alive during warm-up) so the old allocations cannot
+    // be aliased and are destroyed instead of being retired into the texture pool
+    memory_budget_.clearPressureCallbacks(); // the registered owners are about to be destroyed
+    render_techniques_.clear();
+    frame_graph_.clear();
+
+    gfxFinish(gfx_); // flush & sync
+
+    components_.clear();
+    component_table_.clear();
+    for (auto &i : shared_buffers_)
+    {
+        gfxDestroyBuffer(gfx_, i.second);
+    }
+    shared_buffers_.clear();
+    for (auto &i : aov_buffers_)
+    {
+        gfxDestroyTexture(gfx_, i.second);
+    }
+    aov_buffers_.clear();
+    aov_backup_buffers_.clear();
+    aov_clear_buffers_.clear();
+    aov_batch_clear_buffers_.clear();
+    aov_batch_backup_buffers_.clear();
+    debug_views_.clear();
+    debug_view_    = "None";
+    renderer_name_ = "";
+    renderer_      = nullptr;
+    resetPlaybackState();
+    frameGraph.reset();
+
+    adoptRendererModules(*state);
+
+    // Reset flags as all modules were initialised against the current scene during warm-up
+    mesh_updated_              = false;
+    transform_updated_         = false;
+    environment_map_updated_   = false;
+    environment_map_recreated_ = false;
+    scene_updated_             = false;
+    camera_updated_            = false;
+}
+
+void CapsaicinInternal::cancelPendingRenderer() noexcept
+{
+    if (pending_renderer_state_ == nullptr)
+    {
+        return;
+    }
+    auto const state = std::move(pending_renderer_state_);
+
+    gfxFinish(gfx_); // flush & sync, initialised modules may have in-flight work
+
+    // Module destructors terminate anything that was already initialised
+    state->render_techniques.clear();
+    state->components.clear();
+    state->component_table.clear();
+    for (auto &i : state->shared_buffers)
+    {
+        gfxDestroyBuffer(gfx_, i.second);
+    }
+    for (auto &i : state->aov_buffers)
+    {
+        gfxDestroyTexture(gfx_, i.second);
     }
 }
 
+
 void CapsaicinInternal::resetPlaybackState() noexcept
 {
     // Reset frame index
@@ -2494,6 +4945,10 @@ void CapsaicinInternal::resetPlaybackState() noexcept
 
 void CapsaicinInternal::resetRenderState() noexcept
 {
+    // A deferred acceleration structure rebuild cannot straddle a state reset, finish it now so the
+    // complete structure is the one carried forward
+    processDeferredBlasBuilds(UINT64_MAX);
+
     // Reset frame index to signal component/techniques an initialisation is required/occurred
     frame_index_ = 0;
 
@@ -2505,6 +4960,10 @@ void CapsaicinInternal::resetRenderState() noexcept
         {
             gfxCommandClearTexture(gfx_, i.second);
         }
+        for (auto &i : aov_batch_backup_buffers_)
+        {
+            gfxCommandClearTexture(gfx_, i.second);
+        }
     }
 }
 
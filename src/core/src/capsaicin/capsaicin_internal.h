@@ -21,12 +21,20 @@ THE SOFTWARE.
 ********************************************************************/
 #pragma once
 
+#include "capsaicin.h"
+#include "frame_graph.h"
 #include "gpu_shared.h"
 #include "graph.h"
+#include "memory_budget.h"
 #include "renderer.h"
+#include "utilities/frame_arena.h"
+#include "utilities/gpu_statistics.h"
 
+#include <array>
 #include <deque>
+#include <future>
 #include <gfx_imgui.h>
+#include <map>
 #include <gfx_scene.h>
 
 namespace Capsaicin
@@ -43,6 +51,17 @@ public:
     GfxScene    getScene() const;
     uint32_t    getWidth() const;
     uint32_t    getHeight() const;
+
+    /**
+     * Get the display (window/back buffer) resolution.
+     * This matches getWidth()/getHeight() unless the TAA temporal upscaler is active, in which case
+     * AOVs and lighting are rendered at the reduced internal resolution in the top-left region of the
+     * (display sized) buffers and TAA reconstructs the display resolution output.
+     * @return The display width/height in pixels.
+     */
+    uint32_t getDisplayWidth() const noexcept;
+    uint32_t getDisplayHeight() const noexcept;
+
     char const *getShaderPath() const;
 
     /**
@@ -100,6 +119,22 @@ public:
      */
     bool getFixedFrameRate() const noexcept;
 
+    /**
+     * Enable or disable pipelined scene updates.
+     * When enabled the next frame's animation evaluation and change detection hashing run on a
+     * worker thread while the current frame executes on the GPU. Only fixed frame rate playback is
+     * predictable enough to advance the scene ahead of time; otherwise frames fall back to the
+     * regular inline update.
+     * @param enabled True to overlap the CPU scene update with GPU execution.
+     */
+    void setPipelinedUpdate(bool enabled) noexcept;
+
+    /**
+     * Query if pipelined scene updates are enabled.
+     * @return True if the CPU scene update is overlapped with GPU execution.
+     */
+    bool getPipelinedUpdate() const noexcept;
+
     /**
      * Restart playback to start of animation.
      */
@@ -198,12 +233,58 @@ public:
      */
     bool getEnvironmentMapUpdated() const noexcept;
 
+    /**
+     * Check if the environment buffer itself was recreated this frame (scene load or environment
+     * map change), as opposed to a technique having regenerated its contents via
+     * @queueEnvironmentMapUpdate().
+     * @return True if the environment buffer was recreated.
+     */
+    bool getEnvironmentMapRecreated() const noexcept;
+
+    /**
+     * Queue the environment-map-updated flag to be raised at the start of the next frame.
+     * Used by render techniques that regenerate the environment buffer (e.g. atmosphere) so that
+     * consumers running earlier in the frame (IBL prefiltering, light building) re-run.
+     */
+    void queueEnvironmentMapUpdate() noexcept;
+
     /**
      * Gets the list of currently available AOVs.
      * @returns The AOV list.
      */
     std::vector<std::string_view> getAOVs() const noexcept;
 
+    /**
+     * Gets the dependency graph built from the render techniques' declared AOV/buffer accesses.
+     * @returns The frame graph for the current renderer.
+     */
+    FrameGraph const &getFrameGraph() const noexcept;
+
+    /**
+     * Gets the central video memory tracker.
+     * Subsystems can report their resident sizes and register pressure callbacks so caches can be
+     * shrunk cooperatively before the driver starts paging.
+     * @returns The memory budget manager.
+     */
+    MemoryBudget &getMemoryBudget() noexcept;
+
+    /**
+     * Gets the central GPU statistics service.
+     * Techniques and components can register named counters written GPU-side that are streamed
+     * back through a single per-frame copy and polled without stalling.
+     * @returns The GPU statistics service.
+     */
+    GPUStatistics &getGpuStatistics() noexcept;
+
+    /**
+     * Gets the per-frame CPU arena allocator.
+     * The arena is reset at the start of every frame; techniques should back frame-local scratch
+     * containers with it (see @FrameVector / @FrameString) instead of hitting the heap on hot
+     * paths. Anything allocated from it must not outlive the frame.
+     * @returns The frame arena.
+     */
+    FrameArena &getFrameArena() noexcept;
+
     /**
      * Query if a AOV buffer currently exists.
      * @param aov The AOV to search for.
@@ -256,13 +337,26 @@ public:
 
     /**
      * Gets an shared component and casts to requested type.
+     * Frame-time access is a dense array index using the type identifier assigned by the
+     * ComponentFactory at registration, no string lookup or RTTI is involved.
      * @tparam T The type of component cast.
      * @returns The requested component or nullptr if not found.
      */
     template<typename T>
     std::shared_ptr<T> const getComponent() const noexcept
     {
-        return std::dynamic_pointer_cast<T>(getComponent(static_cast<std::string_view>(toStaticString<T>())));
+        uint32_t const type_id = ComponentFactory::Registrar<T>::typeID;
+        if (renderer_warming_up_ && type_id < pending_renderer_state_->component_table.size()
+            && pending_renderer_state_->component_table[type_id] != nullptr)
+        {
+            // Modules of a renderer being warmed up must resolve to the pending component instances
+            return std::static_pointer_cast<T>(pending_renderer_state_->component_table[type_id]);
+        }
+        if (type_id < component_table_.size())
+        {
+            return std::static_pointer_cast<T>(component_table_[type_id]);
+        }
+        return nullptr;
     }
 
     /**
@@ -284,6 +378,23 @@ public:
      */
     bool setRenderer(std::string_view const &name) noexcept;
 
+    /**
+     * Begins switching to the requested renderer asynchronously.
+     * The new renderer's techniques and components are created immediately but their initialisation
+     * (including shader compilation, the dominant cost of a renderer switch) is amortised over
+     * subsequent frames while the current renderer continues to be rendered. Once every module has
+     * been initialised the swap is performed atomically during a later call to render().
+     * @param name The name of the renderer to set (must be one of the options from GetRenderers()).
+     * @returns True if the switch was started (or the renderer is already active), False otherwise.
+     */
+    bool setRendererAsync(std::string_view const &name) noexcept;
+
+    /**
+     * Check if an asynchronous renderer switch is currently in flight.
+     * @return True if a new renderer is still being warmed up.
+     */
+    bool getRendererLoading() const noexcept;
+
     /**
      * Gets the currently set scene.
      * @returns The current scene name.
@@ -297,6 +408,22 @@ public:
      */
     bool setScenes(std::vector<std::string> const &names) noexcept;
 
+    /**
+     * Begins loading the requested scenes asynchronously.
+     * The scene files are imported on a background thread while the currently loaded scene (if any)
+     * continues to be rendered. Once the import has completed the new scene is swapped in during the
+     * next call to render().
+     * @param names The names of the scene files.
+     * @returns True if the load was started (or the scenes are already loaded), False otherwise.
+     */
+    bool setScenesAsync(std::vector<std::string> const &names) noexcept;
+
+    /**
+     * Check if an asynchronous scene load is currently in flight.
+     * @return True if a background scene load has not yet completed.
+     */
+    bool getSceneLoading() const noexcept;
+
     /**
      * Gets the list of cameras available in the current scene.
      * @returns The cameras list.
@@ -354,6 +481,14 @@ public:
      */
     bool setDebugView(std::string_view const &name) noexcept;
 
+    /**
+     * Marks the back buffer as already written for the current frame.
+     * @note Called by a render technique that outputs directly into the back buffer (e.g. a fused
+     * tone map + blit pass) so that the final blit of the colour AOV can be skipped. The flag is
+     * reset at the start of every frame and has no effect while a debug view is active.
+     */
+    void setBackBufferWritten() noexcept;
+
     /**
      * Gets render options currently in use.
      * @returns The render options.
@@ -501,7 +636,16 @@ public:
      */
     uint64_t getBvhDataSize() const noexcept;
 
+    /**
+     * Gets the acceleration structure memory saved by sharing BLASes between instances (in bytes).
+     * Instances referencing the same mesh share a single BLAS through instanced raytracing
+     * primitives; this returns the size the deduplicated copies would otherwise occupy.
+     * @returns The number of bytes saved by BLAS sharing.
+     */
+    uint64_t getBvhSharedDataSize() const noexcept;
+
     GfxBuffer        getInstanceBuffer() const;
+    GfxBuffer        getInstancePackedBuffer() const;
     Instance const  *getInstanceData() const;
     Instance        *getInstanceData();
     glm::vec3 const *getInstanceMinBounds() const;
@@ -542,6 +686,8 @@ public:
 
     /**
      * Calculate and return the AABB surrounding current scene contents.
+     * @note The bounds are cached internally and only recalculated when instance transforms or
+     * meshes have changed, so calling this every frame is cheap.
      * @returns The scene bounds (min, max).
      */
     std::pair<float3, float3> getSceneBounds() const;
@@ -556,6 +702,71 @@ public:
 
     GfxBuffer allocateConstantBuffer(uint64_t size);
 
+    /**
+     * Register a fixed-size per-frame constant block with the shared frame constants arena.
+     * All registered blocks live at fixed offsets inside one persistently mapped upload buffer per
+     * back buffer, so per-frame updates are plain writes through the mapping and the bindable
+     * buffer ranges are created once instead of being re-allocated every frame. Registering an
+     * already registered name returns the existing block, so registration is safe to repeat across
+     * technique re-initialisation.
+     * @tparam TYPE The type of the block contents.
+     * @param name Unique name identifying the block.
+     * @returns Handle to pass to getConstantBlockBuffer().
+     */
+    template<typename TYPE>
+    uint32_t registerConstantBlock(std::string_view const &name)
+    {
+        return registerConstantBlock(name, sizeof(TYPE), (uint32_t)sizeof(TYPE));
+    }
+
+    uint32_t registerConstantBlock(std::string_view const &name, uint64_t size, uint32_t stride);
+
+    /**
+     * Get the GPU buffer backing a registered constant block for the current frame.
+     * The returned range targets the arena for the current back buffer and is reused across frames;
+     * it must not be destroyed by the caller. Contents are written through gfxBufferGetData() and
+     * must be fully rewritten each frame before the first GPU use of the block.
+     * @param constant_block The handle returned by registerConstantBlock().
+     * @returns The buffer range covering the block inside the current frame's arena.
+     */
+    GfxBuffer getConstantBlockBuffer(uint32_t constant_block);
+
+    /**
+     * Upload only the given element ranges of a CPU array into a GPU buffer.
+     * The dirty ranges are packed contiguously into a single pooled staging allocation and copied
+     * across with one copy command per range, so sparse updates of large buffers avoid re-uploading
+     * the whole buffer.
+     * @tparam TYPE The type of buffer elements.
+     * @param buffer The destination GPU buffer.
+     * @param data   The source CPU array (indexed with the same element indices as the buffer).
+     * @param ranges The (first element, element count) ranges to upload.
+     */
+    template<typename TYPE>
+    void uploadBufferRanges(GfxBuffer const &buffer, TYPE const *data,
+        std::vector<std::pair<uint32_t, uint32_t>> const &ranges)
+    {
+        uint32_t total_count = 0;
+        for (auto const &range : ranges)
+        {
+            total_count += range.second;
+        }
+        if (total_count == 0)
+        {
+            return;
+        }
+        GfxBuffer staging_buffer = allocateConstantBuffer<TYPE>(total_count);
+        TYPE     *staging_data   = (TYPE *)gfxBufferGetData(gfx_, staging_buffer);
+        uint32_t  staging_cursor = 0;
+        for (auto const &range : ranges)
+        {
+            memcpy(staging_data + staging_cursor, data + range.first, range.second * sizeof(TYPE));
+            gfxCommandCopyBuffer(gfx_, buffer, (uint64_t)range.first * sizeof(TYPE), staging_buffer,
+                (uint64_t)staging_cursor * sizeof(TYPE), (uint64_t)range.second * sizeof(TYPE));
+            staging_cursor += range.second;
+        }
+        gfxDestroyBuffer(gfx_, staging_buffer);
+    }
+
     /**
      * Initializes Capsaicin. Must be called before any other functions.
      * @param gfx The gfx context to use inside Capsaicin.
@@ -568,6 +779,14 @@ public:
      */
     void render();
 
+    /**
+     * Renders a batch of frames back to back without presenting, for headless/offscreen use.
+     * @param frame_count    The number of frames to render.
+     * @param dump_aov       AOV to dump once the final frame completes (empty for none).
+     * @param dump_file_path Full pathname to the file to save the dumped AOV as.
+     */
+    void renderBatch(uint32_t frame_count, std::string_view const &dump_aov, char const *dump_file_path);
+
     /**
      * Render UI elements related to current internal state
      * Must be called between ImGui::Begin() and ImGui::End().
@@ -591,6 +810,97 @@ public:
      */
     void dumpAOVBuffer(char const *file_path, std::string_view const &aov);
 
+    /**
+     * Checks whether a dump of the given AOV buffer has been requested for the current frame.
+     * Techniques can use this to keep an AOV valid when it is about to be saved to disk.
+     * @param aov The buffer to check for.
+     * @return True if a dump request targeting the buffer is pending.
+     */
+    bool hasAOVDumpRequest(std::string_view const &aov) const noexcept;
+
+    /**
+     * Sets whether dumped EXR images are written using half-precision channel data.
+     * Halves encode time and file size at the cost of precision.
+     * @param enable True to encode EXR channels as half floats.
+     */
+    void setDumpHalfPrecisionEXR(bool enable) noexcept;
+
+    /**
+     * Sets whether negotiable float AOVs are narrowed to half precision.
+     * Only AOVs whose requesting techniques declared their format as a minimum (AOV::AtLeast) are
+     * affected, exact format requests are always honoured. If a renderer is currently loaded it is
+     * rebuilt asynchronously so the new formats take effect.
+     * @param enable True to narrow negotiable AOVs to the half-precision member of their family.
+     */
+    void setHalfPrecisionAOVs(bool enable) noexcept;
+
+    /**
+     * Gets whether negotiable float AOVs are narrowed to half precision.
+     * @returns True if half-precision AOVs are enabled.
+     */
+    bool getHalfPrecisionAOVs() const noexcept;
+
+    /**
+     * Gets the profiling results for the most recently rendered frames.
+     * @returns The profiled frames in increasing frame order.
+     */
+    std::vector<ProfileFrame> getProfileData() const noexcept;
+
+    /**
+     * Gets the profiling results for the most recently rendered frame only.
+     * @returns The profiled frame (empty if nothing has been rendered yet).
+     */
+    ProfileFrame getLastProfileFrame() const noexcept;
+
+    /**
+     * Gets frame-time statistics over a sliding window of the profiling history.
+     * @param window The number of recent frames to cover (0 uses the full available history).
+     * @returns The calculated statistics (zeroed if nothing has been rendered yet).
+     */
+    FrameStats getFrameStats(uint32_t window) const noexcept;
+
+    /**
+     * Sets the frame-time threshold above which a frame is recorded as a stutter event.
+     * @param thresholdMs The threshold (ms), 0 disables stutter tracking.
+     */
+    void setStutterThreshold(float thresholdMs) noexcept;
+
+    /**
+     * Gets the frames that exceeded the stutter threshold with their technique breakdown.
+     * @returns The offending frames in increasing frame order.
+     */
+    std::vector<ProfileFrame> getStutterEvents() const noexcept;
+
+    /**
+     * Saves the current profiling history to disk using the Chrome trace event format.
+     * @param file_path Full pathname to the .json file to save as.
+     * @returns True if successful, False otherwise.
+     */
+    bool dumpProfileTrace(char const *file_path) noexcept;
+
+    /**
+     * Starts recording the per-frame camera state (including the jitter sequence).
+     * Any previously recorded or loaded camera path is discarded.
+     */
+    void startCameraPathRecording() noexcept;
+
+    /**
+     * Stops recording and saves the recorded camera path to disk.
+     * @param file_path Full pathname to the file to save as.
+     * @returns True if successful, False otherwise.
+     */
+    bool stopCameraPathRecording(char const *file_path) noexcept;
+
+    /**
+     * Loads a camera path from disk and starts replaying it from its first frame.
+     * @param file_path Full pathname to the file to load.
+     * @returns True if successful, False otherwise.
+     */
+    bool startCameraPathReplay(char const *file_path) noexcept;
+
+    /** Stops any current camera path replay and returns control to the interactive camera. */
+    void stopCameraPathReplay() noexcept;
+
     /**
      * Saves an texture to disk.
      * @param file_path   Full pathname to the file to save as.
@@ -613,6 +923,97 @@ private:
      */
     void setupRenderTechniques(std::string_view const &name) noexcept;
 
+    struct PendingRendererState;
+
+    /**
+     * Creates the renderer, techniques, components, shared buffers and AOVs for the requested
+     * renderer into the passed in state without touching the currently active renderer.
+     * This only performs resource creation, no technique or component is initialised.
+     * @param name  Name of the renderer to create.
+     * @param state The state to populate.
+     * @returns True if the renderer was successfully created, False otherwise.
+     */
+    bool buildRendererModules(std::string_view const &name, PendingRendererState &state) noexcept;
+
+    /**
+     * Installs a fully built renderer state as the active renderer.
+     * The previous renderer's state must already have been torn down.
+     * @param state The state to install (left empty).
+     */
+    void adoptRendererModules(PendingRendererState &state) noexcept;
+
+    /**
+     * Initialises the next uninitialised module of the pending renderer (components first, then
+     * techniques).
+     * @returns True once all pending modules have been initialised, False otherwise.
+     */
+    bool stepRendererWarmup() noexcept;
+
+    /** Swaps the fully warmed up pending renderer in, retiring the previous one. */
+    void swapPendingRenderer() noexcept;
+
+    /** Abandons any in-flight background renderer switch and releases its resources. */
+    void cancelPendingRenderer() noexcept;
+
+    /**
+     * Gets an AOV texture of the requested format, reusing a retired pooled allocation if one exists.
+     * @param format The format of the requested texture.
+     * @returns The new or recycled texture.
+     */
+    GfxTexture acquireAOVTexture(DXGI_FORMAT format) noexcept;
+
+    /**
+     * Re-flattens the CPU index/vertex arrays from the current scene contents.
+     * The flattened copies are released once the GPU geometry buffers have been built (they double the
+     * geometry footprint on large scenes) so this is used to rebuild them on-demand for the rare CPU
+     * consumer of getIndexData()/getVertexData().
+     */
+    void flattenGeometryData() const;
+
+    /**
+     * Generates the simplified detail levels used for distance based LOD selection.
+     * The simplified index lists are appended behind the base data in the flattened geometry arrays
+     * (sharing the base vertex data) and a mesh_data_ entry is added per level so instances can swap
+     * detail by swapping their mesh index. Must be called on the freshly flattened arrays before the
+     * GPU geometry buffers are created.
+     */
+    void generateMeshLODs();
+
+    /**
+     * Builds a simplified index list for a single mesh by clustering its vertices onto a uniform grid.
+     * The clustering is deterministic so regenerating a level always reproduces the same index list.
+     * @param mesh_index      Index within mesh_data_ of the full-detail mesh to simplify.
+     * @param grid_resolution Number of grid cells across the mesh bounds, lower values simplify more.
+     * @param lod_indices     Receives the simplified index list (indices are mesh local).
+     */
+    void buildMeshLODIndices(
+        uint32_t mesh_index, uint32_t grid_resolution, std::vector<uint32_t> &lod_indices) const;
+
+    /**
+     * Creates a new blank scene containing only the default user camera.
+     * @returns The new scene (null scene if creation failed).
+     */
+    GfxScene createBlankScene() noexcept;
+
+    /**
+     * Imports the requested scene files into the passed in scene.
+     * This only performs CPU side import operations and so is safe to call from a background thread.
+     * @param scene The scene to import into.
+     * @param names The names of the scene files.
+     * @returns True if all scene files were successfully imported, False otherwise.
+     */
+    bool importScenes(GfxScene scene, std::vector<std::string> const &names) noexcept;
+
+    /**
+     * Replaces the currently loaded scene with an already imported one.
+     * Tears down any state tied to the old scene, selects the active camera and re-initialises all
+     * components/techniques against the new scene.
+     * @param scene The fully imported scene to adopt.
+     * @param names The names of the scene files the scene was imported from.
+     * @returns True if successful, False otherwise.
+     */
+    bool swapLoadedScenes(GfxScene scene, std::vector<std::string> const &names) noexcept;
+
     /**
      * Reset current frame index and duration state.
      * This should be called whenever and renderer or scene changes are made.
@@ -624,6 +1025,9 @@ private:
      */
     void resetRenderState() noexcept;
 
+    /** Records this frame's component/technique timings into the profiling history. */
+    void gatherProfileData() noexcept;
+
     void dumpBuffer(char const *file_path, GfxTexture dump_buffer);
     void saveImage(GfxBuffer dump_buffer, uint32_t dump_buffer_width, uint32_t dump_buffer_height,
         char const *file_path);
@@ -636,23 +1040,54 @@ private:
 
     size_t mesh_hash_               = 0;
     size_t transform_hash_          = 0;
+    std::vector<size_t> mesh_hashes_;       /**< Per-mesh hashes used for refit-vs-rebuild detection */
+    std::vector<size_t> mesh_shape_hashes_; /**< Per-mesh topology hashes (vertex/index counts) */
     bool   was_resized_             = false;
     bool   mesh_updated_            = true;
     bool   transform_updated_       = true;
     bool   environment_map_updated_ = true;
+    bool   environment_map_recreated_ =
+        true; /**< Whether the environment buffer itself was recreated this frame */
+    bool   environment_map_update_queued_ =
+        false; /**< Whether a technique regenerated the environment buffer this frame */
     bool   scene_updated_           = true;
     bool   camera_updated_          = true;
 
     GfxContext  gfx_; /**< The graphics context to be used. */
     std::string shader_path_;
-    uint32_t    buffer_width_  = 0;
+    std::map<std::string, size_t>
+        shader_source_hashes_; /**< Per-file hash of the shader source tree at last compile */
+    uint32_t    buffer_width_  = 0; /**< Internal render resolution (scaled when upscaling is active) */
     uint32_t    buffer_height_ = 0;
+    uint32_t    display_width_  = 0; /**< Display (back buffer) resolution */
+    uint32_t    display_height_ = 0;
 
     GfxScene    scene_; /**< The scene to be rendered. */
     GfxTexture  environment_buffer_;
     std::vector<std::string> scene_files_;
     std::string environment_map_file_;
 
+    std::future<bool>        pending_scene_load_;  /**< Pending background scene import (if any) */
+    GfxScene                 pending_scene_;       /**< Scene being populated by the background import */
+    std::vector<std::string> pending_scene_files_; /**< Scene files used by the pending import */
+
+    /** Results of a background scene update advanced to the next frame's playback position */
+    struct PipelinedUpdate
+    {
+        double              play_time = 0.0;   /**< The playback position the scene was advanced to */
+        bool                animation = false; /**< True if any animations were applied */
+        size_t              mesh_hash = 0;     /**< Combined hash of all mesh data */
+        std::vector<size_t> mesh_hashes;       /**< Per-mesh hashes (indexed by mesh index) */
+        size_t              transform_hash = 0; /**< Combined hash of all instance data */
+    };
+
+    bool pipelined_update_enabled_ = false;   /**< Overlap the next frame's CPU scene update with
+                                                   the current frame's GPU execution */
+    std::future<PipelinedUpdate> pipelined_update_; /**< In-flight background scene update (if any) */
+
+    /** Joins any in-flight background scene update before the scene is modified externally. */
+    void syncPipelinedUpdate() noexcept;
+
     uint32_t frame_index_        = 0;   /**< Current frame number (incremented each render call) */
     uint32_t jitter_frame_index_ = ~0u; /**< Current jitter frame number */
     double   current_time_       = 0.0; /**< Current wall clock time used for timing (seconds) */
@@ -675,14 +1110,21 @@ private:
 
     std::vector<std::unique_ptr<RenderTechnique>>
         render_techniques_; /**< The list of render techniques to be applied. */
+    FrameGraph frame_graph_; /**< Dependency graph over the render techniques built from their
+                                  declared AOV/buffer accesses. */
     std::map<std::string_view /*name*/, std::shared_ptr<Component>>
                               components_;         /**< The list of render techniques to be applied. */
+    std::vector<std::shared_ptr<Component>>
+        component_table_; /**< Dense view of @components_ indexed by ComponentFactory type identifier,
+                               used for frame-time lookups. */
     std::string_view          renderer_name_;      /**< Currently used renderer string name */
     std::unique_ptr<Renderer> renderer_ = nullptr; /**< Currently used renderer */
     using debug_views                   = std::vector<std::pair<std::string_view, bool>>;
     debug_views      debug_views_; /**< List of available debug views */
     std::string_view debug_view_;  /**< The debug view to use (get available from GetDebugViews() -
                                                "None" or empty for default behaviour) */
+    bool back_buffer_written_ = false; /**< True if a render technique has already written the back
+                                               buffer this frame (skips the final colour blit). */
 
     GfxKernel  blit_kernel_;  /**< The kernel to blit the color buffer to the back buffer. */
     GfxProgram blit_program_; /**< The program to blit the color buffer to the back buffer. */
@@ -696,48 +1138,245 @@ private:
     aov_buffer aov_buffers_;        /**< The list of AOVs populated by the render techniques. */
     aov_backup aov_backup_buffers_; /**< The list of AOVS to backup each frame */
     aov_clear  aov_clear_buffers_;  /**< List of buffers to clear each frame */
+    aov_clear  aov_batch_clear_buffers_;  /**< UAV-compatible AOVs cleared in batched dispatches */
+    aov_backup aov_batch_backup_buffers_; /**< UAV-compatible AOV backups copied in batched dispatches */
+    std::vector<std::pair<DXGI_FORMAT, GfxTexture>>
+        aov_texture_pool_; /**< Retired AOV allocations reused by format on renderer switches */
+    bool half_precision_aovs_ = false; /**< True to narrow negotiable float AOVs to half precision */
+    GfxProgram batch_clear_program_; /**< Program used to batch AOV clears/backups into single dispatches */
+    GfxKernel  batch_clear_kernel_;
+    GfxKernel  batch_backup_kernel_;
+    GfxProgram update_vertices_program_; /**< Program used to expand animated vertices on the GPU */
+    GfxKernel  update_vertices_kernel_;
     using shared_buffer = std::vector<std::pair<std::string_view, GfxBuffer>>;
     shared_buffer shared_buffers_; /**< The list of buffers populated by the render techniques. */
+
+    /** State for a renderer being switched to in the background by setRendererAsync(). */
+    struct PendingRendererState
+    {
+        std::string_view          name;     /**< Name of the renderer being switched to */
+        std::unique_ptr<Renderer> renderer; /**< The new renderer */
+        std::vector<std::unique_ptr<RenderTechnique>> render_techniques; /**< Its render techniques */
+        std::map<std::string_view, std::shared_ptr<Component>> components; /**< Its components */
+        std::vector<std::shared_ptr<Component>>
+                         component_table; /**< Dense type-identifier-indexed view of @components */
+        RenderOptionList options;         /**< Options requested by the new techniques/components */
+        aov_buffer    aov_buffers;    /**< Its AOVs (both sets are alive until the swap) */
+        aov_backup    aov_backup_buffers;
+        aov_clear     aov_clear_buffers;
+        aov_clear     aov_batch_clear_buffers;
+        aov_backup    aov_batch_backup_buffers;
+        shared_buffer shared_buffers;
+        debug_views   debug_views_list;
+        size_t warmup_index = 0; /**< Number of modules (components then techniques) initialised */
+    };
+
+    std::unique_ptr<PendingRendererState> pending_renderer_state_; /**< In-flight renderer switch */
+    bool renderer_warming_up_ = false; /**< True while a pending module is being initialised, makes
+                                          resource lookups resolve against the pending state */
     GfxBuffer     constant_buffer_pools_[kGfxConstant_BackBufferCount];
     uint64_t      constant_buffer_pool_cursor_ = 0;
 
+    static constexpr uint64_t kLargeConstantBufferSize =
+        64 * 1024; /**< Allocations of at least this size bypass the bump pool */
+
+    /** A pooled buffer used to service large transient constant allocations. */
+    struct ConstantBufferSizeClass
+    {
+        GfxBuffer buffer;          /**< The pooled buffer (power of 2 size class) */
+        uint64_t  last_used_frame; /**< Value of constant_buffer_frame_ when last handed out */
+    };
+
+    std::vector<ConstantBufferSizeClass>
+             large_constant_buffers_;     /**< Size-class pool for large transient allocations, an
+                                               entry is reclaimed once its last frame has left the GPU */
+    uint64_t constant_buffer_frame_ = 0;  /**< Monotonic frame counter used for pool reclamation */
+    uint64_t constant_buffer_frame_usage_ = 0; /**< Bump pool bytes allocated so far this frame */
+    uint64_t constant_buffer_last_usage_  = 0; /**< Bump pool bytes allocated over the last frame */
+    uint64_t constant_buffer_peak_usage_  = 0; /**< Largest per-frame bump pool usage seen */
+    uint64_t constant_buffer_large_frame_usage_ = 0; /**< Large allocation bytes this frame */
+    uint64_t constant_buffer_large_last_usage_  = 0; /**< Large allocation bytes over the last frame */
+    uint32_t constant_buffer_growth_count_ = 0; /**< Number of times the bump pool had to regrow */
+
+    /** A fixed-size per-frame constant block registered with registerConstantBlock(). */
+    struct ConstantBlock
+    {
+        std::string name;       /**< Unique name the block was registered under */
+        uint64_t    offset = 0; /**< Byte offset of the block within each arena buffer */
+        uint64_t    size   = 0; /**< Size of the block contents in bytes */
+        uint32_t    stride = 0; /**< Stride applied to the returned buffer ranges */
+        GfxBuffer   buffers[kGfxConstant_BackBufferCount]; /**< Lazily created per back buffer ranges */
+    };
+
+    /**
+     * Get a registered constant block, lazily (re)creating the current back buffer's arena and the
+     * block's buffer range if registration invalidated them.
+     * @param constant_block The handle returned by registerConstantBlock().
+     * @returns The registered block with its range for the current back buffer valid.
+     */
+    ConstantBlock &ensureConstantBlock(uint32_t constant_block);
+
+    std::vector<ConstantBlock> constant_blocks_; /**< The registered per-frame constant blocks */
+    GfxBuffer constant_block_arenas_[kGfxConstant_BackBufferCount]; /**< Persistently mapped arenas
+                                         holding all registered blocks at fixed offsets */
+    uint64_t  constant_block_arena_size_ = 0; /**< Total registered bytes, arenas are rebuilt lazily
+                                                 after registration grows this */
+
     GfxBuffer                camera_matrices_buffer_[2]; /**< Unjittered and jittered camera matrices */
     std::vector<Instance>    instance_data_;
     GfxBuffer                instance_buffer_;
+    std::vector<InstancePacked> instance_packed_data_; /**< Per-instance records combining the hot
+                                      Instance and Mesh fields for single fetch hit shader lookups */
+    GfxBuffer                instance_packed_buffer_;
     std::vector<glm::vec3>   instance_min_bounds_;
     std::vector<glm::vec3>   instance_max_bounds_;
+    mutable std::pair<float3, float3> scene_bounds_; /**< Cached scene AABB returned by getSceneBounds() */
+    mutable bool scene_bounds_dirty_ = true; /**< True if @scene_bounds_ must be recalculated */
     std::vector<uint32_t>    instance_id_data_;
     GfxBuffer                instance_id_buffer_;
     std::vector<glm::mat4x3> transform_data_;
     GfxBuffer                transform_buffer_;
     std::vector<glm::mat4x3> prev_transform_data_;
+    std::vector<std::pair<uint32_t, uint32_t>>
+        transform_dirty_ranges_; /**< Transform ranges changed by the last transform update, consumed
+                                    by the next frame's history upload */
     GfxBuffer                prev_transform_buffer_;
     std::vector<Material>    material_data_;
     GfxBuffer                material_buffer_;
     std::vector<GfxTexture>  texture_atlas_;
+
+    static constexpr uint32_t kTextureStreamingPlaceholderSize =
+        256; /**< Maximum dimension of the low-resolution placeholder uploaded at scene load */
+    static constexpr uint64_t kTextureStreamingBytesPerFrame =
+        32 * 1024 * 1024; /**< Upload budget for streaming full-resolution textures each frame */
+
+    /** A scene texture still represented by its low-resolution placeholder. */
+    struct StreamedTexture
+    {
+        GfxConstRef<GfxImage> image;       /**< The source image to upload */
+        uint32_t              image_index; /**< Index of the destination within texture_atlas_ */
+    };
+
+    std::deque<StreamedTexture> texture_stream_queue_; /**< Textures awaiting their full-resolution
+                                                            upload, processed in load order */
     GfxSamplerState          linear_sampler_;
     GfxSamplerState          linear_wrap_sampler_;
     GfxSamplerState          nearest_sampler_;
     GfxSamplerState          anisotropic_sampler_;
     std::vector<Mesh>        mesh_data_;
     GfxBuffer                mesh_buffer_;
-    std::vector<uint32_t>    index_data_;
-    GfxBuffer                index_buffer_; /**< The buffer storing all indices so it can be access via RT. */
-    std::vector<Vertex>      vertex_data_;
+    mutable std::vector<uint32_t> index_data_; /**< CPU copy of the index data, released after the GPU
+                                      buffers are built and lazily rebuilt by getIndexData(). */
+    GfxBuffer index_buffer_; /**< The buffer storing all indices so it can be access via RT. */
+    mutable std::vector<Vertex> vertex_data_; /**< CPU copy of the vertex data, released after the GPU
+                                      buffers are built and lazily rebuilt by getVertexData(). */
     GfxBuffer vertex_buffer_; /**< The buffer storing all vertices so it can be access via RT. */
     GfxAccelerationStructure            acceleration_structure_;
     std::vector<GfxRaytracingPrimitive> raytracing_primitives_;
+    std::map<uint32_t, uint32_t> rt_primitive_owners_; /**< Instances whose raytracing primitive is an
+                                       instanced reference to another instance's BLAS (clone -> owner),
+                                       deduplicating identical BLASes across instances of a mesh */
     uint32_t                            sbt_stride_in_entries_[kGfxShaderGroupType_Count] = {};
 
+    /** A BLAS build deferred by a runtime scene rebuild, replayed in budgeted per-frame batches. */
+    struct PendingBlasBuild
+    {
+        uint32_t instance_index; /**< Index into @raytracing_primitives_ */
+        uint32_t index_offset;   /**< First index in the shared index buffer */
+        uint32_t index_count;    /**< Number of indices to build over */
+        uint32_t vertex_offset;  /**< First vertex in the shared vertex buffer */
+        uint32_t vertex_count;   /**< Number of vertices referenced */
+        uint32_t build_flags;    /**< Raytracing primitive build flags */
+    };
+
+    /**
+     * Run a budgeted batch of the BLAS builds deferred by a runtime geometry rebuild.
+     * Ray traced passes keep tracing the previous acceleration structure until the last batch has
+     * completed, at which point the new structure is finalised and swapped in and the stale one is
+     * released.
+     * @param triangle_budget Maximum number of triangles to build this call (UINT64_MAX to drain).
+     */
+    void processDeferredBlasBuilds(uint64_t triangle_budget);
+
+    std::vector<PendingBlasBuild> pending_blas_builds_; /**< BLAS builds still to be run, drained
+                                       back to front by processDeferredBlasBuilds() */
+    GfxAccelerationStructure stale_acceleration_structure_; /**< The previous acceleration structure,
+                                       kept traceable while deferred BLAS builds complete */
+    std::vector<GfxRaytracingPrimitive> stale_raytracing_primitives_; /**< TLAS entries of the stale
+                                       structure, kept so moved instances still update their transform
+                                       there instead of freezing until the swap */
+    static constexpr uint64_t kDeferredBlasTrianglesPerFrame =
+        1000000; /**< Per-frame triangle budget for deferred BLAS builds */
+
+    static constexpr uint32_t kMeshLODCount = 3; /**< Number of detail levels per mesh (including LOD0) */
+    static constexpr uint32_t kMeshLODGridResolutions[kMeshLODCount - 1] = {
+        48, 16}; /**< Vertex clustering grid resolution used to build each simplified level */
+    static constexpr uint32_t kMeshLODMinTriangles =
+        1024; /**< Meshes below this triangle count are never simplified */
+    static constexpr float kMeshLODThresholds[kMeshLODCount - 1] = {
+        0.2f, 0.05f}; /**< Screen coverage (bounding radius over distance) below which each
+                           successive level is selected */
+
+    /** Per-mesh table of the mesh_data_ entries holding each detail level, indexed by base mesh.
+     * Entry 0 is the full-detail mesh itself; levels that brought no reduction repeat the previous
+     * entry. */
+    std::vector<std::array<uint32_t, kMeshLODCount>> mesh_lod_table_;
+
+    /** Per-instance state driving distance based LOD selection, indexed by instance handle. */
+    struct InstanceLOD
+    {
+        uint32_t base_mesh_index; /**< mesh_data_ index of the instance's full-detail mesh */
+        uint32_t current_lod;     /**< Detail level currently selected for draws and the BLAS */
+        uint32_t build_flags;     /**< Raytracing primitive build flags captured at scene build */
+        bool     locked;          /**< True if the instance must stay at full detail (e.g. emissive
+                                       instances feeding area light sampling) */
+    };
+
+    std::vector<InstanceLOD> instance_lods_;
+
     // Scene statistics for currently loaded scene
     uint32_t triangle_count_ = 0;
 
     Graph frameGraph; /**< The stored frame history graph */
 
+    MemoryBudget memory_budget_; /**< Central video memory accounting and pressure tracking */
+
+    GPUStatistics gpu_statistics_; /**< Central non-blocking GPU counter readback service */
+
+    FrameArena frame_arena_; /**< Per-frame linear CPU allocator reset at the start of each frame */
+
+    static constexpr uint32_t kProfileHistorySize = 256; /**< Number of frames of profiling history kept */
+    std::deque<ProfileFrame>  profile_history_;          /**< Ring buffer of per-frame profiling results */
+
+    static constexpr uint32_t kStutterEventLogSize = 64; /**< Number of stutter events kept */
+    float                    stutter_threshold_ = 0.0f; /**< Frame time (ms) above which a frame is logged */
+    std::deque<ProfileFrame> stutter_events_;           /**< Ring buffer of frames that broke the threshold */
+
+    /** Per-frame camera state captured for deterministic record/replay */
+    struct CameraPathFrame
+    {
+        glm::vec3 eye;         /**< Camera position */
+        glm::vec3 center;      /**< Camera look-at position */
+        glm::vec3 up;          /**< Camera up vector */
+        float     aspect;      /**< Aspect ratio */
+        float     fovY;        /**< Vertical field of view */
+        float     nearZ;       /**< Near clip distance */
+        float     farZ;        /**< Far clip distance */
+        uint32_t  jitterIndex; /**< Jitter sequence index used for the frame */
+    };
+
+    std::vector<CameraPathFrame> camera_path_;  /**< The recorded/loaded camera path */
+    bool     camera_path_recording_ = false;    /**< True while recording the camera path */
+    bool     camera_path_replaying_ = false;    /**< True while replaying the camera path */
+    uint32_t camera_path_position_  = 0;        /**< Next frame to replay from the camera path */
+
     std::deque<std::tuple<std::string /*fileName*/, std::string /*AOV*/>>        dump_requests_;
     std::deque<std::tuple<std::string /*fileName*/, bool /*jitterred*/>>         dump_camera_requests_;
     std::deque<std::tuple<GfxBuffer, uint32_t, uint32_t, std::string, uint32_t>> dump_in_flight_buffers_;
-    GfxKernel                                                                    dump_copy_to_buffer_kernel_;
-    GfxProgram                                                                   dump_copy_to_buffer_program_;
+    std::deque<std::pair<GfxBuffer, std::future<void>>> dump_encode_jobs_; /**< Background image encodes
+                                                      whose readback buffer is still referenced */
+    bool       dump_exr_half_precision_ = false; /**< True to encode dumped EXRs as half floats */
+    GfxKernel  dump_copy_to_buffer_kernel_;
+    GfxProgram dump_copy_to_buffer_program_;
 };
 } // namespace Capsaicin
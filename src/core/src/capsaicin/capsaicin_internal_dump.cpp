@@ -21,23 +21,213 @@ THE SOFTWARE.
 ********************************************************************/
 #include "capsaicin_internal.h"
 
+#include "thread_pool.h"
+
+#include <algorithm>
+#include <cstring>
 #include <fstream>
 #include <sstream>
 #include <tinyexr.h>
 #include <stb_image_write.h>
 
+#if defined(__AVX2__)
+#    include <immintrin.h>
+#endif
+
 namespace Capsaicin
 {
+namespace
+{
+constexpr uint32_t kCameraPathMagic   = 0x31504343u; /**< "CCP1" */
+constexpr uint32_t kCameraPathVersion = 1;           /**< Current camera path file version */
+
+/**
+ * Convert a row of RGBA float pixels to tightly packed RGB8, clamping to [0,1].
+ * Uses an 8-wide AVX2 path when available with a scalar fallback for the remainder (and for builds
+ * without AVX2 enabled).
+ * @param source      The row of RGBA float pixels to convert.
+ * @param dest        The destination RGB8 row (3 bytes per pixel).
+ * @param pixel_count The number of pixels in the row.
+ */
+inline void QuantizeRowRGB8(float const *source, unsigned char *dest, uint32_t pixel_count) noexcept
+{
+    uint32_t pixel = 0;
+#if defined(__AVX2__)
+    __m256 const  zero        = _mm256_setzero_ps();
+    __m256 const  one         = _mm256_set1_ps(1.f);
+    __m256 const  scale       = _mm256_set1_ps(255.f);
+    __m256i const pixel_order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+    __m256i const rgb_shuffle = _mm256_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1,
+        0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1);
+    auto const    quantize8   = [&](__m256 const values) {
+        return _mm256_cvttps_epi32(
+            _mm256_mul_ps(_mm256_min_ps(_mm256_max_ps(values, zero), one), scale));
+    };
+    for (; pixel + 8 <= pixel_count; pixel += 8)
+    {
+        float const  *src = source + 4ULL * pixel;
+        __m256i const i0  = quantize8(_mm256_loadu_ps(src + 0));
+        __m256i const i1  = quantize8(_mm256_loadu_ps(src + 8));
+        __m256i const i2  = quantize8(_mm256_loadu_ps(src + 16));
+        __m256i const i3  = quantize8(_mm256_loadu_ps(src + 24));
+        // Narrowing to bytes interleaves the two 128bit lanes, so restore pixel order before
+        // compacting RGBA to RGB within each lane
+        __m256i packed = _mm256_packus_epi16(_mm256_packs_epi32(i0, i1), _mm256_packs_epi32(i2, i3));
+        packed         = _mm256_permutevar8x32_epi32(packed, pixel_order);
+        packed         = _mm256_shuffle_epi8(packed, rgb_shuffle);
+        // Each lane now holds 12 valid bytes, stored as 8+4 to avoid writing past the row
+        unsigned char *dst  = dest + 3ULL * pixel;
+        __m128i const  lo   = _mm256_castsi256_si128(packed);
+        __m128i const  hi   = _mm256_extracti128_si256(packed, 1);
+        int32_t        tail = _mm_extract_epi32(lo, 2);
+        _mm_storel_epi64((__m128i *)dst, lo);
+        memcpy(dst + 8, &tail, sizeof(tail));
+        tail = _mm_extract_epi32(hi, 2);
+        _mm_storel_epi64((__m128i *)(dst + 12), hi);
+        memcpy(dst + 20, &tail, sizeof(tail));
+    }
+#endif
+    for (; pixel < pixel_count; ++pixel)
+    {
+        for (uint32_t channel = 0; channel < 3; ++channel)
+        {
+            dest[3 * pixel + channel] =
+                (unsigned char)glm::floor(glm::clamp(source[4 * pixel + channel], 0.f, 1.f) * 255.f);
+        }
+    }
+}
+} // namespace
+
 void CapsaicinInternal::dumpAOVBuffer(char const *file_path, std::string_view const &aov)
 {
     dump_requests_.push_back({file_path, std::string(aov)});
 }
 
+bool CapsaicinInternal::hasAOVDumpRequest(std::string_view const &aov) const noexcept
+{
+    return std::any_of(dump_requests_.cbegin(), dump_requests_.cend(),
+        [&aov](auto const &request) { return std::get<1>(request) == aov; });
+}
+
 void CapsaicinInternal::dumpCamera(char const *file_path, bool jittered)
 {
     dump_camera_requests_.push_back({file_path, jittered});
 }
 
+void CapsaicinInternal::setDumpHalfPrecisionEXR(bool enable) noexcept
+{
+    dump_exr_half_precision_ = enable;
+}
+
+void CapsaicinInternal::startCameraPathRecording() noexcept
+{
+    camera_path_.clear();
+    camera_path_recording_ = true;
+    camera_path_replaying_ = false;
+    camera_path_position_  = 0;
+}
+
+bool CapsaicinInternal::stopCameraPathRecording(char const *file_path) noexcept
+{
+    camera_path_recording_ = false;
+    std::ofstream file(file_path, std::ios::binary);
+    if (!file.is_open())
+    {
+        GFX_PRINT_ERROR(kGfxResult_InternalError, "Can't write to '%s'", file_path);
+        return false;
+    }
+    uint32_t const header[] = {kCameraPathMagic, kCameraPathVersion, (uint32_t)camera_path_.size()};
+    file.write((char const *)header, sizeof(header));
+    file.write((char const *)camera_path_.data(), camera_path_.size() * sizeof(CameraPathFrame));
+    return file.good();
+}
+
+bool CapsaicinInternal::startCameraPathReplay(char const *file_path) noexcept
+{
+    std::ifstream file(file_path, std::ios::binary);
+    if (!file.is_open())
+    {
+        GFX_PRINT_ERROR(kGfxResult_InternalError, "Can't open '%s'", file_path);
+        return false;
+    }
+    uint32_t header[3] = {};
+    file.read((char *)header, sizeof(header));
+    if (!file.good() || header[0] != kCameraPathMagic || header[1] != kCameraPathVersion)
+    {
+        GFX_PRINT_ERROR(kGfxResult_InternalError, "Invalid camera path file '%s'", file_path);
+        return false;
+    }
+    std::vector<CameraPathFrame> camera_path(header[2]);
+    file.read((char *)camera_path.data(), camera_path.size() * sizeof(CameraPathFrame));
+    if (!file.good())
+    {
+        GFX_PRINT_ERROR(kGfxResult_InternalError, "Invalid camera path file '%s'", file_path);
+        return false;
+    }
+    camera_path_           = std::move(camera_path);
+    camera_path_recording_ = false;
+    camera_path_replaying_ = !camera_path_.empty();
+    camera_path_position_  = 0;
+    return camera_path_replaying_;
+}
+
+void CapsaicinInternal::stopCameraPathReplay() noexcept
+{
+    camera_path_replaying_ = false;
+}
+
+bool CapsaicinInternal::dumpProfileTrace(char const *json_file_path) noexcept
+{
+    std::ofstream json_file(json_file_path);
+    if (!json_file.is_open())
+    {
+        GFX_PRINT_ERROR(kGfxResult_InternalError, "Can't write to '%s'", json_file_path);
+        return false;
+    }
+
+    bool first = true;
+
+    // Timestamps/durations are in microseconds, GPU scopes go on tid 0 and CPU scopes on tid 1
+    auto const writeEvent = [&](std::string_view const &name, uint32_t tid, double start_ms,
+                                double duration_ms, uint32_t frame_index) {
+        if (!first)
+        {
+            json_file << ",\n";
+        }
+        first = false;
+        json_file << "    {\"name\": \"" << name << "\", \"ph\": \"X\", \"pid\": 0, \"tid\": " << tid
+                  << ", \"ts\": " << start_ms * 1000.0 << ", \"dur\": " << duration_ms * 1000.0
+                  << ", \"args\": {\"frame\": " << frame_index << "}}";
+    };
+
+    // Scope start times are reconstructed by laying the recorded durations out sequentially, which
+    // matches submission order as passes execute back to back on the queue
+    json_file << "[\n";
+    double frame_start = 0.0;
+    for (auto const &frame : profile_history_)
+    {
+        double gpu_cursor = frame_start;
+        double cpu_cursor = frame_start;
+        for (auto const &node : frame.nodes)
+        {
+            writeEvent(node.name, 0, gpu_cursor, node.gpuTime, frame.frameIndex);
+            double child_cursor = gpu_cursor;
+            for (auto const &child : node.children)
+            {
+                writeEvent(child.first, 0, child_cursor, child.second, frame.frameIndex);
+                child_cursor += child.second;
+            }
+            writeEvent(node.name, 1, cpu_cursor, node.cpuTime, frame.frameIndex);
+            gpu_cursor += node.gpuTime;
+            cpu_cursor += node.cpuTime;
+        }
+        frame_start += std::max((double)frame.frameTime,
+            std::max(gpu_cursor - frame_start, cpu_cursor - frame_start));
+    }
+    json_file << "\n]" << std::endl;
+    return true;
+}
+
 void CapsaicinInternal::dumpAnyBuffer(char const *file_path, GfxTexture dump_buffer)
 {
     const GfxCommandEvent command_event(gfx_, "Dump '%s'", dump_buffer.getName());
@@ -111,7 +301,8 @@ void CapsaicinInternal::saveEXR(
         channel_info.name[0] = channel_name;
         channel_info.name[1] = '\0';
         pixel_types.push_back(TINYEXR_PIXELTYPE_FLOAT);
-        requested_pixel_types.push_back(TINYEXR_PIXELTYPE_FLOAT);
+        requested_pixel_types.push_back(
+            dump_exr_half_precision_ ? TINYEXR_PIXELTYPE_HALF : TINYEXR_PIXELTYPE_FLOAT);
     }
 
     EXRHeader exr_header;
@@ -130,6 +321,7 @@ void CapsaicinInternal::saveEXR(
 
     std::vector<std::vector<float>> image_channels;
     std::vector<unsigned char *>    images;
+    std::vector<int>                channel_offsets;
     for (char channel_name : channel_names)
     {
         int dump_channel_offset = 0;
@@ -142,14 +334,28 @@ void CapsaicinInternal::saveEXR(
         }
 
         auto &image_channel = image_channels.emplace_back();
-        image_channel.resize(image_pixel_count * sizeof(float));
+        image_channel.resize(image_pixel_count);
         images.push_back((unsigned char *)&image_channel[0]);
-        for (size_t pixel_index = 0; pixel_index < image_pixel_count; ++pixel_index)
-        {
-            image_channel[pixel_index] = dump_buffer_data[4 * pixel_index + dump_channel_offset];
-        }
+        channel_offsets.push_back(dump_channel_offset);
     }
 
+    // Deinterleave rows across the thread pool, a single pass over the source fills every plane
+    ThreadPool().Dispatch(
+        [&](uint32_t row) noexcept {
+            float const *source = dump_buffer_data + 4ULL * row * image_width;
+            size_t const offset = (size_t)row * image_width;
+            for (size_t channel = 0; channel < image_channels.size(); ++channel)
+            {
+                float *const plane               = image_channels[channel].data() + offset;
+                int const    dump_channel_offset = channel_offsets[channel];
+                for (uint32_t pixel_index = 0; pixel_index < image_width; ++pixel_index)
+                {
+                    plane[pixel_index] = source[4 * pixel_index + dump_channel_offset];
+                }
+            }
+        },
+        image_height);
+
     EXRImage exr_image;
     InitEXRImage(&exr_image);
     exr_image.num_channels = channel_count;
@@ -178,25 +384,21 @@ void CapsaicinInternal::saveJPG(
     GfxBuffer dump_buffer, uint32_t dump_buffer_width, uint32_t dump_buffer_height, char const *jpg_file_path)
 {
     // Image
-    float const   *dump_buffer_data  = (float *)gfxBufferGetData(gfx_, dump_buffer);
-    const uint32_t image_width       = dump_buffer_width;
-    const uint32_t image_height      = dump_buffer_height;
-    const uint32_t image_pixel_count = dump_buffer_width * dump_buffer_height;
+    float const   *dump_buffer_data = (float *)gfxBufferGetData(gfx_, dump_buffer);
+    const uint32_t image_width      = dump_buffer_width;
+    const uint32_t image_height     = dump_buffer_height;
 
+    // Quantize rows in parallel straight into the encoder buffer (the encoder consumes the whole
+    // image at once so the RGB8 buffer is the only CPU-side allocation)
     std::vector<unsigned char> image_data;
     image_data.resize((size_t)image_width * image_height * 3);
 
-    for (size_t pixel_index = 0; pixel_index < image_pixel_count; ++pixel_index)
-    {
-        auto quantize = [dump_buffer_data, pixel_index](uint32_t channel_offset) {
-            return (unsigned char)glm::floor(
-                glm::clamp(dump_buffer_data[4 * pixel_index + channel_offset], 0.f, 1.f) * 255.f);
-        };
-
-        image_data[3 * pixel_index + 0] = quantize(0);
-        image_data[3 * pixel_index + 1] = quantize(1);
-        image_data[3 * pixel_index + 2] = quantize(2);
-    }
+    ThreadPool().Dispatch(
+        [&](uint32_t row) noexcept {
+            QuantizeRowRGB8(dump_buffer_data + 4ULL * row * image_width,
+                image_data.data() + 3ULL * row * image_width, image_width);
+        },
+        image_height);
 
     int ret = stbi_write_jpg(jpg_file_path, image_width, image_height, 3, image_data.data(), 90);
     if (ret == 0)
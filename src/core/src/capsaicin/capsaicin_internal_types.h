@@ -21,8 +21,8 @@ THE SOFTWARE.
 ********************************************************************/
 #pragma once
 
+#include <algorithm>
 #include <dxgiformat.h>
-#include <map>
 #include <string_view>
 #include <variant>
 #include <vector>
@@ -57,6 +57,16 @@ struct AOV
 
     const std::string_view backup_name =
         std::string_view(); /**< The name to identify the AOV backup (blank if no backup required) */
+
+    enum Precision
+    {
+        Exact = 0, /**< The requested format must be used exactly as given */
+        AtLeast,   /**< The requested format is a minimum precision; the framework may substitute a
+                      wider format of the same channel layout requested by another technique, or
+                      narrow full float formats to half when half-precision AOVs are globally
+                      enabled */
+    } precision = Exact; /**< How strictly the requested format must be honoured (ignored when the
+                            format is unknown) */
 };
 
 using AOVList = std::vector<AOV>;
@@ -84,6 +94,21 @@ using BufferList = std::vector<Buffer>;
 
 using ComponentList = std::vector<std::string_view>;
 
+using ShaderDirectoryList = std::vector<std::string_view>;
+
+/**
+ * The GPU queue that a component/render technique's work should be scheduled on.
+ * Work flagged as async compute is recorded as a contiguous fenced region: its inputs must be ready
+ * when the region starts and its outputs are only read after the region completes, so the whole
+ * region can be moved onto a separate compute queue and overlapped with unrelated direct queue work
+ * (e.g. ALU-heavy grid builds alongside the geometry-bound visibility buffer raster pass).
+ */
+enum class QueueAffinity : uint32_t
+{
+    Direct = 0,   /**< Record on the main direct queue in submission order (default) */
+    AsyncCompute, /**< Compute-only work eligible for execution on an async compute queue */
+};
+
 /**
  * A macro for easy creation of render options from a struct.
  * @param  variable The member variable name.
@@ -102,6 +127,125 @@ using ComponentList = std::vector<std::string_view>;
 
 #define COMPONENT_MAKE(type) ComponentFactory::Registrar<type>::registeredName<>
 
-using option           = std::variant<bool, uint32_t, int32_t, float>;
-using RenderOptionList = std::map<std::string_view, option>;
+using option = std::variant<bool, uint32_t, int32_t, float>;
+
+/**
+ * Flat hashed storage for render options.
+ * Options are stored contiguously in insertion order and indexed through a sorted list of
+ * precomputed name hashes, so a lookup is a binary search over a dense array instead of a
+ * std::map tree walk. Handles returned from getHandle() let hot paths cache the result of a
+ * lookup and skip hashing entirely; handles stay valid until an option is inserted or the
+ * list is cleared.
+ */
+class RenderOptionList
+{
+public:
+    using value_type     = std::pair<std::string_view, option>;
+    using iterator       = std::vector<value_type>::iterator;
+    using const_iterator = std::vector<value_type>::const_iterator;
+
+    /** Handle caching the storage location of an option. */
+    using OptionHandle = uint32_t;
+
+    static constexpr OptionHandle kInvalidOptionHandle = 0xFFFFFFFFu;
+
+    iterator       begin() noexcept { return values_.begin(); }
+    iterator       end() noexcept { return values_.end(); }
+    const_iterator begin() const noexcept { return values_.begin(); }
+    const_iterator end() const noexcept { return values_.end(); }
+    const_iterator cbegin() const noexcept { return values_.cbegin(); }
+    const_iterator cend() const noexcept { return values_.cend(); }
+
+    bool   empty() const noexcept { return values_.empty(); }
+    size_t size() const noexcept { return values_.size(); }
+
+    void clear() noexcept
+    {
+        values_.clear();
+        hashes_.clear();
+    }
+
+    iterator find(std::string_view const &name) noexcept
+    {
+        OptionHandle const handle = getHandle(name);
+        return handle != kInvalidOptionHandle ? values_.begin() + handle : values_.end();
+    }
+
+    const_iterator find(std::string_view const &name) const noexcept
+    {
+        OptionHandle const handle = getHandle(name);
+        return handle != kInvalidOptionHandle ? values_.cbegin() + handle : values_.cend();
+    }
+
+    bool contains(std::string_view const &name) const noexcept
+    {
+        return getHandle(name) != kInvalidOptionHandle;
+    }
+
+    option &at(std::string_view const &name) noexcept { return values_[getHandle(name)].second; }
+
+    option const &at(std::string_view const &name) const noexcept
+    {
+        return values_[getHandle(name)].second;
+    }
+
+    /**
+     * Gets a cacheable handle to the requested option.
+     * @param name The name of the option to find.
+     * @returns The handle of the option (kInvalidOptionHandle if not found).
+     */
+    OptionHandle getHandle(std::string_view const &name) const noexcept
+    {
+        size_t const hash = std::hash<std::string_view> {}(name);
+        for (auto i = std::lower_bound(hashes_.cbegin(), hashes_.cend(), hash,
+                 [](HashEntry const &entry, size_t value) { return entry.hash < value; });
+             i != hashes_.cend() && i->hash == hash; ++i)
+        {
+            if (values_[i->index].first == name)
+            {
+                return i->index;
+            }
+        }
+        return kInvalidOptionHandle;
+    }
+
+    /** Direct access to an option through a previously cached handle. */
+    option       &operator[](OptionHandle handle) noexcept { return values_[handle].second; }
+    option const &operator[](OptionHandle handle) const noexcept { return values_[handle].second; }
+
+    std::pair<iterator, bool> emplace(std::string_view const &name, option const &value) noexcept
+    {
+        if (OptionHandle const handle = getHandle(name); handle != kInvalidOptionHandle)
+        {
+            return std::make_pair(values_.begin() + handle, false);
+        }
+        uint32_t const index = (uint32_t)values_.size();
+        values_.emplace_back(name, value);
+        HashEntry const entry = {std::hash<std::string_view> {}(name), index};
+        hashes_.insert(std::upper_bound(hashes_.begin(), hashes_.end(), entry.hash,
+                           [](size_t lhs, HashEntry const &rhs) { return lhs < rhs.hash; }),
+            entry);
+        return std::make_pair(values_.begin() + index, true);
+    }
+
+    /** Moves all options not already present from the other list into this one. */
+    void merge(RenderOptionList &&other) noexcept
+    {
+        for (auto const &i : other.values_)
+        {
+            emplace(i.first, i.second);
+        }
+        other.clear();
+    }
+
+private:
+    struct HashEntry
+    {
+        size_t   hash;  /**< Precomputed hash of the option name */
+        uint32_t index; /**< Index of the option inside values_ */
+    };
+
+    std::vector<value_type> values_; /**< The options in insertion order */
+    std::vector<HashEntry>  hashes_; /**< Lookup entries sorted by name hash */
+};
 } // namespace Capsaicin
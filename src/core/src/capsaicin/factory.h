@@ -23,6 +23,7 @@ THE SOFTWARE.
 
 #include "static_string.h"
 
+#include <cstdint>
 #include <memory>
 #include <string_view>
 #include <type_traits>
@@ -63,6 +64,47 @@ public:
         return list;
     }
 
+    /**
+     * Gets the list of dense type identifiers and corresponding type names.
+     * @return The list of names and type identifiers.
+     */
+    static auto &GetIdList() noexcept
+    {
+        static std::unordered_map<std::string_view, uint32_t> list;
+        return list;
+    }
+
+    /**
+     * Gets the number of types registered with this factory.
+     * @return The registered type count.
+     */
+    static uint32_t GetTypeCount() noexcept { return NextTypeId(); }
+
+    /**
+     * Gets the dense type identifier assigned to a registered type name.
+     * @param name The name of the type.
+     * @return The type identifier (UINT32_MAX if the name is unknown).
+     */
+    static uint32_t GetTypeId(std::string_view const &name) noexcept
+    {
+        auto &list = GetIdList();
+        if (auto i = list.find(name); i != list.cend())
+        {
+            return i->second;
+        }
+        return UINT32_MAX;
+    }
+
+    /**
+     * Gets the counter used to assign dense type identifiers.
+     * @return The next unassigned type identifier.
+     */
+    static uint32_t &NextTypeId() noexcept
+    {
+        static uint32_t next = 0;
+        return next;
+    }
+
     /**
      * Makes a new instance of a requested type.
      * @param name The name of the type of create.
@@ -130,11 +172,25 @@ public:
                     return std::make_unique<T>();
                 }
             };
+            // Assign the dense per-factory type identifier (stable across re-registration)
+            if (auto const i = Factory::GetIdList().find(registeredName<T>);
+                i != Factory::GetIdList().cend())
+            {
+                typeID = i->second;
+            }
+            else
+            {
+                typeID = Factory::NextTypeId()++;
+                Factory::GetIdList().emplace(registeredName<T>, typeID);
+            }
             return true;
         }
 
         static bool registered; /**< Internal boolean used to force @registerType to be called */
 
+        static uint32_t typeID; /**< Dense per-factory type identifier assigned during registration,
+                                     usable to index flat tables without any string lookup */
+
         Registrar() noexcept { (void)registered; }
     };
 };
@@ -143,6 +199,10 @@ template<class Base>
 template<class T>
 bool Factory<Base>::Registrar<T>::registered = Factory<Base>::Registrar<T>::registerType();
 
+template<class Base>
+template<class T>
+uint32_t Factory<Base>::Registrar<T>::typeID = 0;
+
 #define MANUALLY_REGISTER_TO_FACTORY(FactoryName, TypeName)            \
     class TypeName##Register : public FactoryName::Registrar<TypeName> \
     {};                                                                \
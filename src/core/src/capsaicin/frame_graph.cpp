@@ -0,0 +1,156 @@
+/**********************************************************************
+Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+********************************************************************/
+
+#include "frame_graph.h"
+
+#include "render_technique.h"
+
+#include <algorithm>
+
+namespace Capsaicin
+{
+namespace
+{
+/** The declared resource accesses of a single technique. */
+struct ResourceAccess
+{
+    std::vector<std::string_view> reads;  /**< Names of AOVs/buffers the technique reads */
+    std::vector<std::string_view> writes; /**< Names of AOVs/buffers the technique writes */
+};
+
+/** Checks whether two sorted name lists share any entry. */
+bool Intersects(
+    std::vector<std::string_view> const &lhs, std::vector<std::string_view> const &rhs) noexcept
+{
+    auto i = lhs.cbegin();
+    auto j = rhs.cbegin();
+    while (i != lhs.cend() && j != rhs.cend())
+    {
+        if (*i == *j)
+        {
+            return true;
+        }
+        (*i < *j) ? ++i : ++j;
+    }
+    return false;
+}
+} // unnamed namespace
+
+void FrameGraph::clear() noexcept
+{
+    nodes_.clear();
+    groupSizes_.clear();
+}
+
+void FrameGraph::build(std::vector<std::unique_ptr<RenderTechnique>> const &techniques) noexcept
+{
+    clear();
+    uint32_t const techniqueCount = (uint32_t)techniques.size();
+    nodes_.resize(techniqueCount);
+
+    // Gather the declared read/write sets of each technique
+    std::vector<ResourceAccess> accesses(techniqueCount);
+    for (uint32_t i = 0; i < techniqueCount; ++i)
+    {
+        ResourceAccess &access = accesses[i];
+        for (auto const &aov : techniques[i]->getAOVs())
+        {
+            if (aov.access == AOV::Read || aov.access == AOV::ReadWrite)
+            {
+                access.reads.push_back(aov.name);
+            }
+            if (aov.access == AOV::Write || aov.access == AOV::ReadWrite)
+            {
+                access.writes.push_back(aov.name);
+            }
+        }
+        for (auto const &buffer : techniques[i]->getBuffers())
+        {
+            if (buffer.access == Buffer::Read || buffer.access == Buffer::ReadWrite)
+            {
+                access.reads.push_back(buffer.name);
+            }
+            if (buffer.access == Buffer::Write || buffer.access == Buffer::ReadWrite)
+            {
+                access.writes.push_back(buffer.name);
+            }
+        }
+        std::sort(access.reads.begin(), access.reads.end());
+        std::sort(access.writes.begin(), access.writes.end());
+    }
+
+    // Add a dependency edge for every read-after-write, write-after-read and write-after-write
+    // hazard between a technique and any earlier technique
+    for (uint32_t i = 0; i < techniqueCount; ++i)
+    {
+        for (uint32_t j = 0; j < i; ++j)
+        {
+            if (Intersects(accesses[i].reads, accesses[j].writes)
+                || Intersects(accesses[i].writes, accesses[j].reads)
+                || Intersects(accesses[i].writes, accesses[j].writes))
+            {
+                nodes_[i].dependencies.push_back(j);
+            }
+        }
+    }
+
+    // Greedily pack techniques into order preserving scheduling groups. A technique joins the
+    // current group only if it has no dependency on any other member of that group, so every
+    // member of a group is guaranteed independent of every other member.
+    uint32_t groupStart = 0;
+    for (uint32_t i = 0; i < techniqueCount; ++i)
+    {
+        bool const dependsOnGroup = std::any_of(nodes_[i].dependencies.cbegin(),
+            nodes_[i].dependencies.cend(), [groupStart](uint32_t dep) { return dep >= groupStart; });
+        if (i > 0 && dependsOnGroup)
+        {
+            groupStart = i;
+        }
+        if (groupStart == i)
+        {
+            groupSizes_.push_back(0);
+        }
+        nodes_[i].group = (uint32_t)groupSizes_.size() - 1;
+        ++groupSizes_.back();
+    }
+}
+
+uint32_t FrameGraph::getGroup(uint32_t technique) const noexcept
+{
+    return nodes_[technique].group;
+}
+
+bool FrameGraph::isGroupStart(uint32_t technique) const noexcept
+{
+    return technique == 0 || nodes_[technique].group != nodes_[technique - 1].group;
+}
+
+uint32_t FrameGraph::getGroupSize(uint32_t group) const noexcept
+{
+    return groupSizes_[group];
+}
+
+std::vector<uint32_t> const &FrameGraph::getDependencies(uint32_t technique) const noexcept
+{
+    return nodes_[technique].dependencies;
+}
+} // namespace Capsaicin
@@ -0,0 +1,96 @@
+/**********************************************************************
+Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+********************************************************************/
+#pragma once
+
+#include <memory>
+#include <string_view>
+#include <vector>
+
+namespace Capsaicin
+{
+class RenderTechnique;
+
+/**
+ * Dependency graph over the frame's render techniques derived from their declared AOV and shared
+ * buffer accesses.
+ * An edge is added from an earlier technique to a later one whenever the later technique reads a
+ * resource the earlier one writes, writes a resource the earlier one reads, or both write the same
+ * resource. Techniques are then packed into scheduling groups: every technique within a group is
+ * independent of every other technique in the same group, so their GPU work needs no barriers
+ * between them and may be freely interleaved or their command recording parallelised. Grouping is
+ * order preserving so the renderer-listed order remains the execution order within and across
+ * groups.
+ * @note Actual barrier placement remains with the gfx layer's automatic resource tracker; the graph
+ * bounds where that tracker's conservatism can legally be relaxed.
+ */
+class FrameGraph
+{
+public:
+    /** A single technique node within the graph. */
+    struct Node
+    {
+        std::vector<uint32_t> dependencies; /**< Indices of earlier techniques this one depends on */
+        uint32_t              group = 0;    /**< Index of the scheduling group the technique is in */
+    };
+
+    /** Resets the graph to empty. */
+    void clear() noexcept;
+
+    /**
+     * Builds the dependency graph and scheduling groups for a list of render techniques.
+     * @param techniques The techniques in renderer-listed execution order.
+     */
+    void build(std::vector<std::unique_ptr<RenderTechnique>> const &techniques) noexcept;
+
+    /**
+     * Gets the scheduling group a technique was packed into.
+     * @param technique Index of the technique in execution order.
+     * @return The group index.
+     */
+    uint32_t getGroup(uint32_t technique) const noexcept;
+
+    /**
+     * Checks whether a technique is the first member of its scheduling group.
+     * @param technique Index of the technique in execution order.
+     * @return True if the technique starts a new group.
+     */
+    bool isGroupStart(uint32_t technique) const noexcept;
+
+    /**
+     * Gets the number of techniques packed into a scheduling group.
+     * @param group The group index.
+     * @return The number of member techniques.
+     */
+    uint32_t getGroupSize(uint32_t group) const noexcept;
+
+    /**
+     * Gets the indices of the earlier techniques a technique depends on.
+     * @param technique Index of the technique in execution order.
+     * @return The list of dependency indices.
+     */
+    std::vector<uint32_t> const &getDependencies(uint32_t technique) const noexcept;
+
+private:
+    std::vector<Node>     nodes_;      /**< Per-technique graph nodes in execution order */
+    std::vector<uint32_t> groupSizes_; /**< Number of techniques within each scheduling group */
+};
+} // namespace Capsaicin
@@ -0,0 +1,292 @@
+/**********************************************************************
+Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+********************************************************************/
+#include "memory_budget.h"
+
+#include <cfloat>
+#include <dxgi1_4.h>
+#include <gfx_imgui.h>
+
+namespace Capsaicin
+{
+namespace
+{
+/** Fraction of the budget above which pressure callbacks start being invoked. */
+constexpr double kPressureThreshold = 0.95;
+/** Fraction of the budget that callbacks are asked to bring usage back down to. */
+constexpr double kPressureTarget = 0.90;
+/** Number of frames to wait between callback invocations so caches have time to reallocate. */
+constexpr uint32_t kPressureCooldownFrames = 60;
+
+uint32_t getFormatBitsPerPixel(DXGI_FORMAT format) noexcept
+{
+    switch (format)
+    {
+    case DXGI_FORMAT_R32G32B32A32_TYPELESS:
+    case DXGI_FORMAT_R32G32B32A32_FLOAT:
+    case DXGI_FORMAT_R32G32B32A32_UINT:
+    case DXGI_FORMAT_R32G32B32A32_SINT: return 128;
+    case DXGI_FORMAT_R32G32B32_TYPELESS:
+    case DXGI_FORMAT_R32G32B32_FLOAT:
+    case DXGI_FORMAT_R32G32B32_UINT:
+    case DXGI_FORMAT_R32G32B32_SINT: return 96;
+    case DXGI_FORMAT_R16G16B16A16_TYPELESS:
+    case DXGI_FORMAT_R16G16B16A16_FLOAT:
+    case DXGI_FORMAT_R16G16B16A16_UNORM:
+    case DXGI_FORMAT_R16G16B16A16_UINT:
+    case DXGI_FORMAT_R16G16B16A16_SNORM:
+    case DXGI_FORMAT_R16G16B16A16_SINT:
+    case DXGI_FORMAT_R32G32_TYPELESS:
+    case DXGI_FORMAT_R32G32_FLOAT:
+    case DXGI_FORMAT_R32G32_UINT:
+    case DXGI_FORMAT_R32G32_SINT: return 64;
+    case DXGI_FORMAT_R8G8_TYPELESS:
+    case DXGI_FORMAT_R8G8_UNORM:
+    case DXGI_FORMAT_R8G8_UINT:
+    case DXGI_FORMAT_R8G8_SNORM:
+    case DXGI_FORMAT_R8G8_SINT:
+    case DXGI_FORMAT_R16_TYPELESS:
+    case DXGI_FORMAT_R16_FLOAT:
+    case DXGI_FORMAT_D16_UNORM:
+    case DXGI_FORMAT_R16_UNORM:
+    case DXGI_FORMAT_R16_UINT:
+    case DXGI_FORMAT_R16_SNORM:
+    case DXGI_FORMAT_R16_SINT: return 16;
+    case DXGI_FORMAT_R8_TYPELESS:
+    case DXGI_FORMAT_R8_UNORM:
+    case DXGI_FORMAT_R8_UINT:
+    case DXGI_FORMAT_R8_SNORM:
+    case DXGI_FORMAT_R8_SINT:
+    case DXGI_FORMAT_A8_UNORM: return 8;
+    case DXGI_FORMAT_BC1_TYPELESS:
+    case DXGI_FORMAT_BC1_UNORM:
+    case DXGI_FORMAT_BC1_UNORM_SRGB:
+    case DXGI_FORMAT_BC4_TYPELESS:
+    case DXGI_FORMAT_BC4_UNORM:
+    case DXGI_FORMAT_BC4_SNORM: return 4;
+    case DXGI_FORMAT_BC2_TYPELESS:
+    case DXGI_FORMAT_BC2_UNORM:
+    case DXGI_FORMAT_BC2_UNORM_SRGB:
+    case DXGI_FORMAT_BC3_TYPELESS:
+    case DXGI_FORMAT_BC3_UNORM:
+    case DXGI_FORMAT_BC3_UNORM_SRGB:
+    case DXGI_FORMAT_BC5_TYPELESS:
+    case DXGI_FORMAT_BC5_UNORM:
+    case DXGI_FORMAT_BC5_SNORM:
+    case DXGI_FORMAT_BC6H_TYPELESS:
+    case DXGI_FORMAT_BC6H_UF16:
+    case DXGI_FORMAT_BC6H_SF16:
+    case DXGI_FORMAT_BC7_TYPELESS:
+    case DXGI_FORMAT_BC7_UNORM:
+    case DXGI_FORMAT_BC7_UNORM_SRGB: return 8;
+    default: return 32; // all remaining supported formats are 32 bits per pixel
+    }
+}
+} // unnamed namespace
+
+MemoryBudget::~MemoryBudget() noexcept
+{
+    terminate();
+}
+
+bool MemoryBudget::initialise(GfxContext gfx) noexcept
+{
+    if (adapter != nullptr)
+    {
+        return true;
+    }
+
+    // Locate the DXGI adapter backing the device so usage/budget can be queried from the OS
+    if (ID3D12Device *device = gfxGetDevice(gfx); device != nullptr)
+    {
+        LUID const     luid    = device->GetAdapterLuid();
+        IDXGIFactory4 *factory = nullptr;
+        if (SUCCEEDED(CreateDXGIFactory1(IID_PPV_ARGS(&factory))))
+        {
+            IDXGIAdapter3 *found = nullptr;
+            if (SUCCEEDED(factory->EnumAdapterByLuid(luid, IID_PPV_ARGS(&found))))
+            {
+                adapter = found;
+            }
+            factory->Release();
+        }
+    }
+
+    return adapter != nullptr;
+}
+
+void MemoryBudget::terminate() noexcept
+{
+    if (adapter != nullptr)
+    {
+        adapter->Release();
+        adapter = nullptr;
+    }
+    subsystems.clear();
+    callbacks.clear();
+    budget = 0;
+    usage  = 0;
+}
+
+void MemoryBudget::report(std::string_view const &subsystem, uint64_t sizeInBytes) noexcept
+{
+    if (auto i = subsystems.find(subsystem); i != subsystems.end())
+    {
+        i->second = {sizeInBytes, true};
+    }
+    else
+    {
+        subsystems.emplace(std::string(subsystem), std::make_pair(sizeInBytes, true));
+    }
+}
+
+uint32_t MemoryBudget::registerPressureCallback(std::function<void(uint64_t)> callback) noexcept
+{
+    uint32_t const handle = nextCallbackHandle++;
+    callbacks.emplace_back(handle, std::move(callback));
+    return handle;
+}
+
+void MemoryBudget::unregisterPressureCallback(uint32_t handle) noexcept
+{
+    std::erase_if(callbacks, [handle](auto const &callback) { return callback.first == handle; });
+}
+
+void MemoryBudget::clearPressureCallbacks() noexcept
+{
+    callbacks.clear();
+}
+
+void MemoryBudget::update() noexcept
+{
+    if (adapter != nullptr)
+    {
+        DXGI_QUERY_VIDEO_MEMORY_INFO info = {};
+        if (SUCCEEDED(adapter->QueryVideoMemoryInfo(0, DXGI_MEMORY_SEGMENT_GROUP_LOCAL, &info)))
+        {
+            budget = info.Budget;
+            usage  = info.CurrentUsage;
+        }
+    }
+    else
+    {
+        // Without adapter access fall back to the summed subsystem sizes (no budget available)
+        usage = getTrackedUsage();
+    }
+    usageGraph.addValue(static_cast<float>(static_cast<double>(usage) / (1024.0 * 1024.0)));
+
+    // Drop subsystems that stopped reporting and reset the refresh flags for the next frame
+    for (auto i = subsystems.begin(); i != subsystems.end();)
+    {
+        if (!i->second.second)
+        {
+            i = subsystems.erase(i);
+        }
+        else
+        {
+            i->second.second = false;
+            ++i;
+        }
+    }
+
+    underPressure =
+        budget > 0 && static_cast<double>(usage) > kPressureThreshold * static_cast<double>(budget);
+    if (pressureCooldown > 0)
+    {
+        --pressureCooldown;
+    }
+    if (underPressure && pressureCooldown == 0 && !callbacks.empty())
+    {
+        auto const     target      = static_cast<uint64_t>(kPressureTarget * static_cast<double>(budget));
+        uint64_t const bytesToFree = usage > target ? usage - target : 0;
+        for (auto const &callback : callbacks)
+        {
+            callback.second(bytesToFree);
+        }
+        pressureCooldown = kPressureCooldownFrames;
+    }
+}
+
+uint64_t MemoryBudget::getBudget() const noexcept
+{
+    return budget;
+}
+
+uint64_t MemoryBudget::getUsage() const noexcept
+{
+    return usage;
+}
+
+uint64_t MemoryBudget::getTrackedUsage() const noexcept
+{
+    uint64_t tracked = 0;
+    for (auto const &i : subsystems)
+    {
+        tracked += i.second.first;
+    }
+    return tracked;
+}
+
+bool MemoryBudget::isUnderPressure() const noexcept
+{
+    return underPressure;
+}
+
+void MemoryBudget::renderGUI() noexcept
+{
+    constexpr double toMiB = 1.0 / (1024.0 * 1024.0);
+    if (budget > 0)
+    {
+        ImGui::Text("Video Memory        : %.0f / %.0f MiB%s", static_cast<double>(usage) * toMiB,
+            static_cast<double>(budget) * toMiB, underPressure ? "  (pressure)" : "");
+        ImGui::ProgressBar(
+            static_cast<float>(static_cast<double>(usage) / static_cast<double>(budget)), ImVec2(-1.0f, 0.0f));
+    }
+    else
+    {
+        ImGui::Text("Video Memory        : %.0f MiB (budget unavailable)", static_cast<double>(usage) * toMiB);
+    }
+    ImGui::PlotLines("", Graph::GetValueAtIndex, &usageGraph, usageGraph.getValueCount(), 0, "Usage (MiB)",
+        0.0f, FLT_MAX, ImVec2(150, 20));
+    ImGui::Separator();
+    for (auto const &i : subsystems)
+    {
+        ImGui::Text("%-24s: %.1f MiB", i.first.c_str(), static_cast<double>(i.second.first) * toMiB);
+    }
+    uint64_t const tracked = getTrackedUsage();
+    ImGui::Text("%-24s: %.1f MiB", "Tracked Total", static_cast<double>(tracked) * toMiB);
+    if (usage > tracked)
+    {
+        ImGui::Text("%-24s: %.1f MiB", "Untracked", static_cast<double>(usage - tracked) * toMiB);
+    }
+}
+
+uint64_t MemoryBudget::GetTextureSize(GfxTexture const &texture) noexcept
+{
+    uint64_t size = static_cast<uint64_t>(texture.getWidth()) * texture.getHeight()
+                  * GFX_MAX(texture.getDepth(), 1U) * getFormatBitsPerPixel(texture.getFormat()) / 8;
+    if (texture.getMipLevels() > 1)
+    {
+        size += size / 3; // approximate cost of the full mip chain
+    }
+    return size;
+}
+} // namespace Capsaicin
@@ -0,0 +1,132 @@
+/**********************************************************************
+Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+********************************************************************/
+#pragma once
+
+#include "graph.h"
+
+#include <functional>
+#include <gfx.h>
+#include <map>
+#include <string>
+#include <string_view>
+#include <vector>
+
+struct IDXGIAdapter3;
+
+namespace Capsaicin
+{
+/**
+ * Central tracker for video memory consumption.
+ * Subsystems report their resident size each frame and the tracker compares the driver reported
+ * usage against the OS provided budget. When usage approaches the budget, registered pressure
+ * callbacks are invoked with the number of bytes that should be released, allowing caches to
+ * shrink cooperatively before the driver starts paging resources out of video memory.
+ */
+class MemoryBudget
+{
+public:
+    MemoryBudget() noexcept = default;
+
+    ~MemoryBudget() noexcept;
+
+    MemoryBudget(MemoryBudget const &) = delete;
+
+    MemoryBudget &operator=(MemoryBudget const &) = delete;
+
+    /**
+     * Initialise the internal data based on current configuration.
+     * @param gfx Active gfx context.
+     * @return True, if the video memory budget could be queried from the adapter.
+     */
+    bool initialise(GfxContext gfx) noexcept;
+
+    /** Terminates and cleans up this object. */
+    void terminate() noexcept;
+
+    /**
+     * Report the current resident size of a subsystem.
+     * Should be called every frame as sizes are cleared between updates; subsystems that stop
+     * reporting are dropped from the accounting.
+     * @param subsystem   Display name used to identify the subsystem.
+     * @param sizeInBytes The current total size of the subsystems video memory allocations.
+     */
+    void report(std::string_view const &subsystem, uint64_t sizeInBytes) noexcept;
+
+    /**
+     * Register a callback to be invoked when the tracker detects memory pressure.
+     * @param callback Called with the number of bytes that should be released.
+     * @return A handle used to unregister the callback (never zero).
+     */
+    uint32_t registerPressureCallback(std::function<void(uint64_t)> callback) noexcept;
+
+    /**
+     * Unregister a previously registered pressure callback.
+     * @param handle The handle returned by @registerPressureCallback().
+     */
+    void unregisterPressureCallback(uint32_t handle) noexcept;
+
+    /** Remove all registered pressure callbacks (used when the owning objects are destroyed). */
+    void clearPressureCallbacks() noexcept;
+
+    /**
+     * Update the tracked usage and budget and invoke pressure callbacks if required.
+     * Should be called once per frame after all subsystems have reported.
+     */
+    void update() noexcept;
+
+    /** @return The OS provided video memory budget in bytes (zero if unavailable). */
+    [[nodiscard]] uint64_t getBudget() const noexcept;
+
+    /** @return The driver reported video memory usage in bytes. */
+    [[nodiscard]] uint64_t getUsage() const noexcept;
+
+    /** @return The summed size of all reporting subsystems in bytes. */
+    [[nodiscard]] uint64_t getTrackedUsage() const noexcept;
+
+    /** @return True, if usage is currently close enough to the budget to trigger callbacks. */
+    [[nodiscard]] bool isUnderPressure() const noexcept;
+
+    /** Draw the memory statistics using ImGui. */
+    void renderGUI() noexcept;
+
+    /**
+     * Calculate the approximate video memory footprint of a texture (all slices and mips).
+     * @param texture The texture to measure.
+     * @return The approximate size of the texture in bytes.
+     */
+    static uint64_t GetTextureSize(GfxTexture const &texture) noexcept;
+
+private:
+    IDXGIAdapter3 *adapter = nullptr; /**< The DXGI adapter used to query usage/budget. */
+
+    uint64_t budget        = 0;     /**< The OS provided video memory budget. */
+    uint64_t usage         = 0;     /**< The driver reported video memory usage. */
+    bool     underPressure = false; /**< True, if usage is close enough to budget to act. */
+    uint32_t pressureCooldown = 0;  /**< Frames to wait before re-invoking the callbacks. */
+    uint32_t nextCallbackHandle = 1;
+
+    /** Reported subsystem sizes along with whether they were refreshed since the last update. */
+    std::map<std::string, std::pair<uint64_t, bool>, std::less<>>   subsystems;
+    std::vector<std::pair<uint32_t, std::function<void(uint64_t)>>> callbacks;
+    Graph                                                           usageGraph; /**< Usage history (MiB). */
+};
+} // namespace Capsaicin
@@ -0,0 +1,223 @@
+/**********************************************************************
+Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+********************************************************************/
+#include "scene_cache.h"
+
+#include <filesystem>
+#include <fstream>
+
+#define WIN32_LEAN_AND_MEAN
+#include <Windows.h>
+
+namespace Capsaicin
+{
+namespace SceneCache
+{
+namespace
+{
+constexpr uint32_t const kCacheMagic   = 0x43534331u; // 'CSC1'
+constexpr uint32_t const kCacheVersion = 1;
+
+struct CacheHeader
+{
+    uint32_t magic;
+    uint32_t version;
+    uint32_t mesh_count;
+    uint32_t material_count;
+    uint64_t index_count;
+    uint64_t vertex_count;
+};
+
+void hashCombine(size_t &seed, size_t value) noexcept
+{
+    seed ^= value + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+}
+
+/** Calculates the cache file path for the given source scene files.
+ * The key is built from the file names, sizes and modification times so that any change to a source
+ * file invalidates the cached data. */
+std::filesystem::path getCachePath(std::vector<std::string> const &scene_files) noexcept
+{
+    size_t          key = 0x12345678u;
+    std::error_code ec;
+    for (auto const &file : scene_files)
+    {
+        hashCombine(key, std::hash<std::string> {}(file));
+        hashCombine(key, (size_t)std::filesystem::file_size(file, ec));
+        hashCombine(key,
+            (size_t)std::filesystem::last_write_time(file, ec).time_since_epoch().count());
+    }
+    char buffer[64];
+    snprintf(buffer, sizeof(buffer), "scene_%016zx.bin", key);
+    return std::filesystem::path("cache") / buffer;
+}
+} // unnamed namespace
+
+View::~View() noexcept
+{
+    if (data_ != nullptr)
+    {
+        UnmapViewOfFile(data_);
+    }
+    if (mapping_ != nullptr)
+    {
+        CloseHandle((HANDLE)mapping_);
+    }
+    if (file_ != nullptr)
+    {
+        CloseHandle((HANDLE)file_);
+    }
+}
+
+View::View(View &&other) noexcept
+{
+    *this = std::move(other);
+}
+
+View &View::operator=(View &&other) noexcept
+{
+    if (this != &other)
+    {
+        this->~View();
+        meshes               = other.meshes;
+        mesh_count           = other.mesh_count;
+        indices              = other.indices;
+        index_count          = other.index_count;
+        vertices             = other.vertices;
+        vertex_count         = other.vertex_count;
+        materials            = other.materials;
+        material_count       = other.material_count;
+        file_                = other.file_;
+        mapping_             = other.mapping_;
+        data_                = other.data_;
+        other.file_          = nullptr;
+        other.mapping_       = nullptr;
+        other.data_          = nullptr;
+        other.meshes         = nullptr;
+        other.mesh_count     = 0;
+        other.indices        = nullptr;
+        other.index_count    = 0;
+        other.vertices       = nullptr;
+        other.vertex_count   = 0;
+        other.materials      = nullptr;
+        other.material_count = 0;
+    }
+    return *this;
+}
+
+bool Load(std::vector<std::string> const &scene_files, View &view) noexcept
+{
+    auto const path = getCachePath(scene_files);
+
+    HANDLE const file = CreateFileA(path.string().c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+        OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        return false;
+    }
+
+    LARGE_INTEGER file_size = {};
+    if (!GetFileSizeEx(file, &file_size) || (uint64_t)file_size.QuadPart < sizeof(CacheHeader))
+    {
+        CloseHandle(file);
+        return false;
+    }
+
+    HANDLE const mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (mapping == nullptr)
+    {
+        CloseHandle(file);
+        return false;
+    }
+
+    void const *data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (data == nullptr)
+    {
+        CloseHandle(mapping);
+        CloseHandle(file);
+        return false;
+    }
+
+    auto const *header = (CacheHeader const *)data;
+    uint64_t const expected_size = sizeof(CacheHeader) + (uint64_t)header->mesh_count * sizeof(Mesh)
+                                 + (uint64_t)header->material_count * sizeof(Material)
+                                 + header->index_count * sizeof(uint32_t)
+                                 + header->vertex_count * sizeof(Vertex);
+    if (header->magic != kCacheMagic || header->version != kCacheVersion
+        || (uint64_t)file_size.QuadPart != expected_size)
+    {
+        UnmapViewOfFile(data);
+        CloseHandle(mapping);
+        CloseHandle(file);
+        return false;
+    }
+
+    auto const *cursor = (uint8_t const *)data + sizeof(CacheHeader);
+    view.meshes        = (Mesh const *)cursor;
+    view.mesh_count    = header->mesh_count;
+    cursor += (uint64_t)header->mesh_count * sizeof(Mesh);
+    view.materials      = (Material const *)cursor;
+    view.material_count = header->material_count;
+    cursor += (uint64_t)header->material_count * sizeof(Material);
+    view.indices     = (uint32_t const *)cursor;
+    view.index_count = header->index_count;
+    cursor += header->index_count * sizeof(uint32_t);
+    view.vertices     = (Vertex const *)cursor;
+    view.vertex_count = header->vertex_count;
+
+    view.file_    = (void *)file;
+    view.mapping_ = (void *)mapping;
+    view.data_    = data;
+    return true;
+}
+
+bool Save(std::vector<std::string> const &scene_files, std::vector<Mesh> const &meshes,
+    std::vector<uint32_t> const &indices, std::vector<Vertex> const &vertices,
+    std::vector<Material> const &materials) noexcept
+{
+    auto const path = getCachePath(scene_files);
+
+    std::error_code ec;
+    std::filesystem::create_directories(path.parent_path(), ec);
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file.is_open())
+    {
+        return false;
+    }
+
+    CacheHeader header    = {};
+    header.magic          = kCacheMagic;
+    header.version        = kCacheVersion;
+    header.mesh_count     = (uint32_t)meshes.size();
+    header.material_count = (uint32_t)materials.size();
+    header.index_count    = indices.size();
+    header.vertex_count   = vertices.size();
+
+    file.write((char const *)&header, sizeof(header));
+    file.write((char const *)meshes.data(), (std::streamsize)(meshes.size() * sizeof(Mesh)));
+    file.write((char const *)materials.data(), (std::streamsize)(materials.size() * sizeof(Material)));
+    file.write((char const *)indices.data(), (std::streamsize)(indices.size() * sizeof(uint32_t)));
+    file.write((char const *)vertices.data(), (std::streamsize)(vertices.size() * sizeof(Vertex)));
+    return file.good();
+}
+} // namespace SceneCache
+} // namespace Capsaicin
@@ -0,0 +1,90 @@
+/**********************************************************************
+Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+********************************************************************/
+#pragma once
+
+#include "gpu_shared.h"
+
+#include <string>
+#include <vector>
+
+namespace Capsaicin
+{
+/**
+ * Binary cache of the flattened scene arrays (Mesh/Vertex/index/Material).
+ * On first load of a scene the already flattened arrays are serialized to disk keyed by a hash of the
+ * source scene files (name, size and modification time). On subsequent runs the cache file is
+ * memory-mapped so the arrays can be consumed without re-parsing the source files.
+ */
+namespace SceneCache
+{
+/** A read-only view over a memory-mapped scene cache file. */
+class View
+{
+    View(View const &)            = delete;
+    View &operator=(View const &) = delete;
+
+public:
+    View() noexcept = default;
+    ~View() noexcept;
+    View(View &&other) noexcept;
+    View &operator=(View &&other) noexcept;
+
+    Mesh const     *meshes         = nullptr; /**< Flattened mesh array (points into the mapped file) */
+    uint32_t        mesh_count     = 0;
+    uint32_t const *indices        = nullptr; /**< Flattened index array (points into the mapped file) */
+    uint64_t        index_count    = 0;
+    Vertex const   *vertices       = nullptr; /**< Flattened vertex array (points into the mapped file) */
+    uint64_t        vertex_count   = 0;
+    Material const *materials      = nullptr; /**< Flattened material array (points into the mapped file) */
+    uint32_t        material_count = 0;
+
+private:
+    friend bool Load(std::vector<std::string> const &scene_files, View &view) noexcept;
+
+    void       *file_    = nullptr; /**< Win32 handle of the backing file */
+    void       *mapping_ = nullptr; /**< Win32 handle of the file mapping */
+    void const *data_    = nullptr; /**< Base address of the mapped view */
+};
+
+/**
+ * Attempts to memory-map the cache file corresponding to the passed in scene files.
+ * @param scene_files The source scene files the cache was built from.
+ * @param [out] view  On success, a view over the mapped cache data. The mapping stays valid for the
+ * lifetime of the view.
+ * @returns True if a valid up-to-date cache file was found and mapped, False otherwise.
+ */
+bool Load(std::vector<std::string> const &scene_files, View &view) noexcept;
+
+/**
+ * Serializes the flattened scene arrays to the cache file for the passed in scene files.
+ * @param scene_files The source scene files the arrays were flattened from.
+ * @param meshes      The flattened mesh array.
+ * @param indices     The flattened index array.
+ * @param vertices    The flattened vertex array.
+ * @param materials   The flattened material array.
+ * @returns True if the cache file was successfully written, False otherwise.
+ */
+bool Save(std::vector<std::string> const &scene_files, std::vector<Mesh> const &meshes,
+    std::vector<uint32_t> const &indices, std::vector<Vertex> const &vertices,
+    std::vector<Material> const &materials) noexcept;
+} // namespace SceneCache
+} // namespace Capsaicin
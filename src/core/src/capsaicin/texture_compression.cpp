@@ -0,0 +1,527 @@
+/**********************************************************************
+Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+********************************************************************/
+#include "texture_compression.h"
+
+#include "thread_pool.h"
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+namespace Capsaicin
+{
+namespace TextureCompression
+{
+namespace
+{
+constexpr uint32_t const kCacheMagic   = 0x43544331u; // 'CTC1'
+constexpr uint32_t const kCacheVersion = 1;
+
+struct CacheHeader
+{
+    uint32_t magic;
+    uint32_t version;
+    uint32_t image_count;
+};
+
+struct CacheEntryHeader
+{
+    uint32_t image_index; /**< Scene object handle of the transcoded image */
+    uint32_t format;      /**< DXGI_FORMAT the data was transcoded to */
+    uint64_t data_size;   /**< Size of the block-compressed mip chain that follows */
+};
+
+void hashCombine(size_t &seed, size_t value) noexcept
+{
+    seed ^= value + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+}
+
+/** Calculates the transcode cache file path for the given source scene files.
+ * Keyed the same way as the scene cache (file names, sizes and modification times) so any change to
+ * a source file also invalidates the transcoded texture data. */
+std::filesystem::path getCachePath(std::vector<std::string> const &scene_files) noexcept
+{
+    size_t          key = 0x12345678u;
+    std::error_code ec;
+    for (auto const &file : scene_files)
+    {
+        hashCombine(key, std::hash<std::string> {}(file));
+        hashCombine(key, (size_t)std::filesystem::file_size(file, ec));
+        hashCombine(key,
+            (size_t)std::filesystem::last_write_time(file, ec).time_since_epoch().count());
+    }
+    char buffer[64];
+    snprintf(buffer, sizeof(buffer), "textures_%016zx.bin", key);
+    return std::filesystem::path("cache") / buffer;
+}
+
+/** Expands a packed 5:6:5 colour endpoint back to 8 bits per channel. */
+void decodeColor565(uint16_t colour, uint8_t out[3]) noexcept
+{
+    out[0] = (uint8_t)(((colour >> 11) << 3) | ((colour >> 13) & 0x7u));
+    out[1] = (uint8_t)((((colour >> 5) & 0x3Fu) << 2) | ((colour >> 9) & 0x3u));
+    out[2] = (uint8_t)(((colour & 0x1Fu) << 3) | ((colour >> 2) & 0x7u));
+}
+
+/** Compresses a 4x4 RGBA texel block to a single 8-byte BC1 block using the colour bounding box as
+ * endpoints. */
+void compressBlockBC1(uint8_t const texels[16][4], uint8_t *out) noexcept
+{
+    uint8_t min_colour[3] = {255, 255, 255};
+    uint8_t max_colour[3] = {};
+    for (uint32_t i = 0; i < 16; ++i)
+    {
+        for (uint32_t c = 0; c < 3; ++c)
+        {
+            min_colour[c] = std::min(min_colour[c], texels[i][c]);
+            max_colour[c] = std::max(max_colour[c], texels[i][c]);
+        }
+    }
+
+    uint16_t colour0 = (uint16_t)(((max_colour[0] >> 3) << 11) | ((max_colour[1] >> 2) << 5)
+                                  | (max_colour[2] >> 3));
+    uint16_t colour1 = (uint16_t)(((min_colour[0] >> 3) << 11) | ((min_colour[1] >> 2) << 5)
+                                  | (min_colour[2] >> 3));
+    if (colour0 < colour1)
+    {
+        std::swap(colour0, colour1); // colour0 > colour1 selects the opaque 4-colour mode
+    }
+
+    out[0] = (uint8_t)(colour0 & 0xFFu);
+    out[1] = (uint8_t)(colour0 >> 8);
+    out[2] = (uint8_t)(colour1 & 0xFFu);
+    out[3] = (uint8_t)(colour1 >> 8);
+
+    uint32_t indices = 0;
+    if (colour0 != colour1)
+    {
+        uint8_t palette[4][3];
+        decodeColor565(colour0, palette[0]);
+        decodeColor565(colour1, palette[1]);
+        for (uint32_t c = 0; c < 3; ++c)
+        {
+            palette[2][c] = (uint8_t)((2 * palette[0][c] + palette[1][c]) / 3);
+            palette[3][c] = (uint8_t)((palette[0][c] + 2 * palette[1][c]) / 3);
+        }
+
+        for (uint32_t i = 0; i < 16; ++i)
+        {
+            uint32_t best       = 0;
+            uint32_t best_error = ~0u;
+            for (uint32_t p = 0; p < 4; ++p)
+            {
+                uint32_t error = 0;
+                for (uint32_t c = 0; c < 3; ++c)
+                {
+                    int32_t const delta = (int32_t)texels[i][c] - (int32_t)palette[p][c];
+                    error += (uint32_t)(delta * delta);
+                }
+                if (error < best_error)
+                {
+                    best_error = error;
+                    best       = p;
+                }
+            }
+            indices |= best << (2 * i);
+        }
+    }
+
+    out[4] = (uint8_t)(indices & 0xFFu);
+    out[5] = (uint8_t)((indices >> 8) & 0xFFu);
+    out[6] = (uint8_t)((indices >> 16) & 0xFFu);
+    out[7] = (uint8_t)((indices >> 24) & 0xFFu);
+}
+
+/** Compresses 16 single channel texels to a single 8-byte BC4 block using the value range as
+ * endpoints. */
+void compressBlockBC4(uint8_t const texels[16], uint8_t *out) noexcept
+{
+    uint8_t min_value = 255;
+    uint8_t max_value = 0;
+    for (uint32_t i = 0; i < 16; ++i)
+    {
+        min_value = std::min(min_value, texels[i]);
+        max_value = std::max(max_value, texels[i]);
+    }
+
+    out[0] = max_value; // value0 > value1 selects the 8-value interpolation mode
+    out[1] = min_value;
+
+    uint64_t indices = 0;
+    if (max_value > min_value)
+    {
+        uint8_t palette[8];
+        palette[0] = max_value;
+        palette[1] = min_value;
+        for (uint32_t i = 1; i <= 6; ++i)
+        {
+            palette[i + 1] = (uint8_t)(((7 - i) * max_value + i * min_value) / 7);
+        }
+
+        for (uint32_t i = 0; i < 16; ++i)
+        {
+            uint32_t best       = 0;
+            uint32_t best_error = ~0u;
+            for (uint32_t p = 0; p < 8; ++p)
+            {
+                uint32_t const error =
+                    (uint32_t)std::abs((int32_t)texels[i] - (int32_t)palette[p]);
+                if (error < best_error)
+                {
+                    best_error = error;
+                    best       = p;
+                }
+            }
+            indices |= (uint64_t)best << (3 * i);
+        }
+    }
+
+    for (uint32_t i = 0; i < 6; ++i)
+    {
+        out[2 + i] = (uint8_t)(indices >> (8 * i));
+    }
+}
+
+/** Fetches a clamped 4x4 texel block, expanding missing channels (grey for single channel sources,
+ * opaque alpha). */
+void extractBlock(uint8_t const *data, uint32_t width, uint32_t height, uint32_t channels,
+    uint32_t block_x, uint32_t block_y, uint8_t texels[16][4]) noexcept
+{
+    for (uint32_t y = 0; y < 4; ++y)
+    {
+        for (uint32_t x = 0; x < 4; ++x)
+        {
+            uint32_t const source_x = std::min(block_x * 4 + x, width - 1);
+            uint32_t const source_y = std::min(block_y * 4 + y, height - 1);
+            size_t const   source   = ((size_t)source_y * width + source_x) * channels;
+            uint8_t *const texel    = texels[y * 4 + x];
+
+            texel[0] = data[source];
+            texel[1] = channels > 1 ? data[source + 1] : texel[0];
+            texel[2] = channels > 2 ? data[source + 2] : texel[0];
+            texel[3] = channels > 3 ? data[source + 3] : (uint8_t)255;
+        }
+    }
+}
+
+/** Box filters a mip level down to the next smaller one. */
+std::vector<uint8_t> downsampleMip(
+    std::vector<uint8_t> const &source, uint32_t width, uint32_t height, uint32_t channels) noexcept
+{
+    uint32_t const new_width  = std::max(width >> 1, 1u);
+    uint32_t const new_height = std::max(height >> 1, 1u);
+
+    std::vector<uint8_t> result((size_t)new_width * new_height * channels);
+    for (uint32_t y = 0; y < new_height; ++y)
+    {
+        uint32_t const source_y0 = y * 2;
+        uint32_t const source_y1 = std::min(y * 2 + 1, height - 1);
+        for (uint32_t x = 0; x < new_width; ++x)
+        {
+            uint32_t const source_x0 = x * 2;
+            uint32_t const source_x1 = std::min(x * 2 + 1, width - 1);
+            for (uint32_t c = 0; c < channels; ++c)
+            {
+                uint32_t const sum = source[((size_t)source_y0 * width + source_x0) * channels + c]
+                                   + source[((size_t)source_y0 * width + source_x1) * channels + c]
+                                   + source[((size_t)source_y1 * width + source_x0) * channels + c]
+                                   + source[((size_t)source_y1 * width + source_x1) * channels + c];
+                result[((size_t)y * new_width + x) * channels + c] = (uint8_t)((sum + 2) / 4);
+            }
+        }
+    }
+    return result;
+}
+
+/** Transcodes the top mip of the passed in image to the target block-compressed format, generating
+ * and compressing the full mip chain. */
+void compressImage(GfxImage &image, DXGI_FORMAT target) noexcept
+{
+    uint32_t const channels   = image.channel_count;
+    uint32_t       width      = image.width;
+    uint32_t       height     = image.height;
+    uint32_t const mip_count  = gfxCalculateMipCount(width, height);
+    uint32_t const block_size =
+        (target == DXGI_FORMAT_BC1_UNORM || target == DXGI_FORMAT_BC1_UNORM_SRGB) ? 8u : 16u;
+
+    std::vector<uint8_t> level(
+        image.data.begin(), image.data.begin() + (size_t)width * height * channels);
+    std::vector<uint8_t> output;
+    output.reserve(((size_t)((width + 3) / 4) * ((height + 3) / 4) * block_size * 4) / 3);
+
+    for (uint32_t mip = 0; mip < mip_count; ++mip)
+    {
+        uint32_t const block_width  = (width + 3) / 4;
+        uint32_t const block_height = (height + 3) / 4;
+        size_t const   offset       = output.size();
+        output.resize(offset + (size_t)block_width * block_height * block_size);
+
+        for (uint32_t block_y = 0; block_y < block_height; ++block_y)
+        {
+            for (uint32_t block_x = 0; block_x < block_width; ++block_x)
+            {
+                uint8_t texels[16][4];
+                extractBlock(level.data(), width, height, channels, block_x, block_y, texels);
+                uint8_t *const block =
+                    &output[offset + ((size_t)block_y * block_width + block_x) * block_size];
+
+                switch (target)
+                {
+                case DXGI_FORMAT_BC3_UNORM:
+                case DXGI_FORMAT_BC3_UNORM_SRGB:
+                {
+                    uint8_t alpha[16];
+                    for (uint32_t i = 0; i < 16; ++i)
+                    {
+                        alpha[i] = texels[i][3];
+                    }
+                    compressBlockBC4(alpha, block);
+                    compressBlockBC1(texels, block + 8);
+                    break;
+                }
+                case DXGI_FORMAT_BC5_UNORM:
+                {
+                    uint8_t red[16];
+                    uint8_t green[16];
+                    for (uint32_t i = 0; i < 16; ++i)
+                    {
+                        red[i]   = texels[i][0];
+                        green[i] = texels[i][1];
+                    }
+                    compressBlockBC4(red, block);
+                    compressBlockBC4(green, block + 8);
+                    break;
+                }
+                default: compressBlockBC1(texels, block); break;
+                }
+            }
+        }
+
+        if (mip + 1 < mip_count)
+        {
+            level = downsampleMip(level, width, height, channels);
+            width  = std::max(width >> 1, 1u);
+            height = std::max(height >> 1, 1u);
+        }
+    }
+
+    image.data   = std::move(output);
+    image.format = target;
+    image.flags |= kGfxImageFlag_HasMipLevels;
+}
+
+/** Attempts to apply a previously cached transcode to the scene images.
+ * @returns The number of images restored from the cache, 0 if no valid cache was found. */
+uint32_t loadCache(std::filesystem::path const &path, GfxScene scene) noexcept
+{
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open())
+    {
+        return 0;
+    }
+
+    CacheHeader header = {};
+    file.read((char *)&header, sizeof(header));
+    if (!file.good() || header.magic != kCacheMagic || header.version != kCacheVersion)
+    {
+        return 0;
+    }
+
+    // Map scene object handles back to the imported images
+    uint32_t const        image_count = gfxSceneGetObjectCount<GfxImage>(scene);
+    GfxImage *const       images      = gfxSceneGetObjects<GfxImage>(scene);
+    std::vector<GfxImage *> images_by_handle;
+    for (uint32_t i = 0; i < image_count; ++i)
+    {
+        uint32_t const handle = (uint32_t)gfxSceneGetObjectHandle<GfxImage>(scene, i);
+        if (handle >= images_by_handle.size())
+        {
+            images_by_handle.resize((size_t)handle + 1, nullptr);
+        }
+        images_by_handle[handle] = &images[i];
+    }
+
+    uint32_t restored = 0;
+    for (uint32_t i = 0; i < header.image_count; ++i)
+    {
+        CacheEntryHeader entry = {};
+        file.read((char *)&entry, sizeof(entry));
+        if (!file.good() || entry.image_index >= images_by_handle.size()
+            || images_by_handle[entry.image_index] == nullptr)
+        {
+            return 0; // scene no longer matches the cache, fall back to transcoding
+        }
+
+        GfxImage &image = *images_by_handle[entry.image_index];
+        image.data.resize(entry.data_size);
+        file.read((char *)image.data.data(), (std::streamsize)entry.data_size);
+        if (!file.good())
+        {
+            return 0;
+        }
+        image.format = (DXGI_FORMAT)entry.format;
+        image.flags |= kGfxImageFlag_HasMipLevels;
+        ++restored;
+    }
+    return restored;
+}
+
+/** Serializes the transcoded images to the cache file. */
+void saveCache(std::filesystem::path const &path,
+    std::vector<std::pair<GfxImage const *, uint32_t>> const &transcoded) noexcept
+{
+    std::error_code ec;
+    std::filesystem::create_directories(path.parent_path(), ec);
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file.is_open())
+    {
+        return;
+    }
+
+    CacheHeader header = {};
+    header.magic       = kCacheMagic;
+    header.version     = kCacheVersion;
+    header.image_count = (uint32_t)transcoded.size();
+    file.write((char const *)&header, sizeof(header));
+
+    for (auto const &[image, handle] : transcoded)
+    {
+        CacheEntryHeader entry = {};
+        entry.image_index      = handle;
+        entry.format           = (uint32_t)image->format;
+        entry.data_size        = image->data.size();
+        file.write((char const *)&entry, sizeof(entry));
+        file.write((char const *)image->data.data(), (std::streamsize)image->data.size());
+    }
+}
+} // unnamed namespace
+
+uint32_t TranscodeSceneTextures(GfxScene scene, std::vector<std::string> const &scene_files) noexcept
+{
+    uint32_t const image_count = gfxSceneGetObjectCount<GfxImage>(scene);
+    if (image_count == 0)
+    {
+        return 0;
+    }
+
+    auto const path = getCachePath(scene_files);
+    if (!scene_files.empty())
+    {
+        if (uint32_t const restored = loadCache(path, scene); restored != 0)
+        {
+            return restored;
+        }
+    }
+
+    // Normal maps need both channels preserved independently so get BC5, everything else is treated
+    // as colour data
+    GfxMaterial const *materials      = gfxSceneGetObjects<GfxMaterial>(scene);
+    uint32_t const     material_count = gfxSceneGetObjectCount<GfxMaterial>(scene);
+    std::vector<bool>  is_normal_map;
+    for (uint32_t i = 0; i < material_count; ++i)
+    {
+        if (!materials[i].normal_map)
+        {
+            continue;
+        }
+        uint32_t const handle = (uint32_t)materials[i].normal_map;
+        if (handle >= is_normal_map.size())
+        {
+            is_normal_map.resize((size_t)handle + 1, false);
+        }
+        is_normal_map[handle] = true;
+    }
+
+    struct TranscodeJob
+    {
+        GfxImage   *image;
+        uint32_t    handle;
+        DXGI_FORMAT target;
+    };
+
+    GfxImage *const           images = gfxSceneGetObjects<GfxImage>(scene);
+    std::vector<TranscodeJob> jobs;
+    for (uint32_t i = 0; i < image_count; ++i)
+    {
+        GfxImage &image = images[i];
+
+        // Only 8-bit RGBA-ordered sources are supported, anything else (HDR environment maps,
+        // already compressed DDS content) is left untouched
+        if (image.format != DXGI_FORMAT_R8_UNORM && image.format != DXGI_FORMAT_R8G8_UNORM
+            && image.format != DXGI_FORMAT_R8G8B8A8_UNORM
+            && image.format != DXGI_FORMAT_R8G8B8A8_UNORM_SRGB)
+        {
+            continue;
+        }
+        // D3D12 requires the top level of a BC texture to be a multiple of the 4x4 block size, so
+        // non-aligned images are left uncompressed rather than failing GPU texture creation
+        if (image.bytes_per_channel != 1 || image.width < 4 || image.height < 4
+            || (image.width % 4) != 0 || (image.height % 4) != 0
+            || image.data.size() < (size_t)image.width * image.height * image.channel_count)
+        {
+            continue;
+        }
+
+        uint32_t const handle = (uint32_t)gfxSceneGetObjectHandle<GfxImage>(scene, i);
+        bool const     normal = handle < is_normal_map.size() && is_normal_map[handle];
+        bool const     srgb   = image.format == DXGI_FORMAT_R8G8B8A8_UNORM_SRGB;
+
+        DXGI_FORMAT target;
+        if (normal)
+        {
+            target = DXGI_FORMAT_BC5_UNORM;
+        }
+        else if ((image.flags & kGfxImageFlag_HasAlphaChannel) != 0)
+        {
+            target = srgb ? DXGI_FORMAT_BC3_UNORM_SRGB : DXGI_FORMAT_BC3_UNORM;
+        }
+        else
+        {
+            target = srgb ? DXGI_FORMAT_BC1_UNORM_SRGB : DXGI_FORMAT_BC1_UNORM;
+        }
+        jobs.push_back({&image, handle, target});
+    }
+
+    if (jobs.empty())
+    {
+        return 0;
+    }
+
+    ThreadPool().Dispatch(
+        [&](uint32_t i) noexcept { compressImage(*jobs[i].image, jobs[i].target); },
+        (uint32_t)jobs.size(), 1);
+
+    if (!scene_files.empty())
+    {
+        std::vector<std::pair<GfxImage const *, uint32_t>> transcoded;
+        transcoded.reserve(jobs.size());
+        for (auto const &job : jobs)
+        {
+            transcoded.emplace_back(job.image, job.handle);
+        }
+        saveCache(path, transcoded);
+    }
+    return (uint32_t)jobs.size();
+}
+} // namespace TextureCompression
+} // namespace Capsaicin
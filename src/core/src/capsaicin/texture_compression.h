@@ -0,0 +1,48 @@
+/**********************************************************************
+Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+********************************************************************/
+#pragma once
+
+#include <gfx_scene.h>
+#include <string>
+#include <vector>
+
+namespace Capsaicin
+{
+/**
+ * Load-time block compression of imported scene textures.
+ * Uncompressed 8-bit scene textures are transcoded in place after import: normal maps become BC5,
+ * colour maps become BC1 (BC3 when the source carries an alpha channel), each with a full CPU
+ * generated mip chain. Compression runs as parallel jobs on the ThreadPool and the results are
+ * cached to disk beside the scene cache so subsequent loads of the same files skip the transcode.
+ */
+namespace TextureCompression
+{
+/**
+ * Transcodes all eligible textures of the passed in scene to block-compressed formats in place.
+ * This only performs CPU side operations and so is safe to call from a background thread.
+ * @param scene       The scene whose imported images should be transcoded.
+ * @param scene_files The source scene files (used to key the on-disk transcode cache).
+ * @returns The number of textures now stored block-compressed (transcoded or loaded from cache).
+ */
+uint32_t TranscodeSceneTextures(GfxScene scene, std::vector<std::string> const &scene_files) noexcept;
+} // namespace TextureCompression
+} // namespace Capsaicin
@@ -23,18 +23,18 @@ THE SOFTWARE.
 
 namespace Capsaicin
 {
-bool                  ThreadPool::terminate_;
-uint32_t              ThreadPool::thread_count_;
-uint32_t              ThreadPool::count_;
-uint32_t              ThreadPool::block_size_;
-uint32_t              ThreadPool::block_count_;
-std::atomic<uint32_t> ThreadPool::block_index_;
-
-std::mutex                              ThreadPool::mutex_;
-std::condition_variable                 ThreadPool::sync_;
-std::condition_variable                 ThreadPool::signal_;
-std::unique_ptr<ThreadPool::KernelBase> ThreadPool::kernel_;
-std::vector<std::thread>                ThreadPool::threads_;
+bool     ThreadPool::terminate_;
+uint32_t ThreadPool::thread_count_;
+uint32_t ThreadPool::count_;
+uint32_t ThreadPool::block_size_;
+uint32_t ThreadPool::block_count_;
+
+std::mutex                                          ThreadPool::mutex_;
+std::condition_variable                             ThreadPool::sync_;
+std::condition_variable                             ThreadPool::signal_;
+std::unique_ptr<ThreadPool::KernelBase>             ThreadPool::kernel_;
+std::vector<std::thread>                            ThreadPool::threads_;
+std::vector<std::unique_ptr<ThreadPool::WorkQueue>> ThreadPool::queues_;
 
 uint32_t ThreadPool::GetThreadCount()
 {
@@ -51,10 +51,17 @@ bool ThreadPool::Create(uint32_t thread_count)
 
     threads_.reserve(thread_count);
 
+    // Create the per-thread work deques before any thread starts
+    queues_.resize(thread_count);
+    for (size_t i = 0; i < queues_.size(); ++i)
+    {
+        queues_[i] = std::make_unique<WorkQueue>();
+    }
+
     // Spawn requested number of threads
     for (size_t i = 0; i < threads_.capacity(); ++i)
     {
-        threads_.push_back(std::thread(Worker));
+        threads_.push_back(std::thread(Worker, (uint32_t)i));
     }
 
     // Wait for all threads to have started
@@ -84,11 +91,42 @@ void ThreadPool::Destroy()
     }
 
     threads_.resize(0);
+    queues_.resize(0);
 
     thread_count_ = 0;
 }
 
-void ThreadPool::Worker()
+bool ThreadPool::GetBlock(uint32_t thread_index, uint32_t &block_index)
+{
+    // Pop from the back of our own deque first (most recently pushed, still cache warm)
+    {
+        WorkQueue                  &queue = *queues_[thread_index];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (!queue.blocks.empty())
+        {
+            block_index = queue.blocks.back();
+            queue.blocks.pop_back();
+            return true;
+        }
+    }
+
+    // Our deque has run dry, steal from the front of another threads deque
+    for (size_t i = 1; i < queues_.size(); ++i)
+    {
+        WorkQueue                  &queue = *queues_[(thread_index + i) % queues_.size()];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (!queue.blocks.empty())
+        {
+            block_index = queue.blocks.front();
+            queue.blocks.pop_front();
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void ThreadPool::Worker(uint32_t thread_index)
 {
     for (;;)
     {
@@ -105,7 +143,7 @@ void ThreadPool::Worker()
 
         // Process all the available blocks
         {
-            kernel_->Run();
+            kernel_->Run(thread_index);
         }
     }
 }
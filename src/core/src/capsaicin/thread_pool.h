@@ -24,6 +24,7 @@ THE SOFTWARE.
 #include <algorithm>
 #include <atomic>
 #include <cstdint>
+#include <deque>
 #include <memory>
 #include <mutex>
 #include <thread>
@@ -54,9 +55,20 @@ public:
         }
         else
         {
+            // Distribute the blocks round-robin across the per-thread deques. Threads consume their
+            // own deque first and steal from other deques once it runs dry.
+            for (size_t i = 0; i < queues_.size(); ++i)
+            {
+                std::lock_guard<std::mutex> lock(queues_[i]->mutex);
+                queues_[i]->blocks.clear();
+                for (uint32_t block = (uint32_t)i; block < block_count_; block += (uint32_t)queues_.size())
+                {
+                    queues_[i]->blocks.push_back(block);
+                }
+            }
+
             // Install the kernel
-            block_index_ = 0;
-            kernel_      = std::make_unique<Kernel<KERNEL>>(kernel);
+            kernel_ = std::make_unique<Kernel<KERNEL>>(kernel);
 
             // And dispatch
             thread_count_ = 0; // consume all threads from the pool
@@ -91,7 +103,7 @@ protected:
 
         inline virtual ~KernelBase() {}
 
-        inline virtual void Run() = 0 {}
+        inline virtual void Run(uint32_t thread_index) = 0;
     };
 
     template<typename KERNEL>
@@ -102,13 +114,13 @@ protected:
             : kernel_(kernel)
         {}
 
-        void Run() override
+        void Run(uint32_t thread_index) override
         {
             for (;;)
             {
-                uint32_t const block_index = block_index_++;
+                uint32_t block_index;
 
-                if (block_index >= block_count_)
+                if (!GetBlock(thread_index, block_index))
                 {
                     break; // everything has been processed
                 }
@@ -128,19 +140,36 @@ protected:
         KERNEL const &kernel_; /**< The kernel to be executed.*/
     };
 
-    static void Worker();
-
-    static bool                  terminate_;    /**< Whether to terminate the threads. */
-    static uint32_t              thread_count_; /**< The number of available threads. */
-    static uint32_t              count_;        /**< The number of kernel invocations. */
-    static uint32_t              block_size_;   /**< The size of a block. */
-    static uint32_t              block_count_;  /**< The number of available blocks. */
-    static std::atomic<uint32_t> block_index_;  /**< The index of the currently executed block. */
+    /** A per-thread deque of remaining block indices. */
+    struct WorkQueue
+    {
+        std::deque<uint32_t> blocks; /**< Remaining block indices owned by this thread */
+        std::mutex           mutex;  /**< Protects access from the owner and stealing threads */
+    };
 
-    static std::mutex                  mutex_;   /**< The mutex for synchronization. */
-    static std::condition_variable     sync_;    /**< The condition variable for synchronizing. */
-    static std::condition_variable     signal_;  /**< The condition variable for signalling. */
-    static std::unique_ptr<KernelBase> kernel_;  /**< The kernel scheduled for execution. */
-    static std::vector<std::thread>    threads_; /**< The available CPU threads. */
+    /**
+     * Gets the next block to process for the given thread.
+     * Pops from the back of the threads own deque first, then steals from the front of another
+     * threads deque once the own deque has run dry.
+     * @param thread_index     The index of the calling thread.
+     * @param [out] block_index The popped/stolen block index.
+     * @returns True if a block was retrieved, False if all blocks have been consumed.
+     */
+    static bool GetBlock(uint32_t thread_index, uint32_t &block_index);
+
+    static void Worker(uint32_t thread_index);
+
+    static bool     terminate_;    /**< Whether to terminate the threads. */
+    static uint32_t thread_count_; /**< The number of available threads. */
+    static uint32_t count_;        /**< The number of kernel invocations. */
+    static uint32_t block_size_;   /**< The size of a block. */
+    static uint32_t block_count_;  /**< The number of available blocks. */
+
+    static std::mutex                              mutex_;   /**< The mutex for synchronization. */
+    static std::condition_variable                 sync_;    /**< The condition variable for synchronizing. */
+    static std::condition_variable                 signal_;  /**< The condition variable for signalling. */
+    static std::unique_ptr<KernelBase>             kernel_;  /**< The kernel scheduled for execution. */
+    static std::vector<std::thread>                threads_; /**< The available CPU threads. */
+    static std::vector<std::unique_ptr<WorkQueue>> queues_;  /**< The per-thread work deques. */
 };
 } // namespace Capsaicin
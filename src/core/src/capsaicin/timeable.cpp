@@ -27,6 +27,7 @@ namespace Capsaicin
 Timeable::TimedSection::TimedSection(Timeable &parentTimeable, std::string_view const &name) noexcept
     : parent(parentTimeable)
     , queryIndex(parent.queryCount++)
+    , cpuStart(std::chrono::steady_clock::now())
 {
     if (queryIndex >= (uint32_t)parent.queries.size())
     {
@@ -42,6 +43,8 @@ Timeable::TimedSection::~TimedSection() noexcept
 {
     gfxCommandEndTimestampQuery(parent.gfx_, parent.queries[queryIndex].query);
     gfxCommandEndEvent(parent.gfx_);
+    parent.queries[queryIndex].cpuTime =
+        std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - cpuStart).count();
 }
 
 Timeable::Timeable(std::string_view const &name) noexcept
@@ -21,6 +21,7 @@ THE SOFTWARE.
 ********************************************************************/
 #pragma once
 
+#include <chrono>
 #include <gfx.h>
 #include <string_view>
 
@@ -31,6 +32,7 @@ class TimestampQuery
 public:
     std::string_view  name; /**< The name of the time stamp */
     GfxTimestampQuery query;
+    float             cpuTime = 0.0f; /**< The CPU duration of the timed section (ms) */
 };
 
 class Timeable
@@ -46,8 +48,9 @@ public:
         ~TimedSection() noexcept;
 
     private:
-        Timeable      &parent;
-        uint32_t const queryIndex;
+        Timeable                                   &parent;
+        uint32_t const                              queryIndex;
+        std::chrono::steady_clock::time_point const cpuStart; /**< CPU time at section start */
     };
 
     /** Defaulted constructor. */
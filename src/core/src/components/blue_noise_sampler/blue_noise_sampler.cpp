@@ -25,6 +25,8 @@ THE SOFTWARE.
 #include "blue_noise_sampler_samples.h" // Separate file as does not play well with IDEs
 #include "capsaicin_internal.h"
 
+#include <cstring>
+
 namespace Capsaicin
 {
 /** Constructor. */
@@ -38,12 +40,35 @@ BlueNoiseSampler::~BlueNoiseSampler() noexcept
     terminate();
 }
 
+ShaderDirectoryList BlueNoiseSampler::getShaderDirectories() const noexcept
+{
+    return {}; // compiles no shader kernels
+}
+
 bool BlueNoiseSampler::init([[maybe_unused]] CapsaicinInternal const &capsaicin) noexcept
 {
-    sobolBuffer          = gfxCreateBuffer(gfx_, sizeof(Sobol256x256), Sobol256x256);
-    rankingTileBuffer    = gfxCreateBuffer(gfx_, sizeof(RankingTiles), RankingTiles);
-    scramblingTileBuffer = gfxCreateBuffer(gfx_, sizeof(ScramblingTiles), ScramblingTiles);
-    return true;
+    sobolBuffer          = gfxCreateBuffer(gfx_, sizeof(Sobol256x256));
+    rankingTileBuffer    = gfxCreateBuffer(gfx_, sizeof(RankingTiles));
+    scramblingTileBuffer = gfxCreateBuffer(gfx_, sizeof(ScramblingTiles));
+
+    // The tables are compile-time embedded so they can all go through a single staging allocation
+    // and batched copy instead of one implicit upload pass per buffer
+    GfxBuffer uploadBuffer = gfxCreateBuffer(
+        gfx_, sizeof(Sobol256x256) + sizeof(RankingTiles) + sizeof(ScramblingTiles), nullptr,
+        kGfxCpuAccess_Write);
+    uint8_t *uploadData = gfxBufferGetData<uint8_t>(gfx_, uploadBuffer);
+    memcpy(uploadData, Sobol256x256, sizeof(Sobol256x256));
+    memcpy(uploadData + sizeof(Sobol256x256), RankingTiles, sizeof(RankingTiles));
+    memcpy(uploadData + sizeof(Sobol256x256) + sizeof(RankingTiles), ScramblingTiles,
+        sizeof(ScramblingTiles));
+
+    gfxCommandCopyBuffer(gfx_, sobolBuffer, 0, uploadBuffer, 0, sizeof(Sobol256x256));
+    gfxCommandCopyBuffer(
+        gfx_, rankingTileBuffer, 0, uploadBuffer, sizeof(Sobol256x256), sizeof(RankingTiles));
+    gfxCommandCopyBuffer(gfx_, scramblingTileBuffer, 0, uploadBuffer,
+        sizeof(Sobol256x256) + sizeof(RankingTiles), sizeof(ScramblingTiles));
+    gfxDestroyBuffer(gfx_, uploadBuffer); // release is deferred until the copies retire
+    return !!sobolBuffer && !!rankingTileBuffer && !!scramblingTileBuffer;
 }
 
 void BlueNoiseSampler::run([[maybe_unused]] CapsaicinInternal &capsaicin) noexcept
@@ -42,6 +42,13 @@ public:
     /** Destructor. */
     virtual ~BlueNoiseSampler() noexcept;
 
+    /**
+     * Gets a list of the shader directories (relative to the shader root) that hold the shader
+     * source compiled by the current component.
+     * @return A list of all shader directories.
+     */
+    ShaderDirectoryList getShaderDirectories() const noexcept override;
+
     /**
      * Initialise any internal data or state.
      * @note This is automatically called by the framework after construction and should be used to create
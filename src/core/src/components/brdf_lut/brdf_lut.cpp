@@ -23,6 +23,7 @@ THE SOFTWARE.
 #include "brdf_lut.h"
 
 #include "capsaicin_internal.h"
+#include "utilities/texture_cache.h"
 
 namespace Capsaicin
 {
@@ -35,6 +36,11 @@ BrdfLut::~BrdfLut() noexcept
     terminate();
 }
 
+ShaderDirectoryList BrdfLut::getShaderDirectories() const noexcept
+{
+    return {"components/brdf_lut"};
+}
+
 bool BrdfLut::init(CapsaicinInternal const &capsaicin) noexcept
 {
     brdf_lut_buffer_ = gfxCreateTexture2D(gfx_, brdf_lut_size_, brdf_lut_size_, DXGI_FORMAT_R16G16_FLOAT);
@@ -42,12 +48,43 @@ bool BrdfLut::init(CapsaicinInternal const &capsaicin) noexcept
 
     GfxProgram const brdf_lut_program =
         gfxCreateProgram(gfx_, "components/brdf_lut/brdf_lut", capsaicin.getShaderPath());
-    GfxKernel const brdf_lut_kernel = gfxCreateComputeKernel(gfx_, brdf_lut_program, "ComputeBrdfLut");
 
     gfxProgramSetParameter(gfx_, brdf_lut_program, "g_LutBuffer", brdf_lut_buffer_);
     gfxProgramSetParameter(gfx_, brdf_lut_program, "g_LutSize", brdf_lut_size_);
     gfxProgramSetParameter(gfx_, brdf_lut_program, "g_SampleSize", brdf_lut_sample_size_);
 
+    // The LUT only depends on its resolution and sample count so key the cache on those, any
+    // change to the constants invalidates the cached data
+    uint64_t const cache_key   = ((uint64_t)brdf_lut_size_ << 32) | brdf_lut_sample_size_;
+    uint32_t const texel_count = brdf_lut_size_ * brdf_lut_size_;
+
+    TextureCache::View cache_view;
+    if (TextureCache::Load("brdf_lut", cache_key, cache_view)
+        && cache_view.size == texel_count * sizeof(uint32_t))
+    {
+        // Upload the cached LUT instead of regenerating it
+        GfxKernel const copy_kernel = gfxCreateComputeKernel(gfx_, brdf_lut_program, "CopyLutFromCache");
+
+        GfxBuffer cache_buffer = gfxCreateBuffer<uint32_t>(gfx_, texel_count, cache_view.data);
+        cache_buffer.setName("Capsaicin_BrdfLut_CacheBuffer");
+
+        gfxProgramSetParameter(gfx_, brdf_lut_program, "g_CacheBuffer", cache_buffer);
+
+        uint32_t const *num_threads  = gfxKernelGetNumThreads(gfx_, copy_kernel);
+        uint32_t const  num_groups_x = (brdf_lut_size_ + num_threads[0] - 1) / num_threads[0];
+        uint32_t const  num_groups_y = (brdf_lut_size_ + num_threads[1] - 1) / num_threads[1];
+        gfxCommandBindKernel(gfx_, copy_kernel);
+        gfxCommandDispatch(gfx_, num_groups_x, num_groups_y, 1);
+
+        gfxDestroyBuffer(gfx_, cache_buffer);
+        gfxDestroyKernel(gfx_, copy_kernel);
+        gfxDestroyProgram(gfx_, brdf_lut_program);
+
+        return true;
+    }
+
+    GfxKernel const brdf_lut_kernel = gfxCreateComputeKernel(gfx_, brdf_lut_program, "ComputeBrdfLut");
+
     // Compute BRDF LUT once in initialization
     uint32_t const *num_threads  = gfxKernelGetNumThreads(gfx_, brdf_lut_kernel);
     uint32_t const  num_groups_x = (brdf_lut_size_ + num_threads[0] - 1) / num_threads[0];
@@ -55,6 +92,29 @@ bool BrdfLut::init(CapsaicinInternal const &capsaicin) noexcept
     gfxCommandBindKernel(gfx_, brdf_lut_kernel);
     gfxCommandDispatch(gfx_, num_groups_x, num_groups_y, 1);
 
+    // Read the generated LUT back and persist it to disk, the stall is acceptable as the LUT is
+    // only ever generated once
+    GfxKernel const copy_kernel = gfxCreateComputeKernel(gfx_, brdf_lut_program, "CopyLutToCache");
+
+    GfxBuffer cache_buffer = gfxCreateBuffer<uint32_t>(gfx_, texel_count);
+    cache_buffer.setName("Capsaicin_BrdfLut_CacheBuffer");
+    GfxBuffer readback_buffer = gfxCreateBuffer<uint32_t>(gfx_, texel_count, nullptr, kGfxCpuAccess_Read);
+    readback_buffer.setName("Capsaicin_BrdfLut_ReadbackBuffer");
+
+    gfxProgramSetParameter(gfx_, brdf_lut_program, "g_CacheBuffer", cache_buffer);
+
+    gfxCommandBindKernel(gfx_, copy_kernel);
+    gfxCommandDispatch(gfx_, num_groups_x, num_groups_y, 1);
+
+    gfxCommandCopyBuffer(gfx_, readback_buffer, cache_buffer);
+    gfxFinish(gfx_);
+
+    TextureCache::Save("brdf_lut", cache_key, gfxBufferGetData<uint32_t>(gfx_, readback_buffer),
+        texel_count * sizeof(uint32_t));
+
+    gfxDestroyBuffer(gfx_, readback_buffer);
+    gfxDestroyBuffer(gfx_, cache_buffer);
+    gfxDestroyKernel(gfx_, copy_kernel);
     gfxDestroyKernel(gfx_, brdf_lut_kernel);
     gfxDestroyProgram(gfx_, brdf_lut_program);
 
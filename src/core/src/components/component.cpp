@@ -43,5 +43,15 @@ BufferList Component::getBuffers() const noexcept
     return {};
 }
 
+ShaderDirectoryList Component::getShaderDirectories() const noexcept
+{
+    return {""}; // conservatively depend on the whole shader tree
+}
+
+QueueAffinity Component::getQueueAffinity() const noexcept
+{
+    return QueueAffinity::Direct;
+}
+
 void Component::renderGUI([[maybe_unused]] CapsaicinInternal &capsaicin) const noexcept {}
 } // namespace Capsaicin
@@ -65,6 +65,26 @@ public:
      */
     virtual BufferList getBuffers() const noexcept;
 
+    /**
+     * Gets a list of the shader directories (relative to the shader root) that hold the shader
+     * source compiled by the current component.
+     * This is used by shader reloading to only re-initialise the components whose shader source
+     * actually changed (files including a changed shared header count as changed themselves). The
+     * default implementation returns the shader root so components that do not override it are
+     * conservatively re-initialised on any change; components that compile no shaders should
+     * return an empty list.
+     * @return A list of all shader directories.
+     */
+    virtual ShaderDirectoryList getShaderDirectories() const noexcept;
+
+    /**
+     * Gets the queue that the component's GPU work should be scheduled on.
+     * @note Components returning QueueAffinity::AsyncCompute must only record compute work and must not
+     * read results produced by any other component/technique run within the same async region.
+     * @return The requested queue affinity.
+     */
+    virtual QueueAffinity getQueueAffinity() const noexcept;
+
     /**
      * Initialise any internal data or state.
      * @note This is automatically called by the framework after construction and should be used to create
@@ -28,6 +28,13 @@ THE SOFTWARE.
 
 namespace Capsaicin
 {
+namespace
+{
+/** Per face texel resolution of the environment alias table (must match
+ * ENVIRONMENT_ALIAS_FACE_RESOLUTION in environment_alias.hlsl) */
+constexpr uint32_t environmentAliasFaceResolution = 64;
+} // namespace
+
 LightBuilder::LightBuilder() noexcept
     : Component(Name)
 {}
@@ -46,6 +53,11 @@ RenderOptionList LightBuilder::getRenderOptions() noexcept
     return newOptions;
 }
 
+ShaderDirectoryList LightBuilder::getShaderDirectories() const noexcept
+{
+    return {"components/light_builder"};
+}
+
 LightBuilder::RenderOptions LightBuilder::convertOptions(RenderOptionList const &options) noexcept
 {
     RenderOptions newOptions;
@@ -65,19 +77,29 @@ bool LightBuilder::init(CapsaicinInternal const &capsaicin) noexcept
     lightCountBuffer = gfxCreateBuffer<uint32_t>(gfx_, 1);
     lightCountBuffer.setName("LightCountBuffer");
 
-    const uint32_t backBufferCount = gfxGetBackBufferCount(gfx_);
-    lightCountBufferTemp.reserve(backBufferCount);
-    for (uint32_t i = 0; i < backBufferCount; ++i)
-    {
-        GfxBuffer   buffer = gfxCreateBuffer<uint32_t>(gfx_, 1, nullptr, kGfxCpuAccess_Read);
-        std::string name   = "AreaLightCountCopyBuffer";
-        name += std::to_string(i);
-        buffer.setName(name.c_str());
-        lightCountBufferTemp.emplace_back(false, buffer);
-    }
     lightHash = 0;
 
-    return !!gatherAreaLightsProgram;
+    // Create the environment map alias table used for importance sampling environment lights
+    uint32_t const aliasEntries =
+        6 * environmentAliasFaceResolution * environmentAliasFaceResolution;
+    environmentAliasProbabilityBuffer = gfxCreateBuffer<float>(gfx_, aliasEntries);
+    environmentAliasProbabilityBuffer.setName("Capsaicin_EnvironmentAliasProbabilityBuffer");
+    environmentAliasIndexBuffer = gfxCreateBuffer<uint32_t>(gfx_, aliasEntries);
+    environmentAliasIndexBuffer.setName("Capsaicin_EnvironmentAliasIndexBuffer");
+    environmentAliasPDFBuffer = gfxCreateBuffer<float>(gfx_, aliasEntries);
+    environmentAliasPDFBuffer.setName("Capsaicin_EnvironmentAliasPDFBuffer");
+    environmentAliasWeightBuffer = gfxCreateBuffer<float>(gfx_, aliasEntries);
+    environmentAliasWeightBuffer.setName("Capsaicin_EnvironmentAliasWeightBuffer");
+
+    reducerSum.initialise(capsaicin, GPUReduce::Type::Float, GPUReduce::Operation::Sum);
+
+    environmentAliasProgram =
+        gfxCreateProgram(gfx_, "components/light_builder/environment_alias", capsaicin.getShaderPath());
+    calculateWeightsKernel = gfxCreateComputeKernel(gfx_, environmentAliasProgram, "CalculateWeights");
+    buildAliasTableKernel  = gfxCreateComputeKernel(gfx_, environmentAliasProgram, "BuildAliasTable");
+    pairAliasTableKernel   = gfxCreateComputeKernel(gfx_, environmentAliasProgram, "PairAliasTable");
+
+    return !!gatherAreaLightsProgram && !!environmentAliasProgram;
 }
 
 void LightBuilder::run(CapsaicinInternal &capsaicin) noexcept
@@ -109,12 +131,14 @@ void LightBuilder::run(CapsaicinInternal &capsaicin) noexcept
             gfxSceneGetObjects<GfxLight>(scene), gfxSceneGetObjectCount<GfxLight>(scene));
 
     // Get last valid area light count value
-    const uint32_t bufferIndex = gfxGetBackBufferIndex(gfx_);
-    if (lightCountBufferTemp[bufferIndex].first)
+    if (lightCountStatsSlot == ~0u)
     {
-        areaLightCount = *gfxBufferGetData<uint32_t>(gfx_, lightCountBufferTemp[bufferIndex].second);
+        lightCountStatsSlot = capsaicin.getGpuStatistics().registerCounter("LightBuilder_LightCount");
+    }
+    if (lightCountPending > 0 && --lightCountPending == 0)
+    {
+        areaLightCount = capsaicin.getGpuStatistics().getValue(lightCountStatsSlot);
         areaLightCount -= deltaLightCount + environmentMapCount;
-        lightCountBufferTemp[bufferIndex].first = false;
     }
 
     auto     environmentMap     = capsaicin.getEnvironmentBuffer();
@@ -137,8 +161,7 @@ void LightBuilder::run(CapsaicinInternal &capsaicin) noexcept
     if (oldLightHash != lightHash
         || (capsaicin.getEnvironmentMapUpdated() && options.environment_light_enable)
         || (oldAreaLightMaxCount != areaLightMaxCount) || (oldDeltaLightCount != deltaLightCount)
-        || lightSettingChanged
-        || (areaLightMaxCount > 0 && (capsaicin.getMeshesUpdated() || capsaicin.getTransformsUpdated())))
+        || lightSettingChanged || (areaLightMaxCount > 0 && capsaicin.getMeshesUpdated()))
     {
         lightsUpdated = true;
 
@@ -253,6 +276,10 @@ void LightBuilder::run(CapsaicinInternal &capsaicin) noexcept
                 lightInstancePrimitiveBuffer.setName("Capsaicin_LightInstancePrimitiveBuffer");
             }
 
+            // Instance handles are sparse so after deletions they can exceed the current object
+            // count; size the hash array by the handle range like the other handle-indexed arrays
+            instanceHashes.clear();
+            instanceHashes.resize(instanceCount);
             for (uint32_t i = 0; i < instanceCount; ++i)
             {
                 GfxConstRef<GfxInstance> instanceRef = gfxSceneGetObjectHandle<GfxInstance>(scene, i);
@@ -268,6 +295,16 @@ void LightBuilder::run(CapsaicinInternal &capsaicin) noexcept
                 Instance const &instance         = capsaicin.getInstanceData()[instanceIndex];
                 Mesh const     &mesh             = capsaicin.getMeshData()[instance.mesh_index];
 
+                if (instanceIndex >= instanceHashes.size())
+                {
+                    instanceHashes.resize((size_t)instanceIndex + 1);
+                }
+
+                // Record the transform used for the build so that later transform only updates can
+                // detect which instances actually changed
+                instanceHashes[instanceIndex] = HashBytes(
+                    &capsaicin.getTransformData()[instance.transform_index], sizeof(glm::mat4x3));
+
                 drawCommands[drawCommandIndex].IndexCountPerInstance = mesh.index_count;
                 drawCommands[drawCommandIndex].InstanceCount         = 1;
                 drawCommands[drawCommandIndex].StartIndexLocation    = mesh.index_offset_idx;
@@ -312,32 +349,171 @@ void LightBuilder::run(CapsaicinInternal &capsaicin) noexcept
             // history. If all that happened is a change in transforms then we can ignore
             if (oldAreaLightMaxCount != areaLightMaxCount || capsaicin.getMeshesUpdated())
             {
-                for (auto &i : lightCountBufferTemp)
-                {
-                    i.first = false;
-                }
                 areaLightCount = areaLightMaxCount;
             }
 
-            // Begin copy of new value (will take 'bufferIndex' number of frames to become valid)
-            gfxCommandCopyBuffer(gfx_, lightCountBufferTemp[bufferIndex].second, lightCountBuffer);
-            lightCountBufferTemp[bufferIndex].first = true;
+            // Begin copy of new value into the statistics counter (takes getDelay() frames to become valid)
+            gfxCommandCopyBuffer(
+                gfx_, capsaicin.getGpuStatistics().getCounterBuffer(lightCountStatsSlot), lightCountBuffer);
+            lightCountPending = capsaicin.getGpuStatistics().getDelay();
         }
         else
         {
             // Need to invalidate previous count history
-            for (auto &i : lightCountBufferTemp)
+            lightCountPending = 0;
+            areaLightCount    = 0;
+        }
+    }
+    else if (areaLightMaxCount > 0 && capsaicin.getTransformsUpdated())
+    {
+        // Only instance transforms have changed so the per-instance light counts and the offsets
+        // stored in the instance buffers from the last full build are still valid. Carry the
+        // previous light data across and re-gather just the lights of instances that actually
+        // moved, leaving every other range of the light buffer untouched.
+        TimedSection const timedSection(*this, "UpdateDirtyAreaLights");
+
+        gfxCommandCopyBuffer(gfx_, lightBuffers[lightBufferIndex], lightBuffers[1 - lightBufferIndex]);
+
+        uint32_t const instanceCount    = gfxSceneGetObjectCount<GfxInstance>(scene);
+        uint32_t       drawCommandCount = 0;
+
+        GfxBuffer instanceIDBuffer = capsaicin.allocateConstantBuffer<uint32_t>(instanceCount);
+        uint32_t *instanceIDData   = (uint32_t *)gfxBufferGetData(gfx_, instanceIDBuffer);
+
+        GfxBuffer drawCommandBuffer =
+            capsaicin.allocateConstantBuffer<D3D12_DRAW_INDEXED_ARGUMENTS>(instanceCount);
+        D3D12_DRAW_INDEXED_ARGUMENTS *drawCommands =
+            (D3D12_DRAW_INDEXED_ARGUMENTS *)gfxBufferGetData(gfx_, drawCommandBuffer);
+
+        for (uint32_t i = 0; i < instanceCount; ++i)
+        {
+            GfxConstRef<GfxInstance> instanceRef = gfxSceneGetObjectHandle<GfxInstance>(scene, i);
+
+            if (!instanceRef->mesh || !instanceRef->material
+                || !gfxMaterialIsEmissive(*instanceRef->material))
+            {
+                continue; // not an emissive primitive
+            }
+
+            uint32_t const instanceIndex = (uint32_t)instanceRef;
+            if (instanceIndex >= instanceHashes.size())
+            {
+                // Newly created handle above the range recorded by the last full build; a zero hash
+                // makes it compare as changed so its lights get gathered
+                instanceHashes.resize((size_t)instanceIndex + 1);
+            }
+            Instance const &instance      = capsaicin.getInstanceData()[instanceIndex];
+            size_t const    transformHash = HashBytes(
+                &capsaicin.getTransformData()[instance.transform_index], sizeof(glm::mat4x3));
+            if (transformHash == instanceHashes[instanceIndex])
             {
-                i.first = 0;
+                continue; // unchanged since the last build
             }
-            areaLightCount = 0;
+            instanceHashes[instanceIndex] = transformHash;
+
+            uint32_t const drawCommandIndex = drawCommandCount++;
+            Mesh const    &mesh             = capsaicin.getMeshData()[instance.mesh_index];
+
+            drawCommands[drawCommandIndex].IndexCountPerInstance = mesh.index_count;
+            drawCommands[drawCommandIndex].InstanceCount         = 1;
+            drawCommands[drawCommandIndex].StartIndexLocation    = mesh.index_offset_idx;
+            drawCommands[drawCommandIndex].BaseVertexLocation    = mesh.vertex_offset_idx;
+            drawCommands[drawCommandIndex].StartInstanceLocation = drawCommandIndex;
+
+            instanceIDData[drawCommandIndex] = instanceIndex;
+        }
+
+        if (drawCommandCount > 0)
+        {
+            lightsUpdated = true;
+
+            gfxProgramSetParameter(
+                gfx_, gatherAreaLightsProgram, "g_LightBuffer", lightBuffers[lightBufferIndex]);
+            gfxProgramSetParameter(gfx_, gatherAreaLightsProgram, "g_LightBufferSize", lightCountBuffer);
+            gfxProgramSetParameter(
+                gfx_, gatherAreaLightsProgram, "g_LightInstanceBuffer", lightInstanceBuffer);
+            gfxProgramSetParameter(gfx_, gatherAreaLightsProgram, "g_LightInstancePrimitiveBuffer",
+                lightInstancePrimitiveBuffer);
+
+            gfxProgramSetParameter(
+                gfx_, gatherAreaLightsProgram, "g_InstanceBuffer", capsaicin.getInstanceBuffer());
+            gfxProgramSetParameter(
+                gfx_, gatherAreaLightsProgram, "g_MaterialBuffer", capsaicin.getMaterialBuffer());
+            gfxProgramSetParameter(
+                gfx_, gatherAreaLightsProgram, "g_TransformBuffer", capsaicin.getTransformBuffer());
+
+            gfxProgramSetParameter(gfx_, gatherAreaLightsProgram, "g_InstanceIDBuffer", instanceIDBuffer);
+            gfxProgramSetParameter(gfx_, gatherAreaLightsProgram, "g_TextureMaps", capsaicin.getTextures(),
+                capsaicin.getTextureCount());
+            gfxProgramSetParameter(
+                gfx_, gatherAreaLightsProgram, "g_TextureSampler", capsaicin.getLinearSampler());
+            // The primitive buffer already holds final light buffer positions from the last full
+            // build (the scatter pass adds g_LightCount in place) so the offset must be zero here
+            gfxProgramSetParameter(gfx_, gatherAreaLightsProgram, "g_LightCount", 0u);
+
+            gfxCommandBindKernel(gfx_, scatterAreaLightsKernel);
+            gfxCommandMultiDrawIndexedIndirect(gfx_, drawCommandBuffer, drawCommandCount);
         }
+
+        gfxDestroyBuffer(gfx_, instanceIDBuffer);
+        gfxDestroyBuffer(gfx_, drawCommandBuffer);
     }
     else
     {
         // Lights haven't changed since last frame, so simply copy the previous light data across.
         gfxCommandCopyBuffer(gfx_, lightBuffers[lightBufferIndex], lightBuffers[1 - lightBufferIndex]);
     }
+
+    // (Re)build the environment map alias table whenever the map itself or the light settings change
+    if (!!environmentMap && options.environment_light_enable
+        && (capsaicin.getEnvironmentMapUpdated() || lightSettingChanged || capsaicin.getFrameIndex() == 0))
+    {
+        TimedSection const timedSection(*this, "BuildEnvironmentAliasTable");
+
+        // Sample the environment map at the mip level closest to the table resolution so that each
+        // table texel weight already accounts for all the map texels it covers
+        uint32_t mipLevel = 0;
+        for (uint32_t width = environmentMap.getWidth(); width > environmentAliasFaceResolution;
+             width >>= 1)
+        {
+            ++mipLevel;
+        }
+
+        gfxProgramSetParameter(gfx_, environmentAliasProgram, "g_EnvironmentBuffer", environmentMap);
+        gfxProgramSetParameter(
+            gfx_, environmentAliasProgram, "g_TextureSampler", capsaicin.getLinearSampler());
+        gfxProgramSetParameter(gfx_, environmentAliasProgram, "g_MipLevel", mipLevel);
+        gfxProgramSetParameter(
+            gfx_, environmentAliasProgram, "g_EnvAlias_Probability", environmentAliasProbabilityBuffer);
+        gfxProgramSetParameter(
+            gfx_, environmentAliasProgram, "g_EnvAlias_Alias", environmentAliasIndexBuffer);
+        gfxProgramSetParameter(gfx_, environmentAliasProgram, "g_EnvAlias_PDF", environmentAliasPDFBuffer);
+        gfxProgramSetParameter(
+            gfx_, environmentAliasProgram, "g_EnvAlias_Weights", environmentAliasWeightBuffer);
+
+        uint32_t const aliasEntries =
+            6 * environmentAliasFaceResolution * environmentAliasFaceResolution;
+
+        // Calculate each texels sampling weight (luminance * solid angle)
+        {
+            uint32_t const *numThreads = gfxKernelGetNumThreads(gfx_, calculateWeightsKernel);
+            gfxCommandBindKernel(gfx_, calculateWeightsKernel);
+            gfxCommandDispatch(gfx_, (environmentAliasFaceResolution + numThreads[0] - 1) / numThreads[0],
+                (environmentAliasFaceResolution + numThreads[1] - 1) / numThreads[1], 6);
+        }
+
+        // Reduce the total weight over all texels
+        reducerSum.reduce(environmentAliasWeightBuffer, aliasEntries);
+
+        // Normalise the weights into probabilities/PDFs then pair over/under subscribed entries
+        {
+            uint32_t const *numThreads = gfxKernelGetNumThreads(gfx_, buildAliasTableKernel);
+            gfxCommandBindKernel(gfx_, buildAliasTableKernel);
+            gfxCommandDispatch(gfx_, (aliasEntries + numThreads[0] - 1) / numThreads[0], 1, 1);
+        }
+        gfxCommandBindKernel(gfx_, pairAliasTableKernel);
+        gfxCommandDispatch(gfx_, 1, 1, 1);
+    }
 }
 
 void LightBuilder::terminate() noexcept
@@ -353,12 +529,9 @@ void LightBuilder::terminate() noexcept
     lightInstanceBuffer = {};
     gfxDestroyBuffer(gfx_, lightInstancePrimitiveBuffer);
     lightInstancePrimitiveBuffer = {};
-    for (auto &i : lightCountBufferTemp)
-    {
-        gfxDestroyBuffer(gfx_, i.second);
-        i.second = {};
-    }
-    lightCountBufferTemp.clear();
+    lightCountStatsSlot = ~0u;
+    lightCountPending   = 0;
+    instanceHashes.clear();
 
     gfxDestroyKernel(gfx_, countAreaLightsKernel);
     countAreaLightsKernel = {};
@@ -366,6 +539,24 @@ void LightBuilder::terminate() noexcept
     scatterAreaLightsKernel = {};
     gfxDestroyProgram(gfx_, gatherAreaLightsProgram);
     gatherAreaLightsProgram = {};
+
+    gfxDestroyBuffer(gfx_, environmentAliasProbabilityBuffer);
+    environmentAliasProbabilityBuffer = {};
+    gfxDestroyBuffer(gfx_, environmentAliasIndexBuffer);
+    environmentAliasIndexBuffer = {};
+    gfxDestroyBuffer(gfx_, environmentAliasPDFBuffer);
+    environmentAliasPDFBuffer = {};
+    gfxDestroyBuffer(gfx_, environmentAliasWeightBuffer);
+    environmentAliasWeightBuffer = {};
+
+    gfxDestroyKernel(gfx_, calculateWeightsKernel);
+    calculateWeightsKernel = {};
+    gfxDestroyKernel(gfx_, buildAliasTableKernel);
+    buildAliasTableKernel = {};
+    gfxDestroyKernel(gfx_, pairAliasTableKernel);
+    pairAliasTableKernel = {};
+    gfxDestroyProgram(gfx_, environmentAliasProgram);
+    environmentAliasProgram = {};
 }
 
 void LightBuilder::renderGUI(CapsaicinInternal &capsaicin) const noexcept
@@ -396,6 +587,10 @@ std::vector<std::string> LightBuilder::getShaderDefines(
     {
         baseDefines.push_back("DISABLE_ENVIRONMENT_LIGHTS");
     }
+    else
+    {
+        baseDefines.push_back("ENABLE_ENVIRONMENT_ALIAS_TABLE");
+    }
     return baseDefines;
 }
 
@@ -407,6 +602,9 @@ void LightBuilder::addProgramParameters(
     gfxProgramSetParameter(gfx_, program, "g_PrevLightBuffer", lightBuffers[1 - lightBufferIndex]);
     gfxProgramSetParameter(gfx_, program, "g_LightInstanceBuffer", lightInstanceBuffer);
     gfxProgramSetParameter(gfx_, program, "g_LightInstancePrimitiveBuffer", lightInstancePrimitiveBuffer);
+    gfxProgramSetParameter(gfx_, program, "g_EnvAlias_Probability", environmentAliasProbabilityBuffer);
+    gfxProgramSetParameter(gfx_, program, "g_EnvAlias_Alias", environmentAliasIndexBuffer);
+    gfxProgramSetParameter(gfx_, program, "g_EnvAlias_PDF", environmentAliasPDFBuffer);
 }
 
 uint32_t LightBuilder::getAreaLightCount() const
@@ -22,6 +22,7 @@ THE SOFTWARE.
 #pragma once
 
 #include "components/component.h"
+#include "utilities/gpu_reduce.h"
 
 namespace Capsaicin
 {
@@ -62,6 +63,13 @@ public:
      */
     static RenderOptions convertOptions(RenderOptionList const &options) noexcept;
 
+    /**
+     * Gets a list of the shader directories (relative to the shader root) that hold the shader
+     * source compiled by the current component.
+     * @return A list of all shader directories.
+     */
+    ShaderDirectoryList getShaderDirectories() const noexcept override;
+
     /**
      * Initialise any internal data or state.
      * @note This is automatically called by the framework after construction and should be used to create
@@ -156,16 +164,32 @@ private:
     bool lightsUpdated       = true;
     bool lightSettingChanged = true;
 
+    std::vector<size_t>
+        instanceHashes; /**< Per-instance transform hashes (indexed by instance index) used to detect
+                             which emissive instances need their area lights re-gathered */
+
     GfxBuffer lightBuffers[2];        /**< Buffers used to hold all light list */
     GfxBuffer lightCountBuffer;       /**< Buffer used to hold number of lights in light buffer */
     GfxBuffer lightInstanceBuffer;    /**< Buffer used to hold the offset of the instance primitives */
     GfxBuffer
         lightInstancePrimitiveBuffer; /**< Buffer used to hold the light identifier per emissive primitive */
-    std::vector<std::pair<bool, GfxBuffer>>
-        lightCountBufferTemp; /**< Buffer used to copy light count into cpu memory */
+    uint32_t lightCountStatsSlot = ~0u; /**< Light count counter slot in the GPU statistics service */
+    uint32_t lightCountPending   = 0;   /**< Frames until the streamed light count becomes valid */
 
     GfxKernel  countAreaLightsKernel;
     GfxKernel  scatterAreaLightsKernel;
     GfxProgram gatherAreaLightsProgram;
+
+    GfxBuffer environmentAliasProbabilityBuffer; /**< Buffer holding environment alias probabilities */
+    GfxBuffer environmentAliasIndexBuffer;       /**< Buffer holding environment alias entries */
+    GfxBuffer environmentAliasPDFBuffer; /**< Buffer holding per-texel solid angle sampling PDFs */
+    GfxBuffer environmentAliasWeightBuffer; /**< Scratch buffer used to reduce the total texel weight */
+
+    GPUReduce reducerSum; /**< Helper to perform GPU parallel reduceSum of texel weights */
+
+    GfxProgram environmentAliasProgram;
+    GfxKernel  calculateWeightsKernel;
+    GfxKernel  buildAliasTableKernel;
+    GfxKernel  pairAliasTableKernel;
 };
 } // namespace Capsaicin
@@ -82,6 +82,24 @@ ComponentList LightSamplerSwitcher::getComponents() const noexcept
     return components;
 }
 
+ShaderDirectoryList LightSamplerSwitcher::getShaderDirectories() const noexcept
+{
+    ShaderDirectoryList directories;
+    // Loop through all possible light samplers and get used shader directories
+    for (auto &i : LightSamplerFactory::getNames())
+    {
+        for (auto &j : LightSamplerFactory::make(i)->getShaderDirectories())
+        {
+            if (std::find(directories.cbegin(), directories.cend(), j) == directories.cend())
+            {
+                // Add the new directory to requested list
+                directories.emplace_back(std::move(j));
+            }
+        }
+    }
+    return directories;
+}
+
 bool LightSamplerSwitcher::init(CapsaicinInternal const &capsaicin) noexcept
 {
     options = convertOptions(capsaicin.getOptions());
@@ -112,6 +130,11 @@ void LightSamplerSwitcher::run(CapsaicinInternal &capsaicin) noexcept
     currentSampler->run(capsaicin);
 }
 
+QueueAffinity LightSamplerSwitcher::getQueueAffinity() const noexcept
+{
+    return currentSampler->getQueueAffinity();
+}
+
 void LightSamplerSwitcher::terminate() noexcept
 {
     currentSampler->terminate();
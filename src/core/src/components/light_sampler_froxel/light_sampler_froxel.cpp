@@ -0,0 +1,277 @@
+/**********************************************************************
+Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+********************************************************************/
+
+#include "light_sampler_froxel.h"
+
+#include "../light_builder/light_builder.h"
+#include "capsaicin_internal.h"
+
+namespace Capsaicin
+{
+LightSamplerFroxel::LightSamplerFroxel() noexcept
+    : LightSampler(Name)
+{}
+
+LightSamplerFroxel::~LightSamplerFroxel() noexcept
+{
+    terminate();
+}
+
+RenderOptionList LightSamplerFroxel::getRenderOptions() noexcept
+{
+    RenderOptionList newOptions;
+    newOptions.emplace(RENDER_OPTION_MAKE(light_froxel_num_tiles, options));
+    newOptions.emplace(RENDER_OPTION_MAKE(light_froxel_num_slices, options));
+    newOptions.emplace(RENDER_OPTION_MAKE(light_froxel_lights_per_froxel, options));
+    return newOptions;
+}
+
+LightSamplerFroxel::RenderOptions LightSamplerFroxel::convertOptions(
+    RenderOptionList const &options) noexcept
+{
+    RenderOptions newOptions;
+    RENDER_OPTION_GET(light_froxel_num_tiles, newOptions, options)
+    RENDER_OPTION_GET(light_froxel_num_slices, newOptions, options)
+    RENDER_OPTION_GET(light_froxel_lights_per_froxel, newOptions, options)
+    return newOptions;
+}
+
+ComponentList LightSamplerFroxel::getComponents() const noexcept
+{
+    ComponentList components;
+    components.emplace_back(COMPONENT_MAKE(LightBuilder));
+    return components;
+}
+
+ShaderDirectoryList LightSamplerFroxel::getShaderDirectories() const noexcept
+{
+    return {"components/light_sampler_froxel"};
+}
+
+bool LightSamplerFroxel::init(CapsaicinInternal const &capsaicin) noexcept
+{
+    initKernels(capsaicin);
+
+    configBuffer = gfxCreateBuffer<FroxelSamplingConfiguration>(gfx_, 1);
+    configBuffer.setName("Capsaicin_LightSamplerFroxel_ConfigBuffer");
+
+    return !!buildProgram;
+}
+
+void LightSamplerFroxel::run(CapsaicinInternal &capsaicin) noexcept
+{
+    // Update internal options
+    auto const optionsNew   = convertOptions(capsaicin.getOptions());
+    auto       lightBuilder = capsaicin.getComponent<LightBuilder>();
+
+    recompileFlag     = lightBuilder->needsRecompile(capsaicin);
+    lightsUpdatedFlag = optionsNew.light_froxel_num_tiles != options.light_froxel_num_tiles
+                     || optionsNew.light_froxel_num_slices != options.light_froxel_num_slices
+                     || optionsNew.light_froxel_lights_per_froxel != options.light_froxel_lights_per_froxel;
+    options = optionsNew;
+
+    if (recompileFlag)
+    {
+        gfxDestroyKernel(gfx_, buildKernel);
+        gfxDestroyProgram(gfx_, buildProgram);
+
+        initKernels(capsaicin);
+    }
+
+    // The grid tracks the camera frustum so it must be rebuilt whenever the camera moves
+    auto const &cameraMatrices = capsaicin.getCameraMatrices();
+    bool const  cameraUpdated  = config.viewProjection != cameraMatrices.view_projection;
+
+    if (cameraUpdated || capsaicin.getMeshesUpdated() || capsaicin.getTransformsUpdated()
+        || lightsUpdatedFlag || lightBuilder->getLightsUpdated() || recompileFlag
+        || capsaicin.getFrameIndex() == 0 || config.numFroxels.x == 0 /*i.e. uninitialised*/)
+    {
+        auto const &camera = capsaicin.getCamera();
+
+        // Keep each screen tile roughly square by scaling the shorter screen axis
+        float const width  = static_cast<float>(capsaicin.getWidth());
+        float const height = static_cast<float>(capsaicin.getHeight());
+        float const largestAxis = glm::max(width, height);
+        const uint2 numTiles    = glm::max(
+            uint2(ceil(float2(width, height) * (static_cast<float>(options.light_froxel_num_tiles) / largestAxis))),
+            uint2(1));
+
+        // Clamp max number of lights to those actually available
+        uint lightsPerFroxel =
+            (options.light_froxel_lights_per_froxel == 0)
+                ? lightBuilder->getLightCount()
+                : glm::min(options.light_froxel_lights_per_froxel, lightBuilder->getLightCount());
+        lightsPerFroxel += 1; // There is 1 extra slot used for froxel table header
+
+        // Create updated configuration
+        config.numFroxels        = uint4(numTiles, options.light_froxel_num_slices, lightsPerFroxel);
+        config.viewProjection    = cameraMatrices.view_projection;
+        config.invViewProjection = cameraMatrices.inv_view_projection;
+        config.cameraPosition    = camera.eye;
+        config.cameraDirection   = normalize(camera.center - camera.eye);
+        config.nearPlane         = camera.nearZ;
+        config.farPlane          = camera.farZ;
+        config.sliceScale        = static_cast<float>(options.light_froxel_num_slices)
+                          / logf(camera.farZ / camera.nearZ);
+
+        GfxBuffer const uploadBuffer =
+            gfxCreateBuffer<FroxelSamplingConfiguration>(gfx_, 1, &config, kGfxCpuAccess_Write);
+        gfxCommandCopyBuffer(gfx_, configBuffer, uploadBuffer);
+        gfxDestroyBuffer(gfx_, uploadBuffer);
+    }
+
+    uint const lightDataLength =
+        config.numFroxels.x * config.numFroxels.y * config.numFroxels.z * config.numFroxels.w;
+    if (lightIndexBuffer.getCount() < lightDataLength && lightDataLength > 0)
+    {
+        gfxDestroyBuffer(gfx_, lightIndexBuffer);
+        gfxDestroyBuffer(gfx_, lightWeightBuffer);
+
+        lightIndexBuffer = gfxCreateBuffer<uint>(gfx_, lightDataLength);
+        lightIndexBuffer.setName("Capsaicin_LightSamplerFroxel_IndexBuffer");
+        lightWeightBuffer = gfxCreateBuffer<float>(gfx_, lightDataLength);
+        lightWeightBuffer.setName("Capsaicin_LightSamplerFroxel_WeightBuffer");
+
+        lightsUpdatedFlag = true;
+    }
+
+    // Create the light sampling structure
+    if (cameraUpdated || lightBuilder->getLightsUpdated() || lightsUpdatedFlag || recompileFlag)
+    {
+        RenderTechnique::TimedSection const timedSection(*this, "BuildLightSampler");
+
+        // Add program parameters
+        addProgramParameters(capsaicin, buildProgram);
+
+        gfxProgramSetParameter(gfx_, buildProgram, "g_EnvironmentBuffer", capsaicin.getEnvironmentBuffer());
+        gfxProgramSetParameter(
+            gfx_, buildProgram, "g_TextureMaps", capsaicin.getTextures(), capsaicin.getTextureCount());
+        gfxProgramSetParameter(gfx_, buildProgram, "g_TextureSampler", capsaicin.getLinearSampler());
+
+        // Cull the lights into the froxel grid
+        uint32_t const *numThreads = gfxKernelGetNumThreads(gfx_, buildKernel);
+        uint32_t const  numGroupsX = (config.numFroxels.x + numThreads[0] - 1) / numThreads[0];
+        uint32_t const  numGroupsY = (config.numFroxels.y + numThreads[1] - 1) / numThreads[1];
+        uint32_t const  numGroupsZ = (config.numFroxels.z + numThreads[2] - 1) / numThreads[2];
+        gfxCommandBindKernel(gfx_, buildKernel);
+        gfxCommandDispatch(gfx_, numGroupsX, numGroupsY, numGroupsZ);
+    }
+}
+
+void LightSamplerFroxel::terminate() noexcept
+{
+    gfxDestroyBuffer(gfx_, configBuffer);
+    configBuffer = {};
+    gfxDestroyBuffer(gfx_, lightIndexBuffer);
+    lightIndexBuffer = {};
+    gfxDestroyBuffer(gfx_, lightWeightBuffer);
+    lightWeightBuffer = {};
+
+    gfxDestroyKernel(gfx_, buildKernel);
+    buildKernel = {};
+    gfxDestroyProgram(gfx_, buildProgram);
+    buildProgram = {};
+}
+
+void LightSamplerFroxel::renderGUI(CapsaicinInternal &capsaicin) const noexcept
+{
+    if (ImGui::CollapsingHeader("Light Sampler Settings", ImGuiTreeNodeFlags_None))
+    {
+        auto lightBuilder = capsaicin.getComponent<LightBuilder>();
+        ImGui::DragInt("Screen Tiles per Axis",
+            (int32_t *)&capsaicin.getOption<uint32_t>("light_froxel_num_tiles"), 1, 1, 128);
+        ImGui::DragInt("Depth Slices",
+            (int32_t *)&capsaicin.getOption<uint32_t>("light_froxel_num_slices"), 1, 1, 64);
+        bool autoLights    = capsaicin.getOption<uint32_t>("light_froxel_lights_per_froxel") == 0;
+        auto currentLights = lightBuilder->getLightCount();
+        if (autoLights)
+        {
+            ImGui::BeginDisabled();
+            ImGui::DragInt("Number Lights per Froxel", (int32_t *)&currentLights, 1, 1, currentLights);
+            ImGui::EndDisabled();
+        }
+        else
+        {
+            ImGui::DragInt("Number Lights per Froxel",
+                (int32_t *)&capsaicin.getOption<uint32_t>("light_froxel_lights_per_froxel"), 1, 1,
+                currentLights);
+        }
+        ImGui::SameLine();
+        if (ImGui::Checkbox("Auto", &autoLights))
+        {
+            capsaicin.setOption<uint32_t>(
+                "light_froxel_lights_per_froxel", autoLights ? 0 : currentLights);
+        }
+    }
+}
+
+bool LightSamplerFroxel::needsRecompile([[maybe_unused]] CapsaicinInternal const &capsaicin) const noexcept
+{
+    return recompileFlag;
+}
+
+std::vector<std::string> LightSamplerFroxel::getShaderDefines(
+    CapsaicinInternal const &capsaicin) const noexcept
+{
+    auto                     lightBuilder = capsaicin.getComponent<LightBuilder>();
+    std::vector<std::string> baseDefines(std::move(lightBuilder->getShaderDefines(capsaicin)));
+    return baseDefines;
+}
+
+void LightSamplerFroxel::addProgramParameters(
+    CapsaicinInternal const &capsaicin, GfxProgram program) const noexcept
+{
+    auto lightBuilder = capsaicin.getComponent<LightBuilder>();
+    lightBuilder->addProgramParameters(capsaicin, program);
+
+    // Bind the light sampling shader parameters
+    gfxProgramSetParameter(gfx_, program, "g_LightSampler_Configuration", configBuffer);
+    gfxProgramSetParameter(gfx_, program, "g_LightSampler_FroxelsIndex", lightIndexBuffer);
+    gfxProgramSetParameter(gfx_, program, "g_LightSampler_FroxelsWeight", lightWeightBuffer);
+}
+
+bool LightSamplerFroxel::getLightsUpdated(CapsaicinInternal const &capsaicin) const noexcept
+{
+    auto lightBuilder = capsaicin.getComponent<LightBuilder>();
+    return lightsUpdatedFlag || lightBuilder->getLightsUpdated();
+}
+
+std::string_view LightSamplerFroxel::getHeaderFile() const noexcept
+{
+    return std::string_view("\"../../components/light_sampler_froxel/light_sampler_froxel.hlsl\"");
+}
+
+bool LightSamplerFroxel::initKernels(CapsaicinInternal const &capsaicin) noexcept
+{
+    buildProgram = gfxCreateProgram(
+        gfx_, "components/light_sampler_froxel/light_sampler_froxel", capsaicin.getShaderPath());
+    auto                      baseDefines(std::move(getShaderDefines(capsaicin)));
+    std::vector<char const *> defines;
+    for (auto &i : baseDefines)
+    {
+        defines.push_back(i.c_str());
+    }
+    buildKernel = gfxCreateComputeKernel(
+        gfx_, buildProgram, "Build", defines.data(), static_cast<uint32_t>(defines.size()));
+    return !!buildKernel;
+}
+} // namespace Capsaicin
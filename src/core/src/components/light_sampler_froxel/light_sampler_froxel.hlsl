@@ -0,0 +1,340 @@
+/**********************************************************************
+Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+********************************************************************/
+
+#ifndef LIGHT_SAMPLER_FROXEL_HLSL
+#define LIGHT_SAMPLER_FROXEL_HLSL
+
+/*
+// Requires the following data to be defined in any shader that uses this file
+TextureCube g_EnvironmentBuffer;
+Texture2D g_TextureMaps[] : register(space99);
+SamplerState g_TextureSampler;
+*/
+
+#include "light_sampler_froxel_shared.h"
+
+RWStructuredBuffer<FroxelSamplingConfiguration> g_LightSampler_Configuration;
+RWStructuredBuffer<uint> g_LightSampler_FroxelsIndex;
+RWStructuredBuffer<float> g_LightSampler_FroxelsWeight;
+
+#include "../light_builder/light_builder.hlsl"
+#include "../../lights/light_sampling.hlsl"
+#include "../../lights/reservoir.hlsl"
+#include "../../math/random.hlsl"
+
+namespace LightSamplerFroxelGrid
+{
+    /**
+     * Calculate the start index for a requested froxel within a continuous 1D buffer.
+     * @param froxel Index of requested froxel (0-indexed).
+     * @return The index of the froxel.
+     */
+    uint getFroxelIndex(uint3 froxel)
+    {
+        const uint3 numFroxels = g_LightSampler_Configuration[0].numFroxels.xyz;
+        const uint maxLightsPerFroxel = g_LightSampler_Configuration[0].numFroxels.w;
+        uint index = froxel.x + numFroxels.x * (froxel.y + numFroxels.y * froxel.z);
+        index *= maxLightsPerFroxel;
+        return index;
+    }
+
+    /**
+     * Calculate the continuous froxel coordinate a world position falls within.
+     * @param position The world space position.
+     * @param froxel   (Out) The continuous froxel coordinate.
+     * @return True if the position lies inside the camera froxel grid, False if the caller must
+     *  fall back to sampling the full light list.
+     */
+    bool getFroxelCoordFromPosition(float3 position, out float3 froxel)
+    {
+        froxel = 0.0f.xxx;
+        const float3 toPosition = position - g_LightSampler_Configuration[0].cameraPosition;
+        const float viewDepth = dot(toPosition, g_LightSampler_Configuration[0].cameraDirection);
+        if (viewDepth < g_LightSampler_Configuration[0].nearPlane
+            || viewDepth > g_LightSampler_Configuration[0].farPlane)
+        {
+            return false;
+        }
+        const float4 clip = mul(g_LightSampler_Configuration[0].viewProjection, float4(position, 1.0f));
+        if (clip.w <= 0.0f)
+        {
+            return false;
+        }
+        const float2 ndc = clip.xy / clip.w;
+        if (any(abs(ndc) > 1.0f))
+        {
+            return false;
+        }
+        const float3 numFroxels = (float3)g_LightSampler_Configuration[0].numFroxels.xyz;
+        // Depth slices are distributed exponentially between the near and far planes
+        const float slice = log(viewDepth / g_LightSampler_Configuration[0].nearPlane)
+                          * g_LightSampler_Configuration[0].sliceScale;
+        froxel = float3(float2(ndc.x * 0.5f + 0.5f, 0.5f - ndc.y * 0.5f) * numFroxels.xy, slice);
+        return true;
+    }
+
+    /**
+     * Calculate which froxel a world position falls within.
+     * @param position The world space position.
+     * @param froxel   (Out) The index of the froxel.
+     * @return True if the position lies inside the camera froxel grid, False if the caller must
+     *  fall back to sampling the full light list.
+     */
+    bool getFroxelFromPosition(float3 position, out uint3 froxel)
+    {
+        float3 froxelCoord;
+        if (!getFroxelCoordFromPosition(position, froxelCoord))
+        {
+            froxel = 0.xxx;
+            return false;
+        }
+        const float3 numFroxels = (float3)g_LightSampler_Configuration[0].numFroxels.xyz;
+        froxel = (uint3)clamp(floor(froxelCoord), 0.0f.xxx, numFroxels - 1.0f.xxx);
+        return true;
+    }
+
+    /**
+     * Calculate which froxel a position falls within for a given jittered position.
+     * @note The froxel coordinate is jittered by +-quarter froxel to decorrelate froxel boundaries.
+     * @tparam RNG The type of random number sampler to be used.
+     * @param position The world space position.
+     * @param froxel   (Out) The index of the froxel.
+     * @return True if the position lies inside the camera froxel grid, False if the caller must
+     *  fall back to sampling the full light list.
+     */
+    template<typename RNG>
+    bool getFroxelFromJitteredPosition(float3 position, inout RNG randomNG, out uint3 froxel)
+    {
+        float3 froxelCoord;
+        if (!getFroxelCoordFromPosition(position, froxelCoord))
+        {
+            froxel = 0.xxx;
+            return false;
+        }
+        // Jitter current froxel coordinate by +-quarter froxel
+        froxelCoord += (randomNG.rand3() - 0.5f) * 0.5f;
+        const float3 numFroxels = (float3)g_LightSampler_Configuration[0].numFroxels.xyz;
+        froxel = (uint3)clamp(floor(froxelCoord), 0.0f.xxx, numFroxels - 1.0f.xxx);
+        return true;
+    }
+}
+
+class LightSamplerFroxel
+{
+    Random randomNG;
+
+    /**
+     * Get a sample light.
+     * @note Positions inside the camera froxel grid only sample the lights culled to their froxel,
+     * positions outside (off screen or beyond the far plane) fall back to the full light list.
+     * @param position Current position on surface.
+     * @param normal   Shading normal vector at current position.
+     * @param lightPDF (Out) The PDF for the calculated sample (is equal to zero if no valid samples could be found).
+     * @returns The index of the new light sample
+     */
+    uint sampleLights(float3 position, float3 normal, out float lightPDF)
+    {
+        uint3 froxel;
+        if (LightSamplerFroxelGrid::getFroxelFromJitteredPosition(position, randomNG, froxel))
+        {
+            const uint froxelIndex = LightSamplerFroxelGrid::getFroxelIndex(froxel);
+            const uint numLights = g_LightSampler_FroxelsIndex[froxelIndex];
+
+            // Return invalid sample if the froxel doesn't contain any lights
+            if (numLights == 0)
+            {
+                lightPDF = 0.0f;
+                return 0;
+            }
+
+            // Choose uniformly from the lights culled to the current froxel
+            lightPDF = 1.0f / numLights;
+            return g_LightSampler_FroxelsIndex[froxelIndex + 1 + randomNG.randInt(numLights)];
+        }
+
+        // Fall back to uniformly sampling the full light list
+        const uint totalLights = getNumberLights();
+        if (totalLights == 0)
+        {
+            lightPDF = 0.0f;
+            return 0;
+        }
+        lightPDF = 1.0f / totalLights;
+        return randomNG.randInt(totalLights);
+    }
+
+    /**
+     * Calculate the PDF of sampling a given light.
+     * @param lightID  The index of the given light.
+     * @param position The position on the surface currently being shaded.
+     * @param normal   Shading normal vector at current position.
+     * @returns The calculated PDF with respect to the light.
+     */
+    float sampleLightPDF(uint lightID, float3 position, float3 normal)
+    {
+        uint3 froxel;
+        if (LightSamplerFroxelGrid::getFroxelFromJitteredPosition(position, randomNG, froxel))
+        {
+            const uint froxelIndex = LightSamplerFroxelGrid::getFroxelIndex(froxel);
+            const uint numLights = g_LightSampler_FroxelsIndex[froxelIndex];
+            const uint startIndex = froxelIndex + 1;
+            for (uint currentIndex = startIndex; currentIndex < startIndex + numLights; ++currentIndex)
+            {
+                if (g_LightSampler_FroxelsIndex[currentIndex] == lightID)
+                {
+                    return 1.0f / numLights;
+                }
+            }
+            // A light culled from the froxel has zero probability of being selected.
+            return FLT_EPSILON;
+        }
+        return 1.0f / getNumberLights();
+    }
+
+    /**
+     * Sample multiple lights into a reservoir.
+     * @tparam numSampledLights Number of lights to sample.
+     * @param position      Current position on surface.
+     * @param normal        Shading normal vector at current position.
+     * @param viewDirection View direction vector at current position.
+     * @param material      Material for current surface position.
+     * @returns Reservoir containing combined samples.
+     */
+    template<uint numSampledLights>
+    Reservoir sampleLightList(float3 position, float3 normal, float3 viewDirection, MaterialBRDF material)
+    {
+        // Create reservoir updater
+        ReservoirUpdater updater = MakeReservoirUpdater();
+
+        uint3 froxel;
+        if (LightSamplerFroxelGrid::getFroxelFromJitteredPosition(position, randomNG, froxel))
+        {
+            const uint froxelIndex = LightSamplerFroxelGrid::getFroxelIndex(froxel);
+            const uint numLights = g_LightSampler_FroxelsIndex[froxelIndex];
+            const uint newLights = min(numLights, numSampledLights);
+
+            // Return invalid sample if the froxel doesn't contain any lights
+            if (numLights == 0)
+            {
+                return MakeReservoir();
+            }
+
+            // Loop through until we have the requested number of lights
+            const float lightPDF = 1.0f / numLights;
+            for (uint i = 0; i < newLights; ++i)
+            {
+                // Choose a light to sample from the froxels culled light list
+                const uint lightIndex = g_LightSampler_FroxelsIndex[froxelIndex + 1 + randomNG.randInt(numLights)];
+
+                // Add the light sample to the reservoir
+                updateReservoir(updater, randomNG, lightIndex, lightPDF, material, position, normal, viewDirection);
+            }
+
+            // Get finalised reservoir for return
+            return updater.reservoir;
+        }
+
+        // Fall back to uniformly sampling the full light list
+        const uint totalLights = getNumberLights();
+        if (totalLights == 0)
+        {
+            return MakeReservoir();
+        }
+        const float lightPDF = 1.0f / totalLights;
+        for (uint lightsAdded = 0; lightsAdded < numSampledLights; ++lightsAdded)
+        {
+            const uint lightIndex = randomNG.randInt(totalLights);
+            updateReservoir(updater, randomNG, lightIndex, lightPDF, material, position, normal, viewDirection);
+        }
+        return updater.reservoir;
+    }
+
+    /**
+     * Sample multiple lights into a reservoir using cone angle.
+     * @tparam numSampledLights Number of lights to sample.
+     * @param position      Current position on surface.
+     * @param normal        Shading normal vector at current position.
+     * @param viewDirection View direction vector at current position.
+     * @param solidAngle    Solid angle around view direction of visible ray cone.
+     * @param material      Material for current surface position.
+     * @returns Reservoir containing combined samples.
+     */
+    template<uint numSampledLights>
+    Reservoir sampleLightListCone(float3 position, float3 normal, float3 viewDirection, float solidAngle, MaterialBRDF material)
+    {
+        // Create reservoir updater
+        ReservoirUpdater updater = MakeReservoirUpdater();
+
+        uint3 froxel;
+        if (LightSamplerFroxelGrid::getFroxelFromJitteredPosition(position, randomNG, froxel))
+        {
+            const uint froxelIndex = LightSamplerFroxelGrid::getFroxelIndex(froxel);
+            const uint numLights = g_LightSampler_FroxelsIndex[froxelIndex];
+            const uint newLights = min(numLights, numSampledLights);
+
+            // Return invalid sample if the froxel doesn't contain any lights
+            if (numLights == 0)
+            {
+                return MakeReservoir();
+            }
+
+            // Loop through until we have the requested number of lights
+            const float lightPDF = 1.0f / numLights;
+            for (uint i = 0; i < newLights; ++i)
+            {
+                // Choose a light to sample from the froxels culled light list
+                const uint lightIndex = g_LightSampler_FroxelsIndex[froxelIndex + 1 + randomNG.randInt(numLights)];
+
+                // Add the light sample to the reservoir
+                updateReservoirCone(updater, randomNG, lightIndex, lightPDF, material, position, normal, viewDirection, solidAngle);
+            }
+
+            // Get finalised reservoir for return
+            return updater.reservoir;
+        }
+
+        // Fall back to uniformly sampling the full light list
+        const uint totalLights = getNumberLights();
+        if (totalLights == 0)
+        {
+            return MakeReservoir();
+        }
+        const float lightPDF = 1.0f / totalLights;
+        for (uint lightsAdded = 0; lightsAdded < numSampledLights; ++lightsAdded)
+        {
+            const uint lightIndex = randomNG.randInt(totalLights);
+            updateReservoirCone(updater, randomNG, lightIndex, lightPDF, material, position, normal, viewDirection, solidAngle);
+        }
+        return updater.reservoir;
+    }
+};
+
+LightSamplerFroxel MakeLightSampler(Random random)
+{
+    LightSamplerFroxel ret;
+    ret.randomNG = random;
+    return ret;
+}
+
+typedef LightSamplerFroxel LightSampler;
+
+#endif // LIGHT_SAMPLER_FROXEL_HLSL
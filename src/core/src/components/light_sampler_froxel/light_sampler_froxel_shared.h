@@ -0,0 +1,54 @@
+/**********************************************************************
+Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+********************************************************************/
+
+#ifndef LIGHT_SAMPLER_FROXEL_SHARED_H
+#define LIGHT_SAMPLER_FROXEL_SHARED_H
+
+#include "../../gpu_shared.h"
+
+#ifdef __cplusplus
+#    pragma warning(push)
+#    pragma warning(disable : 4324) // structure was padded due to alignment specifier
+#endif
+struct FroxelSamplingConfiguration
+{
+    uint4 numFroxels; /*< Number of screen tiles in the x,y directions and depth slices in z */
+    /*< 4th value contains maximum number of lights to store per froxel (includes 1 header slot) */
+    float4x4 viewProjection;    /*< Camera view-projection used to locate the froxel for a world position */
+    float4x4 invViewProjection; /*< Inverse view-projection used to reconstruct froxel corners */
+    float3   cameraPosition;    /*< World space camera position */
+#ifndef __cplusplus
+    float pad;
+#endif
+    float3 cameraDirection; /*< Normalised camera view direction */
+#ifndef __cplusplus
+    float pad2;
+#endif
+    float nearPlane;  /*< Camera near plane distance (first depth slice boundary) */
+    float farPlane;   /*< Camera far plane distance (last depth slice boundary) */
+    float sliceScale; /*< numSlices / log(farPlane / nearPlane), converts view depth to slice index */
+};
+#ifdef __cplusplus
+#    pragma warning(pop)
+#endif
+
+#endif
@@ -66,6 +66,11 @@ ComponentList LightSamplerGridCDF::getComponents() const noexcept
     return components;
 }
 
+ShaderDirectoryList LightSamplerGridCDF::getShaderDirectories() const noexcept
+{
+    return {"components/light_sampler_grid_cdf"};
+}
+
 bool LightSamplerGridCDF::init(CapsaicinInternal const &capsaicin) noexcept
 {
     initKernels(capsaicin);
@@ -187,6 +192,11 @@ void LightSamplerGridCDF::run(CapsaicinInternal &capsaicin) noexcept
     }
 }
 
+QueueAffinity LightSamplerGridCDF::getQueueAffinity() const noexcept
+{
+    return QueueAffinity::AsyncCompute;
+}
+
 void LightSamplerGridCDF::terminate() noexcept
 {
     gfxDestroyBuffer(gfx_, configBuffer);
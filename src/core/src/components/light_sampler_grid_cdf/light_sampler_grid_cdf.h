@@ -77,6 +77,13 @@ public:
      */
     ComponentList getComponents() const noexcept override;
 
+    /**
+     * Gets a list of the shader directories (relative to the shader root) that hold the shader
+     * source compiled by the current component.
+     * @return A list of all shader directories.
+     */
+    ShaderDirectoryList getShaderDirectories() const noexcept override;
+
     /**
      * Initialise any internal data or state.
      * @note This is automatically called by the framework after construction and should be used to create
@@ -92,6 +99,14 @@ public:
      */
     void run(CapsaicinInternal &capsaicin) noexcept override;
 
+    /**
+     * Gets the queue that the component's GPU work should be scheduled on.
+     * @note The grid build is pure compute and only consumes the light buffer, so it is flagged for
+     * async compute allowing it to overlap unrelated raster work.
+     * @return The requested queue affinity.
+     */
+    QueueAffinity getQueueAffinity() const noexcept override;
+
     /**
      * Destroy any used internal resources and shutdown.
      */
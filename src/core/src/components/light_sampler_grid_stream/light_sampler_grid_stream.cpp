@@ -47,6 +47,7 @@ RenderOptionList LightSamplerGridStream::getRenderOptions() noexcept
     newOptions.emplace(RENDER_OPTION_MAKE(light_grid_stream_merge_type, options));
     newOptions.emplace(RENDER_OPTION_MAKE(light_grid_stream_parallel_build, options));
     newOptions.emplace(RENDER_OPTION_MAKE(light_grid_stream_centroid_build, options));
+    newOptions.emplace(RENDER_OPTION_MAKE(light_grid_stream_temporal, options));
     return newOptions;
 }
 
@@ -61,6 +62,7 @@ LightSamplerGridStream::RenderOptions LightSamplerGridStream::convertOptions(
     RENDER_OPTION_GET(light_grid_stream_merge_type, newOptions, options)
     RENDER_OPTION_GET(light_grid_stream_parallel_build, newOptions, options)
     RENDER_OPTION_GET(light_grid_stream_centroid_build, newOptions, options)
+    RENDER_OPTION_GET(light_grid_stream_temporal, newOptions, options)
     return newOptions;
 }
 
@@ -71,6 +73,11 @@ ComponentList LightSamplerGridStream::getComponents() const noexcept
     return components;
 }
 
+ShaderDirectoryList LightSamplerGridStream::getShaderDirectories() const noexcept
+{
+    return {"components/light_sampler_grid_stream", "utilities"};
+}
+
 bool LightSamplerGridStream::init(CapsaicinInternal const &capsaicin) noexcept
 {
     initKernels(capsaicin);
@@ -126,6 +133,11 @@ void LightSamplerGridStream::run(CapsaicinInternal &capsaicin) noexcept
     }
 }
 
+QueueAffinity LightSamplerGridStream::getQueueAffinity() const noexcept
+{
+    return QueueAffinity::AsyncCompute;
+}
+
 void LightSamplerGridStream::terminate() noexcept
 {
     gfxDestroyBuffer(gfx_, boundsLengthBuffer);
@@ -172,6 +184,7 @@ void LightSamplerGridStream::renderGUI(CapsaicinInternal &capsaicin) const noexc
             "Random Select\0Without Replacement\0With Replacement");
         ImGui::Checkbox("Intermediate Resample", &capsaicin.getOption<bool>("light_grid_stream_resample"));
         ImGui::Checkbox("Parallel Build", &capsaicin.getOption<bool>("light_grid_stream_parallel_build"));
+        ImGui::Checkbox("Temporal Reuse", &capsaicin.getOption<bool>("light_grid_stream_temporal"));
     }
 }
 
@@ -218,12 +231,18 @@ void LightSamplerGridStream::update(CapsaicinInternal &capsaicin, Timeable *pare
     bool manyLights = options.light_grid_stream_parallel_build
                    && (lightBuilder->getLightCount() > 128 * options.light_grid_stream_lights_per_cell);
 
+    // Temporal reuse continues last frame's reservoir streams so it is incompatible with the
+    // resample storage format and the parallel wave collapse
+    bool const temporal = optionsNew.light_grid_stream_temporal && !optionsNew.light_grid_stream_resample
+                       && !manyLights;
+
     recompileFlag =
         optionsNew.light_grid_stream_octahedron_sampling != options.light_grid_stream_octahedron_sampling
         || optionsNew.light_grid_stream_resample != options.light_grid_stream_resample
         || optionsNew.light_grid_stream_merge_type != options.light_grid_stream_merge_type
         || optionsNew.light_grid_stream_centroid_build != options.light_grid_stream_centroid_build
-        || usingManyLights != manyLights || lightBuilder->needsRecompile(capsaicin);
+        || usingManyLights != manyLights || usingTemporal != temporal
+        || lightBuilder->needsRecompile(capsaicin);
     lightsUpdatedFlag =
         optionsNew.light_grid_stream_octahedron_sampling != options.light_grid_stream_octahedron_sampling
         || optionsNew.light_grid_stream_lights_per_cell != options.light_grid_stream_lights_per_cell
@@ -232,6 +251,7 @@ void LightSamplerGridStream::update(CapsaicinInternal &capsaicin, Timeable *pare
         || usingManyLights != manyLights;
     options         = optionsNew;
     usingManyLights = manyLights;
+    usingTemporal   = temporal;
 
     const uint32_t numCells = options.light_grid_stream_num_cells;
     uint lightDataLength    = numCells * numCells * numCells * options.light_grid_stream_lights_per_cell;
@@ -322,6 +342,15 @@ void LightSamplerGridStream::update(CapsaicinInternal &capsaicin, Timeable *pare
 
     gfxProgramSetParameter(gfx_, boundsProgram, "g_FrameIndex", capsaicin.getFrameIndex());
 
+    if (usingTemporal)
+    {
+        // The reservoir history is only valid while the cell layout and light list are unchanged
+        bool const temporalReset = recompileFlag || lightsUpdatedFlag || hostUpdated
+                                || lightBuilder->getLightsUpdated() || capsaicin.getMeshesUpdated()
+                                || capsaicin.getTransformsUpdated() || capsaicin.getFrameIndex() == 0;
+        gfxProgramSetParameter(gfx_, boundsProgram, "g_TemporalReset", temporalReset ? 1U : 0U);
+    }
+
     // Create the light sampling structure bounds by reducing all values stored in the boundsMin|MaxBuffers
     if (boundsReservations.size() > (boundsHostReservations.empty() ? 0 : 1))
     {
@@ -391,6 +420,10 @@ std::vector<std::string> LightSamplerGridStream::getShaderDefines(
     {
         baseDefines.push_back("LIGHTSAMPLERSTREAM_RES_MANYLIGHTS");
     }
+    if (usingTemporal)
+    {
+        baseDefines.push_back("LIGHTSAMPLERSTREAM_USE_TEMPORAL");
+    }
     return baseDefines;
 }
 
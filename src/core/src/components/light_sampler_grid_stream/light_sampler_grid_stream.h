@@ -69,6 +69,10 @@ public:
             false; /**< Use faster reservoir parallel build on scene with large light count */
         bool light_grid_stream_centroid_build =
             false; /**< Use faster but simpler cell centroid sampling during build */
+        bool light_grid_stream_temporal =
+            true; /**< Reuse last frame's reservoirs and restream only a slice of the light list per
+                     frame, aging persisted weights (ignored when resampling or parallel build is
+                     in use) */
     };
 
     /**
@@ -84,6 +88,13 @@ public:
      */
     ComponentList getComponents() const noexcept override;
 
+    /**
+     * Gets a list of the shader directories (relative to the shader root) that hold the shader
+     * source compiled by the current component.
+     * @return A list of all shader directories.
+     */
+    ShaderDirectoryList getShaderDirectories() const noexcept override;
+
     /**
      * Initialise any internal data or state.
      * @note This is automatically called by the framework after construction and should be used to create
@@ -99,6 +110,14 @@ public:
      */
     void run(CapsaicinInternal &capsaicin) noexcept override;
 
+    /**
+     * Gets the queue that the component's GPU work should be scheduled on.
+     * @note The grid build is pure compute and only consumes the light buffer, so it is flagged for
+     * async compute allowing it to overlap unrelated raster work.
+     * @return The requested queue affinity.
+     */
+    QueueAffinity getQueueAffinity() const noexcept override;
+
     /**
      * Destroy any used internal resources and shutdown.
      */
@@ -197,6 +216,7 @@ private:
         false; /**< Flag to indicate if option change requires a shader recompile this frame */
     bool lightsUpdatedFlag = false; /**< Flag to indicate if option change effects light samples */
     bool usingManyLights   = false; /**< Flag indicating if ,any lights parallel build is in use */
+    bool usingTemporal     = false; /**< Flag indicating if temporal reservoir reuse is in use */
 
     std::map<size_t, uint32_t>
         boundsReservations; /**< List of any reservations made using reserveBoundsValues() */
@@ -43,6 +43,11 @@ ComponentList LightSamplerUniform::getComponents() const noexcept
     return components;
 }
 
+ShaderDirectoryList LightSamplerUniform::getShaderDirectories() const noexcept
+{
+    return {}; // compiles no shader kernels
+}
+
 bool LightSamplerUniform::init([[maybe_unused]] CapsaicinInternal const &capsaicin) noexcept
 {
     return true;
@@ -23,6 +23,7 @@ THE SOFTWARE.
 #include "prefilter_ibl.h"
 
 #include "capsaicin_internal.h"
+#include "utilities/texture_cache.h"
 
 #define _USE_MATH_DEFINES
 #include <algorithm>
@@ -39,6 +40,11 @@ PrefilterIBL::~PrefilterIBL() noexcept
     terminate();
 }
 
+ShaderDirectoryList PrefilterIBL::getShaderDirectories() const noexcept
+{
+    return {"components/prefilter_ibl"};
+}
+
 bool PrefilterIBL::init(CapsaicinInternal const &capsaicin) noexcept
 {
     prefilter_ibl_buffer_ = gfxCreateTextureCube(
@@ -77,6 +83,39 @@ void PrefilterIBL::addProgramParameters(
 
 void PrefilterIBL::prefilterIBL(CapsaicinInternal const &capsaicin) noexcept
 {
+    // Key the disk cache on the environment map contents so reloading the same map skips the
+    // convolution. Procedurally generated environment maps (e.g. atmosphere) have no source file
+    // and are always re-convolved.
+    uint64_t cache_key = 0;
+    if (std::string const environment_map = capsaicin.getCurrentEnvironmentMap(); !environment_map.empty())
+    {
+        cache_key = TextureCache::HashFile(environment_map.c_str());
+    }
+
+    uint32_t texel_count = 0;
+    for (uint32_t mip_level = 0; mip_level < prefilter_ibl_buffer_mips_; ++mip_level)
+    {
+        uint32_t const mip_size = std::max(prefilter_ibl_buffer_size_ >> mip_level, 1u);
+        texel_count += mip_size * mip_size * 6;
+    }
+
+    if (cache_key != 0)
+    {
+        TextureCache::View cache_view;
+        if (TextureCache::Load("prefilter_ibl", cache_key, cache_view)
+            && cache_view.size == (uint64_t)texel_count * sizeof(glm::uvec2))
+        {
+            // Upload the cached cubemap instead of re-convolving
+            GfxBuffer cache_buffer = gfxCreateBuffer<glm::uvec2>(gfx_, texel_count, cache_view.data);
+            cache_buffer.setName("Capsaicin_PrefilterIBL_CacheBuffer");
+
+            copyCache(cache_buffer, false);
+
+            gfxDestroyBuffer(gfx_, cache_buffer);
+            return;
+        }
+    }
+
     glm::dvec3 const forward_vectors[] = {glm::dvec3(-1.0, 0.0, 0.0), glm::dvec3(1.0, 0.0, 0.0),
         glm::dvec3(0.0, 1.0, 0.0), glm::dvec3(0.0, -1.0, 0.0), glm::dvec3(0.0, 0.0, -1.0),
         glm::dvec3(0.0, 0.0, 1.0)};
@@ -120,6 +159,59 @@ void PrefilterIBL::prefilterIBL(CapsaicinInternal const &capsaicin) noexcept
             gfxDestroyKernel(gfx_, prefilter_ibl_kernel);
         }
     }
+
+    if (cache_key != 0)
+    {
+        // Persist the convolved cubemap to disk, the stall only occurs the first time a given
+        // environment map is seen
+        GfxBuffer cache_buffer = gfxCreateBuffer<glm::uvec2>(gfx_, texel_count);
+        cache_buffer.setName("Capsaicin_PrefilterIBL_CacheBuffer");
+        GfxBuffer readback_buffer =
+            gfxCreateBuffer<glm::uvec2>(gfx_, texel_count, nullptr, kGfxCpuAccess_Read);
+        readback_buffer.setName("Capsaicin_PrefilterIBL_ReadbackBuffer");
+
+        copyCache(cache_buffer, true);
+
+        gfxCommandCopyBuffer(gfx_, readback_buffer, cache_buffer);
+        gfxFinish(gfx_);
+
+        TextureCache::Save("prefilter_ibl", cache_key, gfxBufferGetData<glm::uvec2>(gfx_, readback_buffer),
+            (uint64_t)texel_count * sizeof(glm::uvec2));
+
+        gfxDestroyBuffer(gfx_, readback_buffer);
+        gfxDestroyBuffer(gfx_, cache_buffer);
+    }
+}
+
+void PrefilterIBL::copyCache(GfxBuffer const &cache_buffer, bool to_cache) noexcept
+{
+    GfxKernel const copy_kernel = gfxCreateComputeKernel(
+        gfx_, prefilter_ibl_program_, to_cache ? "CopyIBLToCache" : "CopyIBLFromCache");
+
+    gfxProgramSetParameter(gfx_, prefilter_ibl_program_, "g_CacheBuffer", cache_buffer);
+
+    uint32_t cache_offset = 0;
+    for (uint32_t mip_level = 0; mip_level < prefilter_ibl_buffer_mips_; ++mip_level)
+    {
+        uint32_t const mip_size           = std::max(prefilter_ibl_buffer_size_ >> mip_level, 1u);
+        uint32_t const cache_dimensions[] = {mip_size, mip_size};
+
+        gfxProgramSetParameter(gfx_, prefilter_ibl_program_, "g_CacheOffset", cache_offset);
+        gfxProgramSetParameter(gfx_, prefilter_ibl_program_, "g_CacheDimensions", cache_dimensions);
+        gfxProgramSetParameter(
+            gfx_, prefilter_ibl_program_, "g_PrefilteredBuffer", prefilter_ibl_buffer_, mip_level);
+
+        uint32_t const *num_threads  = gfxKernelGetNumThreads(gfx_, copy_kernel);
+        uint32_t const  num_groups_x = (mip_size + num_threads[0] - 1) / num_threads[0];
+        uint32_t const  num_groups_y = (mip_size + num_threads[1] - 1) / num_threads[1];
+
+        gfxCommandBindKernel(gfx_, copy_kernel);
+        gfxCommandDispatch(gfx_, num_groups_x, num_groups_y, 6); // copy all faces
+
+        cache_offset += mip_size * mip_size * 6;
+    }
+
+    gfxDestroyKernel(gfx_, copy_kernel);
 }
 
 } // namespace Capsaicin
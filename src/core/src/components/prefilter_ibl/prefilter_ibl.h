@@ -41,6 +41,13 @@ public:
 
     ~PrefilterIBL() noexcept;
 
+    /**
+     * Gets a list of the shader directories (relative to the shader root) that hold the shader
+     * source compiled by the current component.
+     * @return A list of all shader directories.
+     */
+    ShaderDirectoryList getShaderDirectories() const noexcept override;
+
     /**
      * Initialise any internal data or state.
      * @note This is automatically called by the framework after construction and should be used to create
@@ -72,6 +79,14 @@ public:
 private:
     void prefilterIBL(CapsaicinInternal const &capsaicin) noexcept;
 
+    /**
+     * Copy the prefiltered cubemap to or from a packed disk cache buffer.
+     * @param cache_buffer Buffer holding the packed texels for all mip levels and faces.
+     * @param to_cache     True to copy the cubemap into the buffer, False to copy the buffer into
+     * the cubemap.
+     */
+    void copyCache(GfxBuffer const &cache_buffer, bool to_cache) noexcept;
+
     GfxProgram prefilter_ibl_program_;
     GfxTexture prefilter_ibl_buffer_;
 
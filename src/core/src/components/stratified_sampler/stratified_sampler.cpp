@@ -25,6 +25,7 @@ THE SOFTWARE.
 #include "capsaicin_internal.h"
 #include "stratified_sampler_data.h"
 
+#include <cstring>
 #include <random>
 
 namespace Capsaicin
@@ -45,6 +46,11 @@ RenderOptionList StratifiedSampler::getRenderOptions() noexcept
     return newOptions;
 }
 
+ShaderDirectoryList StratifiedSampler::getShaderDirectories() const noexcept
+{
+    return {}; // compiles no shader kernels
+}
+
 StratifiedSampler::RenderOptions StratifiedSampler::convertOptions(RenderOptionList const &options) noexcept
 {
     RenderOptions newOptions;
@@ -54,37 +60,43 @@ StratifiedSampler::RenderOptions StratifiedSampler::convertOptions(RenderOptionL
 
 bool StratifiedSampler::init(CapsaicinInternal const &capsaicin) noexcept
 {
-    uint64_t const seedBufferSize =
-        sizeof(uint32_t) * std::max(capsaicin.getWidth(), 1920u) * std::max(capsaicin.getHeight(), 1080u);
+    uint32_t const seedCount =
+        std::max(capsaicin.getWidth(), 1920u) * std::max(capsaicin.getHeight(), 1080u);
+    uint64_t const seedBufferSize = sizeof(uint32_t) * seedCount;
+    bool const     uploadSobol    = !sobolBuffer;
+
+    seedBuffer = gfxCreateBuffer<uint32_t>(gfx_, seedCount);
+    seedBuffer.setName("StratifiedSampler_SeedBuffer");
 
-    std::vector<uint32_t>                   seedBufferData;
-    seedBufferData.reserve(seedBufferSize);
-    if (options.stratified_sampler_deterministic)
+    if (uploadSobol)
     {
-        std::mt19937 gen(5489U);
-        for (uint32_t i = 0; i < seedBufferSize; i += 4)
-        {
-            seedBufferData.push_back(gen());
-        }
+        sobolBuffer = gfxCreateBuffer<uint32_t>(gfx_, (uint32_t)(sizeof(sobolData) / sizeof(uint32_t)));
+        sobolBuffer.setName("StratifiedSampler_SobolBuffer");
     }
-    else
+
+    // Generate the seeds directly into a single staging allocation shared with the (compile-time
+    // embedded) Sobol table so everything is uploaded in one batched copy
+    GfxBuffer uploadBuffer = gfxCreateBuffer(
+        gfx_, seedBufferSize + (uploadSobol ? sizeof(sobolData) : 0), nullptr, kGfxCpuAccess_Write);
+    uint32_t *uploadData = gfxBufferGetData<uint32_t>(gfx_, uploadBuffer);
+
+    std::mt19937 gen(options.stratified_sampler_deterministic ? 5489U : std::random_device()());
+    for (uint32_t i = 0; i < seedCount; ++i)
     {
-        std::random_device                      rd;
-        std::mt19937                            gen(rd());
-        for (uint32_t i = 0; i < seedBufferSize; i += 4)
-        {
-            seedBufferData.push_back(gen());
-        }
+        uploadData[i] = gen();
+    }
+    if (uploadSobol)
+    {
+        memcpy(uploadData + seedCount, sobolData, sizeof(sobolData));
     }
-    seedBuffer = gfxCreateBuffer<uint32_t>(gfx_, (uint32_t)seedBufferData.size(), seedBufferData.data());
-    seedBuffer.setName("StratifiedSampler_SeedBuffer");
 
-    if (!sobolBuffer)
+    gfxCommandCopyBuffer(gfx_, seedBuffer, 0, uploadBuffer, 0, seedBufferSize);
+    if (uploadSobol)
     {
-        sobolBuffer = gfxCreateBuffer<uint32_t>(gfx_, (uint32_t)sizeof(sobolData), sobolData);
-        sobolBuffer.setName("StratifiedSampler_SobolBuffer");
+        gfxCommandCopyBuffer(gfx_, sobolBuffer, 0, uploadBuffer, seedBufferSize, sizeof(sobolData));
     }
-    return true;
+    gfxDestroyBuffer(gfx_, uploadBuffer); // release is deferred until the copies retire
+    return !!seedBuffer && !!sobolBuffer;
 }
 
 void StratifiedSampler::run(CapsaicinInternal &capsaicin) noexcept
@@ -78,13 +78,18 @@ template<typename RayQueryType>
 RayQueryType TraceRay(RayDesc incommingRay)
 {
     RayQueryType ray_query;
-    ray_query.TraceRayInline(g_Scene, RAY_FLAG_NONE, 0xFFu, incommingRay);
+    ray_query.TraceRayInline(g_Scene, RAY_FLAG_NONE, INSTANCE_INCLUSION_MASK_ALL, incommingRay);
     while (ray_query.Proceed())
     {
     }
 
     return ray_query;
 }
+
+ShadowRayQuery TraceShadowRay(RayDesc incommingRay)
+{
+    return TraceRay<ShadowRayQuery>(incommingRay);
+}
 #else // DISABLE_ALPHA_TESTING
 typedef RayQuery<RAY_FLAG_NONE /*| RAY_FLAG_SKIP_PROCEDURAL_PRIMITIVES*/> ClosestRayQuery;
 typedef RayQuery<RAY_FLAG_SKIP_PROCEDURAL_PRIMITIVES | RAY_FLAG_ACCEPT_FIRST_HIT_AND_END_SEARCH> ShadowRayQuery;
@@ -93,7 +98,7 @@ template<typename RayQueryType>
 RayQueryType TraceRay(RayDesc incommingRay)
 {
     RayQueryType ray_query;
-    ray_query.TraceRayInline(g_Scene, RAY_FLAG_NONE, 0xFFu, incommingRay);
+    ray_query.TraceRayInline(g_Scene, RAY_FLAG_NONE, INSTANCE_INCLUSION_MASK_ALL, incommingRay);
     while (ray_query.Proceed())
     {
         if (ray_query.CandidateType() == CANDIDATE_NON_OPAQUE_TRIANGLE)
@@ -113,6 +118,48 @@ RayQueryType TraceRay(RayDesc incommingRay)
 
     return ray_query;
 }
+
+/**
+ * Trace a shadow ray against the two alpha mode partitions of the scene separately.
+ * The opaque partition is traced first with an opaque forced query; as most occluders are fully
+ * opaque the majority of shadow rays terminate here without ever running the alpha-test loop. Only
+ * rays that miss every opaque instance continue into the alpha-tested partition.
+ * @param incommingRay The ray to trace.
+ * @returns The ray query holding the committed hit (if any).
+ */
+ShadowRayQuery TraceShadowRay(RayDesc incommingRay)
+{
+    ShadowRayQuery ray_query;
+    ray_query.TraceRayInline(g_Scene, RAY_FLAG_FORCE_OPAQUE, INSTANCE_INCLUSION_MASK_OPAQUE, incommingRay);
+    while (ray_query.Proceed())
+    {
+    }
+    if (ray_query.CommittedStatus() == COMMITTED_TRIANGLE_HIT)
+    {
+        return ray_query;
+    }
+
+    ShadowRayQuery alpha_query;
+    alpha_query.TraceRayInline(g_Scene, RAY_FLAG_NONE, INSTANCE_INCLUSION_MASK_ALPHA_TESTED, incommingRay);
+    while (alpha_query.Proceed())
+    {
+        if (alpha_query.CandidateType() == CANDIDATE_NON_OPAQUE_TRIANGLE)
+        {
+            if (AlphaTest(GetHitInfoRtInlineCandidate(alpha_query)))
+            {
+                alpha_query.CommitNonOpaqueTriangleHit();
+            }
+        }
+        else
+        {
+            // Should never get here as we don't support non-triangle geometry
+            // However if this conditional is removed the driver crashes
+            alpha_query.Abort();
+        }
+    }
+
+    return alpha_query;
+}
 #endif // DISABLE_ALPHA_TESTING
 
 #endif // INTERSECTION_HLSL
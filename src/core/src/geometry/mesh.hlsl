@@ -31,6 +31,18 @@ StructuredBuffer<Vertex> g_VertexBuffer;
 
 #include "../gpu_shared.h"
 
+/**
+ * Extract the Mesh fields from a packed instance record.
+ * Allows the single fetch g_InstancePackedBuffer path to reuse the Mesh based fetch functions.
+ * @param instance The packed instance record.
+ * @return The mesh data for the instance.
+ */
+Mesh getPackedMesh(InstancePacked instance)
+{
+    Mesh mesh = {instance.vertex_offset_idx, instance.index_offset_idx, instance.index_count};
+    return mesh;
+}
+
 struct Triangle
 {
     float3 v0;
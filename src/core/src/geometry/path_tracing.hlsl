@@ -312,11 +312,11 @@ void sampleLightsNEE(MaterialBRDF material, inout StratifiedSampler randomStrati
 
     // Trace shadow ray
 #if USE_INLINE_RT
-    ShadowRayQuery rayShadowQuery = TraceRay<ShadowRayQuery>(ray);
+    ShadowRayQuery rayShadowQuery = TraceShadowRay(ray);
     bool hit = rayShadowQuery.CommittedStatus() == COMMITTED_NOTHING;
 #else
     ShadowRayPayload payload = {false};
-    TraceRay(g_Scene, SHADOW_RAY_FLAGS, 0xFFu, 1, 0, 1, ray, payload);
+    TraceRay(g_Scene, SHADOW_RAY_FLAGS, INSTANCE_INCLUSION_MASK_ALL, 1, 0, 1, ray, payload);
     bool hit = payload.visible;
 #endif
 
@@ -546,7 +546,7 @@ void tracePath(RayDesc ray, inout StratifiedSampler randomStratified, inout Ligh
         }
 #else
         pathData.bounce = bounce;
-        TraceRay(g_Scene, CLOSEST_RAY_FLAGS, 0xFFu, 0, 0, 0, ray, pathData);
+        TraceRay(g_Scene, CLOSEST_RAY_FLAGS, INSTANCE_INCLUSION_MASK_ALL, 0, 0, 0, ray, pathData);
         // Create new ray
         ray.Origin = pathData.origin;
         ray.Direction = pathData.direction;
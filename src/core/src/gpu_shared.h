@@ -118,6 +118,14 @@ struct DispatchRaysCommand
     uint                            padding[3];
 };
 
+// TLAS instance inclusion masks partitioning geometry by material alpha mode. Fully-opaque
+// instances can never produce non-opaque candidates, so rays that only need the opaque partition
+// (e.g. the first phase of a shadow trace) can skip the alpha-tested instances entirely
+#define INSTANCE_INCLUSION_MASK_OPAQUE       (1u << 0)
+#define INSTANCE_INCLUSION_MASK_ALPHA_TESTED (1u << 1)
+#define INSTANCE_INCLUSION_MASK_ALL \
+    (INSTANCE_INCLUSION_MASK_OPAQUE | INSTANCE_INCLUSION_MASK_ALPHA_TESTED)
+
 struct Instance
 {
     uint mesh_index;
@@ -141,6 +149,20 @@ struct Mesh
     uint index_count;
 };
 
+// Packed per-instance record combining the hot Instance and Mesh fields so a hit can be resolved
+// with a single coherent fetch instead of dependent instance->mesh reads. Kept at 32 bytes so two
+// records share a cache line. mesh_index is retained for cold paths that need the full Mesh entry.
+struct InstancePacked
+{
+    uint vertex_offset_idx;
+    uint index_offset_idx;
+    uint index_count;
+    uint material_index;
+    uint transform_index;
+    uint mesh_index;
+    uint padding[2];
+};
+
 struct Vertex
 {
     float4 position SEMANTIC(POSITION);
@@ -0,0 +1,186 @@
+/**********************************************************************
+Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+********************************************************************/
+
+#ifndef ENVIRONMENT_ALIAS_HLSL
+#define ENVIRONMENT_ALIAS_HLSL
+
+#include "../math/math_constants.hlsl"
+
+/** Per face texel resolution of the environment alias table (must match light_builder.cpp) */
+#define ENVIRONMENT_ALIAS_FACE_RESOLUTION 64
+
+RWStructuredBuffer<float> g_EnvAlias_Probability;
+RWStructuredBuffer<uint> g_EnvAlias_Alias;
+RWStructuredBuffer<float> g_EnvAlias_PDF;
+
+namespace EnvironmentAlias
+{
+    /**
+     * Get the total number of entries in the alias table.
+     * @return The number of entries (one per cube map texel).
+     */
+    uint getNumEntries()
+    {
+        return 6 * ENVIRONMENT_ALIAS_FACE_RESOLUTION * ENVIRONMENT_ALIAS_FACE_RESOLUTION;
+    }
+
+    /**
+     * Calculate the index of a texel within the alias table.
+     * @param face  The cube map face (0..5).
+     * @param texel The texel within the face.
+     * @return The index of the table entry.
+     */
+    uint getTexelIndex(uint face, uint2 texel)
+    {
+        return (face * ENVIRONMENT_ALIAS_FACE_RESOLUTION + texel.y) * ENVIRONMENT_ALIAS_FACE_RESOLUTION
+             + texel.x;
+    }
+
+    /**
+     * Convert a cube face and face coordinate to a world direction.
+     * @note The returned direction is not normalised.
+     * @param face The cube map face (0..5).
+     * @param uv   The coordinate within the face (range [-1,1]).
+     * @return The direction through the requested coordinate.
+     */
+    float3 getTexelDirection(uint face, float2 uv)
+    {
+        switch (face)
+        {
+        case 0: return float3(1.0f, -uv.y, -uv.x);
+        case 1: return float3(-1.0f, -uv.y, uv.x);
+        case 2: return float3(uv.x, 1.0f, uv.y);
+        case 3: return float3(uv.x, -1.0f, -uv.y);
+        case 4: return float3(uv.x, -uv.y, 1.0f);
+        default: return float3(-uv.x, -uv.y, -1.0f);
+        }
+    }
+
+    /**
+     * Convert a direction to a cube face and face coordinate.
+     * @note Exact inverse of EnvironmentAlias::getTexelDirection.
+     * @param direction The direction to convert.
+     * @param uv        (Out) The coordinate within the face (range [-1,1]).
+     * @return The cube map face (0..5).
+     */
+    uint getDirectionFace(float3 direction, out float2 uv)
+    {
+        const float3 absDirection = abs(direction);
+        if (absDirection.x >= absDirection.y && absDirection.x >= absDirection.z)
+        {
+            const bool positive = direction.x > 0.0f;
+            uv = float2(positive ? -direction.z : direction.z, -direction.y) / absDirection.x;
+            return positive ? 0 : 1;
+        }
+        else if (absDirection.y >= absDirection.z)
+        {
+            const bool positive = direction.y > 0.0f;
+            uv = float2(direction.x, positive ? direction.z : -direction.z) / absDirection.y;
+            return positive ? 2 : 3;
+        }
+        else
+        {
+            const bool positive = direction.z > 0.0f;
+            uv = float2(positive ? direction.x : -direction.x, -direction.y) / absDirection.z;
+            return positive ? 4 : 5;
+        }
+    }
+
+    /**
+     * Calculate the area of the spherical projection of the face region below a coordinate.
+     * @param x The first face coordinate (range [-1,1]).
+     * @param y The second face coordinate (range [-1,1]).
+     * @return The projected area.
+     */
+    float areaElement(float x, float y)
+    {
+        return atan2(x * y, sqrt(x * x + y * y + 1.0f));
+    }
+
+    /**
+     * Calculate the solid angle subtended by a cube map texel.
+     * @param texel The texel within a face.
+     * @return The subtended solid angle.
+     */
+    float getTexelSolidAngle(uint2 texel)
+    {
+        const float recipRes = 1.0f / ENVIRONMENT_ALIAS_FACE_RESOLUTION;
+        const float2 uv0 = 2.0f * (float2)texel * recipRes - 1.0f;
+        const float2 uv1 = 2.0f * (float2)(texel + 1) * recipRes - 1.0f;
+        return areaElement(uv0.x, uv0.y) - areaElement(uv0.x, uv1.y) - areaElement(uv1.x, uv0.y)
+             + areaElement(uv1.x, uv1.y);
+    }
+
+    /**
+     * Importance sample a direction from the environment alias table.
+     * @param samples Random number samples used to sample the table.
+     * @param pdf     (Out) The PDF (with respect to solid angle) of the sampled direction.
+     * @return The sampled direction.
+     */
+    float3 sampleAlias(float2 samples, out float pdf)
+    {
+        const uint numEntries = getNumEntries();
+
+        // Select a table entry using the alias method
+        const float scaled = samples.x * numEntries;
+        uint entry = min((uint)scaled, numEntries - 1);
+        float r = scaled - (float)entry;
+        const float probability = g_EnvAlias_Probability[entry];
+        if (r < probability)
+        {
+            // Remap the random number back to [0,1) so it can be reused for the in-texel offset
+            r /= max(probability, FLT_EPSILON);
+        }
+        else
+        {
+            r = (r - probability) / max(1.0f - probability, FLT_EPSILON);
+            entry = g_EnvAlias_Alias[entry];
+        }
+        pdf = g_EnvAlias_PDF[entry];
+
+        // Jitter the sampled direction within the selected texel
+        const uint face = entry / (ENVIRONMENT_ALIAS_FACE_RESOLUTION * ENVIRONMENT_ALIAS_FACE_RESOLUTION);
+        const uint faceEntry =
+            entry - face * (ENVIRONMENT_ALIAS_FACE_RESOLUTION * ENVIRONMENT_ALIAS_FACE_RESOLUTION);
+        const uint2 texel = uint2(faceEntry % ENVIRONMENT_ALIAS_FACE_RESOLUTION,
+            faceEntry / ENVIRONMENT_ALIAS_FACE_RESOLUTION);
+        const float2 uv =
+            2.0f * ((float2)texel + float2(r, samples.y)) / ENVIRONMENT_ALIAS_FACE_RESOLUTION - 1.0f;
+        return normalize(getTexelDirection(face, uv));
+    }
+
+    /**
+     * Calculate the PDF of sampling a given direction from the environment alias table.
+     * @param direction The sampled direction.
+     * @return The PDF (with respect to solid angle) of the direction.
+     */
+    float samplePDF(float3 direction)
+    {
+        float2 uv;
+        const uint face = getDirectionFace(direction, uv);
+        const uint2 texel = min((uint2)((uv * 0.5f + 0.5f) * ENVIRONMENT_ALIAS_FACE_RESOLUTION),
+            ENVIRONMENT_ALIAS_FACE_RESOLUTION - 1);
+        return g_EnvAlias_PDF[getTexelIndex(face, texel)];
+    }
+}
+
+#endif // ENVIRONMENT_ALIAS_HLSL
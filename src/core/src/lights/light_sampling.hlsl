@@ -27,6 +27,9 @@ THE SOFTWARE.
 #include "../geometry/geometry.hlsl"
 #include "../math/math_constants.hlsl"
 #include "../math/sampling.hlsl"
+#ifdef ENABLE_ENVIRONMENT_ALIAS_TABLE
+#include "environment_alias.hlsl"
+#endif
 
 /**
  * Sample the direction, PDF and position on a given area light.
@@ -110,6 +113,10 @@ float sampleAreaLightPDF(LightArea light, float3 shadingPosition, float3 lightPo
  */
 float3 sampleEnvironmentLight(LightEnvironment light, float2 samples, float3 normal, out float pdf)
 {
+#ifdef ENABLE_ENVIRONMENT_ALIAS_TABLE
+    // Importance sample the environment map using the pre-built alias table
+    return EnvironmentAlias::sampleAlias(samples, pdf);
+#else
     // Currently just uses a uniform spherical sample
 
     // Sample uniform sphere
@@ -125,6 +132,7 @@ float3 sampleEnvironmentLight(LightEnvironment light, float2 samples, float3 nor
     pdf = INV_TWO_PI;
 
     return direction;
+#endif
 }
 
 /**
@@ -137,6 +145,10 @@ float3 sampleEnvironmentLight(LightEnvironment light, float2 samples, float3 nor
  */
 float3 sampleEnvironmentLight(LightEnvironment light, float2 samples, out float pdf)
 {
+#ifdef ENABLE_ENVIRONMENT_ALIAS_TABLE
+    // Importance sample the environment map using the pre-built alias table
+    return EnvironmentAlias::sampleAlias(samples, pdf);
+#else
     // Sample uniform sphere
     float z = 1.0f - 2.0f * samples.x;
     float r = sqrt(1.0f - (z * z));
@@ -147,6 +159,7 @@ float3 sampleEnvironmentLight(LightEnvironment light, float2 samples, out float
     pdf = INV_FOUR_PI;
 
     return direction;
+#endif
 }
 
 /**
@@ -158,9 +171,13 @@ float3 sampleEnvironmentLight(LightEnvironment light, float2 samples, out float
  */
 float sampleEnvironmentLightPDF(LightEnvironment light, float3 lightDirection, float3 normal)
 {
+#ifdef ENABLE_ENVIRONMENT_ALIAS_TABLE
+    return EnvironmentAlias::samplePDF(lightDirection);
+#else
     // Currently just uniformly samples a hemisphere
     float pdf = INV_TWO_PI;
     return pdf;
+#endif
 }
 
 /**
@@ -171,9 +188,13 @@ float sampleEnvironmentLightPDF(LightEnvironment light, float3 lightDirection, f
  */
 float sampleEnvironmentLightPDF(LightEnvironment light, float3 lightDirection)
 {
+#ifdef ENABLE_ENVIRONMENT_ALIAS_TABLE
+    return EnvironmentAlias::samplePDF(lightDirection);
+#else
     // Currently just uniformly samples a sphere when no normal is provided
     float pdf = INV_FOUR_PI;
     return pdf;
+#endif
 }
 
 /**
@@ -418,4 +418,48 @@ Reservoir unpackReservoir(uint4 reservoirData)
     reservoir.M = f16tof32(reservoirData.w & 0xFFFFu);
     return reservoir;
 }
+
+/**
+ * Packs a reservoir into a 64bit compressed format.
+ * The light index is truncated to 16 bits, the sample UVs to unorm12 and W to fp16, while M is
+ * stored as 8bit 2.6 fixed point (the temporal clamp keeps M <= 20). This halves the reservoir
+ * storage footprint but is only valid for scenes with fewer than 65536 lights.
+ * @param reservoir The reservoir to pack.
+ * @returns A uint2 containing packed values.
+ */
+uint2 packReservoirCompressed(Reservoir reservoir)
+{
+    uint2 packedData;
+    packedData.x = (reservoir.lightSample.index & 0xFFFFu) | (f32tof16(reservoir.W) << 16);
+    packedData.y = uint(round(saturate(reservoir.lightSample.sampleParams.x) * 4095.0f)) |
+                   (uint(round(saturate(reservoir.lightSample.sampleParams.y) * 4095.0f)) << 12) |
+                   (uint(round(min(reservoir.M, 63.0f) * 4.0f)) << 24);
+    return packedData;
+}
+
+/**
+ * UnPacks a reservoir from its compressed format (created using packReservoirCompressed).
+ * @param reservoirData The packed reservoir data to unpack.
+ * @returns A reservoir containing the unpacked data.
+ */
+Reservoir unpackReservoirCompressed(uint2 reservoirData)
+{
+    Reservoir reservoir;
+    reservoir.lightSample.index = reservoirData.x & 0xFFFFu;
+    reservoir.lightSample.sampleParams = float2((reservoirData.y & 0xFFFu) / 4095.0f,
+                                                ((reservoirData.y >> 12) & 0xFFFu) / 4095.0f);
+    reservoir.W = f16tof32(reservoirData.x >> 16);
+    reservoir.M = (reservoirData.y >> 24) / 4.0f;
+    return reservoir;
+}
+
+#ifdef USE_COMPRESSED_STORAGE
+// Route reservoir storage through the compressed format; the packed reservoir buffers must then
+// be declared (and allocated) as uint2 instead of uint4.
+#define PackedReservoirType uint2
+#define packReservoir       packReservoirCompressed
+#define unpackReservoir     unpackReservoirCompressed
+#else
+#define PackedReservoirType uint4
+#endif // USE_COMPRESSED_STORAGE
 #endif
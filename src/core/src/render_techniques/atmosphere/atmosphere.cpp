@@ -55,6 +55,11 @@ RenderOptionList Atmosphere::getRenderOptions() noexcept
     return newOptions;
 }
 
+ShaderDirectoryList Atmosphere::getShaderDirectories() const noexcept
+{
+    return {"render_techniques/atmosphere"};
+}
+
 Atmosphere::RenderOptions Atmosphere::convertOptions(RenderOptionList const &options) noexcept
 {
     RenderOptions newOptions;
@@ -84,8 +89,33 @@ void Atmosphere::render(CapsaicinInternal &capsaicin) noexcept
 
     uint32_t const buffer_dimensions[] = {environment_buffer.getWidth(), environment_buffer.getHeight()};
 
-    gfxProgramSetParameter(gfx_, atmosphere_program_, "g_Eye", capsaicin.getCamera().eye);
-    gfxProgramSetParameter(gfx_, atmosphere_program_, "g_FrameIndex", capsaicin.getFrameIndex());
+    // Advance the animated sun only while playback is running so static time-of-day shots settle
+    if (!capsaicin.getPaused())
+    {
+        ++sun_frame_;
+    }
+    float const t = sun_frame_ / 360.0f;
+    float       m = cosf(2.0f * t);
+    m             = 20.0f * m * m * (m < 0.0f ? -1.0f : 1.0f);
+    glm::vec3 const light_direction = glm::normalize(glm::vec3(m * sinf(t), 1.0f, m * cosf(t)));
+
+    // Skip regeneration (and the downstream IBL re-convolution) while the inputs are unchanged.
+    // Only a recreated environment buffer invalidates the cache; the environment-map-updated flag
+    // itself is raised every frame after a redraw by our own queued notification
+    glm::vec3 const eye = capsaicin.getCamera().eye;
+    glm::uvec2 const dimensions(buffer_dimensions[0], buffer_dimensions[1]);
+    if (cached_valid_ && !capsaicin.getEnvironmentMapRecreated() && light_direction == cached_light_direction_
+        && eye == cached_eye_ && dimensions == cached_dimensions_)
+    {
+        return; // cached sky is still valid
+    }
+    cached_light_direction_ = light_direction;
+    cached_eye_             = eye;
+    cached_dimensions_      = dimensions;
+    cached_valid_           = true;
+
+    gfxProgramSetParameter(gfx_, atmosphere_program_, "g_Eye", eye);
+    gfxProgramSetParameter(gfx_, atmosphere_program_, "g_LightDirection", light_direction);
     gfxProgramSetParameter(gfx_, atmosphere_program_, "g_BufferDimensions", buffer_dimensions);
 
     gfxProgramSetParameter(gfx_, atmosphere_program_, "g_OutEnvironmentBuffer", environment_buffer);
@@ -145,6 +175,9 @@ void Atmosphere::render(CapsaicinInternal &capsaicin) noexcept
             gfxCommandDispatch(gfx_, num_groups_x, num_groups_y, num_groups_z);
         }
     }
+
+    // Let downstream consumers (IBL prefiltering, light building) pick up the regenerated sky
+    capsaicin.queueEnvironmentMapUpdate();
 }
 
 void Atmosphere::terminate() noexcept
@@ -49,6 +49,13 @@ public:
      */
     static RenderOptions convertOptions(RenderOptionList const &options) noexcept;
 
+    /**
+     * Gets a list of the shader directories (relative to the shader root) that hold the shader
+     * source compiled by the current render technique.
+     * @return A list of all shader directories.
+     */
+    ShaderDirectoryList getShaderDirectories() const noexcept override;
+
     /**
      * Initialise any internal data or state.
      * @note This is automatically called by the framework after construction and should be used to create
@@ -74,5 +81,11 @@ protected:
     GfxProgram    atmosphere_program_;
     GfxKernel     draw_atmosphere_kernel_;
     GfxKernel     filter_atmosphere_kernel_;
+
+    uint32_t  sun_frame_ = 0; /**< Animated sun position, only advanced while playback is running */
+    glm::vec3 cached_light_direction_ = glm::vec3(0.0f); /**< Sun direction the cache was drawn with */
+    glm::vec3 cached_eye_             = glm::vec3(0.0f); /**< Camera position the cache was drawn with */
+    glm::uvec2 cached_dimensions_     = glm::uvec2(0);   /**< Buffer dimensions the cache was drawn at */
+    bool       cached_valid_ = false; /**< Whether the environment buffer holds an up-to-date sky */
 };
 } // namespace Capsaicin
@@ -28,8 +28,48 @@ THE SOFTWARE.
 #include "components/prefilter_ibl/prefilter_ibl.h"
 #include "components/stratified_sampler/stratified_sampler.h"
 
+#include <filesystem>
+#include <fstream>
+
 namespace Capsaicin
 {
+namespace
+{
+constexpr uint32_t const kHashGridCacheFileMagic   = 0x43474331u; // 'CGC1'
+constexpr uint32_t const kHashGridCacheFileVersion = 1;
+
+struct HashGridCacheFileHeader
+{
+    uint32_t magic;
+    uint32_t version;
+    uint32_t hash_count;
+    uint32_t value_count;
+    float    cell_size;
+    float    min_cell_size;
+};
+
+void hashCombine(size_t &seed, size_t value) noexcept
+{
+    seed ^= value + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+}
+
+/** Calculates the radiance cache file path for the given scene and lighting.
+ * The key is built from the scene file names and the environment map so the cached radiance is only
+ * reused for the scene and lighting it was converged under. */
+std::filesystem::path getHashGridCachePath(CapsaicinInternal const &capsaicin) noexcept
+{
+    size_t key = 0x12345678u;
+    for (auto const &file : capsaicin.getCurrentScenes())
+    {
+        hashCombine(key, std::hash<std::string> {}(file));
+    }
+    hashCombine(key, std::hash<std::string> {}(capsaicin.getCurrentEnvironmentMap()));
+    char buffer[64];
+    snprintf(buffer, sizeof(buffer), "gi10_radiance_cache_%016zx.bin", key);
+    return std::filesystem::path("cache") / buffer;
+}
+} // unnamed namespace
+
 char const *kPopulateScreenProbesRaygenShaderName     = "PopulateScreenProbesRaygen";
 char const *kPopulateScreenProbesMissShaderName       = "PopulateScreenProbesMiss";
 char const *kPopulateScreenProbesAnyHitShaderName     = "PopulateScreenProbesAnyHit";
@@ -48,6 +88,11 @@ char const *kTraceReflectionsAnyHitShaderName     = "TraceReflectionsAnyHit";
 char const *kTraceReflectionsClosestHitShaderName = "TraceReflectionsClosestHit";
 char const *kTraceReflectionsHitGroupName         = "TraceReflectionsHitGroup";
 
+// Number of workgroups launched by the persistent-threads tracing mode; sized to saturate current
+// GPUs with one wavefront per workgroup while staying small enough that the atomic work pulls are
+// negligible against the traced rays
+constexpr uint32_t kPersistentGroupCount = 1024;
+
 GI10::Base::Base(GI10 &gi10)
     : gfx_(gi10.gfx_)
     , self(gi10)
@@ -67,10 +112,8 @@ GI10::ScreenProbes::~ScreenProbes()
 
     for (GfxBuffer &probe_sh_buffer : probe_sh_buffers_)
         gfxDestroyBuffer(gfx_, probe_sh_buffer);
-    for (GfxBuffer &probe_spawn_buffer : probe_spawn_buffers_)
-        gfxDestroyBuffer(gfx_, probe_spawn_buffer);
-    gfxDestroyBuffer(gfx_, probe_spawn_scan_buffer_);
-    gfxDestroyBuffer(gfx_, probe_spawn_index_buffer_);
+    gfxDestroyBuffer(gfx_, probe_spawn_buffer_);
+    gfxDestroyBuffer(gfx_, probe_spawn_count_buffer_);
     gfxDestroyBuffer(gfx_, probe_spawn_probe_buffer_);
     gfxDestroyBuffer(gfx_, probe_spawn_sample_buffer_);
     gfxDestroyBuffer(gfx_, probe_spawn_radiance_buffer_);
@@ -179,31 +222,16 @@ void GI10::ScreenProbes::ensureMemoryIsAllocated(CapsaicinInternal const &capsai
         }
     }
 
-    if (probe_spawn_buffers_->getCount() != max_probe_spawn_count)
+    if (probe_spawn_buffer_.getCount() != max_probe_spawn_count)
     {
-        for (GfxBuffer &probe_spawn_buffer : probe_spawn_buffers_)
-            gfxDestroyBuffer(gfx_, probe_spawn_buffer);
-        gfxDestroyBuffer(gfx_, probe_spawn_scan_buffer_);
-        gfxDestroyBuffer(gfx_, probe_spawn_index_buffer_);
+        gfxDestroyBuffer(gfx_, probe_spawn_buffer_);
         gfxDestroyBuffer(gfx_, probe_spawn_probe_buffer_);
         gfxDestroyBuffer(gfx_, probe_spawn_sample_buffer_);
         gfxDestroyBuffer(gfx_, probe_spawn_radiance_buffer_);
         gfxDestroyBuffer(gfx_, probe_override_tile_buffer_);
 
-        for (uint32_t i = 0; i < ARRAYSIZE(probe_spawn_buffers_); ++i)
-        {
-            char buffer[64];
-            GFX_SNPRINTF(buffer, sizeof(buffer), "Capsaicin_ProbeSpawnBuffer%u", i);
-
-            probe_spawn_buffers_[i] = gfxCreateBuffer<uint32_t>(gfx_, max_probe_spawn_count);
-            probe_spawn_buffers_[i].setName(buffer);
-        }
-
-        probe_spawn_scan_buffer_ = gfxCreateBuffer<uint32_t>(gfx_, max_probe_spawn_count);
-        probe_spawn_scan_buffer_.setName("Capsaicin_ProbeSpawnScanBuffer");
-
-        probe_spawn_index_buffer_ = gfxCreateBuffer<uint32_t>(gfx_, max_probe_spawn_count);
-        probe_spawn_index_buffer_.setName("Capsaicin_ProbeSpawnIndexBuffer");
+        probe_spawn_buffer_ = gfxCreateBuffer<uint32_t>(gfx_, max_probe_spawn_count);
+        probe_spawn_buffer_.setName("Capsaicin_ProbeSpawnBuffer");
 
         probe_spawn_probe_buffer_ = gfxCreateBuffer<uint2>(gfx_, max_probe_spawn_count);
         probe_spawn_probe_buffer_.setName("Capsaicin_ProbeSpawnProbeBuffer");
@@ -242,6 +270,14 @@ void GI10::ScreenProbes::ensureMemoryIsAllocated(CapsaicinInternal const &capsai
         probe_override_tile_count_buffer_.setName("Capsaicin_ProbeOverrideTileCountBuffer");
     }
 
+    if (!probe_spawn_count_buffer_.getCount())
+    {
+        gfxDestroyBuffer(gfx_, probe_spawn_count_buffer_);
+
+        probe_spawn_count_buffer_ = gfxCreateBuffer<uint32_t>(gfx_, 1);
+        probe_spawn_count_buffer_.setName("Capsaicin_ProbeSpawnCountBuffer");
+    }
+
     if (probe_cached_tile_buffer_.getWidth() != probe_buffer_width
         || probe_cached_tile_buffer_.getHeight() != probe_buffer_height)
     {
@@ -354,6 +390,8 @@ GI10::HashGridCache::HashGridCache(GI10 &gi10)
     , radiance_cache_update_tile_buffer_(radiance_cache_hash_buffer_uint_[HASHGRIDCACHE_UPDATETILEBUFFER])
     , radiance_cache_update_tile_count_buffer_(
           radiance_cache_hash_buffer_uint_[HASHGRIDCACHE_UPDATETILECOUNTBUFFER])
+    , radiance_cache_update_tile_key_buffer_(
+          radiance_cache_hash_buffer_uint_[HASHGRIDCACHE_UPDATETILEKEYBUFFER])
     , radiance_cache_update_cell_value_buffer_(
           radiance_cache_hash_buffer_uint_[HASHGRIDCACHE_UPDATECELLVALUEBUFFER])
     , radiance_cache_visibility_buffer_(radiance_cache_hash_buffer_float4_[HASHGRIDCACHE_VISIBILITYBUFFER])
@@ -367,6 +405,10 @@ GI10::HashGridCache::HashGridCache(GI10 &gi10)
           radiance_cache_hash_buffer_uint_[HASHGRIDCACHE_VISIBILITYRAYBUFFER])
     , radiance_cache_visibility_ray_count_buffer_(
           radiance_cache_hash_buffer_uint_[HASHGRIDCACHE_VISIBILITYRAYCOUNTBUFFER])
+    , radiance_cache_visibility_ray_key_buffer_(
+          radiance_cache_hash_buffer_uint_[HASHGRIDCACHE_VISIBILITYRAYKEYBUFFER])
+    , radiance_cache_visibility_ray_order_buffer_(
+          radiance_cache_hash_buffer_uint_[HASHGRIDCACHE_VISIBILITYRAYORDERBUFFER])
     , radiance_cache_packed_tile_count_buffer0_(
           radiance_cache_hash_buffer_uint_[HASHGRIDCACHE_PACKEDTILECOUNTBUFFER0])
     , radiance_cache_packed_tile_count_buffer1_(
@@ -575,15 +617,22 @@ void GI10::HashGridCache::ensureMemoryIsAllocated([[maybe_unused]] CapsaicinInte
     if (!radiance_cache_update_tile_buffer_ || max_ray_count != max_ray_count_ || num_cells != num_cells_)
     {
         gfxDestroyBuffer(gfx_, radiance_cache_update_tile_buffer_);
+        gfxDestroyBuffer(gfx_, radiance_cache_update_tile_key_buffer_);
         gfxDestroyBuffer(gfx_, radiance_cache_visibility_buffer_);
         gfxDestroyBuffer(gfx_, radiance_cache_visibility_cell_buffer_);
         gfxDestroyBuffer(gfx_, radiance_cache_visibility_query_buffer_);
         gfxDestroyBuffer(gfx_, radiance_cache_visibility_ray_buffer_);
+        gfxDestroyBuffer(gfx_, radiance_cache_visibility_ray_key_buffer_);
+        gfxDestroyBuffer(gfx_, radiance_cache_visibility_ray_order_buffer_);
 
         radiance_cache_update_tile_buffer_ =
             gfxCreateBuffer<uint32_t>(gfx_, GFX_MIN(max_ray_count, num_cells));
         radiance_cache_update_tile_buffer_.setName("Capsaicin_RadianceCache_UpdateTileBuffer");
 
+        radiance_cache_update_tile_key_buffer_ =
+            gfxCreateBuffer<uint32_t>(gfx_, GFX_MIN(max_ray_count, num_cells));
+        radiance_cache_update_tile_key_buffer_.setName("Capsaicin_RadianceCache_UpdateTileKeyBuffer");
+
         radiance_cache_visibility_buffer_ = gfxCreateBuffer<float4>(gfx_, max_ray_count);
         radiance_cache_visibility_buffer_.setName("Capsaicin_RadianceCache_VisibilityBuffer");
 
@@ -595,13 +644,23 @@ void GI10::HashGridCache::ensureMemoryIsAllocated([[maybe_unused]] CapsaicinInte
 
         radiance_cache_visibility_ray_buffer_ = gfxCreateBuffer<uint32_t>(gfx_, max_ray_count);
         radiance_cache_visibility_ray_buffer_.setName("Capsaicin_RadianceCache_VisibilityRayBuffer");
+
+        radiance_cache_visibility_ray_key_buffer_ = gfxCreateBuffer<uint32_t>(gfx_, max_ray_count);
+        radiance_cache_visibility_ray_key_buffer_.setName("Capsaicin_RadianceCache_VisibilityRayKeyBuffer");
+
+        radiance_cache_visibility_ray_order_buffer_ = gfxCreateBuffer<uint32_t>(gfx_, max_ray_count);
+        radiance_cache_visibility_ray_order_buffer_.setName(
+            "Capsaicin_RadianceCache_VisibilityRayOrderBuffer");
     }
 
     debug_total_memory_size_in_bytes += radiance_cache_update_tile_buffer_.getSize();
+    debug_total_memory_size_in_bytes += radiance_cache_update_tile_key_buffer_.getSize();
     debug_total_memory_size_in_bytes += radiance_cache_visibility_buffer_.getSize();
     debug_total_memory_size_in_bytes += radiance_cache_visibility_cell_buffer_.getSize();
     debug_total_memory_size_in_bytes += radiance_cache_visibility_query_buffer_.getSize();
     debug_total_memory_size_in_bytes += radiance_cache_visibility_ray_buffer_.getSize();
+    debug_total_memory_size_in_bytes += radiance_cache_visibility_ray_key_buffer_.getSize();
+    debug_total_memory_size_in_bytes += radiance_cache_visibility_ray_order_buffer_.getSize();
 
     if (!radiance_cache_debug_free_bucket_buffer_)
     {
@@ -685,6 +744,16 @@ void GI10::HashGridCache::ensureMemoryIsAllocated([[maybe_unused]] CapsaicinInte
         debug_total_memory_size_in_bytes += buffer.getSize();
     }
 
+    if (options.gi10_hash_grid_cache_max_update_tile_count > 0)
+    {
+        update_tile_sorter_.initialise(capsaicin, GPUSort::Type::UInt, GPUSort::Operation::Ascending);
+    }
+
+    if (options.gi10_ray_binning)
+    {
+        visibility_ray_sorter_.initialise(capsaicin, GPUSort::Type::UInt, GPUSort::Operation::Ascending);
+    }
+
     max_ray_count_                         = max_ray_count;
     num_buckets_                           = num_buckets;
     num_tiles_                             = num_tiles;
@@ -739,7 +808,12 @@ void GI10::WorldSpaceReSTIR::ensureMemoryIsAllocated([[maybe_unused]] CapsaicinI
 {
     uint32_t const max_ray_count = self.screen_probes_.max_ray_count;
 
-    if (reservoir_hash_buffers_->getCount() != kConstant_NumEntries)
+    // The reservoir pool is bounded by the cell count option so memory-constrained targets can
+    // trade reservoir count against resampling quality
+    uint32_t const num_entries =
+        (1u << (uint32_t)self.options_.gi10_reservoir_cache_num_cells) * kConstant_NumEntriesPerCell;
+
+    if (reservoir_hash_buffers_->getCount() != num_entries)
     {
         for (GfxBuffer &reservoir_hash_buffer : reservoir_hash_buffers_)
             gfxDestroyBuffer(gfx_, reservoir_hash_buffer);
@@ -756,7 +830,7 @@ void GI10::WorldSpaceReSTIR::ensureMemoryIsAllocated([[maybe_unused]] CapsaicinI
             GFX_SNPRINTF(buffer, sizeof(buffer), "Capsaicin_Reservoir_HashBuffer%u", i);
 
             reservoir_hash_buffers_[i] =
-                gfxCreateBuffer<uint32_t>(gfx_, WorldSpaceReSTIR::kConstant_NumEntries);
+                gfxCreateBuffer<uint32_t>(gfx_, num_entries);
             reservoir_hash_buffers_[i].setName(buffer);
         }
 
@@ -766,7 +840,7 @@ void GI10::WorldSpaceReSTIR::ensureMemoryIsAllocated([[maybe_unused]] CapsaicinI
             GFX_SNPRINTF(buffer, sizeof(buffer), "Capsaicin_Reservoir_HashCountBuffer%u", i);
 
             reservoir_hash_count_buffers_[i] =
-                gfxCreateBuffer<uint32_t>(gfx_, WorldSpaceReSTIR::kConstant_NumEntries);
+                gfxCreateBuffer<uint32_t>(gfx_, num_entries);
             reservoir_hash_count_buffers_[i].setName(buffer);
         }
 
@@ -776,7 +850,7 @@ void GI10::WorldSpaceReSTIR::ensureMemoryIsAllocated([[maybe_unused]] CapsaicinI
             GFX_SNPRINTF(buffer, sizeof(buffer), "Capsaicin_Reservoir_HashIndexBuffer%u", i);
 
             reservoir_hash_index_buffers_[i] =
-                gfxCreateBuffer<uint32_t>(gfx_, WorldSpaceReSTIR::kConstant_NumEntries);
+                gfxCreateBuffer<uint32_t>(gfx_, num_entries);
             reservoir_hash_index_buffers_[i].setName(buffer);
         }
 
@@ -786,7 +860,7 @@ void GI10::WorldSpaceReSTIR::ensureMemoryIsAllocated([[maybe_unused]] CapsaicinI
             GFX_SNPRINTF(buffer, sizeof(buffer), "Capsaicin_Reservoir_HashValueBuffer%u", i);
 
             reservoir_hash_value_buffers_[i] =
-                gfxCreateBuffer<uint32_t>(gfx_, WorldSpaceReSTIR::kConstant_NumEntries);
+                gfxCreateBuffer<uint32_t>(gfx_, num_entries);
             reservoir_hash_value_buffers_[i].setName(buffer);
         }
     }
@@ -803,7 +877,11 @@ void GI10::WorldSpaceReSTIR::ensureMemoryIsAllocated([[maybe_unused]] CapsaicinI
         reservoir_hash_list_count_buffer_.setName("Capsaicin_Reservoir_HashListCountBuffer");
     }
 
-    if (reservoir_indirect_sample_buffer_.getCount() < max_ray_count)
+    uint32_t const reservoir_stride =
+        self.options_.gi10_use_compressed_storage ? (uint32_t)sizeof(uint2) : (uint32_t)sizeof(uint4);
+
+    if (reservoir_indirect_sample_buffer_.getCount() < max_ray_count
+        || reservoir_indirect_sample_reservoir_buffers_[0].getStride() != reservoir_stride)
     {
         gfxDestroyBuffer(gfx_, reservoir_indirect_sample_buffer_);
         for (GfxBuffer &reservoir_indirect_sample_normal_buffer : reservoir_indirect_sample_normal_buffers_)
@@ -834,7 +912,9 @@ void GI10::WorldSpaceReSTIR::ensureMemoryIsAllocated([[maybe_unused]] CapsaicinI
             char buffer[64];
             GFX_SNPRINTF(buffer, sizeof(buffer), "Capsaicin_Reservoir_IndirectSampleReservoirBuffer%u", i);
 
-            reservoir_indirect_sample_reservoir_buffers_[i] = gfxCreateBuffer<uint4>(gfx_, max_ray_count);
+            reservoir_indirect_sample_reservoir_buffers_[i] =
+                self.options_.gi10_use_compressed_storage ? gfxCreateBuffer<uint2>(gfx_, max_ray_count)
+                                                          : gfxCreateBuffer<uint4>(gfx_, max_ray_count);
             reservoir_indirect_sample_reservoir_buffers_[i].setName(buffer);
         }
     }
@@ -911,6 +991,11 @@ void GI10::GlossyReflections::ensureMemoryIsAllocated(CapsaicinInternal const &c
         rt_sample_count_buffer_.setName("RtSampleCountBuffer");
     }
 
+    if (options.gi10_ray_binning)
+    {
+        rt_sample_sorter_.initialise(capsaicin, GPUSort::Type::UInt, GPUSort::Operation::Ascending);
+    }
+
     if (!fireflies_buffer_ || fireflies_buffer_.getWidth() != half_buffer_width
         || fireflies_buffer_.getHeight() != half_buffer_height)
     {
@@ -1099,6 +1184,10 @@ RenderOptionList GI10::getRenderOptions() noexcept
     RenderOptionList newOptions;
     newOptions.emplace(RENDER_OPTION_MAKE(gi10_use_dxr10, options_));
     newOptions.emplace(RENDER_OPTION_MAKE(gi10_use_resampling, options_));
+    newOptions.emplace(RENDER_OPTION_MAKE(gi10_ray_binning, options_));
+    newOptions.emplace(RENDER_OPTION_MAKE(gi10_use_compressed_storage, options_));
+    newOptions.emplace(RENDER_OPTION_MAKE(gi10_screen_probes_adaptive_spawn, options_));
+    newOptions.emplace(RENDER_OPTION_MAKE(gi10_screen_probes_checkerboard, options_));
     newOptions.emplace(RENDER_OPTION_MAKE(gi10_use_alpha_testing, options_));
     newOptions.emplace(RENDER_OPTION_MAKE(gi10_use_direct_lighting, options_));
     newOptions.emplace(RENDER_OPTION_MAKE(gi10_disable_albedo_textures, options_));
@@ -1109,12 +1198,19 @@ RenderOptionList GI10::getRenderOptions() noexcept
     newOptions.emplace(RENDER_OPTION_MAKE(gi10_hash_grid_cache_num_buckets, options_));
     newOptions.emplace(RENDER_OPTION_MAKE(gi10_hash_grid_cache_num_tiles_per_bucket, options_));
     newOptions.emplace(RENDER_OPTION_MAKE(gi10_hash_grid_cache_max_sample_count, options_));
+    newOptions.emplace(RENDER_OPTION_MAKE(gi10_hash_grid_cache_max_update_tile_count, options_));
+    newOptions.emplace(RENDER_OPTION_MAKE(gi10_hash_grid_cache_persistent_threads, options_));
     newOptions.emplace(RENDER_OPTION_MAKE(gi10_hash_grid_cache_debug_mip_level, options_));
     newOptions.emplace(RENDER_OPTION_MAKE(gi10_hash_grid_cache_debug_propagate, options_));
     newOptions.emplace(RENDER_OPTION_MAKE(gi10_hash_grid_cache_debug_max_cell_decay, options_));
     newOptions.emplace(RENDER_OPTION_MAKE(gi10_hash_grid_cache_debug_stats, options_));
     newOptions.emplace(RENDER_OPTION_MAKE(gi10_hash_grid_cache_debug_max_bucket_overflow, options_));
+    newOptions.emplace(RENDER_OPTION_MAKE(gi10_hash_grid_cache_adaptive_resize, options_));
+    newOptions.emplace(RENDER_OPTION_MAKE(gi10_hash_grid_cache_adaptive_resize_min, options_));
+    newOptions.emplace(RENDER_OPTION_MAKE(gi10_hash_grid_cache_adaptive_resize_max, options_));
+    newOptions.emplace(RENDER_OPTION_MAKE(gi10_hash_grid_cache_warm_start, options_));
     newOptions.emplace(RENDER_OPTION_MAKE(gi10_reservoir_cache_cell_size, options_));
+    newOptions.emplace(RENDER_OPTION_MAKE(gi10_reservoir_cache_num_cells, options_));
     newOptions.emplace(RENDER_OPTION_MAKE(gi10_glossy_reflections_halfres, options_));
     newOptions.emplace(RENDER_OPTION_MAKE(gi10_glossy_reflections_denoiser_mode, options_));
     newOptions.emplace(RENDER_OPTION_MAKE(gi10_glossy_reflections_low_roughness_threshold, options_));
@@ -1143,6 +1239,10 @@ GI10::RenderOptions GI10::convertOptions(RenderOptionList const &options) noexce
     RenderOptions newOptions;
     RENDER_OPTION_GET(gi10_use_dxr10, newOptions, options)
     RENDER_OPTION_GET(gi10_use_resampling, newOptions, options)
+    RENDER_OPTION_GET(gi10_ray_binning, newOptions, options)
+    RENDER_OPTION_GET(gi10_use_compressed_storage, newOptions, options)
+    RENDER_OPTION_GET(gi10_screen_probes_adaptive_spawn, newOptions, options)
+    RENDER_OPTION_GET(gi10_screen_probes_checkerboard, newOptions, options)
     RENDER_OPTION_GET(gi10_use_alpha_testing, newOptions, options)
     RENDER_OPTION_GET(gi10_use_direct_lighting, newOptions, options)
     RENDER_OPTION_GET(gi10_disable_albedo_textures, newOptions, options)
@@ -1153,12 +1253,19 @@ GI10::RenderOptions GI10::convertOptions(RenderOptionList const &options) noexce
     RENDER_OPTION_GET(gi10_hash_grid_cache_num_buckets, newOptions, options)
     RENDER_OPTION_GET(gi10_hash_grid_cache_num_tiles_per_bucket, newOptions, options)
     RENDER_OPTION_GET(gi10_hash_grid_cache_max_sample_count, newOptions, options)
+    RENDER_OPTION_GET(gi10_hash_grid_cache_max_update_tile_count, newOptions, options)
+    RENDER_OPTION_GET(gi10_hash_grid_cache_persistent_threads, newOptions, options)
     RENDER_OPTION_GET(gi10_hash_grid_cache_debug_mip_level, newOptions, options)
     RENDER_OPTION_GET(gi10_hash_grid_cache_debug_propagate, newOptions, options)
     RENDER_OPTION_GET(gi10_hash_grid_cache_debug_max_cell_decay, newOptions, options)
     RENDER_OPTION_GET(gi10_hash_grid_cache_debug_stats, newOptions, options)
     RENDER_OPTION_GET(gi10_hash_grid_cache_debug_max_bucket_overflow, newOptions, options)
+    RENDER_OPTION_GET(gi10_hash_grid_cache_adaptive_resize, newOptions, options)
+    RENDER_OPTION_GET(gi10_hash_grid_cache_adaptive_resize_min, newOptions, options)
+    RENDER_OPTION_GET(gi10_hash_grid_cache_adaptive_resize_max, newOptions, options)
+    RENDER_OPTION_GET(gi10_hash_grid_cache_warm_start, newOptions, options)
     RENDER_OPTION_GET(gi10_reservoir_cache_cell_size, newOptions, options)
+    RENDER_OPTION_GET(gi10_reservoir_cache_num_cells, newOptions, options)
     RENDER_OPTION_GET(gi10_glossy_reflections_halfres, newOptions, options)
     RENDER_OPTION_GET(gi10_glossy_reflections_denoiser_mode, newOptions, options)
     RENDER_OPTION_GET(gi10_glossy_reflections_low_roughness_threshold, newOptions, options)
@@ -1192,8 +1299,10 @@ AOVList GI10::getAOVs() const noexcept
 {
     AOVList aovs;
     aovs.push_back({"Debug", AOV::Write});
-    aovs.push_back({"GlobalIllumination", AOV::Write, AOV::None, DXGI_FORMAT_R16G16B16A16_FLOAT});
-    aovs.push_back({"Reflection", AOV::Write, AOV::None, DXGI_FORMAT_R16G16B16A16_FLOAT, "PrevReflection"});
+    aovs.push_back({"GlobalIllumination", AOV::Write, AOV::None, DXGI_FORMAT_R16G16B16A16_FLOAT,
+        std::string_view(), AOV::AtLeast});
+    aovs.push_back({"Reflection", AOV::Write, AOV::None, DXGI_FORMAT_R16G16B16A16_FLOAT, "PrevReflection",
+        AOV::AtLeast});
     aovs.push_back({.name = "VisibilityDepth", .backup_name = "PrevVisibilityDepth"});
     aovs.push_back({.name = "GeometryNormal", .backup_name = "PrevGeometryNormal"});
     aovs.push_back({.name = "ShadingNormal", .backup_name = "PrevShadingNormal"});
@@ -1223,6 +1332,11 @@ DebugViewList GI10::getDebugViews() const noexcept
     return views;
 }
 
+ShaderDirectoryList GI10::getShaderDirectories() const noexcept
+{
+    return {"render_techniques/gi10", "utilities"};
+}
+
 bool GI10::init(CapsaicinInternal const &capsaicin) noexcept
 {
     depth_buffer_ = gfxCreateTexture2D(gfx_, DXGI_FORMAT_D32_FLOAT);
@@ -1235,6 +1349,11 @@ bool GI10::init(CapsaicinInternal const &capsaicin) noexcept
         gfxCreateBuffer(gfx_, GFX_MAX(sizeof(DispatchCommand), sizeof(DispatchRaysCommand)));
     dispatch_command_buffer_.setName("Capsaicin_DispatchCommandBuffer");
 
+    work_counter_buffer_ = gfxCreateBuffer<uint32_t>(gfx_, 1);
+    work_counter_buffer_.setName("Capsaicin_WorkCounterBuffer");
+
+    dispatch_args_.initialise(capsaicin);
+
     // Set up the base defines based on available features
     auto                      light_sampler = capsaicin.getComponent<LightSamplerGridStream>();
     std::vector<std::string>  defines(std::move(light_sampler->getShaderDefines(capsaicin)));
@@ -1246,19 +1365,27 @@ bool GI10::init(CapsaicinInternal const &capsaicin) noexcept
     if (!options_.gi10_use_alpha_testing) base_defines.push_back("DISABLE_ALPHA_TESTING");
     if (capsaicin.hasAOVBuffer("OcclusionAndBentNormal")) base_defines.push_back("HAS_OCCLUSION");
     if (options_.gi10_disable_specular_materials) base_defines.push_back("DISABLE_SPECULAR_MATERIALS");
+    if (options_.gi10_use_compressed_storage) base_defines.push_back("USE_COMPRESSED_STORAGE");
+    if (options_.gi10_use_direct_lighting) base_defines.push_back("USE_DIRECT_LIGHTING");
+    if (options_.gi10_disable_albedo_textures) base_defines.push_back("DISABLE_ALBEDO_TEXTURES");
     uint32_t const base_define_count = (uint32_t)base_defines.size();
 
     std::vector<char const *> resampling_defines = base_defines;
     if (options_.gi10_use_resampling) resampling_defines.push_back("USE_RESAMPLING");
     uint32_t const resampling_define_count = (uint32_t)resampling_defines.size();
 
+    std::vector<char const *> populate_cells_defines = resampling_defines;
+    if (options_.gi10_ray_binning) populate_cells_defines.push_back("USE_RAY_BINNING");
+    uint32_t const populate_cells_define_count = (uint32_t)populate_cells_defines.size();
+
     std::vector<char const *> debug_hash_cells_defines = base_defines;
     if (debug_view_.starts_with("HashGridCache_"))
     {
         debug_hash_cells_defines.push_back("DEBUG_HASH_CELLS");
     }
-    if (options_.gi10_hash_grid_cache_debug_stats)
+    if (options_.gi10_hash_grid_cache_debug_stats || options_.gi10_hash_grid_cache_adaptive_resize)
     {
+        // The adaptive resize heuristic consumes the same occupancy statistics as the debug view
         debug_hash_cells_defines.push_back("DEBUG_HASH_STATS");
     }
     uint32_t const debug_hash_cells_define_count = (uint32_t)debug_hash_cells_defines.size();
@@ -1310,8 +1437,8 @@ bool GI10::init(CapsaicinInternal const &capsaicin) noexcept
     reproject_screen_probes_kernel_ = gfxCreateComputeKernel(gfx_, gi10_program_, "ReprojectScreenProbes");
     count_screen_probes_kernel_     = gfxCreateComputeKernel(gfx_, gi10_program_, "CountScreenProbes");
     scatter_screen_probes_kernel_   = gfxCreateComputeKernel(gfx_, gi10_program_, "ScatterScreenProbes");
+    seed_screen_probes_kernel_      = gfxCreateComputeKernel(gfx_, gi10_program_, "SeedScreenProbes");
     spawn_screen_probes_kernel_     = gfxCreateComputeKernel(gfx_, gi10_program_, "SpawnScreenProbes");
-    compact_screen_probes_kernel_   = gfxCreateComputeKernel(gfx_, gi10_program_, "CompactScreenProbes");
     patch_screen_probes_kernel_     = gfxCreateComputeKernel(gfx_, gi10_program_, "PatchScreenProbes");
     sample_screen_probes_kernel_    = gfxCreateComputeKernel(gfx_, gi10_program_, "SampleScreenProbes");
     if (options_.gi10_use_dxr10)
@@ -1342,7 +1469,7 @@ bool GI10::init(CapsaicinInternal const &capsaicin) noexcept
         populate_cells_kernel_ = gfxCreateRaytracingKernel(gfx_, gi10_program_, nullptr, 0,
             populate_cells_kernel_exports.data(), (uint32_t)populate_cells_kernel_exports.size(),
             populate_cells_kernel_subobjects.data(), (uint32_t)populate_cells_kernel_subobjects.size(),
-            resampling_defines.data(), resampling_define_count);
+            populate_cells_defines.data(), populate_cells_define_count);
 
         std::vector<char const *> trace_reflections_kernel_exports;
         trace_reflections_kernel_exports.push_back(kTraceReflectionsRaygenShaderName);
@@ -1353,7 +1480,8 @@ bool GI10::init(CapsaicinInternal const &capsaicin) noexcept
         trace_reflections_kernel_subobjects.push_back(kTraceReflectionsHitGroupName);
         trace_reflections_kernel_      = gfxCreateRaytracingKernel(gfx_, gi10_program_, nullptr, 0,
                  trace_reflections_kernel_exports.data(), (uint32_t)trace_reflections_kernel_exports.size(),
-                 trace_reflections_kernel_subobjects.data(), (uint32_t)trace_reflections_kernel_subobjects.size());
+                 trace_reflections_kernel_subobjects.data(), (uint32_t)trace_reflections_kernel_subobjects.size(),
+                 base_defines.data(), base_define_count);
         generate_dispatch_rays_kernel_ = gfxCreateComputeKernel(gfx_, gi10_program_, "GenerateDispatchRays");
 
         uint32_t entry_count[kGfxShaderGroupType_Count] {
@@ -1362,17 +1490,24 @@ bool GI10::init(CapsaicinInternal const &capsaicin) noexcept
             gfxSceneGetInstanceCount(capsaicin.getScene())
                 * capsaicin.getSbtStrideInEntries(kGfxShaderGroupType_Hit),
             capsaicin.getSbtStrideInEntries(kGfxShaderGroupType_Callable)};
-        GfxKernel sbt_kernels[] {
-            populate_screen_probes_kernel_, populate_cells_kernel_, trace_reflections_kernel_};
-        sbt_ = gfxCreateSbt(gfx_, sbt_kernels, ARRAYSIZE(sbt_kernels), entry_count);
+        // Each ray tracing pass gets its own SBT so the populated records can be cached across
+        // frames (the passes write different hit groups into the same record slots)
+        populate_screen_probes_sbt_ = gfxCreateSbt(gfx_, &populate_screen_probes_kernel_, 1, entry_count);
+        populate_cells_sbt_         = gfxCreateSbt(gfx_, &populate_cells_kernel_, 1, entry_count);
+        trace_reflections_sbt_      = gfxCreateSbt(gfx_, &trace_reflections_kernel_, 1, entry_count);
+        sbt_primitive_count_        = 0; // force the records to be (re)populated
     }
     else
     {
         populate_screen_probes_kernel_ = gfxCreateComputeKernel(gfx_, gi10_program_,
             "PopulateScreenProbesMain", debug_hash_cells_defines.data(), debug_hash_cells_define_count);
-        populate_cells_kernel_         = gfxCreateComputeKernel(
-            gfx_, gi10_program_, "PopulateCellsMain", resampling_defines.data(), resampling_define_count);
-        trace_reflections_kernel_ = gfxCreateComputeKernel(gfx_, gi10_program_, "TraceReflectionsMain");
+        populate_cells_kernel_         = gfxCreateComputeKernel(gfx_, gi10_program_, "PopulateCellsMain",
+            populate_cells_defines.data(), populate_cells_define_count);
+        populate_cells_persistent_kernel_ =
+            gfxCreateComputeKernel(gfx_, gi10_program_, "PopulateCellsPersistentMain",
+                populate_cells_defines.data(), populate_cells_define_count);
+        trace_reflections_kernel_ = gfxCreateComputeKernel(
+            gfx_, gi10_program_, "TraceReflectionsMain", base_defines.data(), base_define_count);
     }
     blend_screen_probes_kernel_       = gfxCreateComputeKernel(gfx_, gi10_program_, "BlendScreenProbes");
     reorder_screen_probes_kernel_     = gfxCreateComputeKernel(gfx_, gi10_program_, "ReorderScreenProbes");
@@ -1383,10 +1518,13 @@ bool GI10::init(CapsaicinInternal const &capsaicin) noexcept
 
     purge_tiles_kernel_ = gfxCreateComputeKernel(
         gfx_, gi10_program_, "PurgeTiles", debug_hash_cells_defines.data(), debug_hash_cells_define_count);
+    build_visibility_ray_keys_kernel_ = gfxCreateComputeKernel(
+        gfx_, gi10_program_, "BuildVisibilityRayKeys", base_defines.data(), base_define_count);
+    build_update_tile_keys_kernel_ = gfxCreateComputeKernel(gfx_, gi10_program_, "BuildUpdateTileKeys");
     update_tiles_kernel_  = gfxCreateComputeKernel(gfx_, gi10_program_, "UpdateTiles");
     resolve_cells_kernel_ = gfxCreateComputeKernel(gfx_, gi10_program_, "ResolveCells");
 
-    if (options_.gi10_hash_grid_cache_debug_stats)
+    if (options_.gi10_hash_grid_cache_debug_stats || options_.gi10_hash_grid_cache_adaptive_resize)
     {
         clear_bucket_overflow_count_kernel_ =
             gfxCreateComputeKernel(gfx_, gi10_program_, "ClearBucketOverflowCount");
@@ -1417,6 +1555,8 @@ bool GI10::init(CapsaicinInternal const &capsaicin) noexcept
         gfxCreateComputeKernel(gfx_, gi10_program_, "ResolveReflections_AtrousRatioEstimator_Iter");
     resolve_reflections_kernels_[4] =
         gfxCreateComputeKernel(gfx_, gi10_program_, "ResolveReflections_AtrousRatioEstimator_Last");
+    resolve_reflections_kernels_[5] =
+        gfxCreateComputeKernel(gfx_, gi10_program_, "ResolveReflections_AtrousRatioEstimator_IterTiled");
     reproject_reflections_kernel_   = gfxCreateComputeKernel(gfx_, gi10_program_, "ReprojectReflections");
     no_denoiser_reflections_kernel_ = gfxCreateComputeKernel(gfx_, gi10_program_, "NoDenoiserReflections");
 
@@ -1458,11 +1598,16 @@ void GI10::render(CapsaicinInternal &capsaicin) noexcept
 
     bool const needs_recompile =
         (options.gi10_use_resampling != options_.gi10_use_resampling
+            || options.gi10_ray_binning != options_.gi10_ray_binning
+            || options.gi10_use_compressed_storage != options_.gi10_use_compressed_storage
             || options.gi10_use_alpha_testing != options_.gi10_use_alpha_testing
             || options.gi10_disable_specular_materials != options_.gi10_disable_specular_materials
+            || options.gi10_use_direct_lighting != options_.gi10_use_direct_lighting
+            || options.gi10_disable_albedo_textures != options_.gi10_disable_albedo_textures
             || light_sampler->needsRecompile(capsaicin) || needs_debug_view)
         || options_.gi10_use_dxr10 != options.gi10_use_dxr10
-        || options_.gi10_hash_grid_cache_debug_stats != options.gi10_hash_grid_cache_debug_stats;
+        || options_.gi10_hash_grid_cache_debug_stats != options.gi10_hash_grid_cache_debug_stats
+        || options_.gi10_hash_grid_cache_adaptive_resize != options.gi10_hash_grid_cache_adaptive_resize;
 
     bool const needs_hash_grid_clear =
         options_.gi10_hash_grid_cache_cell_size != options.gi10_hash_grid_cache_cell_size
@@ -1509,6 +1654,7 @@ void GI10::render(CapsaicinInternal &capsaicin) noexcept
     if (needs_hash_grid_clear)
     {
         clearHashGridCache(); // clear the radiance cache
+        hash_grid_cache_load_pending_ = true;
     }
 
     // Ensure our scratch memory is allocated
@@ -1518,6 +1664,40 @@ void GI10::render(CapsaicinInternal &capsaicin) noexcept
     glossy_reflections_.ensureMemoryIsAllocated(capsaicin);
     gi_denoiser_.ensureMemoryIsAllocated(capsaicin);
 
+    // Keep the central memory tracker up to date and shrink the hash grid one size step when the
+    // budget manager signals pressure, mirroring the adaptive resize path
+    capsaicin.getMemoryBudget().report(
+        "GI10 Hash Grid Cache", hash_grid_cache_.debug_total_memory_size_in_bytes_);
+    if (memory_pressure_callback_ == 0)
+    {
+        memory_pressure_callback_ = capsaicin.getMemoryBudget().registerPressureCallback(
+            [this](uint64_t) { memory_pressure_shrink_ = true; });
+    }
+    if (memory_pressure_shrink_)
+    {
+        memory_pressure_shrink_ = false;
+        auto &num_buckets = capsaicin.getOption<int>("gi10_hash_grid_cache_num_buckets");
+        if (num_buckets > options_.gi10_hash_grid_cache_adaptive_resize_min)
+        {
+            --num_buckets; // the table is reallocated by ensureMemoryIsAllocated() next frame
+        }
+    }
+
+    // Preload a serialized radiance cache so the first frame starts from converged lighting
+    if (hash_grid_cache_load_pending_)
+    {
+        hash_grid_cache_load_pending_ = false;
+        if (options_.gi10_hash_grid_cache_warm_start)
+        {
+            loadHashGridCache(capsaicin);
+        }
+    }
+    if (hash_grid_cache_save_requested_)
+    {
+        hash_grid_cache_save_requested_ = false;
+        saveHashGridCache(capsaicin);
+    }
+
     // Reallocate fullscreen render target if required
     if (irradiance_buffer_.getWidth() != capsaicin.getWidth()
         || irradiance_buffer_.getHeight() != capsaicin.getHeight())
@@ -1529,12 +1709,19 @@ void GI10::render(CapsaicinInternal &capsaicin) noexcept
         irradiance_buffer_.setName("Capsaicin_IrradianceBuffer");
     }
 
-    // Allocate and populate our constant data
-    GfxBuffer gi10_constants               = capsaicin.allocateConstantBuffer<GI10Constants>(1);
-    GfxBuffer screen_probes_constants      = capsaicin.allocateConstantBuffer<ScreenProbesConstants>(1);
-    GfxBuffer hash_grid_cache_constants    = capsaicin.allocateConstantBuffer<HashGridCacheConstants>(1);
-    GfxBuffer world_space_restir_constants = capsaicin.allocateConstantBuffer<WorldSpaceReSTIRConstants>(1);
-    GfxBuffer glossy_reflections_constants = capsaicin.allocateConstantBuffer<GlossyReflectionsConstants>(1);
+    // Populate our per-frame constant data; the blocks live at fixed offsets inside the shared
+    // frame constants arena, so registration is a no-op after the first frame and the returned
+    // ranges are stable per back buffer instead of being re-allocated every frame
+    GfxBuffer gi10_constants =
+        capsaicin.getConstantBlockBuffer(capsaicin.registerConstantBlock<GI10Constants>("GI10Constants"));
+    GfxBuffer screen_probes_constants = capsaicin.getConstantBlockBuffer(
+        capsaicin.registerConstantBlock<ScreenProbesConstants>("GI10ScreenProbesConstants"));
+    GfxBuffer hash_grid_cache_constants = capsaicin.getConstantBlockBuffer(
+        capsaicin.registerConstantBlock<HashGridCacheConstants>("GI10HashGridCacheConstants"));
+    GfxBuffer world_space_restir_constants = capsaicin.getConstantBlockBuffer(
+        capsaicin.registerConstantBlock<WorldSpaceReSTIRConstants>("GI10WorldSpaceReSTIRConstants"));
+    GfxBuffer glossy_reflections_constants = capsaicin.getConstantBlockBuffer(
+        capsaicin.registerConstantBlock<GlossyReflectionsConstants>("GI10GlossyReflectionsConstants"));
 
     GI10Constants gi_constant_data  = {};
     auto const   &camera            = capsaicin.getCameraMatrices(capsaicin.getOption<bool>("taa_enable"));
@@ -1545,11 +1732,8 @@ void GI10::render(CapsaicinInternal &capsaicin) noexcept
     gi_constant_data.reprojection       = camera.reprojection;
     if (options.gi10_use_dxr10)
     {
-        gfxSbtGetGpuVirtualAddressRangeAndStride(gfx_, sbt_,
-            (D3D12_GPU_VIRTUAL_ADDRESS_RANGE *)&gi_constant_data.ray_generation_shader_record,
-            (D3D12_GPU_VIRTUAL_ADDRESS_RANGE_AND_STRIDE *)&gi_constant_data.miss_shader_table,
-            (D3D12_GPU_VIRTUAL_ADDRESS_RANGE_AND_STRIDE *)&gi_constant_data.hit_group_table,
-            (D3D12_GPU_VIRTUAL_ADDRESS_RANGE_AND_STRIDE *)&gi_constant_data.callable_shader_table);
+        // Re-populate the cached shader binding tables if the instance mapping changed
+        updateSbts(capsaicin);
     }
 
     gfxBufferGetData<GI10Constants>(gfx_, gi10_constants)[0] = gi_constant_data;
@@ -1563,6 +1747,8 @@ void GI10::render(CapsaicinInternal &capsaicin) noexcept
     screen_probes_constant_data.probe_count           = screen_probes_.probe_count_;
     screen_probes_constant_data.probe_mask_mip_count  = screen_probes_.probe_mask_buffers_->getMipLevels();
     screen_probes_constant_data.probe_spawn_tile_size = screen_probes_.probe_spawn_tile_size_;
+    screen_probes_constant_data.adaptive_spawn        = (uint)options_.gi10_screen_probes_adaptive_spawn;
+    screen_probes_constant_data.checkerboard          = (uint)options_.gi10_screen_probes_checkerboard;
     screen_probes_constant_data.debug_mode            = SCREENPROBES_DEBUG_RADIANCE;
     if (debug_view_ == "RadianceCachePerDirection")
     {
@@ -1598,6 +1784,10 @@ void GI10::render(CapsaicinInternal &capsaicin) noexcept
     hash_grid_cache_constant_data.first_cell_offset_tile_mip3 = hash_grid_cache_.first_cell_offset_tile_mip3_;
     hash_grid_cache_constant_data.buffer_ping_pong = hash_grid_cache_.radiance_cache_hash_buffer_ping_pong_;
     hash_grid_cache_constant_data.max_sample_count = options_.gi10_hash_grid_cache_max_sample_count;
+    hash_grid_cache_constant_data.max_update_tile_count =
+        options_.gi10_hash_grid_cache_max_update_tile_count > 0
+            ? (uint32_t)options_.gi10_hash_grid_cache_max_update_tile_count
+            : 0xFFFFFFFFu;
     hash_grid_cache_constant_data.debug_mip_level  = options_.gi10_hash_grid_cache_debug_mip_level;
     hash_grid_cache_constant_data.debug_propagate  = (uint)options_.gi10_hash_grid_cache_debug_propagate;
     hash_grid_cache_constant_data.debug_max_cell_decay = options_.gi10_hash_grid_cache_debug_max_cell_decay;
@@ -1652,7 +1842,7 @@ void GI10::render(CapsaicinInternal &capsaicin) noexcept
         tanf(capsaicin.getCamera().fovY * options_.gi10_reservoir_cache_cell_size
              * GFX_MAX(1.0f / capsaicin.getHeight(),
                  (float)capsaicin.getHeight() / (capsaicin.getWidth() * capsaicin.getWidth())));
-    world_space_restir_constant_data.num_cells            = WorldSpaceReSTIR::kConstant_NumCells;
+    world_space_restir_constant_data.num_cells = 1u << (uint32_t)options_.gi10_reservoir_cache_num_cells;
     world_space_restir_constant_data.num_entries_per_cell = WorldSpaceReSTIR::kConstant_NumEntriesPerCell;
     gfxBufferGetData<WorldSpaceReSTIRConstants>(gfx_, world_space_restir_constants)[0] =
         world_space_restir_constant_data;
@@ -1698,11 +1888,7 @@ void GI10::render(CapsaicinInternal &capsaicin) noexcept
     gfxProgramSetParameter(gfx_, gi10_program_, "g_InvDeviceZ", capsaicin.getInvDeviceZ());
     gfxProgramSetParameter(gfx_, gi10_program_, "g_PreviousEye", previous_camera_.eye);
     gfxProgramSetParameter(gfx_, gi10_program_, "g_BufferDimensions", buffer_dimensions);
-    gfxProgramSetParameter(
-        gfx_, gi10_program_, "g_UseDirectLighting", options_.gi10_use_direct_lighting ? 1 : 0);
     gfxProgramSetParameter(gfx_, gi10_program_, "g_PreViewTranslation", capsaicin.getPreViewTranslation());
-    gfxProgramSetParameter(
-        gfx_, gi10_program_, "g_DisableAlbedoTextures", options_.gi10_disable_albedo_textures ? 1 : 0);
 
     gfxProgramSetParameter(gfx_, gi10_program_, "g_DepthBuffer", capsaicin.getAOVBuffer("VisibilityDepth"));
     gfxProgramSetParameter(
@@ -1793,19 +1979,15 @@ void GI10::render(CapsaicinInternal &capsaicin) noexcept
         screen_probes_.probe_sh_buffers_[1 - screen_probes_.probe_buffer_index_]);
 
     gfxProgramSetParameter(
-        gfx_, gi10_program_, "g_ScreenProbes_ProbeSpawnBuffer", screen_probes_.probe_spawn_buffers_[0]);
-    gfxProgramSetParameter(
-        gfx_, gi10_program_, "g_ScreenProbes_ProbeSpawnScanBuffer", screen_probes_.probe_spawn_scan_buffer_);
-    gfxProgramSetParameter(gfx_, gi10_program_, "g_ScreenProbes_ProbeSpawnIndexBuffer",
-        screen_probes_.probe_spawn_index_buffer_);
+        gfx_, gi10_program_, "g_ScreenProbes_ProbeSpawnBuffer", screen_probes_.probe_spawn_buffer_);
+    gfxProgramSetParameter(gfx_, gi10_program_, "g_ScreenProbes_ProbeSpawnCountBuffer",
+        screen_probes_.probe_spawn_count_buffer_);
     gfxProgramSetParameter(gfx_, gi10_program_, "g_ScreenProbes_ProbeSpawnProbeBuffer",
         screen_probes_.probe_spawn_probe_buffer_);
     gfxProgramSetParameter(gfx_, gi10_program_, "g_ScreenProbes_ProbeSpawnSampleBuffer",
         screen_probes_.probe_spawn_sample_buffer_);
     gfxProgramSetParameter(gfx_, gi10_program_, "g_ScreenProbes_ProbeSpawnRadianceBuffer",
         screen_probes_.probe_spawn_radiance_buffer_);
-    gfxProgramSetParameter(gfx_, gi10_program_, "g_ScreenProbes_PreviousProbeSpawnBuffer",
-        screen_probes_.probe_spawn_buffers_[1]);
 
     gfxProgramSetParameter(
         gfx_, gi10_program_, "g_ScreenProbes_EmptyTileBuffer", screen_probes_.probe_empty_tile_buffer_);
@@ -1933,7 +2115,7 @@ void GI10::render(CapsaicinInternal &capsaicin) noexcept
         gfx_, gi10_program_, "g_GIDenoiser_BlurSampleCountBuffer", gi_denoiser_.blur_sample_count_buffer_);
 
     // Clear bucket overflow count
-    if (options_.gi10_hash_grid_cache_debug_stats)
+    if (options_.gi10_hash_grid_cache_debug_stats || options_.gi10_hash_grid_cache_adaptive_resize)
     {
         TimedSection const timed_section(*this, "ClearBucketOverflowCount");
 
@@ -2000,21 +2182,36 @@ void GI10::render(CapsaicinInternal &capsaicin) noexcept
         gfxCommandDispatchIndirect(gfx_, dispatch_command_buffer_);
     }
 
-    // Spawn our new screen probes
+    // Seed the disoccluded probes from the world-anchored cached tiles,
+    // so GI survives camera cuts rather than re-converging from scratch
+    {
+        TimedSection const timed_section(*this, "SeedScreenProbes");
+
+        uint32_t const probe_count[] = {
+            (buffer_dimensions[0] + screen_probes_.probe_size_ - 1) / screen_probes_.probe_size_,
+            (buffer_dimensions[1] + screen_probes_.probe_size_ - 1) / screen_probes_.probe_size_};
+
+        uint32_t const *num_threads = gfxKernelGetNumThreads(gfx_, seed_screen_probes_kernel_);
+        uint32_t const  num_groups_x =
+            (probe_count[0] * screen_probes_.probe_size_ + num_threads[0] - 1) / num_threads[0];
+        uint32_t const num_groups_y =
+            (probe_count[1] * screen_probes_.probe_size_ + num_threads[1] - 1) / num_threads[1];
+
+        gfxCommandBindKernel(gfx_, seed_screen_probes_kernel_);
+        gfxCommandDispatch(gfx_, num_groups_x, num_groups_y, 1);
+    }
+
+    // Spawn our new screen probes; the kernel classifies the spawn tiles and compacts the
+    // surviving ones into the spawn list in a single wave-cooperative dispatch
     {
         TimedSection const timed_section(*this, "SpawnScreenProbes");
 
         uint32_t const *num_threads = gfxKernelGetNumThreads(gfx_, spawn_screen_probes_kernel_);
         uint32_t const  num_groups_x =
             (screen_probes_.max_probe_spawn_count + num_threads[0] - 1) / num_threads[0];
-        GFX_ASSERT(*num_threads == *gfxKernelGetNumThreads(gfx_, compact_screen_probes_kernel_));
 
         gfxCommandBindKernel(gfx_, spawn_screen_probes_kernel_);
         gfxCommandDispatch(gfx_, num_groups_x, 1, 1);
-        gfxCommandScanSum(gfx_, kGfxDataType_Uint, screen_probes_.probe_spawn_index_buffer_,
-            screen_probes_.probe_spawn_scan_buffer_);
-        gfxCommandBindKernel(gfx_, compact_screen_probes_kernel_);
-        gfxCommandDispatch(gfx_, num_groups_x, 1, 1);
     }
 
     // Stochastically patch the overridable tiles using empty ones (a.k.a., adaptive sampling)
@@ -2044,19 +2241,8 @@ void GI10::render(CapsaicinInternal &capsaicin) noexcept
     {
         TimedSection const timed_section(*this, "PopulateScreenProbes");
 
-        gfxSbtSetShaderGroup(
-            gfx_, sbt_, kGfxShaderGroupType_Raygen, 0, kPopulateScreenProbesRaygenShaderName);
-        gfxSbtSetShaderGroup(gfx_, sbt_, kGfxShaderGroupType_Miss, 0, kPopulateScreenProbesMissShaderName);
-        for (uint32_t i = 0; i < gfxAccelerationStructureGetRaytracingPrimitiveCount(
-                                 gfx_, capsaicin.getAccelerationStructure());
-             i++)
-        {
-            gfxSbtSetShaderGroup(gfx_, sbt_, kGfxShaderGroupType_Hit,
-                i * capsaicin.getSbtStrideInEntries(kGfxShaderGroupType_Hit),
-                kPopulateScreenProbesHitGroupName);
-        }
         gfxCommandBindKernel(gfx_, populate_screen_probes_kernel_);
-        gfxCommandDispatchRays(gfx_, sbt_, screen_probes_.max_ray_count, 1, 1);
+        gfxCommandDispatchRays(gfx_, populate_screen_probes_sbt_, screen_probes_.max_ray_count, 1, 1);
     }
     else
     {
@@ -2069,6 +2255,45 @@ void GI10::render(CapsaicinInternal &capsaicin) noexcept
         gfxCommandDispatch(gfx_, num_groups_x, 1, 1);
     }
 
+    // The visibility counts produced above drive the sizing of several of the following passes, so
+    // batch the generation of their indirect dispatch arguments into a single kernel launch rather
+    // than issuing one tiny conversion dispatch ahead of every consumer
+    uint32_t generate_reservoirs_slot = 0;
+    uint32_t resample_reservoirs_slot = 0;
+    uint32_t bin_visibility_rays_slot = 0;
+    uint32_t populate_cells_slot      = 0;
+    uint32_t resolve_cells_slot       = 0;
+    {
+        TimedSection const timed_section(*this, "GenerateDispatches");
+
+        dispatch_args_.reset();
+        generate_reservoirs_slot =
+            dispatch_args_.registerDispatch(hash_grid_cache_.radiance_cache_visibility_count_buffer_,
+                gfxKernelGetNumThreads(gfx_, generate_reservoirs_kernel_)[0]);
+        if (options_.gi10_use_resampling)
+        {
+            resample_reservoirs_slot =
+                dispatch_args_.registerDispatch(hash_grid_cache_.radiance_cache_visibility_ray_count_buffer_,
+                    gfxKernelGetNumThreads(gfx_, resample_reservoirs_kernel_)[0]);
+        }
+        if (options_.gi10_ray_binning)
+        {
+            bin_visibility_rays_slot =
+                dispatch_args_.registerDispatch(hash_grid_cache_.radiance_cache_visibility_ray_count_buffer_,
+                    gfxKernelGetNumThreads(gfx_, build_visibility_ray_keys_kernel_)[0]);
+        }
+        if (!options.gi10_use_dxr10 && !options_.gi10_hash_grid_cache_persistent_threads)
+        {
+            populate_cells_slot =
+                dispatch_args_.registerDispatch(hash_grid_cache_.radiance_cache_visibility_ray_count_buffer_,
+                    gfxKernelGetNumThreads(gfx_, populate_cells_kernel_)[0]);
+        }
+        resolve_cells_slot =
+            dispatch_args_.registerDispatch(hash_grid_cache_.radiance_cache_visibility_ray_count_buffer_,
+                gfxKernelGetNumThreads(gfx_, resolve_cells_kernel_)[0]);
+        dispatch_args_.generate();
+    }
+
     // Update light sampling data structure
     {
         light_sampler->update(capsaicin, this);
@@ -2080,8 +2305,8 @@ void GI10::render(CapsaicinInternal &capsaicin) noexcept
         TimedSection const timed_section(*this, "ClearReservoirs");
 
         uint32_t const *num_threads = gfxKernelGetNumThreads(gfx_, clear_reservoirs_kernel_);
-        uint32_t const  num_groups_x =
-            (WorldSpaceReSTIR::kConstant_NumEntries + num_threads[0] - 1) / num_threads[0];
+        uint32_t const  num_entries = world_space_restir_.reservoir_hash_buffers_->getCount();
+        uint32_t const  num_groups_x = (num_entries + num_threads[0] - 1) / num_threads[0];
 
         gfxCommandBindKernel(gfx_, clear_reservoirs_kernel_);
         gfxCommandDispatch(gfx_, num_groups_x, 1, 1);
@@ -2091,11 +2316,8 @@ void GI10::render(CapsaicinInternal &capsaicin) noexcept
     {
         TimedSection const timed_section(*this, "GenerateReservoirs");
 
-        uint32_t const *num_threads = gfxKernelGetNumThreads(gfx_, generate_reservoirs_kernel_);
-        generateDispatch(hash_grid_cache_.radiance_cache_visibility_count_buffer_, num_threads[0]);
-
         gfxCommandBindKernel(gfx_, generate_reservoirs_kernel_);
-        gfxCommandDispatchIndirect(gfx_, dispatch_command_buffer_);
+        gfxCommandDispatchIndirect(gfx_, dispatch_args_.getDispatchBuffer(generate_reservoirs_slot));
     }
 
     // Compact the reservoir caching structure
@@ -2120,11 +2342,23 @@ void GI10::render(CapsaicinInternal &capsaicin) noexcept
     {
         TimedSection const timed_section(*this, "ResampleReservoirs");
 
-        uint32_t const *num_threads = gfxKernelGetNumThreads(gfx_, resample_reservoirs_kernel_);
-        generateDispatch(hash_grid_cache_.radiance_cache_visibility_ray_count_buffer_, num_threads[0]);
-
         gfxCommandBindKernel(gfx_, resample_reservoirs_kernel_);
-        gfxCommandDispatchIndirect(gfx_, dispatch_command_buffer_);
+        gfxCommandDispatchIndirect(gfx_, dispatch_args_.getDispatchBuffer(resample_reservoirs_slot));
+    }
+
+    // Sort the shadow rays into coherent bins prior to tracing
+    if (options_.gi10_ray_binning)
+    {
+        TimedSection const timed_section(*this, "BinRadianceCacheRays");
+
+        gfxCommandBindKernel(gfx_, build_visibility_ray_keys_kernel_);
+        gfxCommandDispatchIndirect(gfx_, dispatch_args_.getDispatchBuffer(bin_visibility_rays_slot));
+
+        hash_grid_cache_.visibility_ray_sorter_.sortIndirectPayload(
+            hash_grid_cache_.radiance_cache_visibility_ray_key_buffer_,
+            hash_grid_cache_.radiance_cache_visibility_ray_count_buffer_,
+            hash_grid_cache_.max_ray_count_,
+            hash_grid_cache_.radiance_cache_visibility_ray_order_buffer_);
     }
 
     // Populate the cells of our world-space hash-grid radiance cache
@@ -2132,36 +2366,55 @@ void GI10::render(CapsaicinInternal &capsaicin) noexcept
     {
         TimedSection const timed_section(*this, "PopulateRadianceCache");
 
-        gfxSbtSetShaderGroup(gfx_, sbt_, kGfxShaderGroupType_Raygen, 0, kPopulateCellsRaygenShaderName);
-        gfxSbtSetShaderGroup(gfx_, sbt_, kGfxShaderGroupType_Miss, 0, kPopulateCellsMissShaderName);
-        for (uint32_t i = 0; i < gfxAccelerationStructureGetRaytracingPrimitiveCount(
-                                 gfx_, capsaicin.getAccelerationStructure());
-             i++)
-        {
-            gfxSbtSetShaderGroup(gfx_, sbt_, kGfxShaderGroupType_Hit,
-                i * capsaicin.getSbtStrideInEntries(kGfxShaderGroupType_Hit), kPopulateCellsHitGroupName);
-        }
-
-        generateDispatchRays(hash_grid_cache_.radiance_cache_visibility_ray_count_buffer_);
+        generateDispatchRays(
+            hash_grid_cache_.radiance_cache_visibility_ray_count_buffer_, populate_cells_sbt_);
 
         gfxCommandBindKernel(gfx_, populate_cells_kernel_);
-        gfxCommandDispatchRaysIndirect(gfx_, sbt_, dispatch_command_buffer_);
+        gfxCommandDispatchRaysIndirect(gfx_, populate_cells_sbt_, dispatch_command_buffer_);
     }
-    else
+    else if (options_.gi10_hash_grid_cache_persistent_threads)
     {
         TimedSection const timed_section(*this, "PopulateRadianceCache");
 
-        uint32_t const *num_threads = gfxKernelGetNumThreads(gfx_, populate_cells_kernel_);
-        generateDispatch(hash_grid_cache_.radiance_cache_visibility_ray_count_buffer_, num_threads[0]);
+        // Launch a fixed-size grid of workgroups that pulls ray work from the compacted count with
+        // atomics until drained; occupancy collapses with a one-thread-per-ray indirect launch when
+        // only a small number of rays survives compaction
+        gfxCommandClearBuffer(gfx_, work_counter_buffer_);
+        gfxProgramSetParameter(gfx_, gi10_program_, "g_WorkCounterBuffer", work_counter_buffer_);
+
+        gfxCommandBindKernel(gfx_, populate_cells_persistent_kernel_);
+        gfxCommandDispatch(gfx_, kPersistentGroupCount, 1, 1);
+    }
+    else
+    {
+        TimedSection const timed_section(*this, "PopulateRadianceCache");
 
         gfxCommandBindKernel(gfx_, populate_cells_kernel_);
-        gfxCommandDispatchIndirect(gfx_, dispatch_command_buffer_);
+        gfxCommandDispatchIndirect(gfx_, dispatch_args_.getDispatchBuffer(populate_cells_slot));
     }
 
     // Update our tiles using the result of the raytracing
     {
         TimedSection const timed_section(*this, "UpdateRadianceCache");
 
+        if (options_.gi10_hash_grid_cache_max_update_tile_count > 0)
+        {
+            // Sort the update tiles by how recently they were seen on screen, so the per-frame cap
+            // spends the blending budget on the tiles contributing most to the current view; skipped
+            // tiles keep their accumulated samples and are blended on a later frame.
+            uint32_t const *num_threads = gfxKernelGetNumThreads(gfx_, build_update_tile_keys_kernel_);
+            generateDispatch(hash_grid_cache_.radiance_cache_update_tile_count_buffer_, num_threads[0]);
+
+            gfxCommandBindKernel(gfx_, build_update_tile_keys_kernel_);
+            gfxCommandDispatchIndirect(gfx_, dispatch_command_buffer_);
+
+            hash_grid_cache_.update_tile_sorter_.sortIndirectPayload(
+                hash_grid_cache_.radiance_cache_update_tile_key_buffer_,
+                hash_grid_cache_.radiance_cache_update_tile_count_buffer_,
+                GFX_MIN(hash_grid_cache_.max_ray_count_, hash_grid_cache_.num_cells_),
+                hash_grid_cache_.radiance_cache_update_tile_buffer_);
+        }
+
         gfxCommandBindKernel(gfx_, generate_update_tiles_dispatch_kernel_);
         gfxCommandDispatch(gfx_, 1, 1, 1);
 
@@ -2173,11 +2426,8 @@ void GI10::render(CapsaicinInternal &capsaicin) noexcept
     {
         TimedSection const timed_section(*this, "ResolveRadianceCache");
 
-        uint32_t const *num_threads = gfxKernelGetNumThreads(gfx_, resolve_cells_kernel_);
-        generateDispatch(hash_grid_cache_.radiance_cache_visibility_ray_count_buffer_, num_threads[0]);
-
         gfxCommandBindKernel(gfx_, resolve_cells_kernel_);
-        gfxCommandDispatchIndirect(gfx_, dispatch_command_buffer_);
+        gfxCommandDispatchIndirect(gfx_, dispatch_args_.getDispatchBuffer(resolve_cells_slot));
     }
 
     // Blend the new results into the probe grid
@@ -2295,28 +2545,28 @@ void GI10::render(CapsaicinInternal &capsaicin) noexcept
     }
     else
     {
+        // Sort the queued reflection samples by their packed screen position so neighbouring threads
+        // trace rays with coherent origins and (through the shared gbuffer normals) directions; the
+        // trace writes through the unpacked position, so reordering the queue is output-invariant.
+        if (options_.gi10_ray_binning)
+        {
+            TimedSection const timed_section(*this, "BinReflectionRays");
+
+            glossy_reflections_.rt_sample_sorter_.sortIndirect(glossy_reflections_.rt_sample_buffer_,
+                glossy_reflections_.rt_sample_count_buffer_,
+                glossy_reflections_.rt_sample_buffer_.getCount());
+        }
+
         TimedSection const timed_section(*this, "TraceReflections");
 
         gfxProgramSetParameter(gfx_, gi10_program_, "g_TextureSampler", capsaicin.getAnisotropicSampler());
 
         if (options.gi10_use_dxr10)
         {
-            gfxSbtSetShaderGroup(
-                gfx_, sbt_, kGfxShaderGroupType_Raygen, 0, kTraceReflectionsRaygenShaderName);
-            gfxSbtSetShaderGroup(gfx_, sbt_, kGfxShaderGroupType_Miss, 0, kTraceReflectionsMissShaderName);
-            for (uint32_t i = 0; i < gfxAccelerationStructureGetRaytracingPrimitiveCount(
-                                     gfx_, capsaicin.getAccelerationStructure());
-                 i++)
-            {
-                gfxSbtSetShaderGroup(gfx_, sbt_, kGfxShaderGroupType_Hit,
-                    i * capsaicin.getSbtStrideInEntries(kGfxShaderGroupType_Hit),
-                    kTraceReflectionsHitGroupName);
-            }
-
-            generateDispatchRays(glossy_reflections_.rt_sample_count_buffer_);
+            generateDispatchRays(glossy_reflections_.rt_sample_count_buffer_, trace_reflections_sbt_);
 
             gfxCommandBindKernel(gfx_, trace_reflections_kernel_);
-            gfxCommandDispatchRaysIndirect(gfx_, sbt_, dispatch_command_buffer_);
+            gfxCommandDispatchRaysIndirect(gfx_, trace_reflections_sbt_, dispatch_command_buffer_);
         }
         else
         {
@@ -2404,7 +2654,7 @@ void GI10::render(CapsaicinInternal &capsaicin) noexcept
         GFX_ASSERT(options.gi10_glossy_reflections_atrous_pass_count - 1 <= ARRAYSIZE(section_names));
 
         GfxKernel atrous_kernels[] = {resolve_reflections_kernels_[2], resolve_reflections_kernels_[3],
-            resolve_reflections_kernels_[4]};
+            resolve_reflections_kernels_[4], resolve_reflections_kernels_[5]};
 
         // First
         {
@@ -2456,13 +2706,20 @@ void GI10::render(CapsaicinInternal &capsaicin) noexcept
                     glossy_reflections_.reflections_buffer0_.getWidth(),
                     glossy_reflections_.reflections_buffer0_.getHeight()};
 
-                uint32_t const *num_threads = gfxKernelGetNumThreads(gfx_, atrous_kernels[1]);
+                // Use the LDS-tiled variant while the filter halo still fits in shared memory
+                int const full_step   = 1 << pass_index;
+                int const half_radius = options.gi10_glossy_reflections_halfres
+                                          ? ((2 * full_step) + 1) >> 1
+                                          : 2 * full_step;
+                GfxKernel const iter_kernel = (half_radius <= 4 ? atrous_kernels[3] : atrous_kernels[1]);
+
+                uint32_t const *num_threads = gfxKernelGetNumThreads(gfx_, iter_kernel);
                 uint32_t const  num_groups_x =
                     (refl_buffer_dimensions[0] + num_threads[0] - 1) / num_threads[0];
                 uint32_t const num_groups_y =
                     (refl_buffer_dimensions[1] + num_threads[1] - 1) / num_threads[1];
 
-                gfxCommandBindKernel(gfx_, atrous_kernels[1]);
+                gfxCommandBindKernel(gfx_, iter_kernel);
                 gfxCommandDispatch(gfx_, num_groups_x, num_groups_y, 1);
 
                 gfxDestroyBuffer(gfx_, glossy_reflections_atrous_constants);
@@ -2596,13 +2853,18 @@ void GI10::render(CapsaicinInternal &capsaicin) noexcept
 
         TimedSection const timed_section(*this, "ResolveGI10");
 
+        // Constrain rasterisation to the internal render resolution region of the AOVs
+        gfxCommandSetViewport(gfx_, 0.0f, 0.0f, (float)buffer_dimensions[0], (float)buffer_dimensions[1]);
+
         gfxCommandBindKernel(gfx_, resolve_gi10_kernel_);
         gfxCommandDraw(gfx_, 3);
+
+        gfxCommandSetViewport(gfx_); // restore the automatic full-target viewport
     }
 
     // Debug hash grid cache bucket occupancy (an histogram)
 
-    if (options_.gi10_hash_grid_cache_debug_stats)
+    if (options_.gi10_hash_grid_cache_debug_stats || options_.gi10_hash_grid_cache_adaptive_resize)
     {
         auto &free_bucket_count          = hash_grid_cache_.debug_free_bucket_count_;
         auto &used_bucket_count          = hash_grid_cache_.debug_used_bucket_count_;
@@ -2716,6 +2978,42 @@ void GI10::render(CapsaicinInternal &capsaicin) noexcept
             bucket_overflow_histogram.clear();
             total_memory_size_in_bytes = 0;
         }
+
+        // Adaptively resize the bucket table based on the measured occupancy/overflow
+        if (options_.gi10_hash_grid_cache_adaptive_resize && free_bucket_count + used_bucket_count > 0.0f)
+        {
+            float const bucket_count       = free_bucket_count + used_bucket_count;
+            float const occupancy          = used_bucket_count / bucket_count;
+            float       overflowed_buckets = 0.0f;
+            for (size_t i = 1; i < bucket_overflow_histogram.size(); ++i)
+            {
+                overflowed_buckets += bucket_overflow_histogram[i];
+            }
+
+            // Grow when buckets overflow (radiance history is being lost), shrink when the table
+            // would still be mostly empty one size down; an adjustment requires the condition to
+            // hold over many consecutive frames to avoid oscillating on transient camera moves
+            bool const wants_grow   = overflowed_buckets > 0.01f * bucket_count || occupancy > 0.9f;
+            bool const wants_shrink = occupancy < 0.2f && overflowed_buckets == 0.0f;
+            adaptive_resize_grow_frames_   = wants_grow ? adaptive_resize_grow_frames_ + 1 : 0;
+            adaptive_resize_shrink_frames_ = wants_shrink ? adaptive_resize_shrink_frames_ + 1 : 0;
+
+            constexpr uint32_t kAdaptiveResizeDelay = 60;
+
+            auto &num_buckets = capsaicin.getOption<int>("gi10_hash_grid_cache_num_buckets");
+            if (adaptive_resize_grow_frames_ >= kAdaptiveResizeDelay
+                && num_buckets < options_.gi10_hash_grid_cache_adaptive_resize_max)
+            {
+                ++num_buckets; // the table is reallocated by ensureMemoryIsAllocated() next frame
+                adaptive_resize_grow_frames_ = 0;
+            }
+            else if (adaptive_resize_shrink_frames_ >= kAdaptiveResizeDelay
+                     && num_buckets > options_.gi10_hash_grid_cache_adaptive_resize_min)
+            {
+                --num_buckets;
+                adaptive_resize_shrink_frames_ = 0;
+            }
+        }
     }
 
     // Debug the screen-space radiance cache if asked to do so
@@ -2748,12 +3046,7 @@ void GI10::render(CapsaicinInternal &capsaicin) noexcept
         gfxCommandDraw(gfx_, 3);
     }
 
-    // Release our constant buffers
-    gfxDestroyBuffer(gfx_, gi10_constants);
-    gfxDestroyBuffer(gfx_, screen_probes_constants);
-    gfxDestroyBuffer(gfx_, hash_grid_cache_constants);
-    gfxDestroyBuffer(gfx_, world_space_restir_constants);
-    gfxDestroyBuffer(gfx_, glossy_reflections_constants);
+    // The constant block buffers are owned by the frame constants arena and survive the frame
 
     // Flip the buffers
     screen_probes_.probe_buffer_index_ = (1 - screen_probes_.probe_buffer_index_);
@@ -2773,6 +3066,7 @@ void GI10::terminate() noexcept
     gfxDestroyTexture(gfx_, irradiance_buffer_);
     gfxDestroyBuffer(gfx_, draw_command_buffer_);
     gfxDestroyBuffer(gfx_, dispatch_command_buffer_);
+    gfxDestroyBuffer(gfx_, work_counter_buffer_);
 
     gfxDestroyProgram(gfx_, gi10_program_);
     gfxDestroyKernel(gfx_, resolve_gi10_kernel_);
@@ -2791,8 +3085,8 @@ void GI10::terminate() noexcept
     gfxDestroyKernel(gfx_, reproject_screen_probes_kernel_);
     gfxDestroyKernel(gfx_, count_screen_probes_kernel_);
     gfxDestroyKernel(gfx_, scatter_screen_probes_kernel_);
+    gfxDestroyKernel(gfx_, seed_screen_probes_kernel_);
     gfxDestroyKernel(gfx_, spawn_screen_probes_kernel_);
-    gfxDestroyKernel(gfx_, compact_screen_probes_kernel_);
     gfxDestroyKernel(gfx_, patch_screen_probes_kernel_);
     gfxDestroyKernel(gfx_, sample_screen_probes_kernel_);
     gfxDestroyKernel(gfx_, populate_screen_probes_kernel_);
@@ -2804,6 +3098,9 @@ void GI10::terminate() noexcept
 
     gfxDestroyKernel(gfx_, purge_tiles_kernel_);
     gfxDestroyKernel(gfx_, populate_cells_kernel_);
+    gfxDestroyKernel(gfx_, populate_cells_persistent_kernel_);
+    gfxDestroyKernel(gfx_, build_visibility_ray_keys_kernel_);
+    gfxDestroyKernel(gfx_, build_update_tile_keys_kernel_);
     gfxDestroyKernel(gfx_, update_tiles_kernel_);
     gfxDestroyKernel(gfx_, resolve_cells_kernel_);
     gfxDestroyKernel(gfx_, clear_bucket_overflow_count_kernel_);
@@ -2830,7 +3127,10 @@ void GI10::terminate() noexcept
     gfxDestroyKernel(gfx_, filter_blur_mask_kernel_);
     gfxDestroyKernel(gfx_, filter_gi_kernel_);
 
-    gfxDestroySbt(gfx_, sbt_);
+    gfxDestroySbt(gfx_, populate_screen_probes_sbt_);
+    gfxDestroySbt(gfx_, populate_cells_sbt_);
+    gfxDestroySbt(gfx_, trace_reflections_sbt_);
+    sbt_primitive_count_ = 0;
 
     irradiance_buffer_                  = {};
     clear_bucket_overflow_count_kernel_ = {};
@@ -2844,6 +3144,14 @@ void GI10::terminate() noexcept
 void GI10::renderGUI(CapsaicinInternal &capsaicin) const noexcept
 {
     ImGui::Checkbox("Use Resampling", &capsaicin.getOption<bool>("gi10_use_resampling"));
+    ImGui::Checkbox("Use Ray Binning", &capsaicin.getOption<bool>("gi10_ray_binning"));
+    ImGui::Checkbox(
+        "Use Persistent Threads", &capsaicin.getOption<bool>("gi10_hash_grid_cache_persistent_threads"));
+    ImGui::Checkbox("Use Compressed Storage", &capsaicin.getOption<bool>("gi10_use_compressed_storage"));
+    ImGui::Checkbox(
+        "Adaptive Probe Spawning", &capsaicin.getOption<bool>("gi10_screen_probes_adaptive_spawn"));
+    ImGui::Checkbox(
+        "Checkerboard Probe Tracing", &capsaicin.getOption<bool>("gi10_screen_probes_checkerboard"));
     ImGui::Checkbox("Use Alpha Testing", &capsaicin.getOption<bool>("gi10_use_alpha_testing"));
     ImGui::Checkbox("Use Direct Lighting", &capsaicin.getOption<bool>("gi10_use_direct_lighting"));
     ImGui::Checkbox("Disable Albedo Textures", &capsaicin.getOption<bool>("gi10_disable_albedo_textures"));
@@ -2864,6 +3172,24 @@ void GI10::renderGUI(CapsaicinInternal &capsaicin) const noexcept
             num_tiles_per_bucket = glm::clamp(num_tiles_per_bucket, 1, 8);
         }
 
+        auto &adaptive_resize = capsaicin.getOption<bool>("gi10_hash_grid_cache_adaptive_resize");
+        ImGui::Checkbox("Adaptive Resize", &adaptive_resize);
+
+        ImGui::Checkbox(
+            "Warm Start From Cache", &capsaicin.getOption<bool>("gi10_hash_grid_cache_warm_start"));
+        if (ImGui::Button("Save Radiance Cache"))
+        {
+            hash_grid_cache_save_requested_ = true;
+        }
+
+        auto &max_update_tile_count =
+            capsaicin.getOption<int>("gi10_hash_grid_cache_max_update_tile_count");
+        if (ImGui::DragInt("Max Update Tiles per Frame (0=uncapped)", &max_update_tile_count, 64.f, 0,
+                1 << 20))
+        {
+            max_update_tile_count = glm::max(max_update_tile_count, 0);
+        }
+
         auto &debug_stats = capsaicin.getOption<bool>("gi10_hash_grid_cache_debug_stats");
         ImGui::Checkbox("Debug Statistics", &debug_stats);
         if (debug_stats && ImGui::CollapsingHeader("Hash Grid Cache", ImGuiTreeNodeFlags_DefaultOpen))
@@ -2892,6 +3218,21 @@ void GI10::renderGUI(CapsaicinInternal &capsaicin) const noexcept
             ImGui::Text("Total Memory Size : %u MB", (uint32_t)(total_memory_size_in_bytes >> 20));
         }
     }
+
+    if (ImGui::CollapsingHeader("World-Space ReSTIR", ImGuiTreeNodeFlags_None))
+    {
+        auto &num_cells = capsaicin.getOption<int>("gi10_reservoir_cache_num_cells");
+        if (ImGui::SliderInt("Number of Cells (1<<)", &num_cells, 14, 20))
+        {
+            num_cells = glm::clamp(num_cells, 14, 20);
+        }
+
+        uint64_t const total_memory_size_in_bytes = 8ull * sizeof(uint32_t)
+                                                  * ((uint64_t)WorldSpaceReSTIR::kConstant_NumEntriesPerCell
+                                                      << capsaicin.getOption<int>(
+                                                          "gi10_reservoir_cache_num_cells"));
+        ImGui::Text("Total Memory Size : %u MB", (uint32_t)(total_memory_size_in_bytes >> 20));
+    }
 }
 
 void GI10::generateDispatch(GfxBuffer count_buffer, uint32_t group_size)
@@ -2903,14 +3244,65 @@ void GI10::generateDispatch(GfxBuffer count_buffer, uint32_t group_size)
     gfxCommandDispatch(gfx_, 1, 1, 1);
 }
 
-void GI10::generateDispatchRays(GfxBuffer count_buffer)
+void GI10::generateDispatchRays(GfxBuffer count_buffer, GfxSbt sbt)
 {
+    // Each ray tracing pass has its own cached SBT so the shader table addresses are passed per
+    // dispatch rather than through the shared constant buffer
+    GpuVirtualAddressRange          ray_generation_shader_record = {};
+    GpuVirtualAddressRangeAndStride miss_shader_table            = {};
+    GpuVirtualAddressRangeAndStride hit_group_table              = {};
+    GpuVirtualAddressRangeAndStride callable_shader_table        = {};
+    gfxSbtGetGpuVirtualAddressRangeAndStride(gfx_, sbt,
+        (D3D12_GPU_VIRTUAL_ADDRESS_RANGE *)&ray_generation_shader_record,
+        (D3D12_GPU_VIRTUAL_ADDRESS_RANGE_AND_STRIDE *)&miss_shader_table,
+        (D3D12_GPU_VIRTUAL_ADDRESS_RANGE_AND_STRIDE *)&hit_group_table,
+        (D3D12_GPU_VIRTUAL_ADDRESS_RANGE_AND_STRIDE *)&callable_shader_table);
+    gfxProgramSetParameter(gfx_, gi10_program_, "g_RayGenerationShaderRecord", ray_generation_shader_record);
+    gfxProgramSetParameter(gfx_, gi10_program_, "g_MissShaderTable", miss_shader_table);
+    gfxProgramSetParameter(gfx_, gi10_program_, "g_HitGroupTable", hit_group_table);
+    gfxProgramSetParameter(gfx_, gi10_program_, "g_CallableShaderTable", callable_shader_table);
+
     gfxProgramSetParameter(gfx_, gi10_program_, "g_CountBuffer", count_buffer);
 
     gfxCommandBindKernel(gfx_, generate_dispatch_rays_kernel_);
     gfxCommandDispatch(gfx_, 1, 1, 1);
 }
 
+void GI10::updateSbts(CapsaicinInternal const &capsaicin) noexcept
+{
+    uint32_t const primitive_count =
+        gfxAccelerationStructureGetRaytracingPrimitiveCount(gfx_, capsaicin.getAccelerationStructure());
+    if (!capsaicin.getMeshesUpdated() && primitive_count == sbt_primitive_count_)
+    {
+        // The cached records are still valid
+        return;
+    }
+    sbt_primitive_count_ = primitive_count;
+
+    uint32_t const hit_stride = capsaicin.getSbtStrideInEntries(kGfxShaderGroupType_Hit);
+    gfxSbtSetShaderGroup(gfx_, populate_screen_probes_sbt_, kGfxShaderGroupType_Raygen, 0,
+        kPopulateScreenProbesRaygenShaderName);
+    gfxSbtSetShaderGroup(gfx_, populate_screen_probes_sbt_, kGfxShaderGroupType_Miss, 0,
+        kPopulateScreenProbesMissShaderName);
+    gfxSbtSetShaderGroup(
+        gfx_, populate_cells_sbt_, kGfxShaderGroupType_Raygen, 0, kPopulateCellsRaygenShaderName);
+    gfxSbtSetShaderGroup(
+        gfx_, populate_cells_sbt_, kGfxShaderGroupType_Miss, 0, kPopulateCellsMissShaderName);
+    gfxSbtSetShaderGroup(
+        gfx_, trace_reflections_sbt_, kGfxShaderGroupType_Raygen, 0, kTraceReflectionsRaygenShaderName);
+    gfxSbtSetShaderGroup(
+        gfx_, trace_reflections_sbt_, kGfxShaderGroupType_Miss, 0, kTraceReflectionsMissShaderName);
+    for (uint32_t i = 0; i < primitive_count; i++)
+    {
+        gfxSbtSetShaderGroup(gfx_, populate_screen_probes_sbt_, kGfxShaderGroupType_Hit, i * hit_stride,
+            kPopulateScreenProbesHitGroupName);
+        gfxSbtSetShaderGroup(
+            gfx_, populate_cells_sbt_, kGfxShaderGroupType_Hit, i * hit_stride, kPopulateCellsHitGroupName);
+        gfxSbtSetShaderGroup(gfx_, trace_reflections_sbt_, kGfxShaderGroupType_Hit, i * hit_stride,
+            kTraceReflectionsHitGroupName);
+    }
+}
+
 void GI10::clearHashGridCache()
 {
     if (hash_grid_cache_.radiance_cache_hash_buffer_)
@@ -2920,4 +3312,97 @@ void GI10::clearHashGridCache()
         gfxCommandClearBuffer(gfx_, hash_grid_cache_.radiance_cache_packed_tile_count_buffer1_);
     }
 }
+
+void GI10::saveHashGridCache(CapsaicinInternal const &capsaicin) noexcept
+{
+    uint32_t const hash_count  = hash_grid_cache_.radiance_cache_hash_buffer_.getCount();
+    uint32_t const value_count = hash_grid_cache_.radiance_cache_value_buffer_.getCount();
+    if (hash_count == 0 || value_count == 0)
+    {
+        return; // nothing to serialize
+    }
+
+    GfxBuffer hash_readback  = gfxCreateBuffer<uint32_t>(gfx_, hash_count, nullptr, kGfxCpuAccess_Read);
+    GfxBuffer value_readback = gfxCreateBuffer<uint2>(gfx_, value_count, nullptr, kGfxCpuAccess_Read);
+
+    gfxCommandCopyBuffer(gfx_, hash_readback, hash_grid_cache_.radiance_cache_hash_buffer_);
+    gfxCommandCopyBuffer(gfx_, value_readback, hash_grid_cache_.radiance_cache_value_buffer_);
+    gfxFinish(gfx_); // wait for the copies to complete
+
+    auto const path = getHashGridCachePath(capsaicin);
+
+    std::error_code ec;
+    std::filesystem::create_directories(path.parent_path(), ec);
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (file.is_open())
+    {
+        HashGridCacheFileHeader header = {};
+        header.magic                   = kHashGridCacheFileMagic;
+        header.version                 = kHashGridCacheFileVersion;
+        header.hash_count              = hash_count;
+        header.value_count             = value_count;
+        header.cell_size               = options_.gi10_hash_grid_cache_cell_size;
+        header.min_cell_size           = options_.gi10_hash_grid_cache_min_cell_size;
+
+        file.write((char const *)&header, sizeof(header));
+        file.write((char const *)gfxBufferGetData<uint32_t>(gfx_, hash_readback),
+            (std::streamsize)((uint64_t)hash_count * sizeof(uint32_t)));
+        file.write((char const *)gfxBufferGetData<uint2>(gfx_, value_readback),
+            (std::streamsize)((uint64_t)value_count * sizeof(uint2)));
+    }
+
+    gfxDestroyBuffer(gfx_, hash_readback);
+    gfxDestroyBuffer(gfx_, value_readback);
+}
+
+bool GI10::loadHashGridCache(CapsaicinInternal const &capsaicin) noexcept
+{
+    uint32_t const hash_count  = hash_grid_cache_.radiance_cache_hash_buffer_.getCount();
+    uint32_t const value_count = hash_grid_cache_.radiance_cache_value_buffer_.getCount();
+    if (hash_count == 0 || value_count == 0)
+    {
+        return false; // the cache is not allocated yet
+    }
+
+    auto const path = getHashGridCachePath(capsaicin);
+
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open())
+    {
+        return false; // no cache file for this scene and lighting
+    }
+
+    HashGridCacheFileHeader header = {};
+    file.read((char *)&header, sizeof(header));
+    if (!file.good() || header.magic != kHashGridCacheFileMagic
+        || header.version != kHashGridCacheFileVersion || header.hash_count != hash_count
+        || header.value_count != value_count
+        || header.cell_size != options_.gi10_hash_grid_cache_cell_size
+        || header.min_cell_size != options_.gi10_hash_grid_cache_min_cell_size)
+    {
+        return false; // the serialized layout no longer matches the live cache
+    }
+
+    std::vector<uint32_t> hash_data(hash_count);
+    std::vector<uint2>    value_data(value_count);
+    file.read((char *)hash_data.data(), (std::streamsize)((uint64_t)hash_count * sizeof(uint32_t)));
+    file.read((char *)value_data.data(), (std::streamsize)((uint64_t)value_count * sizeof(uint2)));
+    if (!file.good())
+    {
+        return false; // truncated cache file
+    }
+
+    GfxBuffer hash_upload =
+        gfxCreateBuffer<uint32_t>(gfx_, hash_count, hash_data.data(), kGfxCpuAccess_Write);
+    GfxBuffer value_upload =
+        gfxCreateBuffer<uint2>(gfx_, value_count, value_data.data(), kGfxCpuAccess_Write);
+
+    gfxCommandCopyBuffer(gfx_, hash_grid_cache_.radiance_cache_hash_buffer_, hash_upload);
+    gfxCommandCopyBuffer(gfx_, hash_grid_cache_.radiance_cache_value_buffer_, value_upload);
+
+    gfxDestroyBuffer(gfx_, hash_upload);
+    gfxDestroyBuffer(gfx_, value_upload);
+    return true;
+}
 } // namespace Capsaicin
@@ -27,7 +27,6 @@ float2 g_NearFar;
 uint g_FrameIndex;
 float4 g_InvDeviceZ;
 uint2 g_BufferDimensions;
-uint g_DisableAlbedoTextures;
 
 Texture2D g_DepthBuffer;
 Texture2D g_ShadingNormalBuffer;
@@ -106,13 +105,12 @@ PS_OUTPUT ResolveGI10(in float4 pos : SV_Position)
     MaterialEmissive emissiveMaterial = MakeMaterialEmissive(material, mesh_uv);
 
     MaterialBRDF materialBRDF = MakeMaterialBRDF(material_evaluated);
-    if (g_DisableAlbedoTextures)
-    {
-        materialBRDF.albedo = 0.3f.xxx;
-#ifndef DISABLE_SPECULAR_MATERIALS
-        materialBRDF.F0 = 0.0f.xxx;
-#endif // DISABLE_SPECULAR_MATERIALS
-    }
+#ifdef DISABLE_ALBEDO_TEXTURES
+    materialBRDF.albedo = 0.3f.xxx;
+#   ifndef DISABLE_SPECULAR_MATERIALS
+    materialBRDF.F0 = 0.0f.xxx;
+#   endif // DISABLE_SPECULAR_MATERIALS
+#endif // DISABLE_ALBEDO_TEXTURES
 
     PS_OUTPUT output;
 
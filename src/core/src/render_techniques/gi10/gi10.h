@@ -23,6 +23,8 @@ THE SOFTWARE.
 
 #include "gi10_shared.h"
 #include "render_technique.h"
+#include "utilities/gpu_dispatch_args.h"
+#include "utilities/gpu_sort.h"
 
 #include <gfx_scene.h>
 
@@ -46,6 +48,10 @@ public:
     {
         bool  gi10_use_dxr10                            = false;
         bool  gi10_use_resampling                       = false;
+        bool  gi10_ray_binning                          = false;
+        bool  gi10_use_compressed_storage               = false;
+        bool  gi10_screen_probes_adaptive_spawn         = false;
+        bool  gi10_screen_probes_checkerboard           = false;
         bool  gi10_use_alpha_testing                    = true;
         bool  gi10_use_direct_lighting                  = true;
         bool  gi10_disable_albedo_textures              = false;
@@ -56,12 +62,21 @@ public:
         int   gi10_hash_grid_cache_num_buckets          = 12;   // 1 << 12           = 4096
         int   gi10_hash_grid_cache_num_tiles_per_bucket = 4;    // 1 <<  4           = 16     total : 4194304
         float gi10_hash_grid_cache_max_sample_count     = 16.f; //
+        int   gi10_hash_grid_cache_max_update_tile_count = 0; // 0 = uncapped
+        bool  gi10_hash_grid_cache_persistent_threads =
+            false; // Trace the population rays with a fixed persistent-threads grid that pulls work
+                   // from the compacted ray count, keeping occupancy up for small ray batches
         int   gi10_hash_grid_cache_debug_mip_level      = 0;
         bool  gi10_hash_grid_cache_debug_propagate      = false;
         int   gi10_hash_grid_cache_debug_max_cell_decay = 0; // Debug cells touched this frame
         bool  gi10_hash_grid_cache_debug_stats          = false;
         int   gi10_hash_grid_cache_debug_max_bucket_overflow = 64;
+        bool  gi10_hash_grid_cache_adaptive_resize           = false;
+        int   gi10_hash_grid_cache_adaptive_resize_min       = 10; // 1 << 10 = 1024 buckets
+        int   gi10_hash_grid_cache_adaptive_resize_max       = 16; // 1 << 16 = 65536 buckets
+        bool  gi10_hash_grid_cache_warm_start                = false; // preload serialized cache on load
         float gi10_reservoir_cache_cell_size                 = 16.0f;
+        int   gi10_reservoir_cache_num_cells                 = 18; // 1 << 18 = 262144 cells of 16 entries
 
         bool  gi10_glossy_reflections_halfres                            = true;
         int   gi10_glossy_reflections_denoiser_mode                      = 1; // Atrous Ratio Estimator
@@ -106,6 +121,13 @@ public:
      */
     DebugViewList getDebugViews() const noexcept override;
 
+    /**
+     * Gets a list of the shader directories (relative to the shader root) that hold the shader
+     * source compiled by the current render technique.
+     * @return A list of all shader directories.
+     */
+    ShaderDirectoryList getShaderDirectories() const noexcept override;
+
     /**
      * Initialise any internal data or state.
      * @note This is automatically called by the framework after construction and should be used to create
@@ -134,9 +156,32 @@ public:
 
 protected:
     void generateDispatch(GfxBuffer count_buffer, uint32_t group_size);
-    void generateDispatchRays(GfxBuffer count_buffer);
+    void generateDispatchRays(GfxBuffer count_buffer, GfxSbt sbt);
     void clearHashGridCache();
 
+    /**
+     * Re-populates the cached shader binding tables if the scene's instance mapping has changed.
+     * The hit records reference every ray tracing primitive so populating them each frame is pure
+     * CPU overhead, instead each ray tracing pass owns an SBT whose records persist across frames.
+     * @param capsaicin The current capsaicin context.
+     */
+    void updateSbts(CapsaicinInternal const &capsaicin) noexcept;
+
+    /**
+     * Serializes the radiance cache hash and value buffers to a file keyed by the loaded scene and
+     * environment map, so a later run can start from the converged radiance instead of a cold cache.
+     * @param capsaicin The current capsaicin context.
+     */
+    void saveHashGridCache(CapsaicinInternal const &capsaicin) noexcept;
+
+    /**
+     * Uploads a previously serialized radiance cache into the hash and value buffers.
+     * The file is ignored when its key or layout no longer matches the current scene and settings.
+     * @param capsaicin The current capsaicin context.
+     * @return True if a matching cache file was found and uploaded, False otherwise.
+     */
+    bool loadHashGridCache(CapsaicinInternal const &capsaicin) noexcept;
+
     class Base
     {
         GFX_NON_COPYABLE(Base);
@@ -180,9 +225,8 @@ protected:
         GfxTexture probe_buffers_[2];
         GfxTexture probe_mask_buffers_[2];
         GfxBuffer  probe_sh_buffers_[2];
-        GfxBuffer  probe_spawn_buffers_[2];
-        GfxBuffer  probe_spawn_scan_buffer_;
-        GfxBuffer  probe_spawn_index_buffer_;
+        GfxBuffer  probe_spawn_buffer_;
+        GfxBuffer  probe_spawn_count_buffer_;
         GfxBuffer  probe_spawn_probe_buffer_;
         GfxBuffer  probe_spawn_sample_buffer_;
         GfxBuffer  probe_spawn_radiance_buffer_;
@@ -249,6 +293,7 @@ protected:
         GfxBuffer &radiance_cache_value_buffer_;
         GfxBuffer &radiance_cache_update_tile_buffer_;
         GfxBuffer &radiance_cache_update_tile_count_buffer_;
+        GfxBuffer &radiance_cache_update_tile_key_buffer_;
         GfxBuffer &radiance_cache_update_cell_value_buffer_;
         GfxBuffer &radiance_cache_visibility_buffer_;
         GfxBuffer &radiance_cache_visibility_count_buffer_;
@@ -256,6 +301,8 @@ protected:
         GfxBuffer &radiance_cache_visibility_query_buffer_;
         GfxBuffer &radiance_cache_visibility_ray_buffer_;
         GfxBuffer &radiance_cache_visibility_ray_count_buffer_;
+        GfxBuffer &radiance_cache_visibility_ray_key_buffer_;
+        GfxBuffer &radiance_cache_visibility_ray_order_buffer_;
         GfxBuffer &radiance_cache_packed_tile_count_buffer0_;
         GfxBuffer &radiance_cache_packed_tile_count_buffer1_;
         GfxBuffer &radiance_cache_packed_tile_index_buffer0_;
@@ -274,6 +321,9 @@ protected:
         std::vector<float> debug_bucket_overflow_histogram_;
         float              debug_free_bucket_count_;
         float              debug_used_bucket_count_;
+
+        GPUSort update_tile_sorter_;
+        GPUSort visibility_ray_sorter_;
     };
 
     // Used for sampling the direct lighting at primary (i.e., direct lighting; disabled by default) and
@@ -282,9 +332,7 @@ protected:
     {
         enum Constants
         {
-            kConstant_NumCells          = 0x40000u,
-            kConstant_NumEntriesPerCell = 0x10u,
-            kConstant_NumEntries        = kConstant_NumCells * kConstant_NumEntriesPerCell
+            kConstant_NumEntriesPerCell = 0x10u
         };
 
         WorldSpaceReSTIR(GI10 &gi10);
@@ -327,6 +375,8 @@ protected:
 
         GfxBuffer rt_sample_buffer_;
         GfxBuffer rt_sample_count_buffer_;
+
+        GPUSort rt_sample_sorter_;
     };
 
     // Used for image-space spatiotemporal denoising of the probes' interpolation results.
@@ -351,6 +401,16 @@ protected:
     GfxTexture       irradiance_buffer_;
     GfxBuffer        draw_command_buffer_;
     GfxBuffer        dispatch_command_buffer_;
+    GfxBuffer        work_counter_buffer_; /**< Atomic work cursor used by persistent-threads kernels */
+    GPUDispatchArgs  dispatch_args_; /**< Batched generation of indirect dispatch arguments */
+
+    uint32_t adaptive_resize_grow_frames_   = 0; /**< Consecutive frames the hash grid wanted to grow */
+    uint32_t adaptive_resize_shrink_frames_ = 0; /**< Consecutive frames the hash grid wanted to shrink */
+    uint32_t memory_pressure_callback_ = 0;     /**< Handle of the registered budget pressure callback */
+    bool     memory_pressure_shrink_   = false; /**< Set by the pressure callback, applied next frame */
+
+    bool hash_grid_cache_load_pending_ = false; /**< Attempt a warm-start preload on the next frame */
+    mutable bool hash_grid_cache_save_requested_ = false; /**< Set from the GUI, applied next frame */
 
     // GI-1.0 building blocks:
     ScreenProbes      screen_probes_;
@@ -378,8 +438,8 @@ protected:
     GfxKernel reproject_screen_probes_kernel_;
     GfxKernel count_screen_probes_kernel_;
     GfxKernel scatter_screen_probes_kernel_;
+    GfxKernel seed_screen_probes_kernel_;
     GfxKernel spawn_screen_probes_kernel_;
-    GfxKernel compact_screen_probes_kernel_;
     GfxKernel patch_screen_probes_kernel_;
     GfxKernel sample_screen_probes_kernel_;
     GfxKernel populate_screen_probes_kernel_;
@@ -388,11 +448,17 @@ protected:
     GfxKernel filter_screen_probes_kernel_;
     GfxKernel project_screen_probes_kernel_;
     GfxKernel interpolate_screen_probes_kernel_;
-    GfxSbt    sbt_;
+    GfxSbt    populate_screen_probes_sbt_; /**< Cached per-pass SBTs, hit records are only rebuilt */
+    GfxSbt    populate_cells_sbt_;         /**< when the scene's instance mapping changes */
+    GfxSbt    trace_reflections_sbt_;
+    uint32_t  sbt_primitive_count_ = 0; /**< Number of primitives covered by the cached hit records */
 
     // Hash grid cache kernels:
     GfxKernel purge_tiles_kernel_;
     GfxKernel populate_cells_kernel_;
+    GfxKernel populate_cells_persistent_kernel_; /**< Persistent-threads variant of PopulateCells */
+    GfxKernel build_visibility_ray_keys_kernel_;
+    GfxKernel build_update_tile_keys_kernel_;
     GfxKernel update_tiles_kernel_;
     GfxKernel resolve_cells_kernel_;
     GfxKernel clear_bucket_overflow_count_kernel_;
@@ -410,7 +476,7 @@ protected:
 
     // Reflection kernels:
     GfxKernel trace_reflections_kernel_;
-    GfxKernel resolve_reflections_kernels_[5];
+    GfxKernel resolve_reflections_kernels_[6];
     GfxKernel reproject_reflections_kernel_;
     GfxKernel mark_fireflies_kernel_;
     GfxKernel cleanup_fireflies_kernel_;
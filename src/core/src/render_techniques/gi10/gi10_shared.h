@@ -41,6 +41,8 @@ struct ScreenProbesConstants
     uint2                  probe_count;
     uint                   probe_mask_mip_count;
     uint                   probe_spawn_tile_size;
+    uint                   adaptive_spawn;
+    uint                   checkerboard;
     ScreenProbesDebugModes debug_mode;
 };
 
@@ -80,6 +82,7 @@ struct HashGridCacheConstants
     uint                   first_cell_offset_tile_mip3;
     uint                   buffer_ping_pong;
     float                  max_sample_count;
+    uint                   max_update_tile_count;
     uint                   debug_mip_level;
     uint                   debug_propagate;
     uint                   debug_max_cell_decay;
@@ -101,12 +104,15 @@ enum HashGridBufferNamesUint
     HASHGRIDCACHE_DECAYTILEBUFFER,
     HASHGRIDCACHE_UPDATETILEBUFFER,
     HASHGRIDCACHE_UPDATETILECOUNTBUFFER,
+    HASHGRIDCACHE_UPDATETILEKEYBUFFER,
     HASHGRIDCACHE_UPDATECELLVALUEBUFFER,
     HASHGRIDCACHE_VISIBILITYCOUNTBUFFER,
     HASHGRIDCACHE_VISIBILITYCELLBUFFER,
     HASHGRIDCACHE_VISIBILITYQUERYBUFFER,
     HASHGRIDCACHE_VISIBILITYRAYBUFFER,
     HASHGRIDCACHE_VISIBILITYRAYCOUNTBUFFER,
+    HASHGRIDCACHE_VISIBILITYRAYKEYBUFFER,
+    HASHGRIDCACHE_VISIBILITYRAYORDERBUFFER,
     HASHGRIDCACHE_PACKEDTILECOUNTBUFFER0,
     HASHGRIDCACHE_PACKEDTILECOUNTBUFFER1,
     HASHGRIDCACHE_PACKEDTILEINDEXBUFFER0,
@@ -141,18 +147,11 @@ enum GI10DebugMode
 
 struct GI10Constants
 {
-    float4x4                        view_proj;
-    float4x4                        view_proj_prev;
-    float4x4                        view_proj_inv;
-    float4x4                        view_proj_inv_prev;
-    float4x4                        reprojection;
-    GpuVirtualAddressRange          ray_generation_shader_record;
-    GpuVirtualAddressRangeAndStride miss_shader_table;
-    uint2                           padding0;
-    GpuVirtualAddressRangeAndStride hit_group_table;
-    uint2                           padding1;
-    GpuVirtualAddressRangeAndStride callable_shader_table;
-    uint                            padding2;
+    float4x4 view_proj;
+    float4x4 view_proj_prev;
+    float4x4 view_proj_inv;
+    float4x4 view_proj_inv_prev;
+    float4x4 reprojection;
 };
 
 struct WorldSpaceReSTIRConstants
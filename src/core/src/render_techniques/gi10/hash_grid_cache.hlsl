@@ -58,6 +58,7 @@ RWStructuredBuffer<float4> g_HashGridCache_BuffersFloat4[] : register(space98);
 #define                    g_HashGridCache_ValueBuffer                   g_HashGridCache_BuffersUint2 [HASHGRIDCACHE_VALUEBUFFER]
 #define                    g_HashGridCache_UpdateTileBuffer              g_HashGridCache_BuffersUint  [HASHGRIDCACHE_UPDATETILEBUFFER]
 #define                    g_HashGridCache_UpdateTileCountBuffer         g_HashGridCache_BuffersUint  [HASHGRIDCACHE_UPDATETILECOUNTBUFFER]
+#define                    g_HashGridCache_UpdateTileKeyBuffer           g_HashGridCache_BuffersUint  [HASHGRIDCACHE_UPDATETILEKEYBUFFER]
 #define                    g_HashGridCache_UpdateCellValueBuffer         g_HashGridCache_BuffersUint  [HASHGRIDCACHE_UPDATECELLVALUEBUFFER]
 #define                    g_HashGridCache_VisibilityBuffer              g_HashGridCache_BuffersFloat4[HASHGRIDCACHE_VISIBILITYBUFFER]
 #define                    g_HashGridCache_VisibilityCountBuffer         g_HashGridCache_BuffersUint  [HASHGRIDCACHE_VISIBILITYCOUNTBUFFER]
@@ -65,6 +66,8 @@ RWStructuredBuffer<float4> g_HashGridCache_BuffersFloat4[] : register(space98);
 #define                    g_HashGridCache_VisibilityQueryBuffer         g_HashGridCache_BuffersUint  [HASHGRIDCACHE_VISIBILITYQUERYBUFFER]
 #define                    g_HashGridCache_VisibilityRayBuffer           g_HashGridCache_BuffersUint  [HASHGRIDCACHE_VISIBILITYRAYBUFFER]
 #define                    g_HashGridCache_VisibilityRayCountBuffer      g_HashGridCache_BuffersUint  [HASHGRIDCACHE_VISIBILITYRAYCOUNTBUFFER]
+#define                    g_HashGridCache_VisibilityRayKeyBuffer        g_HashGridCache_BuffersUint  [HASHGRIDCACHE_VISIBILITYRAYKEYBUFFER]
+#define                    g_HashGridCache_VisibilityRayOrderBuffer      g_HashGridCache_BuffersUint  [HASHGRIDCACHE_VISIBILITYRAYORDERBUFFER]
 #define                    g_HashGridCache_PackedTileCountBuffer         g_HashGridCache_BuffersUint  [HASHGRIDCACHE_PACKEDTILECOUNTBUFFER0 + g_HashGridCacheConstants.buffer_ping_pong]
 #define                    g_HashGridCache_PreviousPackedTileCountBuffer g_HashGridCache_BuffersUint  [HASHGRIDCACHE_PACKEDTILECOUNTBUFFER1 - g_HashGridCacheConstants.buffer_ping_pong]
 #define                    g_HashGridCache_PackedTileIndexBuffer         g_HashGridCache_BuffersUint  [HASHGRIDCACHE_PACKEDTILEINDEXBUFFER0 + g_HashGridCacheConstants.buffer_ping_pong]
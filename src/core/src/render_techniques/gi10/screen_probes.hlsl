@@ -48,12 +48,10 @@ RWStructuredBuffer<uint2> g_ScreenProbes_ProbeSHBuffer;
 RWStructuredBuffer<uint2> g_ScreenProbes_PreviousProbeSHBuffer;
 
 RWStructuredBuffer<uint>  g_ScreenProbes_ProbeSpawnBuffer;
-RWStructuredBuffer<uint>  g_ScreenProbes_ProbeSpawnScanBuffer;
-RWStructuredBuffer<uint>  g_ScreenProbes_ProbeSpawnIndexBuffer;
+RWStructuredBuffer<uint>  g_ScreenProbes_ProbeSpawnCountBuffer;
 RWStructuredBuffer<uint2> g_ScreenProbes_ProbeSpawnProbeBuffer;
 RWStructuredBuffer<uint2> g_ScreenProbes_ProbeSpawnSampleBuffer;
 RWStructuredBuffer<uint2> g_ScreenProbes_ProbeSpawnRadianceBuffer;
-RWStructuredBuffer<uint>  g_ScreenProbes_PreviousProbeSpawnBuffer;
 
 RWStructuredBuffer<uint> g_ScreenProbes_EmptyTileBuffer;
 RWStructuredBuffer<uint> g_ScreenProbes_EmptyTileCountBuffer;
@@ -214,6 +212,87 @@ float3 ScreenProbes_CalculateSHIrradiance_BentCone(in float3 normal, in float ao
     return max(irradiance, 0.0f);
 }
 
+//!
+//! Tile-cooperative probe interpolation cache.
+//!
+//! Neighboring pixels within an interpolation tile blend mostly the same probes, so rather than
+//! each pixel re-reading 9 SH coefficients per probe the group dedupes its probe set into LDS and
+//! loads each probe's coefficients once for the whole tile.
+//!
+
+#define kScreenProbes_TileCacheSize 16
+
+groupshared uint   lds_ScreenProbes_TileProbeIDs[kScreenProbes_TileCacheSize];
+groupshared float3 lds_ScreenProbes_TileProbeSH[9 * kScreenProbes_TileCacheSize];
+
+// Clears the tile probe cache; call from every thread in the group and follow with a group sync.
+void ScreenProbes_ClearTileProbeCache(in uint local_index)
+{
+    if (local_index < kScreenProbes_TileCacheSize)
+    {
+        lds_ScreenProbes_TileProbeIDs[local_index] = kGI10_InvalidId;
+    }
+}
+
+// Inserts a probe into the tile cache, returning its slot.
+// Returns kGI10_InvalidId if the cache is full, in which case the caller should fall back to
+// fetching that probe's coefficients directly from memory.
+uint ScreenProbes_CacheTileProbe(in uint probe_id)
+{
+    for (uint slot = 0; slot < kScreenProbes_TileCacheSize; ++slot)
+    {
+        uint previous_id;
+        InterlockedCompareExchange(
+            lds_ScreenProbes_TileProbeIDs[slot], kGI10_InvalidId, probe_id, previous_id);
+
+        if (previous_id == kGI10_InvalidId || previous_id == probe_id)
+        {
+            return slot;    // claimed a free slot or the probe was already cached
+        }
+    }
+
+    return kGI10_InvalidId;
+}
+
+// Cooperatively loads the SH coefficients of all cached probes into LDS.
+// Call from every thread in the group after syncing over the insertions and follow with another
+// group sync before evaluating any cached irradiance.
+void ScreenProbes_LoadTileProbeCache(in uint local_index, in uint group_size)
+{
+    uint probe_count = (g_BufferDimensions.x + g_ScreenProbesConstants.probe_size - 1) / g_ScreenProbesConstants.probe_size;
+
+    for (uint i = local_index; i < 9 * kScreenProbes_TileCacheSize; i += group_size)
+    {
+        uint probe_id = lds_ScreenProbes_TileProbeIDs[i / 9];
+
+        if (probe_id == kGI10_InvalidId)
+        {
+            continue;   // unused slot
+        }
+
+        uint2 probe       = ScreenProbes_UnpackSeed(probe_id) / g_ScreenProbesConstants.probe_size;
+        uint  probe_index = probe.x + probe.y * probe_count;
+
+        lds_ScreenProbes_TileProbeSH[i] = ScreenProbes_UnpackSHColor(g_ScreenProbes_ProbeSHBuffer[9 * probe_index + (i % 9)]).xyz;
+    }
+}
+
+// Evaluates the irradiance from a cached probe's SH representation using a bent cone.
+float3 ScreenProbes_CalculateSHIrradiance_BentCone_Cached(in float3 normal, in float ao, in uint slot)
+{
+    float clamped_cosine_sh[9];
+    SH_GetCoefficients_ClampedCosine_Cone(normal, acos(sqrt(saturate(1.0f - ao))), clamped_cosine_sh);
+
+    float3 irradiance = float3(0.0f, 0.0f, 0.0f);
+
+    for (uint i = 0; i < 9; ++i)
+    {
+        irradiance += clamped_cosine_sh[i] * lds_ScreenProbes_TileProbeSH[9 * slot + i];
+    }
+
+    return max(irradiance, 0.0f);
+}
+
 // Packs the radiance for storing inside the probe cell.
 uint2 ScreenProbes_PackRadiance(in float4 radiance)
 {
@@ -48,9 +48,9 @@ RWStructuredBuffer<uint>  g_Reservoir_PreviousHashValueBuffer;
 RWStructuredBuffer<float4> g_Reservoir_IndirectSampleBuffer;
 RWStructuredBuffer<uint>   g_Reservoir_IndirectSampleNormalBuffer;
 RWStructuredBuffer<uint>   g_Reservoir_IndirectSampleMaterialBuffer;
-RWStructuredBuffer<uint4>  g_Reservoir_IndirectSampleReservoirBuffer;
+RWStructuredBuffer<PackedReservoirType> g_Reservoir_IndirectSampleReservoirBuffer;
 RWStructuredBuffer<uint>   g_Reservoir_PreviousIndirectSampleNormalBuffer;
-RWStructuredBuffer<uint4>  g_Reservoir_PreviousIndirectSampleReservoirBuffer;
+RWStructuredBuffer<PackedReservoirType> g_Reservoir_PreviousIndirectSampleReservoirBuffer;
 
 // Gets the size of the reservoir cell for the given world-space position.
 float Reservoir_GetCellSize(in float3 position)
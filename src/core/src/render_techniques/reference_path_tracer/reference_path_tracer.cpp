@@ -25,6 +25,11 @@ THE SOFTWARE.
 #include "capsaicin_internal.h"
 #include "components/light_sampler/light_sampler_switcher.h"
 #include "components/stratified_sampler/stratified_sampler.h"
+#include "hash_reduce.h"
+#include "utilities/texture_cache.h"
+
+#include <algorithm>
+#include <bit>
 
 char const *kReferencePTRaygenShaderName       = "ReferencePTRaygen";
 char const *kReferencePTMissShaderName         = "ReferencePTMiss";
@@ -59,6 +64,14 @@ RenderOptionList ReferencePT::getRenderOptions() noexcept
     newOptions.emplace(RENDER_OPTION_MAKE(reference_pt_disable_nee, options));
     newOptions.emplace(RENDER_OPTION_MAKE(reference_pt_nee_reservoir_resampling, options));
     newOptions.emplace(RENDER_OPTION_MAKE(reference_pt_use_dxr10, options));
+    newOptions.emplace(RENDER_OPTION_MAKE(reference_pt_tile_size, options));
+    newOptions.emplace(RENDER_OPTION_MAKE(reference_pt_tile_first, options));
+    newOptions.emplace(RENDER_OPTION_MAKE(reference_pt_tile_count, options));
+    newOptions.emplace(RENDER_OPTION_MAKE(reference_pt_checkpoint_interval, options));
+    newOptions.emplace(RENDER_OPTION_MAKE(reference_pt_adaptive_sampling, options));
+    newOptions.emplace(RENDER_OPTION_MAKE(reference_pt_adaptive_threshold, options));
+    newOptions.emplace(RENDER_OPTION_MAKE(reference_pt_split_count, options));
+    newOptions.emplace(RENDER_OPTION_MAKE(reference_pt_split_index, options));
     return newOptions;
 }
 
@@ -75,6 +88,14 @@ ReferencePT::RenderOptions ReferencePT::convertOptions(RenderOptionList const &o
     RENDER_OPTION_GET(reference_pt_disable_nee, newOptions, options)
     RENDER_OPTION_GET(reference_pt_nee_reservoir_resampling, newOptions, options)
     RENDER_OPTION_GET(reference_pt_use_dxr10, newOptions, options)
+    RENDER_OPTION_GET(reference_pt_tile_size, newOptions, options)
+    RENDER_OPTION_GET(reference_pt_tile_first, newOptions, options)
+    RENDER_OPTION_GET(reference_pt_tile_count, newOptions, options)
+    RENDER_OPTION_GET(reference_pt_checkpoint_interval, newOptions, options)
+    RENDER_OPTION_GET(reference_pt_adaptive_sampling, newOptions, options)
+    RENDER_OPTION_GET(reference_pt_adaptive_threshold, newOptions, options)
+    RENDER_OPTION_GET(reference_pt_split_count, newOptions, options)
+    RENDER_OPTION_GET(reference_pt_split_index, newOptions, options)
     return newOptions;
 }
 
@@ -93,14 +114,25 @@ AOVList ReferencePT::getAOVs() const noexcept
     return aovs;
 }
 
+ShaderDirectoryList ReferencePT::getShaderDirectories() const noexcept
+{
+    return {"render_techniques/reference_path_tracer"};
+}
+
 bool ReferencePT::init(CapsaicinInternal const &capsaicin) noexcept
 {
     rayCameraData = gfxCreateBuffer<RayCamera>(gfx_, 1, nullptr, kGfxCpuAccess_Write);
     rayCameraData.setName("Capsaicin_PT_RayCamera");
     accumulationBuffer = gfxCreateTexture2D(gfx_, DXGI_FORMAT_R32G32B32A32_FLOAT);
     accumulationBuffer.setName("Capsaicin_PT_AccumulationBuffer");
+    varianceBuffer = gfxCreateTexture2D(gfx_, DXGI_FORMAT_R32_FLOAT);
+    varianceBuffer.setName("Capsaicin_PT_VarianceBuffer");
 
     reference_pt_program_ = gfxCreateProgram(gfx_, getProgramName(), capsaicin.getShaderPath());
+    copy_to_checkpoint_kernel_ =
+        gfxCreateComputeKernel(gfx_, reference_pt_program_, "CopyAccumulationToBuffer");
+    copy_from_checkpoint_kernel_ =
+        gfxCreateComputeKernel(gfx_, reference_pt_program_, "CopyAccumulationFromBuffer");
     return initKernels(capsaicin);
 }
 
@@ -121,7 +153,12 @@ void ReferencePT::render(CapsaicinInternal &capsaicin) noexcept
                          && options.reference_pt_min_rr_bounces == newOptions.reference_pt_min_rr_bounces
                          && !capsaicin.getMeshesUpdated() && !capsaicin.getTransformsUpdated()
                          && !lightSampler->getLightsUpdated(capsaicin)
-                         && !capsaicin.getEnvironmentMapUpdated() && capsaicin.getFrameIndex() > 0;
+                         && !capsaicin.getEnvironmentMapUpdated() && capsaicin.getFrameIndex() > 0
+                         && options.reference_pt_tile_size == newOptions.reference_pt_tile_size
+                         && options.reference_pt_tile_first == newOptions.reference_pt_tile_first
+                         && options.reference_pt_tile_count == newOptions.reference_pt_tile_count
+                         && options.reference_pt_split_count == newOptions.reference_pt_split_count
+                         && options.reference_pt_split_index == newOptions.reference_pt_split_index;
 
     // Update the history
     bufferDimensions = uint2(capsaicin.getWidth(), capsaicin.getHeight());
@@ -142,15 +179,69 @@ void ReferencePT::render(CapsaicinInternal &capsaicin) noexcept
         initKernels(capsaicin);
     }
 
+    if (!accumulate)
+    {
+        // Restart the tile sweep so every tile gets rewritten before accumulation resumes
+        tileIndex = 0;
+        tileSweep = 0;
+    }
+
+    // Resolve the progressive tile to render this frame. In tiled mode a single tile is rendered
+    // per frame and each tile accumulates independently (the per-pixel sample count already lives
+    // in the accumulation buffer) so arbitrarily large frames never exceed the per-frame GPU
+    // budget, and a tile range can be assigned per machine to split a frame across several nodes
+    uint2    dispatchDimensions = bufferDimensions;
+    uint2    tileOffset         = uint2(0);
+    uint32_t tileRangeCount     = 1;
+    if (options.reference_pt_tile_size > 0)
+    {
+        uint32_t const tileSize = options.reference_pt_tile_size;
+        uint2 const    tileCounts((bufferDimensions.x + tileSize - 1) / tileSize,
+            (bufferDimensions.y + tileSize - 1) / tileSize);
+        uint32_t const totalTiles = tileCounts.x * tileCounts.y;
+        uint32_t const firstTile  = std::min(options.reference_pt_tile_first, totalTiles - 1);
+        tileRangeCount            = options.reference_pt_tile_count != 0
+                                      ? std::min(options.reference_pt_tile_count, totalTiles - firstTile)
+                                      : totalTiles - firstTile;
+
+        uint32_t const tile = firstTile + std::min(tileIndex, tileRangeCount - 1);
+        tileOffset         = uint2((tile % tileCounts.x) * tileSize, (tile / tileCounts.x) * tileSize);
+        dispatchDimensions = uint2(std::min(tileSize, bufferDimensions.x - tileOffset.x),
+            std::min(tileSize, bufferDimensions.y - tileOffset.y));
+    }
+
+    if (options.reference_pt_checkpoint_interval > 0 && !checkpointChecked)
+    {
+        checkpointChecked = true;
+        if (loadCheckpoint())
+        {
+            // Continue accumulating on top of the restored samples
+            tileSweep = std::max(tileSweep, 1U);
+        }
+    }
+
     // Bind the shader parameters
     gfxProgramSetParameter(gfx_, reference_pt_program_, "g_BufferDimensions", bufferDimensions);
+    gfxProgramSetParameter(gfx_, reference_pt_program_, "g_TileOffset", tileOffset);
     gfxProgramSetParameter(gfx_, reference_pt_program_, "g_FrameIndex", capsaicin.getFrameIndex());
+    // Each split instance draws a disjoint, interleaved sample set so partial accumulations from
+    // several GPUs/machines can later be merged by summation
+    gfxProgramSetParameter(
+        gfx_, reference_pt_program_, "g_SampleStride", std::max(options.reference_pt_split_count, 1U));
+    gfxProgramSetParameter(
+        gfx_, reference_pt_program_, "g_SampleOffset", options.reference_pt_split_index);
     gfxProgramSetParameter(gfx_, reference_pt_program_, "g_RayCamera", cameraData);
     gfxProgramSetParameter(gfx_, reference_pt_program_, "g_BounceCount", options.reference_pt_bounce_count);
     gfxProgramSetParameter(
         gfx_, reference_pt_program_, "g_BounceRRCount", options.reference_pt_min_rr_bounces);
     gfxProgramSetParameter(gfx_, reference_pt_program_, "g_SampleCount", options.reference_pt_sample_count);
-    gfxProgramSetParameter(gfx_, reference_pt_program_, "g_Accumulate", accumulate ? 1 : 0);
+    // A tile first rendered during sweep 0 overwrites its accumulation, later sweeps accumulate.
+    // In full-frame mode every frame is a complete sweep so this matches the accumulate flag
+    gfxProgramSetParameter(gfx_, reference_pt_program_, "g_Accumulate", tileSweep > 0 ? 1 : 0);
+    gfxProgramSetParameter(gfx_, reference_pt_program_, "g_AdaptiveSampling",
+        options.reference_pt_adaptive_sampling ? 1 : 0);
+    gfxProgramSetParameter(
+        gfx_, reference_pt_program_, "g_AdaptiveThreshold", options.reference_pt_adaptive_threshold);
 
     stratified_sampler->addProgramParameters(capsaicin, reference_pt_program_);
 
@@ -162,6 +253,7 @@ void ReferencePT::render(CapsaicinInternal &capsaicin) noexcept
     gfxProgramSetParameter(gfx_, reference_pt_program_, "g_MaterialBuffer", capsaicin.getMaterialBuffer());
 
     gfxProgramSetParameter(gfx_, reference_pt_program_, "g_AccumulationBuffer", accumulationBuffer);
+    gfxProgramSetParameter(gfx_, reference_pt_program_, "g_VarianceBuffer", varianceBuffer);
     gfxProgramSetParameter(gfx_, reference_pt_program_, "g_OutputBuffer", capsaicin.getAOVBuffer("Color"));
 
     gfxProgramSetParameter(gfx_, reference_pt_program_, "g_Scene", capsaicin.getAccelerationStructure());
@@ -180,19 +272,39 @@ void ReferencePT::render(CapsaicinInternal &capsaicin) noexcept
     {
         setupSbt(capsaicin);
         gfxCommandBindKernel(gfx_, reference_pt_kernel_);
-        gfxCommandDispatchRays(gfx_, reference_pt_sbt_, bufferDimensions.x, bufferDimensions.y, 1);
+        gfxCommandDispatchRays(gfx_, reference_pt_sbt_, dispatchDimensions.x, dispatchDimensions.y, 1);
     }
     else
     {
         TimedSection const timed_section(*this, "ReferencePT");
 
         uint32_t const *num_threads  = gfxKernelGetNumThreads(gfx_, reference_pt_kernel_);
-        uint32_t const  num_groups_x = (bufferDimensions.x + num_threads[0] - 1) / num_threads[0];
-        uint32_t const  num_groups_y = (bufferDimensions.y + num_threads[1] - 1) / num_threads[1];
+        uint32_t const  num_groups_x = (dispatchDimensions.x + num_threads[0] - 1) / num_threads[0];
+        uint32_t const  num_groups_y = (dispatchDimensions.y + num_threads[1] - 1) / num_threads[1];
 
         gfxCommandBindKernel(gfx_, reference_pt_kernel_);
         gfxCommandDispatch(gfx_, num_groups_x, num_groups_y, 1);
     }
+
+    // Advance the progressive tile sweep
+    if (++tileIndex >= tileRangeCount)
+    {
+        tileIndex = 0;
+        ++tileSweep;
+    }
+
+    if (options.reference_pt_checkpoint_interval > 0
+        && ++checkpointFrames >= options.reference_pt_checkpoint_interval)
+    {
+        checkpointFrames = 0;
+        saveCheckpoint();
+    }
+
+    if (mergeRequested)
+    {
+        mergeRequested = false;
+        mergeSplitResults();
+    }
 }
 
 void ReferencePT::terminate() noexcept
@@ -201,11 +313,17 @@ void ReferencePT::terminate() noexcept
     rayCameraData = {};
     gfxDestroyTexture(gfx_, accumulationBuffer);
     accumulationBuffer = {};
+    gfxDestroyTexture(gfx_, varianceBuffer);
+    varianceBuffer = {};
 
     gfxDestroyProgram(gfx_, reference_pt_program_);
     reference_pt_program_ = {};
     gfxDestroyKernel(gfx_, reference_pt_kernel_);
     reference_pt_kernel_ = {};
+    gfxDestroyKernel(gfx_, copy_to_checkpoint_kernel_);
+    copy_to_checkpoint_kernel_ = {};
+    gfxDestroyKernel(gfx_, copy_from_checkpoint_kernel_);
+    copy_from_checkpoint_kernel_ = {};
     gfxDestroySbt(gfx_, reference_pt_sbt_);
     reference_pt_sbt_ = {};
 }
@@ -227,6 +345,22 @@ void ReferencePT::renderGUI(CapsaicinInternal &capsaicin) const noexcept
     ImGui::Checkbox("Disable NEE", &capsaicin.getOption<bool>("reference_pt_disable_nee"));
     ImGui::Checkbox(
         "Disable Specular Materials", &capsaicin.getOption<bool>("reference_pt_disable_specular_materials"));
+    ImGui::Checkbox("Adaptive Sampling", &capsaicin.getOption<bool>("reference_pt_adaptive_sampling"));
+    ImGui::DragFloat("Adaptive Threshold",
+        &capsaicin.getOption<float>("reference_pt_adaptive_threshold"), 5e-3F, 1e-3F, 1.0F);
+    ImGui::DragInt(
+        "Tile Size", (int32_t *)&capsaicin.getOption<uint32_t>("reference_pt_tile_size"), 64, 0, 4096);
+    ImGui::DragInt("Checkpoint Interval",
+        (int32_t *)&capsaicin.getOption<uint32_t>("reference_pt_checkpoint_interval"), 16, 0, 16384);
+    ImGui::DragInt(
+        "Split Count", (int32_t *)&capsaicin.getOption<uint32_t>("reference_pt_split_count"), 1, 1, 16);
+    ImGui::DragInt(
+        "Split Index", (int32_t *)&capsaicin.getOption<uint32_t>("reference_pt_split_index"), 1, 0, 15);
+    if (capsaicin.getOption<uint32_t>("reference_pt_split_count") > 1
+        && ImGui::Button("Merge Split Results"))
+    {
+        mergeRequested = true;
+    }
 }
 
 bool ReferencePT::initKernels(CapsaicinInternal const &capsaicin) noexcept
@@ -377,4 +511,194 @@ char const *ReferencePT::getProgramName() noexcept
 {
     return "render_techniques/reference_path_tracer/reference_path_tracer";
 }
+
+uint64_t ReferencePT::checkpointKey(bool includeSplit) const noexcept
+{
+    float const cameraValues[] = {camera.eye.x, camera.eye.y, camera.eye.z, camera.center.x,
+        camera.center.y, camera.center.z, camera.up.x, camera.up.y, camera.up.z, camera.aspect,
+        camera.fovY, camera.nearZ, camera.farZ};
+
+    size_t key = 0x12345678U;
+    HashCombine(key, bufferDimensions.x);
+    HashCombine(key, bufferDimensions.y);
+    HashCombine(key, options.reference_pt_bounce_count);
+    HashCombine(key, options.reference_pt_min_rr_bounces);
+    HashCombine(key, HashBytes(cameraValues, sizeof(cameraValues)));
+    if (includeSplit && options.reference_pt_split_count > 1)
+    {
+        // Each split instance owns a distinct periodic checkpoint even on a shared cache directory
+        HashCombine(key, options.reference_pt_split_count);
+        HashCombine(key, options.reference_pt_split_index);
+    }
+    return key;
+}
+
+void ReferencePT::saveCheckpoint() noexcept
+{
+    uint32_t const texelCount = bufferDimensions.x * bufferDimensions.y;
+    if (texelCount == 0)
+    {
+        return;
+    }
+
+    GfxBuffer checkpointBuffer = gfxCreateBuffer<float4>(gfx_, texelCount);
+    checkpointBuffer.setName("Capsaicin_PT_CheckpointBuffer");
+    GfxBuffer varianceCheckpointBuffer = gfxCreateBuffer<float>(gfx_, texelCount);
+    varianceCheckpointBuffer.setName("Capsaicin_PT_VarianceCheckpointBuffer");
+    GfxBuffer readbackBuffer = gfxCreateBuffer<float4>(gfx_, texelCount, nullptr, kGfxCpuAccess_Read);
+    readbackBuffer.setName("Capsaicin_PT_CheckpointReadbackBuffer");
+    GfxBuffer varianceReadbackBuffer = gfxCreateBuffer<float>(gfx_, texelCount, nullptr, kGfxCpuAccess_Read);
+    varianceReadbackBuffer.setName("Capsaicin_PT_VarianceCheckpointReadbackBuffer");
+
+    gfxProgramSetParameter(gfx_, reference_pt_program_, "g_BufferDimensions", bufferDimensions);
+    gfxProgramSetParameter(gfx_, reference_pt_program_, "g_AccumulationBuffer", accumulationBuffer);
+    gfxProgramSetParameter(gfx_, reference_pt_program_, "g_VarianceBuffer", varianceBuffer);
+    gfxProgramSetParameter(gfx_, reference_pt_program_, "g_CheckpointBuffer", checkpointBuffer);
+    gfxProgramSetParameter(
+        gfx_, reference_pt_program_, "g_VarianceCheckpointBuffer", varianceCheckpointBuffer);
+
+    uint32_t const *num_threads = gfxKernelGetNumThreads(gfx_, copy_to_checkpoint_kernel_);
+    gfxCommandBindKernel(gfx_, copy_to_checkpoint_kernel_);
+    gfxCommandDispatch(gfx_, (bufferDimensions.x + num_threads[0] - 1) / num_threads[0],
+        (bufferDimensions.y + num_threads[1] - 1) / num_threads[1], 1);
+
+    // The stall only occurs every checkpoint interval which is negligible next to the render itself
+    gfxCommandCopyBuffer(gfx_, readbackBuffer, checkpointBuffer);
+    gfxCommandCopyBuffer(gfx_, varianceReadbackBuffer, varianceCheckpointBuffer);
+    gfxFinish(gfx_);
+
+    TextureCache::Save("reference_pt", checkpointKey(), gfxBufferGetData<float4>(gfx_, readbackBuffer),
+        (uint64_t)texelCount * sizeof(float4));
+    TextureCache::Save("reference_pt_variance", checkpointKey(),
+        gfxBufferGetData<float>(gfx_, varianceReadbackBuffer), (uint64_t)texelCount * sizeof(float));
+
+    if (options.reference_pt_split_count > 1)
+    {
+        // Also publish this instance's partial accumulation under the shared split key so any of
+        // the parallel instances can merge the combined result
+        std::string const splitName =
+            "reference_pt_split" + std::to_string(options.reference_pt_split_index);
+        TextureCache::Save(splitName.c_str(), checkpointKey(false),
+            gfxBufferGetData<float4>(gfx_, readbackBuffer), (uint64_t)texelCount * sizeof(float4));
+        TextureCache::Save((splitName + "_variance").c_str(), checkpointKey(false),
+            gfxBufferGetData<float>(gfx_, varianceReadbackBuffer), (uint64_t)texelCount * sizeof(float));
+    }
+
+    gfxDestroyBuffer(gfx_, varianceReadbackBuffer);
+    gfxDestroyBuffer(gfx_, readbackBuffer);
+    gfxDestroyBuffer(gfx_, varianceCheckpointBuffer);
+    gfxDestroyBuffer(gfx_, checkpointBuffer);
+}
+
+bool ReferencePT::loadCheckpoint() noexcept
+{
+    uint32_t const     texelCount = bufferDimensions.x * bufferDimensions.y;
+    TextureCache::View cacheView;
+    if (!TextureCache::Load("reference_pt", checkpointKey(), cacheView)
+        || cacheView.size != (uint64_t)texelCount * sizeof(float4))
+    {
+        return false;
+    }
+
+    GfxBuffer checkpointBuffer = gfxCreateBuffer<float4>(gfx_, texelCount, cacheView.data);
+    checkpointBuffer.setName("Capsaicin_PT_CheckpointBuffer");
+
+    // The variance state ships in a sibling cache entry; fall back to zeroed variance (treated as
+    // "not yet converged" by the adaptive skip) if only the accumulation entry exists
+    GfxBuffer          varianceCheckpointBuffer;
+    TextureCache::View varianceView;
+    if (TextureCache::Load("reference_pt_variance", checkpointKey(), varianceView)
+        && varianceView.size == (uint64_t)texelCount * sizeof(float))
+    {
+        varianceCheckpointBuffer = gfxCreateBuffer<float>(gfx_, texelCount, varianceView.data);
+    }
+    else
+    {
+        std::vector<float> const zeroes(texelCount, 0.0F);
+        varianceCheckpointBuffer = gfxCreateBuffer<float>(gfx_, texelCount, zeroes.data());
+    }
+    varianceCheckpointBuffer.setName("Capsaicin_PT_VarianceCheckpointBuffer");
+
+    gfxProgramSetParameter(gfx_, reference_pt_program_, "g_BufferDimensions", bufferDimensions);
+    gfxProgramSetParameter(gfx_, reference_pt_program_, "g_AccumulationBuffer", accumulationBuffer);
+    gfxProgramSetParameter(gfx_, reference_pt_program_, "g_VarianceBuffer", varianceBuffer);
+    gfxProgramSetParameter(gfx_, reference_pt_program_, "g_CheckpointBuffer", checkpointBuffer);
+    gfxProgramSetParameter(
+        gfx_, reference_pt_program_, "g_VarianceCheckpointBuffer", varianceCheckpointBuffer);
+
+    uint32_t const *num_threads = gfxKernelGetNumThreads(gfx_, copy_from_checkpoint_kernel_);
+    gfxCommandBindKernel(gfx_, copy_from_checkpoint_kernel_);
+    gfxCommandDispatch(gfx_, (bufferDimensions.x + num_threads[0] - 1) / num_threads[0],
+        (bufferDimensions.y + num_threads[1] - 1) / num_threads[1], 1);
+
+    gfxDestroyBuffer(gfx_, varianceCheckpointBuffer);
+    gfxDestroyBuffer(gfx_, checkpointBuffer);
+    return true;
+}
+
+bool ReferencePT::mergeSplitResults() noexcept
+{
+    uint32_t const texelCount = bufferDimensions.x * bufferDimensions.y;
+    if (texelCount == 0 || options.reference_pt_split_count <= 1)
+    {
+        return false;
+    }
+
+    // Sum the published partial accumulations; the radiance sums, sample counts and squared
+    // luminance sums are all additive since every instance draws a disjoint sample set
+    std::vector<float4> accumulation(texelCount, float4(0.0F));
+    std::vector<float>  variance(texelCount, 0.0F);
+    for (uint32_t split = 0; split < options.reference_pt_split_count; ++split)
+    {
+        std::string const  splitName = "reference_pt_split" + std::to_string(split);
+        TextureCache::View cacheView;
+        if (!TextureCache::Load(splitName.c_str(), checkpointKey(false), cacheView)
+            || cacheView.size != (uint64_t)texelCount * sizeof(float4))
+        {
+            GFX_PRINTLN("Cannot merge split results: no matching accumulation for instance %u", split);
+            return false;
+        }
+        auto const *source = reinterpret_cast<float4 const *>(cacheView.data);
+        for (uint32_t texel = 0; texel < texelCount; ++texel)
+        {
+            accumulation[texel].x += source[texel].x;
+            accumulation[texel].y += source[texel].y;
+            accumulation[texel].z += source[texel].z;
+            // The sample count is stored as a bit-cast uint in the alpha channel
+            accumulation[texel].w = std::bit_cast<float>(
+                std::bit_cast<uint32_t>(accumulation[texel].w) + std::bit_cast<uint32_t>(source[texel].w));
+        }
+        TextureCache::View varianceView;
+        if (TextureCache::Load((splitName + "_variance").c_str(), checkpointKey(false), varianceView)
+            && varianceView.size == (uint64_t)texelCount * sizeof(float))
+        {
+            auto const *varianceSource = reinterpret_cast<float const *>(varianceView.data);
+            for (uint32_t texel = 0; texel < texelCount; ++texel)
+            {
+                variance[texel] += varianceSource[texel];
+            }
+        }
+    }
+
+    GfxBuffer checkpointBuffer = gfxCreateBuffer<float4>(gfx_, texelCount, accumulation.data());
+    checkpointBuffer.setName("Capsaicin_PT_CheckpointBuffer");
+    GfxBuffer varianceCheckpointBuffer = gfxCreateBuffer<float>(gfx_, texelCount, variance.data());
+    varianceCheckpointBuffer.setName("Capsaicin_PT_VarianceCheckpointBuffer");
+
+    gfxProgramSetParameter(gfx_, reference_pt_program_, "g_BufferDimensions", bufferDimensions);
+    gfxProgramSetParameter(gfx_, reference_pt_program_, "g_AccumulationBuffer", accumulationBuffer);
+    gfxProgramSetParameter(gfx_, reference_pt_program_, "g_VarianceBuffer", varianceBuffer);
+    gfxProgramSetParameter(gfx_, reference_pt_program_, "g_CheckpointBuffer", checkpointBuffer);
+    gfxProgramSetParameter(
+        gfx_, reference_pt_program_, "g_VarianceCheckpointBuffer", varianceCheckpointBuffer);
+
+    uint32_t const *num_threads = gfxKernelGetNumThreads(gfx_, copy_from_checkpoint_kernel_);
+    gfxCommandBindKernel(gfx_, copy_from_checkpoint_kernel_);
+    gfxCommandDispatch(gfx_, (bufferDimensions.x + num_threads[0] - 1) / num_threads[0],
+        (bufferDimensions.y + num_threads[1] - 1) / num_threads[1], 1);
+
+    gfxDestroyBuffer(gfx_, varianceCheckpointBuffer);
+    gfxDestroyBuffer(gfx_, checkpointBuffer);
+    return true;
+}
 } // namespace Capsaicin
@@ -57,6 +57,26 @@ public:
         bool reference_pt_nee_reservoir_resampling =
             false;                           /**< Use reservoir resampling for selecting NEE light samples */
         bool reference_pt_use_dxr10 = false; /**< Use dxr 1.0 ray-tracing pipelines instead of inline rt */
+        uint32_t reference_pt_tile_size =
+            0; /**< Side length in pixels of each progressive tile, one tile is rendered per frame and
+                  tiles accumulate independently (0 renders the full frame every frame) */
+        uint32_t reference_pt_tile_first = 0; /**< First tile index rendered by this instance, used to
+                                                 split a frame across multiple machines by tile range */
+        uint32_t reference_pt_tile_count =
+            0; /**< Number of tiles rendered by this instance (0 = all remaining tiles) */
+        uint32_t reference_pt_checkpoint_interval =
+            0; /**< Number of frames between accumulation checkpoints to disk so long reference renders
+                  survive restarts (0 disables checkpointing) */
+        bool reference_pt_adaptive_sampling =
+            false; /**< Skip pixels whose accumulated estimate has converged so the sample budget
+                      concentrates on high variance regions */
+        float reference_pt_adaptive_threshold =
+            0.05F; /**< Relative error of the running mean below which a pixel counts as converged */
+        uint32_t reference_pt_split_count =
+            1; /**< Number of instances (typically one per GPU) accumulating the same view in
+                  parallel, each instance draws a disjoint sample set (1 disables splitting) */
+        uint32_t reference_pt_split_index =
+            0; /**< Index of this instance within the split sample range */
     };
 
     /**
@@ -78,6 +98,13 @@ public:
      */
     AOVList getAOVs() const noexcept override;
 
+    /**
+     * Gets a list of the shader directories (relative to the shader root) that hold the shader
+     * source compiled by the current render technique.
+     * @return A list of all shader directories.
+     */
+    ShaderDirectoryList getShaderDirectories() const noexcept override;
+
     /**
      * Initialise any internal data or state.
      * @note This is automatically called by the framework after construction and should be used to create
@@ -136,15 +163,53 @@ protected:
 
     virtual char const *getProgramName() noexcept;
 
+    /**
+     * Calculate the disk cache key identifying the current accumulation state.
+     * The key covers the buffer dimensions, camera and path settings so a checkpoint is only ever
+     * restored into an identical render setup.
+     * @param includeSplit True to also mix in the split index/count so each split instance owns a
+     *  distinct checkpoint, false for the shared key used by the cross-instance split entries.
+     * @returns The checkpoint key.
+     */
+    uint64_t checkpointKey(bool includeSplit = true) const noexcept;
+
+    /** Save the current accumulation buffer to the disk checkpoint (stalls on GPU completion). */
+    void saveCheckpoint() noexcept;
+
+    /**
+     * Try to restore the accumulation buffer from a matching disk checkpoint.
+     * @returns True if a checkpoint was restored.
+     */
+    bool loadCheckpoint() noexcept;
+
+    /**
+     * Merge the published accumulations of all split instances into this instance.
+     * The accumulation buffer stores radiance sums and sample counts and every instance draws a
+     * disjoint sample set, so the merge is an exact summation. Intended as the final step before
+     * reading back the ground-truth image; this instance keeps accumulating on top of the merged
+     * result so it must not be merged a second time.
+     * @returns True if the results of every split instance were found and merged.
+     */
+    bool mergeSplitResults() noexcept;
+
     GfxBuffer  rayCameraData;
     GfxTexture accumulationBuffer; /**< Buffer used to store pixel running average, .w= number of samples */
+    GfxTexture varianceBuffer;     /**< Per-pixel running sum of squared sample luminance */
     RayCamera  cameraData;
     uint2      bufferDimensions = uint2(0);
     GfxCamera  camera           = {};
     RenderOptions options;
 
+    uint32_t tileIndex = 0;         /**< Next tile (within the rendered range) in the current sweep */
+    uint32_t tileSweep = 0;         /**< Completed tile sweeps since accumulation last restarted */
+    uint32_t checkpointFrames  = 0; /**< Frames rendered since the last checkpoint save */
+    bool     checkpointChecked = false; /**< True once a checkpoint restore has been attempted */
+    mutable bool mergeRequested = false; /**< Set by the GUI, the merge runs after the next frame */
+
     GfxProgram reference_pt_program_;
     GfxKernel  reference_pt_kernel_;
+    GfxKernel  copy_to_checkpoint_kernel_;
+    GfxKernel  copy_from_checkpoint_kernel_;
     GfxSbt     reference_pt_sbt_;
 };
 } // namespace Capsaicin
@@ -52,6 +52,18 @@ DebugViewList RenderTechnique::getDebugViews() const noexcept
     return {};
 }
 
+ShaderDirectoryList RenderTechnique::getShaderDirectories() const noexcept
+{
+    return {""}; // conservatively depend on the whole shader tree
+}
+
+QueueAffinity RenderTechnique::getQueueAffinity() const noexcept
+{
+    return QueueAffinity::Direct;
+}
+
+void RenderTechnique::prepare([[maybe_unused]] CapsaicinInternal const &capsaicin) noexcept {}
+
 void RenderTechnique::renderGUI(CapsaicinInternal &capsaicin) const noexcept
 {
     (void)&capsaicin;
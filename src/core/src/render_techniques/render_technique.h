@@ -73,6 +73,26 @@ public:
      */
     virtual DebugViewList getDebugViews() const noexcept;
 
+    /**
+     * Gets a list of the shader directories (relative to the shader root) that hold the shader
+     * source compiled by the current render technique.
+     * This is used by shader reloading to only re-initialise the techniques whose shader source
+     * actually changed (files including a changed shared header count as changed themselves). The
+     * default implementation returns the shader root so techniques that do not override it are
+     * conservatively re-initialised on any change; techniques that compile no shaders should
+     * return an empty list.
+     * @return A list of all shader directories.
+     */
+    virtual ShaderDirectoryList getShaderDirectories() const noexcept;
+
+    /**
+     * Gets the queue that the technique's GPU work should be scheduled on.
+     * @note Techniques returning QueueAffinity::AsyncCompute must only record compute work and must not
+     * read results produced by any other technique run within the same async region.
+     * @return The requested queue affinity.
+     */
+    virtual QueueAffinity getQueueAffinity() const noexcept;
+
     /**
      * Initialise any internal data or state.
      * @note This is automatically called by the framework after construction and should be used to create
@@ -82,6 +102,16 @@ public:
      */
     virtual bool init(CapsaicinInternal const &capsaicin) noexcept = 0;
 
+    /**
+     * Perform CPU-side preparation for the frame ahead of any command recording.
+     * Called once per frame for every technique before any technique's render(). The prepare
+     * implementations of the different techniques are executed concurrently on ThreadPool workers,
+     * so they must only build CPU-side state owned by the technique and must not make any gfx calls
+     * (the gfx layer records through a single immediate context).
+     * @param capsaicin The current capsaicin context.
+     */
+    virtual void prepare(CapsaicinInternal const &capsaicin) noexcept;
+
     /**
      * Perform render operations.
      * @param [in,out] capsaicin The current capsaicin context.
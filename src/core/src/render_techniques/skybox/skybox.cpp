@@ -42,12 +42,24 @@ AOVList Skybox::getAOVs() const noexcept
     return aovs;
 }
 
+ShaderDirectoryList Skybox::getShaderDirectories() const noexcept
+{
+    return {"render_techniques/skybox"};
+}
+
 bool Skybox::init(CapsaicinInternal const &capsaicin) noexcept
 {
     GfxDrawState skybox_draw_state;
     gfxDrawStateSetColorTarget(skybox_draw_state, 0, capsaicin.getAOVBuffer("DirectLighting"));
     gfxDrawStateSetDepthStencilTarget(skybox_draw_state, capsaicin.getAOVBuffer("Depth"));
 
+    // The skybox triangle sits just inside the far plane so the depth test early-rejects every
+    // pixel covered by the visibility buffer; only true background pixels reach the environment
+    // evaluation. Depth writes are disabled to keep the background at the exact far-plane clear
+    // value that downstream passes use to classify sky pixels
+    gfxDrawStateSetDepthCmpOp(skybox_draw_state, D3D12_COMPARISON_FUNC_LESS);
+    gfxDrawStateSetDepthWriteMask(skybox_draw_state, D3D12_DEPTH_WRITE_MASK_ZERO);
+
     skybox_program_ = gfxCreateProgram(gfx_, "render_techniques/skybox/skybox", capsaicin.getShaderPath());
     skybox_kernel_  = gfxCreateGraphicsKernel(gfx_, skybox_program_, skybox_draw_state);
     return !!skybox_program_;
@@ -67,8 +79,14 @@ void Skybox::render(CapsaicinInternal &capsaicin) noexcept
 
     gfxProgramSetParameter(gfx_, skybox_program_, "g_LinearSampler", capsaicin.getLinearSampler());
 
+    // Constrain rasterisation to the internal render resolution region of the AOVs
+    gfxCommandSetViewport(
+        gfx_, 0.0f, 0.0f, (float)buffer_dimensions[0], (float)buffer_dimensions[1]);
+
     gfxCommandBindKernel(gfx_, skybox_kernel_);
     gfxCommandDraw(gfx_, 3);
+
+    gfxCommandSetViewport(gfx_); // restore the automatic full-target viewport
 }
 
 void Skybox::terminate() noexcept
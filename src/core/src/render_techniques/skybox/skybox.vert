@@ -22,5 +22,7 @@ THE SOFTWARE.
 
 float4 main(in uint idx : SV_VertexID) : SV_Position
 {
+    // The triangle sits just inside the far plane so that the depth test early-rejects every
+    // pixel already covered by the visibility buffer
     return 1.0f - float4(4.0f * (idx & 1), 4.0f * (idx >> 1), 1e-6f, 0.0f);
 }
@@ -45,6 +45,7 @@ RenderOptionList SSGI::getRenderOptions() noexcept
     newOptions.emplace(RENDER_OPTION_MAKE(ssgi_view_radius_, options_));
     newOptions.emplace(RENDER_OPTION_MAKE(ssgi_falloff_range_, options_));
     newOptions.emplace(RENDER_OPTION_MAKE(ssgi_unroll_kernel_, options_));
+    newOptions.emplace(RENDER_OPTION_MAKE(ssgi_interleaved_, options_));
     return newOptions;
 }
 
@@ -56,6 +57,7 @@ SSGI::RenderOptions SSGI::convertOptions(RenderOptionList const &options) noexce
     RENDER_OPTION_GET(ssgi_view_radius_, newOptions, options)
     RENDER_OPTION_GET(ssgi_falloff_range_, newOptions, options)
     RENDER_OPTION_GET(ssgi_unroll_kernel_, newOptions, options)
+    RENDER_OPTION_GET(ssgi_interleaved_, newOptions, options)
     return newOptions;
 }
 
@@ -74,9 +76,10 @@ AOVList SSGI::getAOVs() const noexcept
     aovs.push_back({"OcclusionAndBentNormal", AOV::Write, AOV::None, DXGI_FORMAT_R16G16B16A16_FLOAT});
     aovs.push_back({"NearFieldGlobalIllumination", AOV::Write, AOV::None, DXGI_FORMAT_R16G16B16A16_FLOAT});
 
-    aovs.push_back({"VisibilityDepth"});
+    aovs.push_back({.name = "VisibilityDepth", .backup_name = "PrevVisibilityDepth"});
     aovs.push_back({"ShadingNormal"});
     aovs.push_back({"PrevCombinedIllumination"});
+    aovs.push_back({"Velocity"});
     return aovs;
 }
 
@@ -88,6 +91,11 @@ DebugViewList SSGI::getDebugViews() const noexcept
     return views;
 }
 
+ShaderDirectoryList SSGI::getShaderDirectories() const noexcept
+{
+    return {"render_techniques/ssgi"};
+}
+
 bool SSGI::init(CapsaicinInternal const &capsaicin) noexcept
 {
     initializeStaticResources(capsaicin);
@@ -107,7 +115,8 @@ void SSGI::render(CapsaicinInternal &capsaicin) noexcept
 
     uint32_t   buffer_width      = capsaicin.getWidth();
     uint32_t   buffer_height     = capsaicin.getHeight();
-    bool const need_reallocation = (buffer_width != buffer_width_ || buffer_height != buffer_height_);
+    bool const need_reallocation = (buffer_width != buffer_width_ || buffer_height != buffer_height_)
+                                || (options_.ssgi_interleaved_ != !!occlusion_history_texture_);
     if (need_reallocation)
     {
         destroyBuffers();
@@ -139,6 +148,10 @@ void SSGI::render(CapsaicinInternal &capsaicin) noexcept
         float falloff_from         = options_.ssgi_view_radius_ * (1.f - options_.ssgi_falloff_range_);
         ssgi_constants.falloff_mul = -1.f / falloff_range;
         ssgi_constants.falloff_add = falloff_from / falloff_range + 1.f;
+        uint32_t const frame_index = capsaicin.getFrameIndex();
+        ssgi_constants.interleaved_offset = glm::int2(frame_index & 1, (frame_index >> 1) & 1);
+        ssgi_constants.history_valid      = history_valid_ ? 1 : 0;
+        ssgi_constants.history_blend      = 0.9f;
     }
     gfxBufferGetData<SSGIConstants>(gfx_, ssgi_constant_buffer)[0] = ssgi_constants;
 
@@ -162,6 +175,60 @@ void SSGI::render(CapsaicinInternal &capsaicin) noexcept
         capsaicin.getAOVBuffer("NearFieldGlobalIllumination"));
     gfxProgramSetSamplerState(gfx_, ssgi_program_, "g_PointSampler", point_sampler_);
 
+    if (options_.ssgi_interleaved_)
+    {
+        if (!history_valid_)
+        {
+            gfxCommandClearTexture(gfx_, occlusion_history_texture_);
+            gfxCommandClearTexture(gfx_, lighting_history_texture_);
+        }
+
+        gfxProgramSetParameter(gfx_, ssgi_program_, "g_VelocityBuffer", capsaicin.getAOVBuffer("Velocity"));
+        gfxProgramSetParameter(
+            gfx_, ssgi_program_, "g_PrevDepthBuffer", capsaicin.getAOVBuffer("PrevVisibilityDepth"));
+        gfxProgramSetParameter(gfx_, ssgi_program_, "g_OcclusionHistoryBuffer", occlusion_history_texture_);
+        gfxProgramSetParameter(gfx_, ssgi_program_, "g_LightingHistoryBuffer", lighting_history_texture_);
+        gfxProgramSetParameter(
+            gfx_, ssgi_program_, "g_InterleavedOcclusionBuffer", interleaved_occlusion_texture_);
+        gfxProgramSetParameter(
+            gfx_, ssgi_program_, "g_InterleavedLightingBuffer", interleaved_lighting_texture_);
+        gfxProgramSetSamplerState(gfx_, ssgi_program_, "g_LinearSampler", linear_sampler_);
+
+        {
+            TimedSection const timed_section(*this, "Trace");
+
+            GfxKernel trace_kernel =
+                options_.ssgi_unroll_kernel_ ? trace_interleaved_unrolled_kernel_ : trace_interleaved_kernel_;
+
+            uint32_t const  half_width   = (buffer_width_ + 1) / 2;
+            uint32_t const  half_height  = (buffer_height_ + 1) / 2;
+            uint32_t const *num_threads  = gfxKernelGetNumThreads(gfx_, trace_kernel);
+            uint32_t const  num_groups_x = (half_width + num_threads[0] - 1) / num_threads[0];
+            uint32_t const  num_groups_y = (half_height + num_threads[1] - 1) / num_threads[1];
+
+            gfxCommandBindKernel(gfx_, trace_kernel);
+            gfxCommandDispatch(gfx_, num_groups_x, num_groups_y, 1);
+        }
+
+        {
+            TimedSection const timed_section(*this, "Resolve");
+
+            uint32_t const *num_threads  = gfxKernelGetNumThreads(gfx_, resolve_kernel_);
+            uint32_t const  num_groups_x = (buffer_width_ + num_threads[0] - 1) / num_threads[0];
+            uint32_t const  num_groups_y = (buffer_height_ + num_threads[1] - 1) / num_threads[1];
+
+            gfxCommandBindKernel(gfx_, resolve_kernel_);
+            gfxCommandDispatch(gfx_, num_groups_x, num_groups_y, 1);
+        }
+
+        // Keep the resolved outputs as next frame's history
+        gfxCommandCopyTexture(
+            gfx_, occlusion_history_texture_, capsaicin.getAOVBuffer("OcclusionAndBentNormal"));
+        gfxCommandCopyTexture(
+            gfx_, lighting_history_texture_, capsaicin.getAOVBuffer("NearFieldGlobalIllumination"));
+        history_valid_ = true;
+    }
+    else
     {
         TimedSection const timed_section(*this, "Main");
 
@@ -217,6 +284,11 @@ void SSGI::render(CapsaicinInternal &capsaicin) noexcept
     gfxDestroyBuffer(gfx_, ssgi_constant_buffer);
 }
 
+QueueAffinity SSGI::getQueueAffinity() const noexcept
+{
+    return QueueAffinity::AsyncCompute;
+}
+
 void SSGI::terminate() noexcept
 {
     destroyStaticResources();
@@ -228,6 +300,8 @@ void SSGI::initializeStaticResources([[maybe_unused]] CapsaicinInternal const &c
 {
     point_sampler_ = gfxCreateSamplerState(gfx_, D3D12_FILTER_MIN_MAG_MIP_POINT,
         D3D12_TEXTURE_ADDRESS_MODE_CLAMP, D3D12_TEXTURE_ADDRESS_MODE_CLAMP);
+    linear_sampler_ = gfxCreateSamplerState(gfx_, D3D12_FILTER_MIN_MAG_MIP_LINEAR,
+        D3D12_TEXTURE_ADDRESS_MODE_CLAMP, D3D12_TEXTURE_ADDRESS_MODE_CLAMP);
 }
 
 void SSGI::initializeBuffers(CapsaicinInternal const &capsaicin)
@@ -237,6 +311,28 @@ void SSGI::initializeBuffers(CapsaicinInternal const &capsaicin)
 
     buffer_width_  = buffer_width;
     buffer_height_ = buffer_height;
+
+    if (options_.ssgi_interleaved_)
+    {
+        uint32_t const half_width  = (buffer_width + 1) / 2;
+        uint32_t const half_height = (buffer_height + 1) / 2;
+
+        interleaved_occlusion_texture_ =
+            gfxCreateTexture2D(gfx_, half_width, half_height, DXGI_FORMAT_R16G16B16A16_FLOAT);
+        interleaved_occlusion_texture_.setName("Capsaicin_SSGI_InterleavedOcclusionBuffer");
+        interleaved_lighting_texture_ =
+            gfxCreateTexture2D(gfx_, half_width, half_height, DXGI_FORMAT_R16G16B16A16_FLOAT);
+        interleaved_lighting_texture_.setName("Capsaicin_SSGI_InterleavedLightingBuffer");
+
+        occlusion_history_texture_ =
+            gfxCreateTexture2D(gfx_, buffer_width, buffer_height, DXGI_FORMAT_R16G16B16A16_FLOAT);
+        occlusion_history_texture_.setName("Capsaicin_SSGI_OcclusionHistoryBuffer");
+        lighting_history_texture_ =
+            gfxCreateTexture2D(gfx_, buffer_width, buffer_height, DXGI_FORMAT_R16G16B16A16_FLOAT);
+        lighting_history_texture_.setName("Capsaicin_SSGI_LightingHistoryBuffer");
+
+        history_valid_ = false;
+    }
 }
 
 void SSGI::initializeKernels(CapsaicinInternal const &capsaicin)
@@ -263,6 +359,20 @@ void SSGI::initializeKernels(CapsaicinInternal const &capsaicin)
         main_unrolled_kernel_ =
             gfxCreateComputeKernel(gfx_, ssgi_program_, "Main", defines.data(), (uint32_t)defines.size());
     }
+    {
+        std::vector<char const *> defines;
+        defines.insert(defines.cend(), global_defines.cbegin(), global_defines.cend());
+        trace_interleaved_kernel_ = gfxCreateComputeKernel(
+            gfx_, ssgi_program_, "MainInterleaved", defines.data(), (uint32_t)defines.size());
+    }
+    {
+        std::vector<char const *> defines;
+        defines.insert(defines.cend(), global_defines.cbegin(), global_defines.cend());
+        defines.insert(defines.cend(), unroll_defines.cbegin(), unroll_defines.cend());
+        trace_interleaved_unrolled_kernel_ = gfxCreateComputeKernel(
+            gfx_, ssgi_program_, "MainInterleaved", defines.data(), (uint32_t)defines.size());
+    }
+    resolve_kernel_ = gfxCreateComputeKernel(gfx_, ssgi_program_, "Resolve");
 
     // Debug kernels
     debug_occlusion_program_   = gfxCreateProgram(gfx_, "ssgi_debug", shader_path.c_str());
@@ -274,9 +384,21 @@ void SSGI::initializeKernels(CapsaicinInternal const &capsaicin)
 void SSGI::destroyStaticResources()
 {
     gfxDestroySamplerState(gfx_, point_sampler_);
+    gfxDestroySamplerState(gfx_, linear_sampler_);
 }
 
-void SSGI::destroyBuffers() {}
+void SSGI::destroyBuffers()
+{
+    gfxDestroyTexture(gfx_, interleaved_occlusion_texture_);
+    gfxDestroyTexture(gfx_, interleaved_lighting_texture_);
+    gfxDestroyTexture(gfx_, occlusion_history_texture_);
+    gfxDestroyTexture(gfx_, lighting_history_texture_);
+    interleaved_occlusion_texture_ = {};
+    interleaved_lighting_texture_  = {};
+    occlusion_history_texture_     = {};
+    lighting_history_texture_      = {};
+    history_valid_                 = false;
+}
 
 void SSGI::destroyKernels()
 {
@@ -284,6 +406,9 @@ void SSGI::destroyKernels()
     gfxDestroyProgram(gfx_, ssgi_program_);
     gfxDestroyKernel(gfx_, main_kernel_);
     gfxDestroyKernel(gfx_, main_unrolled_kernel_);
+    gfxDestroyKernel(gfx_, trace_interleaved_kernel_);
+    gfxDestroyKernel(gfx_, trace_interleaved_unrolled_kernel_);
+    gfxDestroyKernel(gfx_, resolve_kernel_);
 
     // Debug kernels
     gfxDestroyProgram(gfx_, debug_occlusion_program_);
@@ -44,6 +44,8 @@ public:
         float    ssgi_view_radius_   = 0.2f;
         float    ssgi_falloff_range_ = 0.05f;
         bool     ssgi_unroll_kernel_ = false; // BE CAREFUL: if true, check shader for slice and step counts
+        bool     ssgi_interleaved_ =
+            false; // Trace at quarter rate in a 2x2 interleaved pattern with temporal accumulation
     };
 
     /**
@@ -71,6 +73,13 @@ public:
      */
     DebugViewList getDebugViews() const noexcept override;
 
+    /**
+     * Gets a list of the shader directories (relative to the shader root) that hold the shader
+     * source compiled by the current render technique.
+     * @return A list of all shader directories.
+     */
+    ShaderDirectoryList getShaderDirectories() const noexcept override;
+
     /**
      * Initialise any internal data or state.
      * @note This is automatically called by the framework after construction and should be used to create
@@ -86,6 +95,15 @@ public:
      */
     void render(CapsaicinInternal &capsaicin) noexcept override;
 
+    /**
+     * Gets the queue that the technique's GPU work should be scheduled on.
+     * @note SSGI is pure compute: its inputs (depth/normal) are complete once the visibility buffer
+     * pass has run and its outputs are not consumed until the following techniques, so it is flagged
+     * for async compute allowing it to overlap neighbouring raster work.
+     * @return The requested queue affinity.
+     */
+    QueueAffinity getQueueAffinity() const noexcept override;
+
     /**
      * Destroy any used internal resources and shutdown.
      */
@@ -103,15 +121,24 @@ protected:
     uint32_t      buffer_width_;
     uint32_t      buffer_height_;
 
-    // Buffers
+    // Buffers (interleaved mode only)
+    GfxTexture interleaved_occlusion_texture_; /**< Half-res occlusion/bent normal traced this frame */
+    GfxTexture interleaved_lighting_texture_;  /**< Half-res near field lighting traced this frame */
+    GfxTexture occlusion_history_texture_;     /**< Previous frame's resolved occlusion/bent normal */
+    GfxTexture lighting_history_texture_;      /**< Previous frame's resolved near field lighting */
+    bool       history_valid_ = false;         /**< Whether the history textures hold resolved data */
 
     // Samplers
     GfxSamplerState point_sampler_;
+    GfxSamplerState linear_sampler_;
 
     // Kernels
     GfxProgram ssgi_program_;
     GfxKernel  main_kernel_;
     GfxKernel  main_unrolled_kernel_;
+    GfxKernel  trace_interleaved_kernel_;
+    GfxKernel  trace_interleaved_unrolled_kernel_;
+    GfxKernel  resolve_kernel_;
 
     // Debug kernels
     GfxProgram debug_occlusion_program_;
@@ -47,6 +47,9 @@ struct SSGIConstants
     float    view_radius;
     float    falloff_mul;
     float    falloff_add;
+    int2     interleaved_offset; /**< The 2x2 pattern position traced this frame (interleaved mode) */
+    uint     history_valid;      /**< Whether the temporal history can be resolved against */
+    float    history_blend;      /**< The weight given to reprojected history during resolve */
 };
 
 #ifdef __cplusplus
@@ -128,6 +128,18 @@ public:
         return ret;
     }
 
+    /**
+     * Gets a list of the shader directories (relative to the shader root) that hold the shader
+     * source compiled by the current render technique.
+     * @return A list of all shader directories.
+     */
+    ShaderDirectoryList getShaderDirectories() const noexcept override
+    {
+        auto ret = technique1.getShaderDirectories();
+        std::ranges::move(technique2.getShaderDirectories(), std::back_inserter(ret));
+        return ret;
+    }
+
     /**
      * Initialise any internal data or state.
      * @note This is automatically called by the framework after construction and should be used to create
@@ -38,6 +38,7 @@ RenderOptionList TAA::getRenderOptions() noexcept
 {
     RenderOptionList newOptions;
     newOptions.emplace(RENDER_OPTION_MAKE(taa_enable, options));
+    newOptions.emplace(RENDER_OPTION_MAKE(taa_render_scale, options));
     return newOptions;
 }
 
@@ -45,6 +46,7 @@ TAA::RenderOptions TAA::convertOptions(RenderOptionList const &options) noexcept
 {
     RenderOptions newOptions;
     RENDER_OPTION_GET(taa_enable, newOptions, options)
+    RENDER_OPTION_GET(taa_render_scale, newOptions, options)
     return newOptions;
 }
 
@@ -60,6 +62,11 @@ AOVList TAA::getAOVs() const noexcept
     return aovs;
 }
 
+ShaderDirectoryList TAA::getShaderDirectories() const noexcept
+{
+    return {"render_techniques/taa"};
+}
+
 bool TAA::init(CapsaicinInternal const &capsaicin) noexcept
 {
     std::vector<char const *> defines;
@@ -74,6 +81,8 @@ bool TAA::init(CapsaicinInternal const &capsaicin) noexcept
     taa_program_             = gfxCreateProgram(gfx_, "render_techniques/taa/taa", capsaicin.getShaderPath());
     resolve_temporal_kernel_ = gfxCreateComputeKernel(
         gfx_, taa_program_, "ResolveTemporal", defines.data(), (uint32_t)defines.size());
+    resolve_upscale_kernel_  = gfxCreateComputeKernel(
+        gfx_, taa_program_, "ResolveTemporalUpscale", defines.data(), (uint32_t)defines.size());
     resolve_passthru_kernel_ = gfxCreateComputeKernel(
         gfx_, taa_program_, "ResolvePassthru", defines.data(), (uint32_t)defines.size());
     update_history_kernel_ = gfxCreateComputeKernel(gfx_, taa_program_, "UpdateHistory");
@@ -82,12 +91,21 @@ bool TAA::init(CapsaicinInternal const &capsaicin) noexcept
 
 void TAA::render(CapsaicinInternal &capsaicin) noexcept
 {
-    // Make sure our color buffers are properly created
-    uint32_t const buffer_width  = capsaicin.getWidth();
-    uint32_t const buffer_height = capsaicin.getHeight();
+    options = convertOptions(capsaicin.getOptions());
 
+    // TAA accumulates at display resolution: when the temporal upscaler is active the inputs occupy
+    // the reduced render resolution region of their buffers and the history holds the reconstructed
+    // display resolution image
+    uint32_t const render_width   = capsaicin.getWidth();
+    uint32_t const render_height  = capsaicin.getHeight();
+    uint32_t const display_width  = capsaicin.getDisplayWidth();
+    uint32_t const display_height = capsaicin.getDisplayHeight();
+    bool const     upscaling =
+        options.taa_enable && (render_width != display_width || render_height != display_height);
+
+    // Make sure our color buffers are properly created
     bool not_cleared_history = true;
-    if (buffer_width != color_buffers_->getWidth() || buffer_height != color_buffers_->getHeight())
+    if (display_width != color_buffers_->getWidth() || display_height != color_buffers_->getHeight())
     {
         for (GfxTexture &color_buffer : color_buffers_)
             gfxDestroyTexture(gfx_, color_buffer);
@@ -98,7 +116,7 @@ void TAA::render(CapsaicinInternal &capsaicin) noexcept
             GFX_SNPRINTF(buffer, sizeof(buffer), "Capsaicin_ColorBuffer%u", i);
 
             color_buffers_[i] =
-                gfxCreateTexture2D(gfx_, buffer_width, buffer_height, DXGI_FORMAT_R16G16B16A16_FLOAT);
+                gfxCreateTexture2D(gfx_, display_width, display_height, DXGI_FORMAT_R16G16B16A16_FLOAT);
             color_buffers_[i].setName(buffer);
 
             gfxCommandClearTexture(gfx_, color_buffers_[i]);
@@ -108,13 +126,17 @@ void TAA::render(CapsaicinInternal &capsaicin) noexcept
     }
 
     // Bind the shader parameters
-    uint32_t const buffer_dimensions[] = {buffer_width, buffer_height};
+    uint32_t const buffer_dimensions[] = {display_width, display_height};
+    uint32_t const render_dimensions[] = {render_width, render_height};
 
-    options = convertOptions(capsaicin.getOptions());
+    auto const &camera_matrices = capsaicin.getCameraMatrices(true);
+    float const jitter[]        = {camera_matrices.projection[2][0], camera_matrices.projection[2][1]};
 
     gfxProgramSetParameter(
         gfx_, taa_program_, "g_HaveHistory", not_cleared_history && capsaicin.getFrameIndex() > 0);
     gfxProgramSetParameter(gfx_, taa_program_, "g_BufferDimensions", buffer_dimensions);
+    gfxProgramSetParameter(gfx_, taa_program_, "g_RenderDimensions", render_dimensions);
+    gfxProgramSetParameter(gfx_, taa_program_, "g_Jitter", jitter);
 
     gfxProgramSetParameter(gfx_, taa_program_, "g_DepthBuffer", capsaicin.getAOVBuffer("VisibilityDepth"));
     gfxProgramSetParameter(gfx_, taa_program_, "g_VelocityBuffer", capsaicin.getAOVBuffer("Velocity"));
@@ -138,26 +160,30 @@ void TAA::render(CapsaicinInternal &capsaicin) noexcept
     if (!options.taa_enable)
     {
         uint32_t const *num_threads  = gfxKernelGetNumThreads(gfx_, resolve_passthru_kernel_);
-        uint32_t const  num_groups_x = (buffer_width + num_threads[0] - 1) / num_threads[0];
-        uint32_t const  num_groups_y = (buffer_height + num_threads[1] - 1) / num_threads[1];
+        uint32_t const  num_groups_x = (render_width + num_threads[0] - 1) / num_threads[0];
+        uint32_t const  num_groups_y = (render_height + num_threads[1] - 1) / num_threads[1];
 
         gfxCommandBindKernel(gfx_, resolve_passthru_kernel_);
         gfxCommandDispatch(gfx_, num_groups_x, num_groups_y, 1);
     }
     else
     {
-        // Perform the temporal resolve
+        // Perform the temporal resolve (with jitter-aware upsampling when the render resolution is
+        // below the display resolution)
         {
             TimedSection const timed_section(*this, "ResolveTemporal");
 
-            uint32_t const *num_threads  = gfxKernelGetNumThreads(gfx_, resolve_temporal_kernel_);
-            uint32_t const  num_groups_x = (buffer_width + num_threads[0] - 1) / num_threads[0];
-            uint32_t const  num_groups_y = (buffer_height + num_threads[1] - 1) / num_threads[1];
+            GfxKernel const &resolve_kernel =
+                upscaling ? resolve_upscale_kernel_ : resolve_temporal_kernel_;
+
+            uint32_t const *num_threads  = gfxKernelGetNumThreads(gfx_, resolve_kernel);
+            uint32_t const  num_groups_x = (display_width + num_threads[0] - 1) / num_threads[0];
+            uint32_t const  num_groups_y = (display_height + num_threads[1] - 1) / num_threads[1];
 
             gfxProgramSetParameter(gfx_, taa_program_, "g_OutputBuffer", color_buffers_[0]);
             gfxProgramSetParameter(gfx_, taa_program_, "g_HistoryBuffer", color_buffers_[1]);
 
-            gfxCommandBindKernel(gfx_, resolve_temporal_kernel_);
+            gfxCommandBindKernel(gfx_, resolve_kernel);
             gfxCommandDispatch(gfx_, num_groups_x, num_groups_y, 1);
         }
 
@@ -166,8 +192,8 @@ void TAA::render(CapsaicinInternal &capsaicin) noexcept
             TimedSection const timed_section(*this, "UpdateHistory");
 
             uint32_t const *num_threads  = gfxKernelGetNumThreads(gfx_, update_history_kernel_);
-            uint32_t const  num_groups_x = (buffer_width + num_threads[0] - 1) / num_threads[0];
-            uint32_t const  num_groups_y = (buffer_height + num_threads[1] - 1) / num_threads[1];
+            uint32_t const  num_groups_x = (display_width + num_threads[0] - 1) / num_threads[0];
+            uint32_t const  num_groups_y = (display_height + num_threads[1] - 1) / num_threads[1];
 
             gfxProgramSetParameter(gfx_, taa_program_, "g_OutputBuffer", color_buffers_[1]);
             gfxProgramSetParameter(gfx_, taa_program_, "g_HistoryBuffer", color_buffers_[0]);
@@ -185,6 +211,7 @@ void TAA::terminate() noexcept
 
     gfxDestroyProgram(gfx_, taa_program_);
     gfxDestroyKernel(gfx_, resolve_temporal_kernel_);
+    gfxDestroyKernel(gfx_, resolve_upscale_kernel_);
     gfxDestroyKernel(gfx_, resolve_passthru_kernel_);
     gfxDestroyKernel(gfx_, update_history_kernel_);
 
@@ -194,5 +221,6 @@ void TAA::terminate() noexcept
 void TAA::renderGUI(CapsaicinInternal &capsaicin) const noexcept
 {
     ImGui::Checkbox("Use TAA", &capsaicin.getOption<bool>("taa_enable"));
+    ImGui::SliderFloat("Render Scale", &capsaicin.getOption<float>("taa_render_scale"), 0.5f, 1.0f);
 }
 } // namespace Capsaicin
@@ -39,7 +39,11 @@ public:
 
     struct RenderOptions
     {
-        bool taa_enable = true;
+        bool  taa_enable = true;
+        float taa_render_scale =
+            1.0f; /**< Internal render resolution as a fraction of the display resolution; below 1 the
+                       frame renders at reduced resolution and TAA performs jitter-aware upsampled
+                       accumulation to the display resolution (only effects if taa_enable is enabled) */
     };
 
     /**
@@ -55,6 +59,13 @@ public:
      */
     AOVList getAOVs() const noexcept override;
 
+    /**
+     * Gets a list of the shader directories (relative to the shader root) that hold the shader
+     * source compiled by the current render technique.
+     * @return A list of all shader directories.
+     */
+    ShaderDirectoryList getShaderDirectories() const noexcept override;
+
     /**
      * Initialise any internal data or state.
      * @note This is automatically called by the framework after construction and should be used to create
@@ -88,6 +99,7 @@ protected:
 
     GfxProgram taa_program_;
     GfxKernel  resolve_temporal_kernel_;
+    GfxKernel  resolve_upscale_kernel_; /**< Jitter-aware upsampled accumulation to display resolution */
     GfxKernel  resolve_passthru_kernel_;
     GfxKernel  update_history_kernel_;
 };
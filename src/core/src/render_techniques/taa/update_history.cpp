@@ -43,6 +43,11 @@ AOVList UpdateHistory::getAOVs() const noexcept
     return aovs;
 }
 
+ShaderDirectoryList UpdateHistory::getShaderDirectories() const noexcept
+{
+    return {"render_techniques/taa"};
+}
+
 bool UpdateHistory::init(CapsaicinInternal const &capsaicin) noexcept
 {
     std::vector<char const *> defines;
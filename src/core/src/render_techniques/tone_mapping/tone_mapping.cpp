@@ -40,6 +40,7 @@ RenderOptionList ToneMapping::getRenderOptions() noexcept
     RenderOptionList newOptions;
     newOptions.emplace(RENDER_OPTION_MAKE(tonemap_enable, options));
     newOptions.emplace(RENDER_OPTION_MAKE(tonemap_exposure, options));
+    newOptions.emplace(RENDER_OPTION_MAKE(tonemap_auto_exposure, options));
     return newOptions;
 }
 
@@ -48,6 +49,7 @@ ToneMapping::RenderOptions ToneMapping::convertOptions(RenderOptionList const &o
     RenderOptions newOptions;
     RENDER_OPTION_GET(tonemap_enable, newOptions, options)
     RENDER_OPTION_GET(tonemap_exposure, newOptions, options)
+    RENDER_OPTION_GET(tonemap_auto_exposure, newOptions, options)
     return newOptions;
 }
 
@@ -66,11 +68,27 @@ AOVList ToneMapping::getAOVs() const noexcept
     return aovs;
 }
 
+BufferList ToneMapping::getBuffers() const noexcept
+{
+    BufferList buffers;
+    // GPU-computed auto-exposure (zero-initialised, i.e. neutral, unless a technique such as
+    // variance_estimate writes it)
+    buffers.push_back({"Exposure", Buffer::Read, 2 * sizeof(float)});
+    return buffers;
+}
+
+ShaderDirectoryList ToneMapping::getShaderDirectories() const noexcept
+{
+    return {"render_techniques/tone_mapping"};
+}
+
 bool ToneMapping::init(CapsaicinInternal const &capsaicin) noexcept
 {
     tone_mapping_program_ =
         gfxCreateProgram(gfx_, "render_techniques/tone_mapping/tone_mapping", capsaicin.getShaderPath());
     tone_mapping_kernel_ = gfxCreateComputeKernel(gfx_, tone_mapping_program_, "Tonemap");
+    // The fused output kernel uses the default draw state so it renders straight to the back buffer
+    tone_mapping_output_kernel_ = gfxCreateGraphicsKernel(gfx_, tone_mapping_program_, "TonemapOutput");
     return !!tone_mapping_program_;
 }
 
@@ -80,41 +98,72 @@ void ToneMapping::render(CapsaicinInternal &capsaicin) noexcept
 
     if (!options.tonemap_enable) return;
 
+    // Tone mapping runs after TAA so it operates at the display resolution (this matches the render
+    // resolution unless the temporal upscaler is active)
     uint32_t const buffer_dimensions[] =
     {
-        capsaicin.getWidth(),
-        capsaicin.getHeight()
+        capsaicin.getDisplayWidth(),
+        capsaicin.getDisplayHeight()
     };
 
     gfxProgramSetParameter(gfx_, tone_mapping_program_, "g_BufferDimensions", buffer_dimensions);
     gfxProgramSetParameter(gfx_, tone_mapping_program_, "g_FrameIndex", capsaicin.getFrameIndex());
     gfxProgramSetParameter(gfx_, tone_mapping_program_, "g_Exposure", options.tonemap_exposure);
+    gfxProgramSetParameter(
+        gfx_, tone_mapping_program_, "g_AutoExposure", (uint32_t)options.tonemap_auto_exposure);
+    gfxProgramSetParameter(gfx_, tone_mapping_program_, "g_ExposureBuffer", capsaicin.getBuffer("Exposure"));
 
     GfxTexture input      = capsaicin.getAOVBuffer("Color");
     GfxTexture output     = input;
     auto       debug_view = capsaicin.getCurrentDebugView();
 
-    if (!debug_view.empty() && debug_view != "None")
+    // The fused output path leaves the colour AOV linear, so fall back to the in-place tonemap
+    // (followed by the framework blit) whenever something consumes the tone mapped AOV this frame,
+    // such as benchmark screenshot dumps or the image metrics comparison
+    bool const no_debug_view      = debug_view.empty() || debug_view == "None";
+    bool const color_aov_consumed = capsaicin.hasAOVDumpRequest("Color")
+                                 || (capsaicin.hasOption<bool>("image_metrics_enable")
+                                     && capsaicin.getOption<bool>("image_metrics_enable"));
+
+    if (no_debug_view && !color_aov_consumed)
     {
-        // Tone map the debug buffer if we are using a debug view
-        if (capsaicin.checkDebugViewAOV(debug_view))
-        {
-            // If the debug view is actually an AOV then only tonemap if its a floating point format
-            auto const debugAOV = capsaicin.getAOVBuffer(debug_view);
-            auto const format   = debugAOV.getFormat();
-            if (format == DXGI_FORMAT_R32G32B32A32_FLOAT || format == DXGI_FORMAT_R32G32B32_FLOAT
-                || format == DXGI_FORMAT_R16G16B16A16_FLOAT || format == DXGI_FORMAT_R11G11B10_FLOAT)
-            {
-                input  = debugAOV;
-                output = capsaicin.getAOVBuffer("Debug");
-            }
-        }
-        else
+        // Fused output path: tone map the colour AOV directly into the back buffer instead of
+        // writing it back in place and blitting it in a second full-screen pass
+        auto blue_noise_sampler = capsaicin.getComponent<BlueNoiseSampler>();
+        blue_noise_sampler->addProgramParameters(capsaicin, tone_mapping_program_);
+
+        gfxProgramSetParameter(gfx_, tone_mapping_program_, "g_InputBuffer", input);
+
+        gfxCommandBindKernel(gfx_, tone_mapping_output_kernel_);
+        gfxCommandDraw(gfx_, 3);
+
+        capsaicin.setBackBufferWritten();
+        return;
+    }
+
+    // Tone map the debug buffer if we are using a debug view
+    if (no_debug_view)
+    {
+        // Colour AOV consumer active: tone map the colour AOV in place and let the framework blit
+        // output it to the back buffer
+    }
+    else if (capsaicin.checkDebugViewAOV(debug_view))
+    {
+        // If the debug view is actually an AOV then only tonemap if its a floating point format
+        auto const debugAOV = capsaicin.getAOVBuffer(debug_view);
+        auto const format   = debugAOV.getFormat();
+        if (format == DXGI_FORMAT_R32G32B32A32_FLOAT || format == DXGI_FORMAT_R32G32B32_FLOAT
+            || format == DXGI_FORMAT_R16G16B16A16_FLOAT || format == DXGI_FORMAT_R11G11B10_FLOAT)
         {
-            input  = capsaicin.getAOVBuffer("Debug");
-            output = input;
+            input  = debugAOV;
+            output = capsaicin.getAOVBuffer("Debug");
         }
     }
+    else
+    {
+        input  = capsaicin.getAOVBuffer("Debug");
+        output = input;
+    }
 
     auto blue_noise_sampler = capsaicin.getComponent<BlueNoiseSampler>();
     blue_noise_sampler->addProgramParameters(capsaicin, tone_mapping_program_);
@@ -133,6 +182,7 @@ void ToneMapping::render(CapsaicinInternal &capsaicin) noexcept
 void ToneMapping::terminate() noexcept
 {
     gfxDestroyKernel(gfx_, tone_mapping_kernel_);
+    gfxDestroyKernel(gfx_, tone_mapping_output_kernel_);
     gfxDestroyProgram(gfx_, tone_mapping_program_);
 }
 
@@ -141,6 +191,7 @@ void ToneMapping::renderGUI(CapsaicinInternal &capsaicin) const noexcept
     bool &enabled = capsaicin.getOption<bool>("tonemap_enable");
     if (!enabled) ImGui::BeginDisabled(true);
     ImGui::DragFloat("Exposure", &capsaicin.getOption<float>("tonemap_exposure"), 5e-3f);
+    ImGui::Checkbox("Auto Exposure", &capsaicin.getOption<bool>("tonemap_auto_exposure"));
     if (!enabled) ImGui::EndDisabled();
     ImGui::Checkbox("Enable Tone Mapping", &enabled);
 }
@@ -0,0 +1,45 @@
+/**********************************************************************
+Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+********************************************************************/
+#include "../../math/color.hlsl"
+
+uint  g_FrameIndex;
+float g_Exposure;
+uint  g_AutoExposure;
+
+StructuredBuffer<float> g_ExposureBuffer;
+
+Texture2D g_InputBuffer;
+
+#include "../../components/blue_noise_sampler/blue_noise_sampler.hlsl"
+
+#include "tone_mapping.hlsl"
+
+float4 TonemapOutput(in float4 pos : SV_Position) : SV_Target
+{
+    uint2 did = uint2(pos.xy);
+
+    float3 color = g_InputBuffer.Load(int3(did, 0)).xyz;
+
+    color = tonemapColor(did, color);
+
+    return float4(color, 1.0f);
+}
@@ -39,8 +39,10 @@ public:
 
     struct RenderOptions
     {
-        bool  tonemap_enable   = true;
-        float tonemap_exposure = 1.0f;
+        bool  tonemap_enable        = true;
+        float tonemap_exposure      = 1.0f;
+        bool  tonemap_auto_exposure = false; /**< Apply the GPU-computed auto-exposure (requires a
+                                                  technique writing the "Exposure" buffer). */
     };
 
     /**
@@ -62,6 +64,19 @@ public:
      */
     AOVList getAOVs() const noexcept override;
 
+    /**
+     * Gets a list of any shared buffers used by the current render technique.
+     * @return A list of all supported buffers.
+     */
+    BufferList getBuffers() const noexcept override;
+
+    /**
+     * Gets a list of the shader directories (relative to the shader root) that hold the shader
+     * source compiled by the current render technique.
+     * @return A list of all shader directories.
+     */
+    ShaderDirectoryList getShaderDirectories() const noexcept override;
+
     /**
      * Initialise any internal data or state.
      * @note This is automatically called by the framework after construction and should be used to create
@@ -92,6 +107,7 @@ private:
     RenderOptions options;
 
     GfxKernel  tone_mapping_kernel_;
+    GfxKernel  tone_mapping_output_kernel_; /**< Fused tone map pass writing directly to the back buffer. */
     GfxProgram tone_mapping_program_;
 };
 } // namespace Capsaicin
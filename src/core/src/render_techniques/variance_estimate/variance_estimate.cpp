@@ -28,7 +28,7 @@ namespace Capsaicin
 VarianceEstimate::VarianceEstimate()
     : RenderTechnique("Variance Estimate")
     , cv_(0.0f)
-    , readback_buffer_index_(0)
+    , exposure_(0.0f)
 {}
 
 VarianceEstimate::~VarianceEstimate()
@@ -43,25 +43,34 @@ AOVList VarianceEstimate::getAOVs() const noexcept
     return aovs;
 }
 
+BufferList VarianceEstimate::getBuffers() const noexcept
+{
+    BufferList buffers;
+    // Exposure and coefficient of variation, consumed directly on the GPU by tone mapping
+    buffers.push_back({"Exposure", Buffer::Write, 2 * sizeof(float)});
+    return buffers;
+}
+
+ShaderDirectoryList VarianceEstimate::getShaderDirectories() const noexcept
+{
+    return {"render_techniques/variance_estimate"};
+}
+
 bool VarianceEstimate::init(CapsaicinInternal const &capsaicin) noexcept
 {
-    result_buffer_ = gfxCreateBuffer<float>(gfx_, 1);
-    result_buffer_.setName("Capsaicin_ResultBuffer");
+    uint32_t const completion_clear = 0;
 
-    for (uint32_t i = 0; i < ARRAYSIZE(readback_buffers_); ++i)
-    {
-        char buffer[64];
-        GFX_SNPRINTF(buffer, sizeof(buffer), "Capsaicin_ReadbackBuffer%u", i);
+    completion_buffer_ = gfxCreateBuffer<uint32_t>(gfx_, 1, &completion_clear);
+    completion_buffer_.setName("Capsaicin_CompletionBuffer");
 
-        readback_buffers_[i] = gfxCreateBuffer<float>(gfx_, 1, nullptr, kGfxCpuAccess_Read);
-        readback_buffers_[i].setName(buffer);
+    if (!result_readback_.initialise(gfx_, 2, "Capsaicin_ReadbackBuffer"))
+    {
+        return false;
     }
 
     variance_estimate_program_ = gfxCreateProgram(
         gfx_, "render_techniques/variance_estimate/variance_estimate", capsaicin.getShaderPath());
-    compute_mean_kernel_      = gfxCreateComputeKernel(gfx_, variance_estimate_program_, "ComputeMean");
-    compute_distance_kernel_  = gfxCreateComputeKernel(gfx_, variance_estimate_program_, "ComputeDistance");
-    compute_deviation_kernel_ = gfxCreateComputeKernel(gfx_, variance_estimate_program_, "ComputeDeviation");
+    compute_variance_kernel_ = gfxCreateComputeKernel(gfx_, variance_estimate_program_, "ComputeVariance");
 
     return !!variance_estimate_program_;
 }
@@ -70,16 +79,10 @@ void VarianceEstimate::render(CapsaicinInternal &capsaicin) noexcept
 {
     uint32_t const buffer_dimensions[] = {capsaicin.getWidth(), capsaicin.getHeight()};
 
-    uint32_t const  pixel_count  = buffer_dimensions[0] * buffer_dimensions[1];
-    uint32_t const *num_threads  = gfxKernelGetNumThreads(gfx_, compute_mean_kernel_);
+    uint32_t const *num_threads  = gfxKernelGetNumThreads(gfx_, compute_variance_kernel_);
     uint32_t const  num_groups_x = (buffer_dimensions[0] + num_threads[0] - 1) / num_threads[0];
     uint32_t const  num_groups_y = (buffer_dimensions[1] + num_threads[1] - 1) / num_threads[1];
-    uint32_t const  elem_count =
-        (pixel_count + num_threads[0] * num_threads[1] - 1) / (num_threads[0] * num_threads[1]);
-
-    GFX_ASSERT(num_threads[0] == gfxKernelGetNumThreads(gfx_, compute_distance_kernel_)[0]
-               && num_threads[1] == gfxKernelGetNumThreads(gfx_, compute_distance_kernel_)[1]
-               && num_threads[2] == gfxKernelGetNumThreads(gfx_, compute_distance_kernel_)[2]);
+    uint32_t const  elem_count   = num_groups_x * num_groups_y;
 
     if (mean_buffer_.getCount() != elem_count)
     {
@@ -97,6 +100,16 @@ void VarianceEstimate::render(CapsaicinInternal &capsaicin) noexcept
         square_buffer_.setName("Capsaicin_SquareBuffer");
     }
 
+    if (log_luma_buffer_.getCount() != elem_count)
+    {
+        gfxDestroyBuffer(gfx_, log_luma_buffer_);
+
+        log_luma_buffer_ = gfxCreateBuffer<float>(gfx_, elem_count);
+        log_luma_buffer_.setName("Capsaicin_LogLumaBuffer");
+    }
+
+    GfxBuffer const exposure_buffer = capsaicin.getBuffer("Exposure");
+
     gfxProgramSetParameter(gfx_, variance_estimate_program_, "g_BufferDimensions", buffer_dimensions);
 
     gfxProgramSetParameter(
@@ -104,50 +117,29 @@ void VarianceEstimate::render(CapsaicinInternal &capsaicin) noexcept
 
     gfxProgramSetParameter(gfx_, variance_estimate_program_, "g_MeanBuffer", mean_buffer_);
     gfxProgramSetParameter(gfx_, variance_estimate_program_, "g_SquareBuffer", square_buffer_);
-    gfxProgramSetParameter(gfx_, variance_estimate_program_, "g_ResultBuffer", result_buffer_);
+    gfxProgramSetParameter(gfx_, variance_estimate_program_, "g_LogLumaBuffer", log_luma_buffer_);
+    gfxProgramSetParameter(gfx_, variance_estimate_program_, "g_CompletionBuffer", completion_buffer_);
+    gfxProgramSetParameter(gfx_, variance_estimate_program_, "g_ExposureBuffer", exposure_buffer);
 
-    // Compute the mean
+    // Compute the mean, variance and auto-exposure in a single pass. The last group to finish
+    // performs the final reduction on the GPU so no intermediate reduce chain is needed and the
+    // results stay resident for tone mapping to consume directly
     {
-        TimedSection const timed_section(*this, "ComputeMean");
+        TimedSection const timed_section(*this, "ComputeVariance");
 
-        gfxCommandBindKernel(gfx_, compute_mean_kernel_);
+        gfxCommandBindKernel(gfx_, compute_variance_kernel_);
         gfxCommandDispatch(gfx_, num_groups_x, num_groups_y, 1);
-        gfxCommandReduceSum(gfx_, kGfxDataType_Float, mean_buffer_, mean_buffer_);
     }
 
-    // Compute the squared distance to the mean
+    // Stream the result back to the CPU (display only, nothing waits on it)
     {
-        TimedSection const timed_section(*this, "ComputeDistance");
-
-        gfxCommandBindKernel(gfx_, compute_distance_kernel_);
-        gfxCommandDispatch(gfx_, num_groups_x, num_groups_y, 1);
-        gfxCommandReduceSum(gfx_, kGfxDataType_Float, square_buffer_, square_buffer_);
-    }
-
-    // Compute the standard deviation
-    {
-        TimedSection const timed_section(*this, "ComputeDeviation");
-
-        gfxCommandBindKernel(gfx_, compute_deviation_kernel_);
-        gfxCommandDispatch(gfx_, 1, 1, 1);
-    }
-
-    // Stream the result back to the CPU
-    {
-        GfxBuffer const &readback_buffer =
-            readback_buffers_[readback_buffer_index_ % ARRAYSIZE(readback_buffers_)];
-
-        if (readback_buffer_index_ >= ARRAYSIZE(readback_buffers_))
+        if (float const *results = result_readback_.tryGet(); results != nullptr)
         {
-            cv_ = *gfxBufferGetData<float>(gfx_, readback_buffer);
+            exposure_ = results[0];
+            cv_       = results[1];
         }
 
-        gfxCommandCopyBuffer(gfx_, readback_buffer, result_buffer_);
-
-        if (++readback_buffer_index_ >= 2 * ARRAYSIZE(readback_buffers_))
-        {
-            readback_buffer_index_ -= ARRAYSIZE(readback_buffers_);
-        }
+        result_readback_.readback(exposure_buffer);
     }
 }
 
@@ -157,27 +149,22 @@ void VarianceEstimate::terminate() noexcept
     mean_buffer_ = {};
     gfxDestroyBuffer(gfx_, square_buffer_);
     square_buffer_ = {};
-    gfxDestroyBuffer(gfx_, result_buffer_);
-    result_buffer_ = {};
+    gfxDestroyBuffer(gfx_, log_luma_buffer_);
+    log_luma_buffer_ = {};
+    gfxDestroyBuffer(gfx_, completion_buffer_);
+    completion_buffer_ = {};
 
-    for (GfxBuffer &readback_buffer : readback_buffers_)
-    {
-        gfxDestroyBuffer(gfx_, readback_buffer);
-        readback_buffer = {};
-    }
+    result_readback_.terminate();
 
     gfxDestroyProgram(gfx_, variance_estimate_program_);
     variance_estimate_program_ = {};
-    gfxDestroyKernel(gfx_, compute_mean_kernel_);
-    compute_mean_kernel_ = {};
-    gfxDestroyKernel(gfx_, compute_distance_kernel_);
-    compute_distance_kernel_ = {};
-    gfxDestroyKernel(gfx_, compute_deviation_kernel_);
-    compute_deviation_kernel_ = {};
+    gfxDestroyKernel(gfx_, compute_variance_kernel_);
+    compute_variance_kernel_ = {};
 }
 
 void VarianceEstimate::renderGUI([[maybe_unused]] CapsaicinInternal &capsaicin) const noexcept
 {
     ImGui::Text("Noise amount :  %f", cv_);
+    ImGui::Text("Auto exposure:  %f", exposure_);
 }
 } // namespace Capsaicin
@@ -21,6 +21,7 @@ THE SOFTWARE.
 ********************************************************************/
 #pragma once
 
+#include "../../utilities/readback_view.h"
 #include "render_technique.h"
 
 namespace Capsaicin
@@ -37,6 +38,19 @@ public:
      */
     AOVList getAOVs() const noexcept override;
 
+    /**
+     * Gets a list of any shared buffers used by the current render technique.
+     * @return A list of all supported buffers.
+     */
+    BufferList getBuffers() const noexcept override;
+
+    /**
+     * Gets a list of the shader directories (relative to the shader root) that hold the shader
+     * source compiled by the current render technique.
+     * @return A list of all shader directories.
+     */
+    ShaderDirectoryList getShaderDirectories() const noexcept override;
+
     /**
      * Initialise any internal data or state.
      * @note This is automatically called by the framework after construction and should be used to create
@@ -64,18 +78,17 @@ public:
     void renderGUI(CapsaicinInternal &capsaicin) const noexcept override;
 
 protected:
-    float cv_; //
+    float cv_;       //
+    float exposure_; //
 
-    GfxBuffer mean_buffer_;   //
-    GfxBuffer square_buffer_; //
-    GfxBuffer result_buffer_; //
+    GfxBuffer mean_buffer_;       //
+    GfxBuffer square_buffer_;     //
+    GfxBuffer log_luma_buffer_;   //
+    GfxBuffer completion_buffer_; //
 
-    GfxBuffer readback_buffers_[kGfxConstant_BackBufferCount]; //
-    uint32_t  readback_buffer_index_;                          //
+    ReadbackView<float> result_readback_; //
 
     GfxProgram variance_estimate_program_; //
-    GfxKernel  compute_mean_kernel_;       //
-    GfxKernel  compute_distance_kernel_;   //
-    GfxKernel  compute_deviation_kernel_;  //
+    GfxKernel  compute_variance_kernel_;   //
 };
 } // namespace Capsaicin
@@ -43,6 +43,7 @@ RenderOptionList VisibilityBuffer::getRenderOptions() noexcept
     RenderOptionList newOptions;
     newOptions.emplace(RENDER_OPTION_MAKE(visibility_buffer_use_rt, options));
     newOptions.emplace(RENDER_OPTION_MAKE(visibility_buffer_use_rt_dxr10, options));
+    newOptions.emplace(RENDER_OPTION_MAKE(visibility_buffer_gpu_culling, options));
     return newOptions;
 }
 
@@ -51,6 +52,7 @@ VisibilityBuffer::RenderOptions VisibilityBuffer::convertOptions(RenderOptionLis
     RenderOptions newOptions;
     RENDER_OPTION_GET(visibility_buffer_use_rt, newOptions, options)
     RENDER_OPTION_GET(visibility_buffer_use_rt_dxr10, newOptions, options)
+    RENDER_OPTION_GET(visibility_buffer_gpu_culling, newOptions, options)
     return newOptions;
 }
 
@@ -91,6 +93,11 @@ DebugViewList VisibilityBuffer::getDebugViews() const noexcept
     return views;
 }
 
+ShaderDirectoryList VisibilityBuffer::getShaderDirectories() const noexcept
+{
+    return {"render_techniques/visibility_buffer"};
+}
+
 bool VisibilityBuffer::init(CapsaicinInternal const &capsaicin) noexcept
 {
     if (capsaicin.hasAOVBuffer("DisocclusionMask"))
@@ -119,6 +126,43 @@ bool VisibilityBuffer::init(CapsaicinInternal const &capsaicin) noexcept
     return initKernel(capsaicin);
 }
 
+void VisibilityBuffer::prepare(CapsaicinInternal const &capsaicin) noexcept
+{
+    RenderOptions const newOptions = convertOptions(capsaicin.getOptions());
+    if (newOptions.visibility_buffer_use_rt)
+    {
+        return; // the ray tracing path issues no indirect draws
+    }
+
+    // Build the per-instance draw commands on the worker thread, render() only copies them into
+    // this frame's constant buffer allocation
+    uint32_t const instance_count = gfxSceneGetObjectCount<GfxInstance>(capsaicin.getScene());
+    draw_commands_.resize(instance_count);
+    cull_bounds_.resize(newOptions.visibility_buffer_gpu_culling ? instance_count : 0);
+    for (uint32_t i = 0; i < instance_count; ++i)
+    {
+        uint32_t const  instance_index = capsaicin.getInstanceIdData()[i];
+        Instance const &instance       = capsaicin.getInstanceData()[instance_index];
+        Mesh const     &mesh           = capsaicin.getMeshData()[instance.mesh_index];
+
+        draw_commands_[i].IndexCountPerInstance = mesh.index_count;
+        draw_commands_[i].InstanceCount         = 1;
+        draw_commands_[i].StartIndexLocation    = mesh.index_offset_idx;
+        draw_commands_[i].BaseVertexLocation    = mesh.vertex_offset_idx;
+        draw_commands_[i].StartInstanceLocation = i; // <- drawID
+
+        if (newOptions.visibility_buffer_gpu_culling)
+        {
+            glm::vec3 const &bound_min = capsaicin.getInstanceMinBounds()[instance_index];
+            glm::vec3 const &bound_max = capsaicin.getInstanceMaxBounds()[instance_index];
+            cull_bounds_[i]            = {
+                {bound_min.x, bound_min.y, bound_min.z, 0.0f},
+                {bound_max.x, bound_max.y, bound_max.z, 0.0f}
+            };
+        }
+    }
+}
+
 void VisibilityBuffer::render(CapsaicinInternal &capsaicin) noexcept
 {
     // Check for option change
@@ -134,6 +178,11 @@ void VisibilityBuffer::render(CapsaicinInternal &capsaicin) noexcept
         gfxDestroyKernel(gfx_, visibility_buffer_kernel_);
         gfxDestroySbt(gfx_, visibility_buffer_sbt_);
         visibility_buffer_sbt_ = {};
+        gfxDestroyProgram(gfx_, gpu_culling_program_);
+        gfxDestroyKernel(gfx_, copy_depth_kernel_);
+        gfxDestroyKernel(gfx_, downsample_max_kernel_);
+        gfxDestroyKernel(gfx_, cull_instances_kernel_);
+        gpu_culling_program_ = {};
 
         initKernel(capsaicin);
     }
@@ -151,17 +200,96 @@ void VisibilityBuffer::render(CapsaicinInternal &capsaicin) noexcept
         D3D12_DRAW_INDEXED_ARGUMENTS *draw_commands =
             (D3D12_DRAW_INDEXED_ARGUMENTS *)gfxBufferGetData(gfx_, draw_command_buffer);
 
-        for (uint32_t i = 0; i < instance_count; ++i)
+        // The draw commands were already built during prepare()
+        memcpy(draw_commands, draw_commands_.data(), instance_count * sizeof(D3D12_DRAW_INDEXED_ARGUMENTS));
+
+        GfxBuffer cull_bounds_buffer = {};
+        if (options.visibility_buffer_gpu_culling && instance_count > 0)
         {
-            uint32_t const  instance_index = capsaicin.getInstanceIdData()[i];
-            Instance const &instance       = capsaicin.getInstanceData()[instance_index];
-            Mesh const     &mesh           = capsaicin.getMeshData()[instance.mesh_index];
-
-            draw_commands[i].IndexCountPerInstance = mesh.index_count;
-            draw_commands[i].InstanceCount         = 1;
-            draw_commands[i].StartIndexLocation    = mesh.index_offset_idx;
-            draw_commands[i].BaseVertexLocation    = mesh.vertex_offset_idx;
-            draw_commands[i].StartInstanceLocation = i; // <- drawID
+            TimedSection const timed_section(*this, "CullInstances");
+
+            // Upload this frame's world-space instance bounds (built during prepare())
+            cull_bounds_buffer = capsaicin.allocateConstantBuffer<float4>(2 * instance_count);
+            memcpy(gfxBufferGetData(gfx_, cull_bounds_buffer), cull_bounds_.data(),
+                instance_count * sizeof(CullBounds));
+
+            // (Re)create the depth pyramid and compaction buffers on first use or resize
+            uint32_t const buffer_width  = capsaicin.getWidth();
+            uint32_t const buffer_height = capsaicin.getHeight();
+            if (!depth_pyramid_ || depth_pyramid_.getWidth() != buffer_width
+                || depth_pyramid_.getHeight() != buffer_height)
+            {
+                gfxDestroyTexture(gfx_, depth_pyramid_);
+                depth_pyramid_ = gfxCreateTexture2D(gfx_, buffer_width, buffer_height,
+                    DXGI_FORMAT_R32_FLOAT, gfxCalculateMipCount(buffer_width, buffer_height));
+                depth_pyramid_.setName("Capsaicin_DepthPyramid");
+            }
+            if (!culled_draw_command_buffer_
+                || culled_draw_command_buffer_.getCount() < instance_count)
+            {
+                gfxDestroyBuffer(gfx_, culled_draw_command_buffer_);
+                culled_draw_command_buffer_ =
+                    gfxCreateBuffer<D3D12_DRAW_INDEXED_ARGUMENTS>(gfx_, instance_count);
+                culled_draw_command_buffer_.setName("Capsaicin_CulledDrawCommandBuffer");
+            }
+            if (!culled_draw_count_buffer_)
+            {
+                culled_draw_count_buffer_ = gfxCreateBuffer<uint32_t>(gfx_, 1);
+                culled_draw_count_buffer_.setName("Capsaicin_CulledDrawCountBuffer");
+            }
+
+            // Build the max-filtered pyramid over the previous frame's depth
+            uint32_t const mip_count = gfxCalculateMipCount(buffer_width, buffer_height);
+            gfxProgramSetParameter(gfx_, gpu_culling_program_, "g_DepthPyramidSize",
+                uint2(buffer_width, buffer_height));
+            gfxProgramSetParameter(gfx_, gpu_culling_program_, "g_SourceDepth",
+                capsaicin.getAOVBuffer("PrevVisibilityDepth"));
+            gfxProgramSetParameter(gfx_, gpu_culling_program_, "g_DepthPyramidOut", depth_pyramid_, 0);
+
+            uint32_t const *num_threads = gfxKernelGetNumThreads(gfx_, copy_depth_kernel_);
+            gfxCommandBindKernel(gfx_, copy_depth_kernel_);
+            gfxCommandDispatch(gfx_, (buffer_width + num_threads[0] - 1) / num_threads[0],
+                (buffer_height + num_threads[1] - 1) / num_threads[1], 1);
+
+            num_threads = gfxKernelGetNumThreads(gfx_, downsample_max_kernel_);
+            gfxCommandBindKernel(gfx_, downsample_max_kernel_);
+            for (uint32_t mip = 1; mip < mip_count; ++mip)
+            {
+                uint2 const src_size(
+                    GFX_MAX(buffer_width >> (mip - 1), 1u), GFX_MAX(buffer_height >> (mip - 1), 1u));
+                uint2 const dst_size(GFX_MAX(buffer_width >> mip, 1u), GFX_MAX(buffer_height >> mip, 1u));
+
+                gfxProgramSetParameter(gfx_, gpu_culling_program_, "g_SrcMipSize", src_size);
+                gfxProgramSetParameter(gfx_, gpu_culling_program_, "g_DstMipSize", dst_size);
+                gfxProgramSetParameter(
+                    gfx_, gpu_culling_program_, "g_DepthPyramidIn", depth_pyramid_, mip - 1);
+                gfxProgramSetParameter(gfx_, gpu_culling_program_, "g_DepthPyramidOut", depth_pyramid_, mip);
+
+                gfxCommandDispatch(gfx_, (dst_size.x + num_threads[0] - 1) / num_threads[0],
+                    (dst_size.y + num_threads[1] - 1) / num_threads[1], 1);
+            }
+
+            // Cull and compact the surviving draw arguments. The compacted buffer is cleared first so
+            // the fixed-count multi-draw below sees zero-index draws past the survivor count
+            gfxCommandClearBuffer(gfx_, culled_draw_command_buffer_, 0);
+            gfxCommandClearBuffer(gfx_, culled_draw_count_buffer_, 0);
+
+            gfxProgramSetParameter(gfx_, gpu_culling_program_, "g_InstanceCount", instance_count);
+            gfxProgramSetParameter(gfx_, gpu_culling_program_, "g_ViewProjection", camera.view_projection);
+            gfxProgramSetParameter(
+                gfx_, gpu_culling_program_, "g_PrevViewProjection", camera.view_projection_prev);
+            gfxProgramSetParameter(gfx_, gpu_culling_program_, "g_DepthPyramidMips", mip_count);
+            gfxProgramSetParameter(gfx_, gpu_culling_program_, "g_DepthPyramid", depth_pyramid_);
+            gfxProgramSetParameter(gfx_, gpu_culling_program_, "g_CullBounds", cull_bounds_buffer);
+            gfxProgramSetParameter(gfx_, gpu_culling_program_, "g_DrawCommands", draw_command_buffer);
+            gfxProgramSetParameter(
+                gfx_, gpu_culling_program_, "g_CulledDrawCommands", culled_draw_command_buffer_);
+            gfxProgramSetParameter(
+                gfx_, gpu_culling_program_, "g_CulledDrawCount", culled_draw_count_buffer_);
+
+            num_threads = gfxKernelGetNumThreads(gfx_, cull_instances_kernel_);
+            gfxCommandBindKernel(gfx_, cull_instances_kernel_);
+            gfxCommandDispatch(gfx_, (instance_count + num_threads[0] - 1) / num_threads[0], 1, 1);
         }
 
         gfxProgramSetParameter(gfx_, visibility_buffer_program_, "g_Eye", capsaicin.getCamera().eye);
@@ -189,10 +317,21 @@ void VisibilityBuffer::render(CapsaicinInternal &capsaicin) noexcept
         gfxProgramSetParameter(
             gfx_, visibility_buffer_program_, "g_TextureSampler", capsaicin.getAnisotropicSampler());
 
+        // Constrain rasterisation to the internal render resolution region of the AOVs (differs from
+        // the target size when the TAA temporal upscaler is active)
+        gfxCommandSetViewport(
+            gfx_, 0.0f, 0.0f, (float)capsaicin.getWidth(), (float)capsaicin.getHeight());
+
         gfxCommandBindKernel(gfx_, visibility_buffer_kernel_);
-        gfxCommandMultiDrawIndexedIndirect(gfx_, draw_command_buffer, instance_count);
+        gfxCommandMultiDrawIndexedIndirect(gfx_,
+            options.visibility_buffer_gpu_culling && instance_count > 0 ? culled_draw_command_buffer_
+                                                                        : draw_command_buffer,
+            instance_count);
+
+        gfxCommandSetViewport(gfx_); // restore the automatic full-target viewport
 
         gfxDestroyBuffer(gfx_, draw_command_buffer);
+        gfxDestroyBuffer(gfx_, cull_bounds_buffer);
         gfxCommandCopyTexture(
             gfx_, capsaicin.getAOVBuffer("VisibilityDepth"), capsaicin.getAOVBuffer("Depth"));
     }
@@ -210,6 +349,8 @@ void VisibilityBuffer::render(CapsaicinInternal &capsaicin) noexcept
         gfxProgramSetParameter(gfx_, visibility_buffer_program_, "g_FrameIndex", capsaicin.getFrameIndex());
         gfxProgramSetParameter(
             gfx_, visibility_buffer_program_, "g_InstanceBuffer", capsaicin.getInstanceBuffer());
+        gfxProgramSetParameter(gfx_, visibility_buffer_program_, "g_InstancePackedBuffer",
+            capsaicin.getInstancePackedBuffer());
         gfxProgramSetParameter(gfx_, visibility_buffer_program_, "g_MeshBuffer", capsaicin.getMeshBuffer());
         gfxProgramSetParameter(
             gfx_, visibility_buffer_program_, "g_TransformBuffer", capsaicin.getTransformBuffer());
@@ -454,6 +595,18 @@ void VisibilityBuffer::terminate() noexcept
     gfxDestroySbt(gfx_, visibility_buffer_sbt_);
     visibility_buffer_sbt_ = {};
 
+    gfxDestroyKernel(gfx_, copy_depth_kernel_);
+    gfxDestroyKernel(gfx_, downsample_max_kernel_);
+    gfxDestroyKernel(gfx_, cull_instances_kernel_);
+    gfxDestroyProgram(gfx_, gpu_culling_program_);
+    gpu_culling_program_ = {};
+    gfxDestroyTexture(gfx_, depth_pyramid_);
+    depth_pyramid_ = {};
+    gfxDestroyBuffer(gfx_, culled_draw_command_buffer_);
+    culled_draw_command_buffer_ = {};
+    gfxDestroyBuffer(gfx_, culled_draw_count_buffer_);
+    culled_draw_count_buffer_ = {};
+
     gfxDestroyKernel(gfx_, debug_velocities_kernel_);
     gfxDestroyProgram(gfx_, debug_velocities_program_);
     debug_velocities_program_ = {};
@@ -503,6 +656,16 @@ bool VisibilityBuffer::initKernel(CapsaicinInternal const &capsaicin) noexcept
             gfx_, "render_techniques/visibility_buffer/visibility_buffer", capsaicin.getShaderPath());
         visibility_buffer_kernel_ = gfxCreateGraphicsKernel(gfx_, visibility_buffer_program_,
             visibility_buffer_draw_state, nullptr, defines.data(), (uint32_t)defines.size());
+
+        // Initialise the GPU culling prepass kernels used by the raster path
+        if (!gpu_culling_program_)
+        {
+            gpu_culling_program_ = gfxCreateProgram(
+                gfx_, "render_techniques/visibility_buffer/gpu_culling", capsaicin.getShaderPath());
+            copy_depth_kernel_     = gfxCreateComputeKernel(gfx_, gpu_culling_program_, "CopyDepth");
+            downsample_max_kernel_ = gfxCreateComputeKernel(gfx_, gpu_culling_program_, "DownsampleMax");
+            cull_instances_kernel_ = gfxCreateComputeKernel(gfx_, gpu_culling_program_, "CullInstances");
+        }
     }
     else
     {
@@ -43,6 +43,8 @@ public:
         bool visibility_buffer_use_rt_dxr10 =
             false; /**< Use dxr 1.0 ray-tracing pipelines instead of inline rt
                    (only effects if visibility_buffer_use_rt is enabled) */
+        bool visibility_buffer_gpu_culling = true; /**< Frustum and HiZ occlusion cull instances on the
+                   GPU before rasterisation (only effects if visibility_buffer_use_rt is disabled) */
     };
 
     /**
@@ -70,6 +72,13 @@ public:
      */
     DebugViewList getDebugViews() const noexcept override;
 
+    /**
+     * Gets a list of the shader directories (relative to the shader root) that hold the shader
+     * source compiled by the current render technique.
+     * @return A list of all shader directories.
+     */
+    ShaderDirectoryList getShaderDirectories() const noexcept override;
+
     /**
      * Initialise any internal data or state.
      * @note This is automatically called by the framework after construction and should be used to create
@@ -79,6 +88,13 @@ public:
      */
     bool init(CapsaicinInternal const &capsaicin) noexcept override;
 
+    /**
+     * Perform CPU-side preparation for the frame ahead of any command recording.
+     * Builds the per-instance indirect draw commands for the raster path on a worker thread.
+     * @param capsaicin The current capsaicin context.
+     */
+    void prepare(CapsaicinInternal const &capsaicin) noexcept override;
+
     /**
      * Perform render operations.
      * @param [in,out] capsaicin The current capsaicin context.
@@ -98,7 +114,25 @@ private:
      */
     bool initKernel(CapsaicinInternal const &capsaicin) noexcept;
 
+    /** A world-space instance AABB laid out as the (min, max) float4 pair consumed by the culling
+     * kernel. */
+    struct CullBounds
+    {
+        float min[4];
+        float max[4];
+    };
+
     RenderOptions options;
+    std::vector<D3D12_DRAW_INDEXED_ARGUMENTS>
+                            draw_commands_; /**< Per-instance indirect draw commands built during prepare() */
+    std::vector<CullBounds> cull_bounds_;   /**< Per-instance world-space AABBs built during prepare() */
+    GfxProgram    gpu_culling_program_;
+    GfxKernel     copy_depth_kernel_;     /**< Copies previous frame depth into the pyramid top mip */
+    GfxKernel     downsample_max_kernel_; /**< Max-filters the depth pyramid mip chain */
+    GfxKernel     cull_instances_kernel_; /**< Culls instances and compacts surviving draw arguments */
+    GfxTexture    depth_pyramid_;         /**< Max-filtered pyramid of the previous frame's depth */
+    GfxBuffer     culled_draw_command_buffer_; /**< Compacted indirect draw arguments */
+    GfxBuffer     culled_draw_count_buffer_;   /**< Number of instances surviving the cull */
     GfxKernel     disocclusion_mask_kernel_;
     GfxProgram    disocclusion_mask_program_;
     GfxKernel     visibility_buffer_kernel_;
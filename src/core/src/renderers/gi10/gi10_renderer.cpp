@@ -59,9 +59,21 @@ public:
         render_techniques.emplace_back(std::make_unique<Atmosphere>());
         render_techniques.emplace_back(std::make_unique<Skybox>());
         render_techniques.emplace_back(std::make_unique<UpdateHistory>());
-        render_techniques.emplace_back(std::make_unique<TAA>());
+        if (auto upscaler = setupUpscaler())
+        {
+            render_techniques.emplace_back(std::move(upscaler));
+        }
         render_techniques.emplace_back(std::make_unique<ToneMapping>());
         return render_techniques;
     }
+
+    /**
+     * Creates the technique filling the upscaler slot.
+     * @return The built-in TAA temporal upscaler (replace to drop in a third-party upscaler).
+     */
+    std::unique_ptr<RenderTechnique> setupUpscaler() noexcept override
+    {
+        return std::make_unique<TAA>();
+    }
 };
 } // namespace Capsaicin
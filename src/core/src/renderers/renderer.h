@@ -45,6 +45,20 @@ public:
      */
     virtual std::vector<std::unique_ptr<RenderTechnique>> setupRenderTechniques(
         RenderOptionList const &renderOptions) noexcept = 0;
+
+    /**
+     * Creates the technique filling the renderer's upscaler slot.
+     * The upscaler is the boundary between the internal render resolution and the display
+     * resolution: every technique ahead of it in the list runs at
+     * CapsaicinInternal::getWidth()/getHeight() while everything after it runs at
+     * getDisplayWidth()/getDisplayHeight(). A technique in this slot can rely on the standard AOV
+     * contracts: "Velocity" holds UV-space motion toward the previous frame and "VisibilityDepth"
+     * the post-opaque scene depth, both at the internal render resolution. Third-party temporal
+     * upscalers (e.g. FSR2-class) can be dropped in by overriding this to return their
+     * RenderTechnique wrapper without modifying the individual techniques.
+     * @return The upscaler technique (null for renderers that do not upscale).
+     */
+    virtual std::unique_ptr<RenderTechnique> setupUpscaler() noexcept { return nullptr; }
 };
 
 class RendererFactory : public Factory<Renderer>
@@ -0,0 +1,200 @@
+/**********************************************************************
+Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+********************************************************************/
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <string>
+#include <vector>
+
+namespace Capsaicin
+{
+/**
+ * Per-frame linear CPU allocator.
+ * Allocations are served by bumping an offset inside a single block and are all released at once
+ * when @reset is called at the start of the next frame, so frame-local scratch containers pay
+ * neither per-allocation heap traffic nor per-element frees and stay hot in cache. If a frame
+ * outgrows the block the remainder falls back to the heap and the block is enlarged at the next
+ * reset. Use through the @FrameVector / @FrameString aliases; anything allocated from the arena
+ * must not outlive the frame that allocated it.
+ */
+class FrameArena
+{
+public:
+    /**
+     * Construct an arena with an initial block size.
+     * @param capacityBytes (Optional) Initial size of the linear block in bytes.
+     */
+    explicit FrameArena(size_t const capacityBytes = 1024ULL * 1024ULL) noexcept
+        : block(std::make_unique<std::byte[]>(capacityBytes))
+        , capacity(capacityBytes)
+    {}
+
+    FrameArena(FrameArena const &) = delete;
+
+    FrameArena &operator=(FrameArena const &) = delete;
+
+    /**
+     * Allocate a block of memory valid until the next @reset.
+     * @param size      Number of bytes to allocate.
+     * @param alignment Required alignment of the allocation (must be a power of two).
+     * @return Pointer to the allocation, nullptr if an exhausted arena also failed to heap allocate.
+     */
+    void *allocate(size_t const size, size_t const alignment) noexcept
+    {
+        uintptr_t const base    = reinterpret_cast<uintptr_t>(block.get());
+        uintptr_t const aligned = (base + offset + (alignment - 1)) & ~(uintptr_t)(alignment - 1);
+        if ((aligned - base) + size <= capacity)
+        {
+            offset = (aligned - base) + size;
+            return reinterpret_cast<void *>(aligned);
+        }
+        // Arena exhausted; fall back to the heap and grow the block at the next reset
+        overflow += size;
+        return ::operator new(size, std::align_val_t(alignment), std::nothrow);
+    }
+
+    /**
+     * Release a block returned by @allocate.
+     * Arena memory is a no-op (it is reclaimed wholesale by @reset), only heap fallbacks are freed.
+     * @param allocation The allocation to release.
+     * @param alignment  The alignment the allocation was made with.
+     */
+    void deallocate(void *const allocation, size_t const alignment) noexcept
+    {
+        uintptr_t const address = reinterpret_cast<uintptr_t>(allocation);
+        uintptr_t const base    = reinterpret_cast<uintptr_t>(block.get());
+        if (address < base || address >= base + capacity)
+        {
+            ::operator delete(allocation, std::align_val_t(alignment));
+        }
+    }
+
+    /**
+     * Release every allocation made since the previous reset.
+     * @note Called once per frame by the framework; any arena-backed container still alive from the
+     *  previous frame is invalidated. Grows the block if the previous frame overflowed to the heap.
+     */
+    void reset() noexcept
+    {
+        peak = std::max(peak, offset + overflow);
+        if (overflow > 0)
+        {
+            size_t newCapacity = std::max<size_t>(capacity, 1);
+            while (newCapacity < peak)
+            {
+                newCapacity *= 2;
+            }
+            block    = std::make_unique<std::byte[]>(newCapacity);
+            capacity = newCapacity;
+        }
+        offset   = 0;
+        overflow = 0;
+    }
+
+    /**
+     * Get the size of the linear block.
+     * @return The block size in bytes.
+     */
+    size_t getCapacity() const noexcept { return capacity; }
+
+    /**
+     * Get the largest number of bytes any frame has allocated so far.
+     * @return The high water mark in bytes.
+     */
+    size_t getPeakUsage() const noexcept { return std::max(peak, offset + overflow); }
+
+private:
+    std::unique_ptr<std::byte[]> block;        /**< The linear block allocations are served from */
+    size_t                       capacity = 0; /**< Size of the linear block in bytes */
+    size_t                       offset   = 0; /**< Bytes of the block consumed this frame */
+    size_t                       overflow = 0; /**< Bytes served by the heap fallback this frame */
+    size_t                       peak     = 0; /**< Largest per-frame usage seen so far */
+};
+
+/**
+ * Standard allocator adaptor over @FrameArena for use with STL containers.
+ * @tparam T Generic type parameter of objects being allocated.
+ */
+template<typename T>
+class FrameAllocator
+{
+public:
+    using value_type = T;
+
+    /**
+     * Construct an allocator drawing from a given arena.
+     * @param arenaIn The arena to allocate from.
+     */
+    FrameAllocator(FrameArena &arenaIn) noexcept
+        : arena(&arenaIn)
+    {}
+
+    /** Converting constructor required for container internal rebinding. */
+    template<typename U>
+    FrameAllocator(FrameAllocator<U> const &other) noexcept
+        : arena(other.arena)
+    {}
+
+    /**
+     * Allocate storage for a number of objects.
+     * @param count Number of objects of type T to allocate for.
+     * @return Pointer to the uninitialised storage.
+     */
+    T *allocate(size_t const count)
+    {
+        void *const allocation = arena->allocate(count * sizeof(T), alignof(T));
+        if (allocation == nullptr)
+        {
+            throw std::bad_alloc();
+        }
+        return static_cast<T *>(allocation);
+    }
+
+    /**
+     * Release storage previously returned by @allocate.
+     * @param allocation The storage to release.
+     */
+    void deallocate(T *const allocation, size_t /*count*/) noexcept
+    {
+        arena->deallocate(allocation, alignof(T));
+    }
+
+    template<typename U>
+    bool operator==(FrameAllocator<U> const &other) const noexcept
+    {
+        return arena == other.arena;
+    }
+
+    FrameArena *arena; /**< The arena allocations are drawn from */
+};
+
+/** Frame-local vector released wholesale at the next arena reset. */
+template<typename T>
+using FrameVector = std::vector<T, FrameAllocator<T>>;
+
+/** Frame-local string released wholesale at the next arena reset. */
+using FrameString = std::basic_string<char, std::char_traits<char>, FrameAllocator<char>>;
+} // namespace Capsaicin
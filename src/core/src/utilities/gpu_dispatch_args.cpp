@@ -0,0 +1,141 @@
+/**********************************************************************
+Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+********************************************************************/
+#include "gpu_dispatch_args.h"
+
+#include "capsaicin_internal.h"
+
+namespace Capsaicin
+{
+GPUDispatchArgs::~GPUDispatchArgs() noexcept
+{
+    terminate();
+}
+
+bool GPUDispatchArgs::initialise(GfxContext gfxIn, std::string_view const &shaderPath) noexcept
+{
+    gfx = gfxIn;
+
+    if (!argsProgram)
+    {
+        argsProgram    = gfxCreateProgram(gfx, "utilities/gpu_dispatch_args", shaderPath.data());
+        generateKernel = gfxCreateComputeKernel(gfx, argsProgram, "GenerateDispatches");
+    }
+
+    return !!generateKernel;
+}
+
+bool GPUDispatchArgs::initialise(CapsaicinInternal const &capsaicin) noexcept
+{
+    return initialise(capsaicin.getGfx(), capsaicin.getShaderPath());
+}
+
+void GPUDispatchArgs::reset() noexcept
+{
+    conversions.clear();
+}
+
+uint32_t GPUDispatchArgs::registerDispatch(GfxBuffer const &countBuffer, uint32_t groupSize) noexcept
+{
+    uint32_t const slot = static_cast<uint32_t>(conversions.size());
+    conversions.push_back({countBuffer, groupSize});
+    return slot;
+}
+
+GfxBuffer const &GPUDispatchArgs::getDispatchBuffer(uint32_t slot) const noexcept
+{
+    GFX_ASSERT(slot < argsViews.size());
+    return argsViews[slot];
+}
+
+void GPUDispatchArgs::generate() noexcept
+{
+    uint32_t const numConversions = static_cast<uint32_t>(conversions.size());
+    if (numConversions == 0)
+    {
+        return;
+    }
+
+    if (numConversions > argsViews.size())
+    {
+        // Grow the shared arguments array and recreate the per-slot views into it
+        for (GfxBuffer const &view : argsViews)
+        {
+            gfxDestroyBuffer(gfx, view);
+        }
+        argsViews.clear();
+        gfxDestroyBuffer(gfx, countsBuffer);
+        gfxDestroyBuffer(gfx, argsBuffer);
+        countsBuffer = gfxCreateBuffer<uint>(gfx, numConversions);
+        countsBuffer.setName("Capsaicin_DispatchArgs_CountsBuffer");
+        argsBuffer = gfxCreateBuffer<DispatchCommand>(gfx, numConversions);
+        argsBuffer.setName("Capsaicin_DispatchArgs_ArgsBuffer");
+        argsViews.reserve(numConversions);
+        for (uint32_t slot = 0; slot < numConversions; ++slot)
+        {
+            argsViews.push_back(gfxCreateBufferRange<DispatchCommand>(gfx, argsBuffer, slot, 1));
+        }
+    }
+
+    // Pack the registered counts and group sizes so a single kernel can convert all of them
+    std::vector<uint> groupSizes;
+    groupSizes.reserve(numConversions);
+    for (uint32_t slot = 0; slot < numConversions; ++slot)
+    {
+        gfxCommandCopyBuffer(
+            gfx, countsBuffer, slot * sizeof(uint), conversions[slot].countBuffer, 0, sizeof(uint));
+        groupSizes.push_back(conversions[slot].groupSize);
+    }
+    gfxDestroyBuffer(gfx, groupSizesBuffer);
+    groupSizesBuffer = gfxCreateBuffer<uint>(gfx, numConversions, groupSizes.data());
+    groupSizesBuffer.setName("Capsaicin_DispatchArgs_GroupSizesBuffer");
+
+    gfxProgramSetParameter(gfx, argsProgram, "g_NumConversions", numConversions);
+    gfxProgramSetParameter(gfx, argsProgram, "g_CountsBuffer", countsBuffer);
+    gfxProgramSetParameter(gfx, argsProgram, "g_GroupSizesBuffer", groupSizesBuffer);
+    gfxProgramSetParameter(gfx, argsProgram, "g_ArgsBuffer", argsBuffer);
+
+    uint32_t const *numThreads = gfxKernelGetNumThreads(gfx, generateKernel);
+    gfxCommandBindKernel(gfx, generateKernel);
+    gfxCommandDispatch(gfx, (numConversions + numThreads[0] - 1) / numThreads[0], 1, 1);
+}
+
+void GPUDispatchArgs::terminate() noexcept
+{
+    conversions.clear();
+    for (GfxBuffer const &view : argsViews)
+    {
+        gfxDestroyBuffer(gfx, view);
+    }
+    argsViews.clear();
+    gfxDestroyBuffer(gfx, countsBuffer);
+    countsBuffer = {};
+    gfxDestroyBuffer(gfx, groupSizesBuffer);
+    groupSizesBuffer = {};
+    gfxDestroyBuffer(gfx, argsBuffer);
+    argsBuffer = {};
+
+    gfxDestroyProgram(gfx, argsProgram);
+    argsProgram = {};
+    gfxDestroyKernel(gfx, generateKernel);
+    generateKernel = {};
+}
+} // namespace Capsaicin
@@ -0,0 +1,121 @@
+/**********************************************************************
+Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+********************************************************************/
+#pragma once
+
+#include "gpu_shared.h"
+
+#include <gfx.h>
+#include <string_view>
+#include <vector>
+
+namespace Capsaicin
+{
+class CapsaicinInternal;
+
+/**
+ * A helper utility class that batches the conversion of GPU work counts into indirect dispatch
+ * arguments.
+ * Techniques that size their dispatches from GPU generated counts typically launch a single-thread
+ * kernel per conversion, paying more in launch and barrier overhead than in actual work. This class
+ * instead gathers any number of count->arguments conversions and performs them with a single kernel
+ * writing into a shared arguments array, with each conversion exposed as an individual buffer view
+ * that can be passed directly to @gfxCommandDispatchIndirect().
+ */
+class GPUDispatchArgs
+{
+public:
+    /** Defaulted constructor. */
+    GPUDispatchArgs() noexcept = default;
+
+    /** Destructor. */
+    ~GPUDispatchArgs() noexcept;
+
+    GPUDispatchArgs(GPUDispatchArgs const &) = delete;
+
+    GPUDispatchArgs &operator=(GPUDispatchArgs const &) = delete;
+
+    /**
+     * Initialise the internal data based on current configuration.
+     * @param gfx        Active gfx context.
+     * @param shaderPath Path to shader files based on current working directory.
+     * @return True, if any initialisation/changes succeeded.
+     */
+    bool initialise(GfxContext gfx, std::string_view const &shaderPath) noexcept;
+
+    /**
+     * Initialise the internal data based on current configuration.
+     * @param capsaicin Current framework context.
+     * @return True, if any initialisation/changes succeeded.
+     */
+    bool initialise(CapsaicinInternal const &capsaicin) noexcept;
+
+    /** Remove all currently registered conversions and invalidate their slots. */
+    void reset() noexcept;
+
+    /**
+     * Register a new count->arguments conversion.
+     * The conversion is only performed once @generate() is called, at which point the count buffer
+     * must already contain the final value for the frame.
+     * @param countBuffer The buffer containing the number of work items (uint at offset zero).
+     * @param groupSize   The thread group size of the kernel that will consume the arguments.
+     * @return The slot index used to retrieve the generated arguments (see @getDispatchBuffer()).
+     */
+    uint32_t registerDispatch(GfxBuffer const &countBuffer, uint32_t groupSize) noexcept;
+
+    /**
+     * Get the dispatch arguments buffer associated with a previously registered conversion.
+     * The returned view aliases the shared arguments array and is valid to pass to
+     * @gfxCommandDispatchIndirect() once @generate() has been issued.
+     * @param slot The slot index returned by @registerDispatch().
+     * @return The buffer containing the generated dispatch arguments.
+     */
+    [[nodiscard]] GfxBuffer const &getDispatchBuffer(uint32_t slot) const noexcept;
+
+    /**
+     * Generate the dispatch arguments for all registered conversions using a single dispatch.
+     * Must be called after the count buffers have received their final values and before any of the
+     * consuming indirect dispatches are issued.
+     */
+    void generate() noexcept;
+
+private:
+    /** Terminates and cleans up this object. */
+    void terminate() noexcept;
+
+    /** Internal description of a registered count->arguments conversion. */
+    struct Conversion
+    {
+        GfxBuffer countBuffer; /**< The buffer containing the number of work items. */
+        uint32_t  groupSize;   /**< The thread group size of the consuming kernel. */
+    };
+
+    GfxContext gfx;
+
+    std::vector<Conversion> conversions;     /**< The conversions registered since the last @reset(). */
+    std::vector<GfxBuffer>  argsViews;       /**< Per-slot views into @argsBuffer. */
+    GfxBuffer               countsBuffer;    /**< Packed copy of all registered counts. */
+    GfxBuffer               groupSizesBuffer; /**< The group size of each registered conversion. */
+    GfxBuffer               argsBuffer;      /**< The shared array of generated dispatch arguments. */
+    GfxProgram              argsProgram;
+    GfxKernel               generateKernel;
+};
+} // namespace Capsaicin
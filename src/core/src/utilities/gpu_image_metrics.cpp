@@ -26,15 +26,64 @@ THE SOFTWARE.
 
 namespace Capsaicin
 {
+namespace
+{
+/** Builds the shader defines required for a given image type and metric. */
+std::vector<char const *> buildMetricDefines(
+    GPUImageMetrics::Type type, GPUImageMetrics::Operation operation) noexcept
+{
+    std::vector<char const *> baseDefines;
+    if (type == GPUImageMetrics::Type::HDR_RGB || type == GPUImageMetrics::Type::SDR_RGB
+        || type == GPUImageMetrics::Type::SDR_SRGB)
+    {
+        baseDefines.push_back("INPUT_MULTICHANNEL");
+    }
+    if (type == GPUImageMetrics::Type::HDR_RGB || type == GPUImageMetrics::Type::HDR)
+    {
+        baseDefines.push_back("INPUT_HDR");
+    }
+    if (type != GPUImageMetrics::Type::SDR_NONLINEAR && type != GPUImageMetrics::Type::SDR_SRGB)
+    {
+        baseDefines.push_back("INPUT_LINEAR");
+    }
+    if (operation == GPUImageMetrics::Operation::PSNR)
+    {
+        baseDefines.push_back("CALCULATE_PSNR");
+    }
+    else if (operation == GPUImageMetrics::Operation::MSE)
+    {
+        baseDefines.push_back("CALCULATE_MSE");
+    }
+    else if (operation == GPUImageMetrics::Operation::RMSE)
+    {
+        baseDefines.push_back("CALCULATE_RMSE");
+    }
+    else if (operation == GPUImageMetrics::Operation::RMAE)
+    {
+        baseDefines.push_back("CALCULATE_RMAE");
+    }
+    else if (operation == GPUImageMetrics::Operation::SMAPE)
+    {
+        baseDefines.push_back("CALCULATE_SMAPE");
+    }
+    else if (operation == GPUImageMetrics::Operation::SSIM)
+    {
+        baseDefines.push_back("CALCULATE_SSIM");
+    }
+    return baseDefines;
+}
+} // unnamed namespace
+
 GPUImageMetrics::~GPUImageMetrics() noexcept
 {
     terminate();
 }
 
 bool GPUImageMetrics::initialise(
-    GfxContext gfxIn, std::string_view const &shaderPath, Type type, Operation operation) noexcept
+    GfxContext gfxIn, std::string_view const &shaderPathIn, Type type, Operation operation) noexcept
 {
-    gfx = gfxIn;
+    gfx        = gfxIn;
+    shaderPath = shaderPathIn; // stored so batched jobs can create kernels on demand
 
     if (type != currentType || operation != currentOperation)
     {
@@ -95,43 +144,7 @@ bool GPUImageMetrics::initialise(
         gfxDestroyProgram(gfx, metricsProgram);
         gfxDestroyKernel(gfx, metricsKernel);
         metricsProgram = gfxCreateProgram(gfx, "utilities/gpu_image_metrics", shaderPath.data());
-        std::vector<char const *> baseDefines;
-        if (currentType == Type::HDR_RGB || currentType == Type::SDR_RGB || currentType == Type::SDR_SRGB)
-        {
-            baseDefines.push_back("INPUT_MULTICHANNEL");
-        }
-        if (currentType == Type::HDR_RGB || currentType == Type::HDR)
-        {
-            baseDefines.push_back("INPUT_HDR");
-        }
-        if (currentType != Type::SDR_NONLINEAR && currentType != Type::SDR_SRGB)
-        {
-            baseDefines.push_back("INPUT_LINEAR");
-        }
-        if (currentOperation == Operation::PSNR)
-        {
-            baseDefines.push_back("CALCULATE_PSNR");
-        }
-        else if (currentOperation == Operation::MSE)
-        {
-            baseDefines.push_back("CALCULATE_MSE");
-        }
-        else if (currentOperation == Operation::RMSE)
-        {
-            baseDefines.push_back("CALCULATE_RMSE");
-        }
-        else if (currentOperation == Operation::RMAE)
-        {
-            baseDefines.push_back("CALCULATE_RMAE");
-        }
-        else if (currentOperation == Operation::SMAPE)
-        {
-            baseDefines.push_back("CALCULATE_SMAPE");
-        }
-        else if (currentOperation == Operation::SSIM)
-        {
-            baseDefines.push_back("CALCULATE_SSIM");
-        }
+        std::vector<char const *> const baseDefines = buildMetricDefines(currentType, currentOperation);
         metricsKernel = gfxCreateComputeKernel(gfx, metricsProgram, "ComputeMetric", baseDefines.data(),
             static_cast<uint32_t>(baseDefines.size()));
     }
@@ -183,6 +196,71 @@ bool GPUImageMetrics::compareAsync(GfxTexture const &sourceImage, GfxTexture con
     return true;
 }
 
+bool GPUImageMetrics::queueCompare(GfxTexture const &sourceImage, GfxTexture const &referenceImage,
+    Type type, Operation operation) noexcept
+{
+    if ((sourceImage.getWidth() != referenceImage.getWidth() && sourceImage.getWidth() != 0)
+        || (sourceImage.getHeight() != referenceImage.getHeight() && sourceImage.getHeight() != 0))
+    {
+        return false;
+    }
+
+    queuedJobs.push_back({sourceImage, referenceImage, type, operation});
+    return true;
+}
+
+bool GPUImageMetrics::executeBatch(std::vector<float> &results) noexcept
+{
+    results.clear();
+    if (queuedJobs.empty())
+    {
+        return true;
+    }
+
+    uint32_t const jobCount = static_cast<uint32_t>(queuedJobs.size());
+
+    if (batchResultsBuffer.getCount() < jobCount)
+    {
+        gfxDestroyBuffer(gfx, batchResultsBuffer);
+        batchResultsBuffer = gfxCreateBuffer<float>(gfx, jobCount);
+        batchResultsBuffer.setName("GPUImageMetrics_BatchResultsBuffer");
+
+        gfxDestroyBuffer(gfx, batchReadbackBuffer);
+        batchReadbackBuffer = gfxCreateBuffer<float>(gfx, jobCount, nullptr, kGfxCpuAccess_Read);
+        batchReadbackBuffer.setName("GPUImageMetrics_BatchReadbackBuffer");
+    }
+
+    // Record every job into the same command submission, packing each reduced metric into the
+    // shared results buffer
+    for (uint32_t jobIndex = 0; jobIndex < jobCount; ++jobIndex)
+    {
+        Job const &job    = queuedJobs[jobIndex];
+        GfxKernel  kernel = getMetricsKernel(job.type, job.operation);
+        if (!compareInternal(job.sourceImage, job.referenceImage, kernel))
+        {
+            queuedJobs.clear();
+            return false;
+        }
+        gfxCommandCopyBuffer(
+            gfx, batchResultsBuffer, jobIndex * sizeof(float), metricBuffer, 0, sizeof(float));
+    }
+    gfxCommandCopyBuffer(gfx, batchReadbackBuffer, batchResultsBuffer);
+
+    // A single synchronisation covers the whole batch
+    gfxFinish(gfx);
+
+    float const *values = gfxBufferGetData<float>(gfx, batchReadbackBuffer);
+    results.reserve(jobCount);
+    for (uint32_t jobIndex = 0; jobIndex < jobCount; ++jobIndex)
+    {
+        Job const     &job          = queuedJobs[jobIndex];
+        uint32_t const totalSamples = job.referenceImage.getWidth() * job.referenceImage.getHeight();
+        results.push_back(convertMetric(values[jobIndex], totalSamples, job.type, job.operation));
+    }
+    queuedJobs.clear();
+    return true;
+}
+
 float GPUImageMetrics::getMetricValue() const noexcept
 {
     return currentValue;
@@ -203,15 +281,56 @@ void GPUImageMetrics::terminate() noexcept
         i.second = {};
     }
     metricBufferTemp.clear();
+    gfxDestroyBuffer(gfx, batchResultsBuffer);
+    batchResultsBuffer = {};
+    gfxDestroyBuffer(gfx, batchReadbackBuffer);
+    batchReadbackBuffer = {};
+    queuedJobs.clear();
 
     gfxDestroyProgram(gfx, metricsProgram);
     metricsProgram = {};
     gfxDestroyKernel(gfx, metricsKernel);
     metricsKernel = {};
+    for (auto &i : batchKernels)
+    {
+        gfxDestroyKernel(gfx, i.second);
+    }
+    batchKernels.clear();
+}
+
+GfxKernel GPUImageMetrics::getMetricsKernel(Type type, Operation operation) noexcept
+{
+    // The primary configuration reuses the kernel created by 'initialise'
+    if (type == currentType && operation == currentOperation && !!metricsKernel)
+    {
+        return metricsKernel;
+    }
+
+    uint32_t const key = (static_cast<uint32_t>(type) << 8U) | static_cast<uint32_t>(operation);
+    if (auto const i = batchKernels.find(key); i != batchKernels.end())
+    {
+        return i->second;
+    }
+
+    if (!metricsProgram)
+    {
+        metricsProgram = gfxCreateProgram(gfx, "utilities/gpu_image_metrics", shaderPath.data());
+    }
+    std::vector<char const *> const baseDefines = buildMetricDefines(type, operation);
+    GfxKernel kernel = gfxCreateComputeKernel(gfx, metricsProgram, "ComputeMetric", baseDefines.data(),
+        static_cast<uint32_t>(baseDefines.size()));
+    batchKernels.emplace(key, kernel);
+    return kernel;
 }
 
 bool GPUImageMetrics::compareInternal(
     GfxTexture const &sourceImage, GfxTexture const &referenceImage) noexcept
+{
+    return compareInternal(sourceImage, referenceImage, metricsKernel);
+}
+
+bool GPUImageMetrics::compareInternal(
+    GfxTexture const &sourceImage, GfxTexture const &referenceImage, GfxKernel const &kernel) noexcept
 {
     if ((sourceImage.getWidth() != referenceImage.getWidth() && sourceImage.getWidth() != 0)
         || (sourceImage.getHeight() != referenceImage.getHeight() && sourceImage.getHeight() != 0))
@@ -220,7 +339,7 @@ bool GPUImageMetrics::compareInternal(
     }
 
     uint32_t const  dimensions[]    = {referenceImage.getWidth(), referenceImage.getHeight()};
-    uint32_t const *numThreads      = gfxKernelGetNumThreads(gfx, metricsKernel);
+    uint32_t const *numThreads      = gfxKernelGetNumThreads(gfx, kernel);
     uint32_t const  numGroupsX      = (dimensions[0] + numThreads[0] - 1) / numThreads[0];
     uint32_t const  numGroupsY      = (dimensions[1] + numThreads[1] - 1) / numThreads[1];
     uint32_t const  numOutputValues = numGroupsX * numGroupsY;
@@ -242,7 +361,7 @@ bool GPUImageMetrics::compareInternal(
 
     // Compute the metric
     {
-        gfxCommandBindKernel(gfx, metricsKernel);
+        gfxCommandBindKernel(gfx, kernel);
         gfxCommandDispatch(gfx, numGroupsX, numGroupsY, 1);
     }
 
@@ -259,10 +378,16 @@ bool GPUImageMetrics::compareInternal(
 }
 
 float GPUImageMetrics::convertMetric(float value, uint32_t totalSamples) const noexcept
+{
+    return convertMetric(value, totalSamples, currentType, currentOperation);
+}
+
+float GPUImageMetrics::convertMetric(
+    float value, uint32_t totalSamples, Type type, Operation operation) noexcept
 {
     double const totalPixels = static_cast<double>(totalSamples);
     double       ret         = (double)value / totalPixels;
-    switch (currentOperation)
+    switch (operation)
     {
     case Operation::MSE:
         // MSE = [1/(width*height)]Sum([Ref.x.y - Src.x.y]^2)
@@ -273,7 +398,7 @@ float GPUImageMetrics::convertMetric(float value, uint32_t totalSamples) const n
         break;
     case Operation::PSNR:
         // PSNR = 20log10(MaxValue) - 10log10(MSE)
-        if (currentType == Type::HDR || currentType == Type::HDR_RGB)
+        if (type == Type::HDR || type == Type::HDR_RGB)
         {
             // MaxValue is set as 1.0f as we assume always using normalised float values
             ret = -10.0 * log10(ret);
@@ -24,6 +24,10 @@ THE SOFTWARE.
 #include "gpu_reduce.h"
 #include "gpu_shared.h"
 
+#include <map>
+#include <string>
+#include <vector>
+
 namespace Capsaicin
 {
 class CapsaicinInternal;
@@ -96,6 +100,28 @@ public:
      */
     bool compareAsync(GfxTexture const &sourceImage, GfxTexture const &referenceImage) noexcept;
 
+    /**
+     * Queue a comparison job for batched execution.
+     * @note Queued jobs are only executed by a following call to 'executeBatch'. Each job may use a
+     * different image type and metric, kernels are created on demand and cached.
+     * @param sourceImage    The input image to compare.
+     * @param referenceImage The reference image to compare to.
+     * @param type           The type of data in the images.
+     * @param operation      The type of operation to perform.
+     * @returns True, if the job was queued.
+     */
+    bool queueCompare(GfxTexture const &sourceImage, GfxTexture const &referenceImage, Type type,
+        Operation operation) noexcept;
+
+    /**
+     * Execute all queued comparison jobs and read back their results.
+     * All jobs are recorded into a single command submission and their results are read back with a
+     * single GPU synchronisation, avoiding the per-call pipeline flush of 'compare'.
+     * @param [out] results The calculated metric value for each queued job, in queue order.
+     * @returns True, if all operations succeeded.
+     */
+    bool executeBatch(std::vector<float> &results) noexcept;
+
     /**
      * Read back the value of the most recent calculated metric.
      * @note When using 'compareAsync' there will be a delay before the final value is available. This delay
@@ -111,14 +137,38 @@ public:
     uint32_t getAsyncDelay() const noexcept;
 
 private:
+    /** A single queued comparison job for batched execution. */
+    struct Job
+    {
+        GfxTexture sourceImage;    /**< The input image to compare */
+        GfxTexture referenceImage; /**< The reference image to compare to */
+        Type       type;           /**< The type of data in the images */
+        Operation  operation;      /**< The type of operation to perform */
+    };
+
     /** Terminates and cleans up this object. */
     void terminate() noexcept;
 
     bool compareInternal(GfxTexture const &sourceImage, GfxTexture const &referenceImage) noexcept;
 
+    bool compareInternal(GfxTexture const &sourceImage, GfxTexture const &referenceImage,
+        GfxKernel const &kernel) noexcept;
+
+    /**
+     * Get (creating and caching on first use) the metrics kernel for a given configuration.
+     * @param type      The type of data in the images.
+     * @param operation The type of operation to perform.
+     * @returns The requested kernel.
+     */
+    GfxKernel getMetricsKernel(Type type, Operation operation) noexcept;
+
     float convertMetric(float value, uint32_t totalSamples) const noexcept;
 
-    GfxContext gfx;
+    static float convertMetric(
+        float value, uint32_t totalSamples, Type type, Operation operation) noexcept;
+
+    GfxContext  gfx;
+    std::string shaderPath; /**< Path to shader files, stored for deferred kernel creation */
 
     Type      currentType      = Type::HDR_RGB;
     Operation currentOperation = Operation::RMSE;
@@ -131,6 +181,12 @@ private:
     GfxProgram metricsProgram;
     GfxKernel  metricsKernel;
 
+    std::vector<Job> queuedJobs;          /**< Jobs queued for the next 'executeBatch' */
+    std::map<uint32_t, GfxKernel>
+              batchKernels;               /**< Kernel cache keyed on (type, operation) */
+    GfxBuffer batchResultsBuffer;         /**< Packed per-job results (GPU) */
+    GfxBuffer batchReadbackBuffer;        /**< Packed per-job results (CPU readback) */
+
     GPUReduce reducer;
 };
 } // namespace Capsaicin
@@ -70,6 +70,12 @@ bool GPUReduce::initialise(
         gfxDestroyKernel(gfx, reduceKernel);
         gfxDestroyKernel(gfx, reduceIndirectKernel);
         gfxDestroyKernel(gfx, dispatchIndirectKernel);
+        gfxDestroyKernel(gfx, singlePassReduceKernel);
+        gfxDestroyKernel(gfx, singlePassReduceIndirectKernel);
+        gfxDestroyKernel(gfx, reduceScanKernel);
+        reduceScanKernel = {};
+        gfxDestroyKernel(gfx, reduceScanIndirectKernel);
+        reduceScanIndirectKernel = {};
         reduceProgram = gfxCreateProgram(gfx, "utilities/gpu_reduce", shaderPath.data());
         std::vector<char const *> baseDefines;
         switch (currentType)
@@ -105,6 +111,20 @@ bool GPUReduce::initialise(
               baseDefines.data(), static_cast<uint32_t>(baseDefines.size()));
         dispatchIndirectKernel = gfxCreateComputeKernel(gfx, reduceProgram, "GenerateDispatches",
             baseDefines.data(), static_cast<uint32_t>(baseDefines.size()));
+        singlePassReduceKernel = gfxCreateComputeKernel(gfx, reduceProgram, "SinglePassReduce",
+            baseDefines.data(), static_cast<uint32_t>(baseDefines.size()));
+        singlePassReduceIndirectKernel = gfxCreateComputeKernel(gfx, reduceProgram,
+            "SinglePassReduceIndirect", baseDefines.data(), static_cast<uint32_t>(baseDefines.size()));
+        if (currentOperation == Operation::Sum)
+        {
+            // The fused reduce+scan kernels are only compiled for sum reductions
+            reduceScanKernel         = gfxCreateComputeKernel(gfx, reduceProgram, "ReduceScan",
+                        baseDefines.data(), static_cast<uint32_t>(baseDefines.size()));
+            reduceScanIndirectKernel = gfxCreateComputeKernel(gfx, reduceProgram, "ReduceScanIndirect",
+                baseDefines.data(), static_cast<uint32_t>(baseDefines.size()));
+        }
+        // Fall back to the multi-dispatch chain if the single-pass kernels failed to compile
+        useSinglePass = !!singlePassReduceKernel;
     }
 
     return !!dispatchIndirectKernel;
@@ -119,6 +139,16 @@ void GPUReduce::terminate() noexcept
 {
     gfxDestroyBuffer(gfx, scratchBuffer);
     scratchBuffer = {};
+    gfxDestroyBuffer(gfx, partialBuffer);
+    partialBuffer = {};
+    gfxDestroyBuffer(gfx, inclusiveBuffer);
+    inclusiveBuffer = {};
+    gfxDestroyBuffer(gfx, statusBuffer);
+    statusBuffer = {};
+    gfxDestroyBuffer(gfx, counterBuffer);
+    counterBuffer = {};
+    gfxDestroyBuffer(gfx, totalScratchBuffer);
+    totalScratchBuffer = {};
     gfxDestroyBuffer(gfx, indirectBuffer);
     indirectBuffer = {};
     gfxDestroyBuffer(gfx, indirectBuffer2);
@@ -136,6 +166,14 @@ void GPUReduce::terminate() noexcept
     reduceIndirectKernel = {};
     gfxDestroyKernel(gfx, dispatchIndirectKernel);
     dispatchIndirectKernel = {};
+    gfxDestroyKernel(gfx, singlePassReduceKernel);
+    singlePassReduceKernel = {};
+    gfxDestroyKernel(gfx, singlePassReduceIndirectKernel);
+    singlePassReduceIndirectKernel = {};
+    gfxDestroyKernel(gfx, reduceScanKernel);
+    reduceScanKernel = {};
+    gfxDestroyKernel(gfx, reduceScanIndirectKernel);
+    reduceScanIndirectKernel = {};
 }
 
 bool GPUReduce::reduceIndirect(
@@ -162,6 +200,39 @@ bool GPUReduce::reduceInternal(
     const uint      keysPerGroup  = groupSize * keysPerThread;
     const uint32_t  numGroups1    = (maxNumKeys + keysPerGroup - 1) / keysPerGroup;
     const uint32_t  numGroups2    = (numGroups1 + keysPerGroup - 1) / keysPerGroup;
+
+    if (useSinglePass)
+    {
+        // Single dispatch: the last group to publish its aggregate combines all the partials
+        ensureSinglePassScratch(numGroups1, false);
+
+        gfxCommandClearBuffer(gfx, counterBuffer);
+
+        gfxProgramSetParameter(gfx, reduceProgram, "g_InputBuffer", sourceBuffer);
+        gfxProgramSetParameter(gfx, reduceProgram, "g_OutputBuffer", sourceBuffer);
+        gfxProgramSetParameter(gfx, reduceProgram, "g_PartialBuffer", partialBuffer);
+        gfxProgramSetParameter(gfx, reduceProgram, "g_GroupCounterBuffer", counterBuffer);
+        if (indirect)
+        {
+            gfxProgramSetParameter(gfx, reduceProgram, "g_InputLength", *numKeys);
+            gfxProgramSetParameter(gfx, reduceProgram, "g_Dispatch1", indirectBuffer);
+            gfxProgramSetParameter(gfx, reduceProgram, "g_Dispatch2", indirectBuffer2);
+            gfxProgramSetParameter(gfx, reduceProgram, "g_InputLength1", indirectCountBuffer);
+            gfxProgramSetParameter(gfx, reduceProgram, "g_InputLength2", indirectCountBuffer2);
+            gfxCommandBindKernel(gfx, dispatchIndirectKernel);
+            gfxCommandDispatch(gfx, 1, 1, 1);
+            gfxCommandBindKernel(gfx, singlePassReduceIndirectKernel);
+            gfxCommandDispatchIndirect(gfx, indirectBuffer);
+        }
+        else
+        {
+            gfxProgramSetParameter(gfx, reduceProgram, "g_Count", maxNumKeys);
+            gfxCommandBindKernel(gfx, singlePassReduceKernel);
+            gfxCommandDispatch(gfx, numGroups1, 1, 1);
+        }
+        return true;
+    }
+
     if (numGroups2 > numThreads[0])
     {
         // To many keys as we only support 2 loops
@@ -261,4 +332,114 @@ bool GPUReduce::reduceInternal(
 
     return true;
 }
+
+bool GPUReduce::reduceScan(GfxBuffer const &destBuffer, GfxBuffer const &sourceBuffer, const uint numKeys,
+    GfxBuffer const *totalBuffer) noexcept
+{
+    return reduceScanInternal(destBuffer, sourceBuffer, numKeys, nullptr, totalBuffer);
+}
+
+bool GPUReduce::reduceScanIndirect(GfxBuffer const &destBuffer, GfxBuffer const &sourceBuffer,
+    GfxBuffer const &numKeys, const uint maxNumKeys, GfxBuffer const *totalBuffer) noexcept
+{
+    return reduceScanInternal(destBuffer, sourceBuffer, maxNumKeys, &numKeys, totalBuffer);
+}
+
+bool GPUReduce::reduceScanInternal(GfxBuffer const &destBuffer, GfxBuffer const &sourceBuffer,
+    const uint maxNumKeys, GfxBuffer const *numKeys, GfxBuffer const *totalBuffer) noexcept
+{
+    if (!reduceScanKernel)
+    {
+        // The fused reduce+scan is only supported for sum reductions
+        return false;
+    }
+
+    // Check if indirect
+    bool indirect = (numKeys != nullptr);
+
+    uint32_t const *numThreads    = gfxKernelGetNumThreads(gfx, reduceScanKernel);
+    const uint      groupSize     = numThreads[0];
+    const uint      keysPerThread = 4; // Must match KEYS_PER_THREAD in shader
+    const uint      keysPerGroup  = groupSize * keysPerThread;
+    const uint32_t  numGroups     = (maxNumKeys + keysPerGroup - 1) / keysPerGroup;
+
+    ensureSinglePassScratch(numGroups, true);
+
+    // The lookback statuses and the group counter must start cleared
+    gfxCommandClearBuffer(gfx, statusBuffer);
+    gfxCommandClearBuffer(gfx, counterBuffer);
+
+    gfxProgramSetParameter(gfx, reduceProgram, "g_InputBuffer", sourceBuffer);
+    gfxProgramSetParameter(gfx, reduceProgram, "g_ScanBuffer", destBuffer);
+    gfxProgramSetParameter(
+        gfx, reduceProgram, "g_OutputBuffer", totalBuffer != nullptr ? *totalBuffer : totalScratchBuffer);
+    gfxProgramSetParameter(gfx, reduceProgram, "g_PartialBuffer", partialBuffer);
+    gfxProgramSetParameter(gfx, reduceProgram, "g_InclusiveBuffer", inclusiveBuffer);
+    gfxProgramSetParameter(gfx, reduceProgram, "g_GroupStatusBuffer", statusBuffer);
+    gfxProgramSetParameter(gfx, reduceProgram, "g_GroupCounterBuffer", counterBuffer);
+    if (indirect)
+    {
+        gfxProgramSetParameter(gfx, reduceProgram, "g_InputLength", *numKeys);
+        gfxProgramSetParameter(gfx, reduceProgram, "g_Dispatch1", indirectBuffer);
+        gfxProgramSetParameter(gfx, reduceProgram, "g_Dispatch2", indirectBuffer2);
+        gfxProgramSetParameter(gfx, reduceProgram, "g_InputLength1", indirectCountBuffer);
+        gfxProgramSetParameter(gfx, reduceProgram, "g_InputLength2", indirectCountBuffer2);
+        gfxCommandBindKernel(gfx, dispatchIndirectKernel);
+        gfxCommandDispatch(gfx, 1, 1, 1);
+        gfxCommandBindKernel(gfx, reduceScanIndirectKernel);
+        gfxCommandDispatchIndirect(gfx, indirectBuffer);
+    }
+    else
+    {
+        gfxProgramSetParameter(gfx, reduceProgram, "g_Count", maxNumKeys);
+        gfxCommandBindKernel(gfx, reduceScanKernel);
+        gfxCommandDispatch(gfx, numGroups, 1, 1);
+    }
+
+    return true;
+}
+
+void GPUReduce::ensureSinglePassScratch(const uint numGroups, bool scan) noexcept
+{
+    const uint64_t typeSize = (((uint64_t)currentType % 4) + 1)
+                            * (currentType >= Type::Double ? sizeof(double) : sizeof(float));
+    const uint64_t partialBufferSize = numGroups * typeSize;
+    if (!partialBuffer || (partialBuffer.getSize() < partialBufferSize)
+        || (partialBuffer.getStride() != static_cast<uint32_t>(typeSize)))
+    {
+        gfxDestroyBuffer(gfx, partialBuffer);
+        partialBuffer = gfxCreateBuffer(gfx, partialBufferSize);
+        partialBuffer.setStride(static_cast<uint32_t>(typeSize));
+        partialBuffer.setName("Capsaicin_Reduce_PartialBuffer");
+    }
+    if (!counterBuffer)
+    {
+        counterBuffer = gfxCreateBuffer<uint>(gfx, 1);
+        counterBuffer.setName("Capsaicin_Reduce_CounterBuffer");
+    }
+    if (scan)
+    {
+        if (!inclusiveBuffer || (inclusiveBuffer.getSize() < partialBufferSize)
+            || (inclusiveBuffer.getStride() != static_cast<uint32_t>(typeSize)))
+        {
+            gfxDestroyBuffer(gfx, inclusiveBuffer);
+            inclusiveBuffer = gfxCreateBuffer(gfx, partialBufferSize);
+            inclusiveBuffer.setStride(static_cast<uint32_t>(typeSize));
+            inclusiveBuffer.setName("Capsaicin_Reduce_InclusiveBuffer");
+        }
+        if (!statusBuffer || (statusBuffer.getCount() < numGroups))
+        {
+            gfxDestroyBuffer(gfx, statusBuffer);
+            statusBuffer = gfxCreateBuffer<uint>(gfx, numGroups);
+            statusBuffer.setName("Capsaicin_Reduce_StatusBuffer");
+        }
+        if (!totalScratchBuffer || (totalScratchBuffer.getSize() < typeSize))
+        {
+            gfxDestroyBuffer(gfx, totalScratchBuffer);
+            totalScratchBuffer = gfxCreateBuffer(gfx, typeSize);
+            totalScratchBuffer.setStride(static_cast<uint32_t>(typeSize));
+            totalScratchBuffer.setName("Capsaicin_Reduce_TotalScratchBuffer");
+        }
+    }
+}
 } // namespace Capsaicin
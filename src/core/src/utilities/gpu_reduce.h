@@ -107,6 +107,33 @@ public:
      */
     bool reduce(GfxBuffer const &sourceBuffer, uint numKeys) noexcept;
 
+    /**
+     * Perform a fused reduce+scan in a single dispatch (only valid for @Operation::Sum).
+     * The exclusive scan of the source is written to the destination buffer and the overall
+     * total is written to the first element of the total buffer (when one is provided).
+     * @param destBuffer   The buffer to receive the exclusive scan of the source keys.
+     * @param sourceBuffer The buffer containing the keys to scan.
+     * @param numKeys      Value containing the number of keys in the source buffer.
+     * @param totalBuffer  (Optional) If non-null, a buffer to receive the reduced total.
+     * @return True, if operation succeeded.
+     */
+    bool reduceScan(GfxBuffer const &destBuffer, GfxBuffer const &sourceBuffer, uint numKeys,
+        GfxBuffer const *totalBuffer = nullptr) noexcept;
+
+    /**
+     * Perform a fused reduce+scan in a single dispatch using indirect execution (only valid for
+     * @Operation::Sum).
+     * @param destBuffer   The buffer to receive the exclusive scan of the source keys.
+     * @param sourceBuffer The buffer containing the keys to scan.
+     * @param numKeys      A buffer containing the number of keys in the source buffer.
+     * @param maxNumKeys   Value containing the number of keys in the source buffer, if exact value is unknown
+     *  then this should be the maximum possible number of values in the source.
+     * @param totalBuffer  (Optional) If non-null, a buffer to receive the reduced total.
+     * @return True, if operation succeeded.
+     */
+    bool reduceScanIndirect(GfxBuffer const &destBuffer, GfxBuffer const &sourceBuffer,
+        GfxBuffer const &numKeys, uint maxNumKeys, GfxBuffer const *totalBuffer = nullptr) noexcept;
+
 private:
     /** Terminates and cleans up this object. */
     void terminate() noexcept;
@@ -124,6 +151,28 @@ private:
     bool reduceInternal(
         GfxBuffer const &sourceBuffer, uint maxNumKeys, GfxBuffer const *numKeys = nullptr) noexcept;
 
+    /**
+     * Internal fused reduce+scan implementation used to handle direct and indirect cases.
+     * @param destBuffer   The buffer to receive the exclusive scan of the source keys.
+     * @param sourceBuffer The buffer containing the keys to scan.
+     * @param maxNumKeys   Value containing the number of keys in the source buffer, if using indirect
+     *  execution and exact value is unknown then this should be the maximum possible number of values in the
+     *  source.
+     * @param numKeys      (Optional) If non-null, a buffer containing the number of keys in the source buffer
+     *  used for indirect execution. If null then @maxNumKeys is used instead.
+     * @param totalBuffer  (Optional) If non-null, a buffer to receive the reduced total.
+     * @return True, if operation succeeded.
+     */
+    bool reduceScanInternal(GfxBuffer const &destBuffer, GfxBuffer const &sourceBuffer, uint maxNumKeys,
+        GfxBuffer const *numKeys = nullptr, GfxBuffer const *totalBuffer = nullptr) noexcept;
+
+    /**
+     * Ensure the scratch buffers used by the single-pass kernels can hold the requested group count.
+     * @param numGroups The number of thread groups in the dispatch.
+     * @param scan      True, if the per-group inclusive prefix and status buffers are also needed.
+     */
+    void ensureSinglePassScratch(uint numGroups, bool scan) noexcept;
+
     GfxContext gfx;
 
     Type       currentType      = Type::Float;
@@ -133,9 +182,19 @@ private:
     GfxBuffer  indirectBuffer2;
     GfxBuffer  indirectCountBuffer;
     GfxBuffer  indirectCountBuffer2;
+    GfxBuffer  partialBuffer;
+    GfxBuffer  inclusiveBuffer;
+    GfxBuffer  statusBuffer;
+    GfxBuffer  counterBuffer;
+    GfxBuffer  totalScratchBuffer;
     GfxProgram reduceProgram;
     GfxKernel  reduceKernel;
     GfxKernel  reduceIndirectKernel;
     GfxKernel  dispatchIndirectKernel;
+    GfxKernel  singlePassReduceKernel;
+    GfxKernel  singlePassReduceIndirectKernel;
+    GfxKernel  reduceScanKernel;
+    GfxKernel  reduceScanIndirectKernel;
+    bool       useSinglePass = false;
 };
 } // namespace Capsaicin
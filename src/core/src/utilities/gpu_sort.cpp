@@ -29,16 +29,30 @@ THE SOFTWARE.
 
 namespace Capsaicin
 {
+namespace
+{
+/** Number of keys processed by each tile of the single pass sort backend (must match gpu_sort.comp). */
+constexpr uint32_t kOneSweepTileSize = 4096;
+/** Number of digit values per 8bit pass of the single pass sort backend. */
+constexpr uint32_t kOneSweepRadix = 256;
+/** Maximum number of 8bit digit passes needed to sort a 32bit key. */
+constexpr uint32_t kOneSweepMaxPasses = 4;
+} // unnamed namespace
+
 GPUSort::~GPUSort() noexcept
 {
     terminate();
 }
 
-bool GPUSort::initialise(
-    GfxContext gfxIn, std::string_view const &shaderPath, Type type, Operation operation) noexcept
+bool GPUSort::initialise(GfxContext gfxIn, std::string_view const &shaderPath, Type type, Operation operation,
+    const uint keyBits) noexcept
 {
     gfx = gfxIn;
 
+    // Clamp the requested key width to the width of the key type (0 means the full width)
+    uint const maxKeyBits = (type == Type::UInt64) ? 64U : 32U;
+    currentKeyBits        = (keyBits == 0) ? maxKeyBits : std::min(keyBits, maxKeyBits);
+
     if (!parallelSortCBBuffer)
     {
         // Currently we just allocate enough for a max number of 16 segments
@@ -48,6 +62,8 @@ bool GPUSort::initialise(
         countScatterArgsBuffer.setName("Capsaicin_CountScatterArgsBuffer");
         reduceScanArgsBuffer = gfxCreateBuffer<uint>(gfx, 3 * 16);
         reduceScanArgsBuffer.setName("Capsaicin_ReduceScanArgsBuffer");
+        scanArgsBuffer = gfxCreateBuffer<uint>(gfx, 3 * 16);
+        scanArgsBuffer.setName("Capsaicin_ScanArgsBuffer");
     }
 
     if (type != currentType || operation != currentOperation)
@@ -57,6 +73,8 @@ bool GPUSort::initialise(
         sortProgram = {};
         gfxDestroyKernel(gfx, setupIndirect);
         setupIndirect = {};
+        gfxDestroyKernel(gfx, setupIndirectSegmented);
+        setupIndirectSegmented = {};
         gfxDestroyKernel(gfx, count);
         count = {};
         gfxDestroyKernel(gfx, countReduce);
@@ -69,6 +87,24 @@ bool GPUSort::initialise(
         scatter = {};
         gfxDestroyKernel(gfx, scatterPayload);
         scatterPayload = {};
+        gfxDestroyKernel(gfx, initKeyIndices);
+        initKeyIndices = {};
+        gfxDestroyKernel(gfx, extractKeyWord);
+        extractKeyWord = {};
+        gfxDestroyKernel(gfx, gatherKeys);
+        gatherKeys = {};
+        gfxDestroyKernel(gfx, gatherPayloads);
+        gatherPayloads = {};
+        gfxDestroyKernel(gfx, oneSweepSetup);
+        oneSweepSetup = {};
+        gfxDestroyKernel(gfx, oneSweepHist);
+        oneSweepHist = {};
+        gfxDestroyKernel(gfx, oneSweepScan);
+        oneSweepScan = {};
+        gfxDestroyKernel(gfx, oneSweepBinning);
+        oneSweepBinning = {};
+        gfxDestroyKernel(gfx, oneSweepBinningPayload);
+        oneSweepBinningPayload = {};
     }
     currentType      = type;
     currentOperation = operation;
@@ -76,18 +112,29 @@ bool GPUSort::initialise(
     if (!sortProgram)
     {
         gfxDestroyKernel(gfx, setupIndirect);
+        gfxDestroyKernel(gfx, setupIndirectSegmented);
         gfxDestroyKernel(gfx, count);
         gfxDestroyKernel(gfx, countReduce);
         gfxDestroyKernel(gfx, scan);
         gfxDestroyKernel(gfx, scanAdd);
         gfxDestroyKernel(gfx, scatter);
         gfxDestroyKernel(gfx, scatterPayload);
+        gfxDestroyKernel(gfx, initKeyIndices);
+        gfxDestroyKernel(gfx, extractKeyWord);
+        gfxDestroyKernel(gfx, gatherKeys);
+        gfxDestroyKernel(gfx, gatherPayloads);
+        gfxDestroyKernel(gfx, oneSweepSetup);
+        gfxDestroyKernel(gfx, oneSweepHist);
+        gfxDestroyKernel(gfx, oneSweepScan);
+        gfxDestroyKernel(gfx, oneSweepBinning);
+        gfxDestroyKernel(gfx, oneSweepBinningPayload);
         sortProgram = gfxCreateProgram(gfx, "utilities/gpu_sort", shaderPath.data());
         std::vector<char const *> baseDefines;
         switch (currentType)
         {
         case Type::Float: baseDefines.push_back("TYPE=float"); break;
         case Type::UInt: baseDefines.push_back("TYPE=uint"); break;
+        case Type::UInt64: baseDefines.push_back("TYPE=uint"); break; // Sorted as pairs of 32bit words
         default: break;
         }
         switch (currentOperation)
@@ -97,6 +144,8 @@ bool GPUSort::initialise(
         }
         setupIndirect = gfxCreateComputeKernel(gfx, sortProgram, "setupIndirectParameters",
             baseDefines.data(), static_cast<uint32_t>(baseDefines.size()));
+        setupIndirectSegmented = gfxCreateComputeKernel(gfx, sortProgram, "setupIndirectParametersSegmented",
+            baseDefines.data(), static_cast<uint32_t>(baseDefines.size()));
         count         = gfxCreateComputeKernel(
             gfx, sortProgram, "count", baseDefines.data(), static_cast<uint32_t>(baseDefines.size()));
         countReduce = gfxCreateComputeKernel(
@@ -109,14 +158,48 @@ bool GPUSort::initialise(
             gfx, sortProgram, "scatter", baseDefines.data(), static_cast<uint32_t>(baseDefines.size()));
         scatterPayload = gfxCreateComputeKernel(gfx, sortProgram, "scatterPayload", baseDefines.data(),
             static_cast<uint32_t>(baseDefines.size()));
+        initKeyIndices = gfxCreateComputeKernel(gfx, sortProgram, "initKeyIndices", baseDefines.data(),
+            static_cast<uint32_t>(baseDefines.size()));
+        extractKeyWord = gfxCreateComputeKernel(gfx, sortProgram, "extractKeyWord", baseDefines.data(),
+            static_cast<uint32_t>(baseDefines.size()));
+        gatherKeys     = gfxCreateComputeKernel(
+            gfx, sortProgram, "gatherKeys", baseDefines.data(), static_cast<uint32_t>(baseDefines.size()));
+        gatherPayloads = gfxCreateComputeKernel(gfx, sortProgram, "gatherPayloads", baseDefines.data(),
+            static_cast<uint32_t>(baseDefines.size()));
+        oneSweepSetup  = gfxCreateComputeKernel(gfx, sortProgram, "oneSweepSetupIndirect",
+             baseDefines.data(), static_cast<uint32_t>(baseDefines.size()));
+        oneSweepHist   = gfxCreateComputeKernel(gfx, sortProgram, "oneSweepHistogram", baseDefines.data(),
+              static_cast<uint32_t>(baseDefines.size()));
+        oneSweepScan = gfxCreateComputeKernel(gfx, sortProgram, "oneSweepScanHistograms",
+            baseDefines.data(), static_cast<uint32_t>(baseDefines.size()));
+        oneSweepBinning = gfxCreateComputeKernel(gfx, sortProgram, "oneSweepBinning", baseDefines.data(),
+            static_cast<uint32_t>(baseDefines.size()));
+        oneSweepBinningPayload = gfxCreateComputeKernel(gfx, sortProgram, "oneSweepBinningPayload",
+            baseDefines.data(), static_cast<uint32_t>(baseDefines.size()));
+    }
+
+    // The single pass backend resolves inter-tile prefixes with decoupled lookback which relies on
+    // wave ops with at least 32 wide waves, check hardware support and otherwise keep the multi-pass
+    // pipeline
+    useOneSweep = false;
+    if (ID3D12Device *device = gfxGetDevice(gfx); device != nullptr)
+    {
+        D3D12_FEATURE_DATA_D3D12_OPTIONS1 options1 = {};
+        if (SUCCEEDED(device->CheckFeatureSupport(D3D12_FEATURE_D3D12_OPTIONS1, &options1, sizeof(options1))))
+        {
+            useOneSweep = (options1.WaveOps != FALSE) && (options1.WaveLaneCountMin >= 32);
+        }
     }
+    useOneSweep = useOneSweep && !!oneSweepSetup && !!oneSweepHist && !!oneSweepScan && !!oneSweepBinning
+               && !!oneSweepBinningPayload;
 
     return !!scatterPayload;
 }
 
-bool GPUSort::initialise(CapsaicinInternal const &capsaicin, Type type, Operation operation) noexcept
+bool GPUSort::initialise(
+    CapsaicinInternal const &capsaicin, Type type, Operation operation, const uint keyBits) noexcept
 {
-    return initialise(capsaicin.getGfx(), capsaicin.getShaderPath(), type, operation);
+    return initialise(capsaicin.getGfx(), capsaicin.getShaderPath(), type, operation, keyBits);
 }
 
 void GPUSort::terminate() noexcept
@@ -127,6 +210,8 @@ void GPUSort::terminate() noexcept
     countScatterArgsBuffer = {};
     gfxDestroyBuffer(gfx, reduceScanArgsBuffer);
     reduceScanArgsBuffer = {};
+    gfxDestroyBuffer(gfx, scanArgsBuffer);
+    scanArgsBuffer = {};
 
     gfxDestroyBuffer(gfx, scratchBuffer);
     scratchBuffer = {};
@@ -138,10 +223,32 @@ void GPUSort::terminate() noexcept
     gfxDestroyBuffer(gfx, payloadPongBuffer);
     payloadPongBuffer = {};
 
+    gfxDestroyBuffer(gfx, keyScratchBuffer);
+    keyScratchBuffer = {};
+    gfxDestroyBuffer(gfx, keyIndexBuffer);
+    keyIndexBuffer = {};
+    gfxDestroyBuffer(gfx, sourcePong64Buffer);
+    sourcePong64Buffer = {};
+
+    gfxDestroyBuffer(gfx, oneSweepCBBuffer);
+    oneSweepCBBuffer = {};
+    gfxDestroyBuffer(gfx, oneSweepArgsBuffer);
+    oneSweepArgsBuffer = {};
+    gfxDestroyBuffer(gfx, oneSweepHistBuffer);
+    oneSweepHistBuffer = {};
+    gfxDestroyBuffer(gfx, oneSweepOffsetsBuffer);
+    oneSweepOffsetsBuffer = {};
+    gfxDestroyBuffer(gfx, oneSweepPassHistBuffer);
+    oneSweepPassHistBuffer = {};
+    gfxDestroyBuffer(gfx, oneSweepIndexBuffer);
+    oneSweepIndexBuffer = {};
+
     gfxDestroyProgram(gfx, sortProgram);
     sortProgram = {};
     gfxDestroyKernel(gfx, setupIndirect);
     setupIndirect = {};
+    gfxDestroyKernel(gfx, setupIndirectSegmented);
+    setupIndirectSegmented = {};
     gfxDestroyKernel(gfx, count);
     count = {};
     gfxDestroyKernel(gfx, countReduce);
@@ -154,6 +261,24 @@ void GPUSort::terminate() noexcept
     scatter = {};
     gfxDestroyKernel(gfx, scatterPayload);
     scatterPayload = {};
+    gfxDestroyKernel(gfx, initKeyIndices);
+    initKeyIndices = {};
+    gfxDestroyKernel(gfx, extractKeyWord);
+    extractKeyWord = {};
+    gfxDestroyKernel(gfx, gatherKeys);
+    gatherKeys = {};
+    gfxDestroyKernel(gfx, gatherPayloads);
+    gatherPayloads = {};
+    gfxDestroyKernel(gfx, oneSweepSetup);
+    oneSweepSetup = {};
+    gfxDestroyKernel(gfx, oneSweepHist);
+    oneSweepHist = {};
+    gfxDestroyKernel(gfx, oneSweepScan);
+    oneSweepScan = {};
+    gfxDestroyKernel(gfx, oneSweepBinning);
+    oneSweepBinning = {};
+    gfxDestroyKernel(gfx, oneSweepBinningPayload);
+    oneSweepBinningPayload = {};
 }
 
 void GPUSort::sortIndirect(
@@ -206,6 +331,20 @@ void GPUSort::sortPayloadSegmented(GfxBuffer const &sourceBuffer, std::vector<ui
 void GPUSort::sortInternal(GfxBuffer const &sourceBuffer, const uint maxNumKeys, GfxBuffer const *numKeys,
     GfxBuffer const *sourcePayload) noexcept
 {
+    // 64bit keys require additional passes and scratch so are handled separately
+    if (currentType == Type::UInt64)
+    {
+        sortInternal64(sourceBuffer, maxNumKeys, numKeys, sourcePayload);
+        return;
+    }
+
+    // Use the single pass per digit backend whenever the hardware supports it
+    if (useOneSweep)
+    {
+        sortInternalOneSweep(sourceBuffer, maxNumKeys, numKeys, sourcePayload);
+        return;
+    }
+
     // Check if we have payload to also sort
     bool hasPayload = sourcePayload;
 
@@ -269,8 +408,12 @@ void GPUSort::sortInternal(GfxBuffer const &sourceBuffer, const uint maxNumKeys,
     GfxBuffer const *readPayloadBuffer(sourcePayload);
     GfxBuffer const *writePayloadBuffer(&payloadPongBuffer);
 
+    // Only sort the number of bits actually used by the keys, rounded up to an even number of passes
+    // so that the final result always lands back in the source buffer
+    uint const sortBits = (std::min(currentKeyBits, 32U) + 7U) & ~7U;
+
     // Perform Radix Sort (currently only support 32-bit key/payload sorting
-    for (uint32_t shift = 0; shift < 32u; shift += FFX_PARALLELSORT_SORT_BITS_PER_PASS)
+    for (uint32_t shift = 0; shift < sortBits; shift += FFX_PARALLELSORT_SORT_BITS_PER_PASS)
     {
         // Sort Count
         {
@@ -357,10 +500,383 @@ void GPUSort::sortInternal(GfxBuffer const &sourceBuffer, const uint maxNumKeys,
     }
 }
 
+void GPUSort::sortInternalOneSweep(GfxBuffer const &sourceBuffer, const uint maxNumKeys,
+    GfxBuffer const *numKeys, GfxBuffer const *sourcePayload) noexcept
+{
+    // Check if we have payload to also sort
+    bool hasPayload = sourcePayload;
+
+    // Check if indirect
+    bool indirect = (numKeys != nullptr);
+
+    // Only sort the number of bits actually used by the keys
+    uint const sortBits  = (std::min(currentKeyBits, 32U) + 7U) & ~7U;
+    uint const numPasses = sortBits / 8U;
+    uint const maxTiles  = (maxNumKeys + kOneSweepTileSize - 1) / kOneSweepTileSize;
+    if (maxTiles == 0)
+    {
+        return;
+    }
+
+    // Make the histogram and lookback scratch buffers
+    if (!oneSweepHistBuffer)
+    {
+        oneSweepHistBuffer = gfxCreateBuffer<uint>(gfx, kOneSweepMaxPasses * kOneSweepRadix);
+        oneSweepHistBuffer.setName("Capsaicin_OneSweepHistBuffer");
+        oneSweepOffsetsBuffer = gfxCreateBuffer<uint>(gfx, kOneSweepMaxPasses * kOneSweepRadix);
+        oneSweepOffsetsBuffer.setName("Capsaicin_OneSweepOffsetsBuffer");
+        oneSweepIndexBuffer = gfxCreateBuffer<uint>(gfx, kOneSweepMaxPasses);
+        oneSweepIndexBuffer.setName("Capsaicin_OneSweepIndexBuffer");
+        oneSweepArgsBuffer = gfxCreateBuffer<uint>(gfx, 4);
+        oneSweepArgsBuffer.setName("Capsaicin_OneSweepArgsBuffer");
+    }
+    if (!oneSweepPassHistBuffer
+        || (oneSweepPassHistBuffer.getCount() < kOneSweepMaxPasses * maxTiles * kOneSweepRadix))
+    {
+        gfxDestroyBuffer(gfx, oneSweepPassHistBuffer);
+        oneSweepPassHistBuffer = gfxCreateBuffer<uint>(gfx, kOneSweepMaxPasses * maxTiles * kOneSweepRadix);
+        oneSweepPassHistBuffer.setName("Capsaicin_OneSweepPassHistBuffer");
+    }
+
+    if (indirect)
+    {
+        if (!oneSweepCBBuffer)
+        {
+            oneSweepCBBuffer = gfxCreateBuffer<uint>(gfx, 2);
+            oneSweepCBBuffer.setName("Capsaicin_OneSweepCBBuffer");
+        }
+        // Read the key count and size the tile dispatches on the GPU
+        gfxProgramSetParameter(gfx, sortProgram, "numKeys", *numKeys);
+        gfxProgramSetParameter(gfx, sortProgram, "OneSweepCB", oneSweepCBBuffer);
+        gfxProgramSetParameter(gfx, sortProgram, "OneSweepArgs", oneSweepArgsBuffer);
+        gfxCommandBindKernel(gfx, oneSweepSetup);
+        gfxCommandDispatch(gfx, 1, 1, 1);
+    }
+    else
+    {
+        uint const constantData[] = {maxNumKeys, maxTiles};
+        gfxDestroyBuffer(gfx, oneSweepCBBuffer);
+        oneSweepCBBuffer = gfxCreateBuffer<uint>(gfx, 2, constantData);
+        oneSweepCBBuffer.setName("Capsaicin_OneSweepCBBuffer");
+    }
+
+    // Setup ping-pong buffers
+    if (!sourcePongBuffer || ((sourcePongBuffer.getSize() / sizeof(uint)) < maxNumKeys))
+    {
+        gfxDestroyBuffer(gfx, sourcePongBuffer);
+        sourcePongBuffer = gfxCreateBuffer<uint>(gfx, maxNumKeys);
+        sourcePongBuffer.setName("Capsaicin_SourcePongBuffer");
+    }
+    if (hasPayload && (!payloadPongBuffer || ((payloadPongBuffer.getSize() / sizeof(uint)) < maxNumKeys)))
+    {
+        gfxDestroyBuffer(gfx, payloadPongBuffer);
+        payloadPongBuffer = gfxCreateBuffer<uint>(gfx, maxNumKeys);
+        payloadPongBuffer.setName("Capsaicin_PayloadPongBuffer");
+    }
+
+    // Reset the histograms and lookback chain state
+    gfxCommandClearBuffer(gfx, oneSweepHistBuffer, 0);
+    gfxCommandClearBuffer(gfx, oneSweepPassHistBuffer, 0);
+    gfxCommandClearBuffer(gfx, oneSweepIndexBuffer, 0);
+
+    gfxProgramSetParameter(gfx, sortProgram, "CNumPasses", numPasses);
+    gfxProgramSetParameter(gfx, sortProgram, "CMaxTiles", maxTiles);
+    gfxProgramSetParameter(gfx, sortProgram, "OneSweepCB", oneSweepCBBuffer);
+    gfxProgramSetParameter(gfx, sortProgram, "GlobalHistogram", oneSweepHistBuffer);
+    gfxProgramSetParameter(gfx, sortProgram, "GlobalOffsets", oneSweepOffsetsBuffer);
+    gfxProgramSetParameter(gfx, sortProgram, "PassHistogram", oneSweepPassHistBuffer);
+    gfxProgramSetParameter(gfx, sortProgram, "TileIndex", oneSweepIndexBuffer);
+
+    // Build the digit histograms of every pass in a single read of the keys
+    gfxProgramSetParameter(gfx, sortProgram, "SrcBuffer", sourceBuffer);
+    gfxCommandBindKernel(gfx, oneSweepHist);
+    if (indirect)
+    {
+        gfxCommandDispatchIndirect(gfx, oneSweepArgsBuffer);
+    }
+    else
+    {
+        gfxCommandDispatch(gfx, maxTiles, 1, 1);
+    }
+
+    // Exclusive prefix sum the histogram of each pass
+    gfxCommandBindKernel(gfx, oneSweepScan);
+    gfxCommandDispatch(gfx, numPasses, 1, 1);
+
+    GfxBuffer const *readBuffer(&sourceBuffer);
+    GfxBuffer const *writeBuffer(&sourcePongBuffer);
+    GfxBuffer const *readPayloadBuffer(sourcePayload);
+    GfxBuffer const *writePayloadBuffer(&payloadPongBuffer);
+
+    // Sort each 8bit digit with a single dispatch
+    for (uint32_t pass = 0; pass < numPasses; ++pass)
+    {
+        gfxProgramSetParameter(gfx, sortProgram, "CShiftBit", pass * 8U);
+        gfxProgramSetParameter(gfx, sortProgram, "CPassIndex", pass);
+        gfxProgramSetParameter(gfx, sortProgram, "SrcBuffer", *readBuffer);
+        gfxProgramSetParameter(gfx, sortProgram, "DstBuffer", *writeBuffer);
+        if (hasPayload)
+        {
+            gfxProgramSetParameter(gfx, sortProgram, "SrcPayload", *readPayloadBuffer);
+            gfxProgramSetParameter(gfx, sortProgram, "DstPayload", *writePayloadBuffer);
+            gfxCommandBindKernel(gfx, oneSweepBinningPayload);
+        }
+        else
+        {
+            gfxCommandBindKernel(gfx, oneSweepBinning);
+        }
+        if (indirect)
+        {
+            gfxCommandDispatchIndirect(gfx, oneSweepArgsBuffer);
+        }
+        else
+        {
+            gfxCommandDispatch(gfx, maxTiles, 1, 1);
+        }
+
+        // Swap read/write sources
+        std::swap(readBuffer, writeBuffer);
+        std::swap(readPayloadBuffer, writePayloadBuffer);
+    }
+
+    // An odd number of passes finishes in the ping-pong buffers so copy the result back
+    if ((numPasses & 1U) != 0)
+    {
+        gfxCommandCopyBuffer(gfx, sourceBuffer, 0, sourcePongBuffer, 0,
+            std::min(sourceBuffer.getSize(), (uint64_t)maxNumKeys * sizeof(uint)));
+        if (hasPayload)
+        {
+            gfxCommandCopyBuffer(gfx, *sourcePayload, 0, payloadPongBuffer, 0,
+                std::min(sourcePayload->getSize(), (uint64_t)maxNumKeys * sizeof(uint)));
+        }
+    }
+}
+
+void GPUSort::sortInternal64(GfxBuffer const &sourceBuffer, const uint maxNumKeys, GfxBuffer const *numKeys,
+    GfxBuffer const *sourcePayload) noexcept
+{
+    // Check if we have payload to also sort
+    bool hasPayload = sourcePayload;
+
+    // Check if indirect
+    bool indirect = (numKeys != nullptr);
+
+    uint numThreadgroupsToRun        = 0;
+    uint numReducedThreadgroupsToRun = 0;
+    if (indirect)
+    {
+        // Run the indirect sort setup kernel
+        gfxProgramSetParameter(gfx, sortProgram, "CBufferUAV", parallelSortCBBuffer);
+        gfxProgramSetParameter(gfx, sortProgram, "CountScatterArgs", countScatterArgsBuffer);
+        gfxProgramSetParameter(gfx, sortProgram, "ReduceScanArgs", reduceScanArgsBuffer);
+        gfxProgramSetParameter(gfx, sortProgram, "numKeys", *numKeys);
+
+        gfxCommandBindKernel(gfx, setupIndirect);
+        gfxCommandDispatch(gfx, 1, 1, 1);
+    }
+    else
+    {
+        FFX_ParallelSortCB constantBufferData = {0};
+        FFX_ParallelSort_SetConstantAndDispatchData(
+            maxNumKeys, 800, constantBufferData, numThreadgroupsToRun, numReducedThreadgroupsToRun);
+        gfxDestroyBuffer(gfx, parallelSortCBBuffer);
+        parallelSortCBBuffer = gfxCreateBuffer<FFX_ParallelSortCB>(gfx, 1, &constantBufferData);
+    }
+
+    // Make scratch buffers
+    uint scratchBufferSize;
+    uint reducedScratchBufferSize;
+    FFX_ParallelSort_CalculateScratchResourceSize(maxNumKeys, scratchBufferSize, reducedScratchBufferSize);
+    if (!scratchBuffer || (scratchBuffer.getSize() < scratchBufferSize))
+    {
+        gfxDestroyBuffer(gfx, scratchBuffer);
+        scratchBuffer = gfxCreateBuffer(gfx, scratchBufferSize);
+        scratchBuffer.setName("Capsaicin_ScratchBuffer");
+    }
+    if (!reducedScratchBuffer || (reducedScratchBuffer.getSize() < reducedScratchBufferSize))
+    {
+        gfxDestroyBuffer(gfx, reducedScratchBuffer);
+        reducedScratchBuffer = gfxCreateBuffer(gfx, reducedScratchBufferSize);
+        reducedScratchBuffer.setName("Capsaicin_ReducedScratchBuffer");
+    }
+
+    // Setup ping-pong buffers for the extracted key words and the key ordering.
+    // The ordering always travels through the payload channel of the sort so any user payload is
+    // only touched by the final gather.
+    if (!sourcePongBuffer || (sourcePongBuffer.getCount() < maxNumKeys))
+    {
+        gfxDestroyBuffer(gfx, sourcePongBuffer);
+        sourcePongBuffer = gfxCreateBuffer<uint>(gfx, maxNumKeys);
+        sourcePongBuffer.setName("Capsaicin_SourcePongBuffer");
+    }
+    if (!payloadPongBuffer || (payloadPongBuffer.getCount() < maxNumKeys))
+    {
+        gfxDestroyBuffer(gfx, payloadPongBuffer);
+        payloadPongBuffer = gfxCreateBuffer<uint>(gfx, maxNumKeys);
+        payloadPongBuffer.setName("Capsaicin_PayloadPongBuffer");
+    }
+    if (!keyScratchBuffer || (keyScratchBuffer.getCount() < maxNumKeys))
+    {
+        gfxDestroyBuffer(gfx, keyScratchBuffer);
+        keyScratchBuffer = gfxCreateBuffer<uint>(gfx, maxNumKeys);
+        keyScratchBuffer.setName("Capsaicin_KeyScratchBuffer");
+    }
+    if (!keyIndexBuffer || (keyIndexBuffer.getCount() < maxNumKeys))
+    {
+        gfxDestroyBuffer(gfx, keyIndexBuffer);
+        keyIndexBuffer = gfxCreateBuffer<uint>(gfx, maxNumKeys);
+        keyIndexBuffer.setName("Capsaicin_KeyIndexBuffer");
+    }
+    if (!sourcePong64Buffer || (sourcePong64Buffer.getCount() < maxNumKeys))
+    {
+        gfxDestroyBuffer(gfx, sourcePong64Buffer);
+        sourcePong64Buffer = gfxCreateBuffer<uint64_t>(gfx, maxNumKeys);
+        sourcePong64Buffer.setName("Capsaicin_SourcePong64Buffer");
+    }
+
+    uint const numHelperGroups =
+        (maxNumKeys + FFX_PARALLELSORT_THREADGROUP_SIZE - 1) / FFX_PARALLELSORT_THREADGROUP_SIZE;
+
+    // Start from the identity key ordering
+    gfxProgramSetParameter(gfx, sortProgram, "CBuffer", parallelSortCBBuffer);
+    gfxProgramSetParameter(gfx, sortProgram, "KeyIndexBuffer", keyIndexBuffer);
+    gfxCommandBindKernel(gfx, initKeyIndices);
+    gfxCommandDispatch(gfx, numHelperGroups, 1, 1);
+
+    GfxBuffer const *readBuffer(&keyScratchBuffer);
+    GfxBuffer const *writeBuffer(&sourcePongBuffer);
+    GfxBuffer const *readIndexBuffer(&keyIndexBuffer);
+    GfxBuffer const *writeIndexBuffer(&payloadPongBuffer);
+
+    // Sort the 64bit keys as up to 2 stable 32bit sorts from least to most significant word, carrying
+    // the key ordering through the payload channel. Each sort only covers the number of bits actually
+    // used by its word of the keys.
+    for (uint32_t word = 0; word * 32U < currentKeyBits; ++word)
+    {
+        uint32_t const wordBits = std::min(currentKeyBits - (word * 32U), 32U);
+
+        // Extract the requested word of each key in the current sorted order
+        gfxProgramSetParameter(gfx, sortProgram, "CBuffer", parallelSortCBBuffer);
+        gfxProgramSetParameter(gfx, sortProgram, "CKeyWord", word);
+        gfxProgramSetParameter(gfx, sortProgram, "SrcBuffer64", sourceBuffer);
+        gfxProgramSetParameter(gfx, sortProgram, "KeyIndexBuffer", *readIndexBuffer);
+        gfxProgramSetParameter(gfx, sortProgram, "DstBuffer", *readBuffer);
+        gfxCommandBindKernel(gfx, extractKeyWord);
+        gfxCommandDispatch(gfx, numHelperGroups, 1, 1);
+
+        for (uint32_t shift = 0; shift < wordBits; shift += FFX_PARALLELSORT_SORT_BITS_PER_PASS)
+        {
+            // Sort Count
+            {
+                gfxProgramSetParameter(gfx, sortProgram, "CShiftBit", shift);
+                gfxProgramSetParameter(gfx, sortProgram, "CBuffer", parallelSortCBBuffer);
+                gfxProgramSetParameter(gfx, sortProgram, "SrcBuffer", *readBuffer);
+                gfxProgramSetParameter(gfx, sortProgram, "SumTable", scratchBuffer);
+
+                gfxCommandBindKernel(gfx, count);
+                if (indirect)
+                {
+                    gfxCommandDispatchIndirect(gfx, countScatterArgsBuffer);
+                }
+                else
+                {
+                    gfxCommandDispatch(gfx, numThreadgroupsToRun, 1, 1);
+                }
+            }
+
+            // Sort Reduce
+            {
+                gfxProgramSetParameter(gfx, sortProgram, "ReduceTable", reducedScratchBuffer);
+
+                gfxCommandBindKernel(gfx, countReduce);
+                if (indirect)
+                {
+                    gfxCommandDispatchIndirect(gfx, reduceScanArgsBuffer);
+                }
+                else
+                {
+                    gfxCommandDispatch(gfx, numReducedThreadgroupsToRun, 1, 1);
+                }
+            }
+
+            // Sort Scan
+            {
+                // First do scan prefix of reduced values
+                gfxProgramSetParameter(gfx, sortProgram, "ScanSrc", reducedScratchBuffer);
+                gfxProgramSetParameter(gfx, sortProgram, "ScanDst", reducedScratchBuffer);
+                gfxCommandBindKernel(gfx, scan);
+                gfxCommandDispatch(gfx, 1, 1, 1);
+
+                // Next do scan prefix on the histogram with partial sums that we just did
+                gfxProgramSetParameter(gfx, sortProgram, "ScanSrc", scratchBuffer);
+                gfxProgramSetParameter(gfx, sortProgram, "ScanDst", scratchBuffer);
+                gfxProgramSetParameter(gfx, sortProgram, "ScanScratch", reducedScratchBuffer);
+                gfxCommandBindKernel(gfx, scanAdd);
+                if (indirect)
+                {
+                    gfxCommandDispatchIndirect(gfx, reduceScanArgsBuffer);
+                }
+                else
+                {
+                    gfxCommandDispatch(gfx, numReducedThreadgroupsToRun, 1, 1);
+                }
+            }
+
+            // Sort Scatter
+            {
+                gfxProgramSetParameter(gfx, sortProgram, "DstBuffer", *writeBuffer);
+                gfxProgramSetParameter(gfx, sortProgram, "SrcPayload", *readIndexBuffer);
+                gfxProgramSetParameter(gfx, sortProgram, "DstPayload", *writeIndexBuffer);
+                gfxCommandBindKernel(gfx, scatterPayload);
+                if (indirect)
+                {
+                    gfxCommandDispatchIndirect(gfx, countScatterArgsBuffer);
+                }
+                else
+                {
+                    gfxCommandDispatch(gfx, numThreadgroupsToRun, 1, 1);
+                }
+            }
+
+            // Swap read/write sources
+            std::swap(readBuffer, writeBuffer);
+            std::swap(readIndexBuffer, writeIndexBuffer);
+        }
+    }
+
+    // Write the keys back out in the final sorted order. The gather reads from a copy of the source so
+    // that any keys beyond the actual count are left untouched.
+    gfxCommandCopyBuffer(gfx, sourcePong64Buffer, 0, sourceBuffer, 0,
+        std::min(sourceBuffer.getSize(), sourcePong64Buffer.getSize()));
+    gfxProgramSetParameter(gfx, sortProgram, "CBuffer", parallelSortCBBuffer);
+    gfxProgramSetParameter(gfx, sortProgram, "KeyIndexBuffer", *readIndexBuffer);
+    gfxProgramSetParameter(gfx, sortProgram, "SrcBuffer64", sourcePong64Buffer);
+    gfxProgramSetParameter(gfx, sortProgram, "DstBuffer64", sourceBuffer);
+    gfxCommandBindKernel(gfx, gatherKeys);
+    gfxCommandDispatch(gfx, numHelperGroups, 1, 1);
+
+    if (hasPayload)
+    {
+        // Apply the same ordering to the user payload (the word scratch is free for the copy by now)
+        gfxCommandCopyBuffer(gfx, *writeBuffer, 0, *sourcePayload, 0,
+            std::min(sourcePayload->getSize(), writeBuffer->getSize()));
+        gfxProgramSetParameter(gfx, sortProgram, "SrcPayload", *writeBuffer);
+        gfxProgramSetParameter(gfx, sortProgram, "DstPayload", *sourcePayload);
+        gfxCommandBindKernel(gfx, gatherPayloads);
+        gfxCommandDispatch(gfx, numHelperGroups, 1, 1);
+    }
+}
+
 void GPUSort::sortInternalSegmented(GfxBuffer const &sourceBuffer, std::vector<uint> const &numKeysList,
     const uint maxNumKeys, uint numSegments, GfxBuffer const *numKeys,
     GfxBuffer const *sourcePayload) noexcept
 {
+    // Segmented sorting does not currently support 64bit keys
+    if (currentType == Type::UInt64)
+    {
+        return;
+    }
+
     // Check if we have payload to also sort
     bool hasPayload = sourcePayload != nullptr;
 
@@ -372,7 +888,7 @@ void GPUSort::sortInternalSegmented(GfxBuffer const &sourceBuffer, std::vector<u
     std::vector<BufferView<FFX_ParallelSortCB>> parallelSortCBBufferViews;
     std::vector<BufferView<uint>>               countScatterArgsBufferViews;
     std::vector<BufferView<uint>>               reduceScanArgsBufferViews;
-    std::vector<BufferView<uint>>               numKeysViews;
+    std::vector<BufferView<uint>>               scanArgsBufferViews;
     std::vector<uint>                           numThreadgroupsToRun;
     std::vector<uint>                           numReducedThreadgroupsToRun;
     if (isIndirect)
@@ -386,6 +902,9 @@ void GPUSort::sortInternalSegmented(GfxBuffer const &sourceBuffer, std::vector<u
             gfxDestroyBuffer(gfx, reduceScanArgsBuffer);
             reduceScanArgsBuffer = gfxCreateBuffer<uint>(gfx, 4 * numSegments);
             reduceScanArgsBuffer.setName("Capsaicin_ReduceScanArgsBuffer");
+            gfxDestroyBuffer(gfx, scanArgsBuffer);
+            scanArgsBuffer = gfxCreateBuffer<uint>(gfx, 4 * numSegments);
+            scanArgsBuffer.setName("Capsaicin_ScanArgsBuffer");
         }
         if (parallelSortCBBuffer.getCount() < numSegments)
         {
@@ -397,27 +916,28 @@ void GPUSort::sortInternalSegmented(GfxBuffer const &sourceBuffer, std::vector<u
         parallelSortCBBufferViews.reserve(numSegments);
         countScatterArgsBufferViews.reserve(numSegments);
         reduceScanArgsBufferViews.reserve(numSegments);
-        numKeysViews.reserve(numSegments);
+        scanArgsBufferViews.reserve(numSegments);
         for (uint i = 0; i < numSegments; ++i)
         {
             parallelSortCBBufferViews.emplace_back(gfx, parallelSortCBBuffer, i, 1);
             countScatterArgsBufferViews.emplace_back(gfx, countScatterArgsBuffer, i * 4, 3);
             reduceScanArgsBufferViews.emplace_back(gfx, reduceScanArgsBuffer, i * 4, 3);
-            numKeysViews.emplace_back(gfx, *numKeys, i, 1);
+            scanArgsBufferViews.emplace_back(gfx, scanArgsBuffer, i * 4, 3);
         }
 
-        // Run the indirect sort setup kernel
-        gfxCommandBindKernel(gfx, setupIndirect);
-        for (uint i = 0; i < numSegments; ++i)
-        {
-            gfxProgramSetParameter(gfx, sortProgram, "CBufferUAV", parallelSortCBBufferViews[i].buffer);
-            gfxProgramSetParameter(
-                gfx, sortProgram, "CountScatterArgs", countScatterArgsBufferViews[i].buffer);
-            gfxProgramSetParameter(gfx, sortProgram, "ReduceScanArgs", reduceScanArgsBufferViews[i].buffer);
-            gfxProgramSetParameter(gfx, sortProgram, "numKeys", numKeysViews[i].buffer);
+        // Run the segmented indirect sort setup kernel over all segments in a single dispatch. This
+        // reads the per-segment key counts on the GPU and writes zero sized dispatch arguments for any
+        // empty segments so that their per-pass indirect dispatches retire without doing any work.
+        gfxProgramSetParameter(gfx, sortProgram, "CNumSegments", numSegments);
+        gfxProgramSetParameter(gfx, sortProgram, "numKeys", *numKeys);
+        gfxProgramSetParameter(gfx, sortProgram, "CBufferUAV", parallelSortCBBuffer);
+        gfxProgramSetParameter(gfx, sortProgram, "CountScatterArgs", countScatterArgsBuffer);
+        gfxProgramSetParameter(gfx, sortProgram, "ReduceScanArgs", reduceScanArgsBuffer);
+        gfxProgramSetParameter(gfx, sortProgram, "ScanArgs", scanArgsBuffer);
 
-            gfxCommandDispatch(gfx, 1, 1, 1);
-        }
+        gfxCommandBindKernel(gfx, setupIndirectSegmented);
+        gfxCommandDispatch(gfx,
+            (numSegments + FFX_PARALLELSORT_THREADGROUP_SIZE - 1) / FFX_PARALLELSORT_THREADGROUP_SIZE, 1, 1);
     }
     else
     {
@@ -518,8 +1038,12 @@ void GPUSort::sortInternalSegmented(GfxBuffer const &sourceBuffer, std::vector<u
     std::vector<BufferView<uint>> const *readPayloadBuffer(&sourcePayloadViews);
     std::vector<BufferView<uint>> const *writePayloadBuffer(&payloadPongBufferViews);
 
+    // Only sort the number of bits actually used by the keys, rounded up to an even number of passes
+    // so that the final result always lands back in the source buffer
+    uint const sortBits = (std::min(currentKeyBits, 32U) + 7U) & ~7U;
+
     // Perform Radix Sort (currently only support 32-bit key/payload sorting
-    for (uint32_t shift = 0; shift < 32u; shift += FFX_PARALLELSORT_SORT_BITS_PER_PASS)
+    for (uint32_t shift = 0; shift < sortBits; shift += FFX_PARALLELSORT_SORT_BITS_PER_PASS)
     {
         // Sort Count
         {
@@ -569,7 +1093,14 @@ void GPUSort::sortInternalSegmented(GfxBuffer const &sourceBuffer, std::vector<u
                 gfxProgramSetParameter(gfx, sortProgram, "CBuffer", parallelSortCBBufferViews[i].buffer);
                 gfxProgramSetParameter(gfx, sortProgram, "ScanSrc", reducedScratchBufferViews[i].buffer);
                 gfxProgramSetParameter(gfx, sortProgram, "ScanDst", reducedScratchBufferViews[i].buffer);
-                gfxCommandDispatch(gfx, 1, 1, 1);
+                if (isIndirect)
+                {
+                    gfxCommandDispatchIndirect(gfx, scanArgsBufferViews[i].buffer);
+                }
+                else
+                {
+                    gfxCommandDispatch(gfx, 1, 1, 1);
+                }
             }
 
             // Next do scan prefix on the histogram with partial sums that we just did
@@ -41,6 +41,7 @@ public:
     {
         Float = 0, /* Does not support negative values */
         UInt,
+        UInt64, /* Keys are sorted as pairs of 32bit words (not supported by segmented sorts) */
     };
 
     /** Type of sort operation to perform. */
@@ -56,23 +57,29 @@ public:
      * @param shaderPath Path to shader files based on current working directory.
      * @param type       The object type to reduce.
      * @param operation  The type of operation to perform.
+     * @param keyBits    (Optional) The number of least significant bits actually used by the keys. Only
+     *  this many bits are sorted, use 0 to sort the full width of the key type.
      * @return True, if any initialisation/changes succeeded.
      */
-    bool initialise(
-        GfxContext gfx, std::string_view const &shaderPath, Type type, Operation operation) noexcept;
+    bool initialise(GfxContext gfx, std::string_view const &shaderPath, Type type, Operation operation,
+        uint keyBits = 0) noexcept;
 
     /**
      * Initialise the internal data based on current configuration.
      * @param capsaicin Current framework context.
      * @param type      The object type to sort.
      * @param operation The type of operation to perform.
+     * @param keyBits   (Optional) The number of least significant bits actually used by the keys. Only
+     *  this many bits are sorted, use 0 to sort the full width of the key type.
      * @return True, if any initialisation/changes succeeded.
      */
-    bool initialise(CapsaicinInternal const &capsaicin, Type type, Operation operation) noexcept;
+    bool initialise(
+        CapsaicinInternal const &capsaicin, Type type, Operation operation, uint keyBits = 0) noexcept;
 
     /**
      * Sort a list of keys from smallest to largest using indirect execution.
-     * @param sourceBuffer The buffer containing the keys to sort (only 32bit uint or float>=0 are supported).
+     * @param sourceBuffer The buffer containing the keys to sort (only 32/64bit uint or float>=0 are
+     *  supported).
      * @param numKeys      A buffer containing the number of keys in the source buffer.
      * @param maxNumKeys   Value containing the number of keys in the source buffer, if exact value is unknown
      *  then this should be the maximum possible number of values in the source.
@@ -81,7 +88,7 @@ public:
 
     /**
      * Sort a list of keys and associated payload from smallest to largest using indirect execution.
-     * @param sourceBuffer  The buffer containing the keys to sort (only 32bit uint or float>=0 are
+     * @param sourceBuffer  The buffer containing the keys to sort (only 32/64bit uint or float>=0 are
      * supported).
      * @param numKeys       A buffer containing the number of keys in the source buffer.
      * @param maxNumKeys    Value containing the number of keys in the source buffer, if exact value is
@@ -94,14 +101,15 @@ public:
 
     /**
      * Sort a list of keys from smallest to largest.
-     * @param sourceBuffer The buffer containing the keys to sort (only 32bit uint or float>=0 are supported).
+     * @param sourceBuffer The buffer containing the keys to sort (only 32/64bit uint or float>=0 are
+     *  supported).
      * @param numKeys      Value containing the number of keys in the source buffer.
      */
     void sort(GfxBuffer const &sourceBuffer, uint numKeys) noexcept;
 
     /**
      * Sort a list of keys and associated payload from smallest to largest.
-     * @param sourceBuffer  The buffer containing the keys to sort (only 32bit uint or float>=0 are
+     * @param sourceBuffer  The buffer containing the keys to sort (only 32/64bit uint or float>=0 are
      * supported).
      * @param numKeys       Value containing the number of keys in the source buffer.
      * @param sourcePayload The buffer containing the payload for each key (only 32bit payloads per key are
@@ -111,6 +119,8 @@ public:
 
     /**
      * Sort a segmented list of keys from smallest to largest using indirect execution.
+     * The per-segment key counts are read directly on the GPU and empty segments are given zero sized
+     * dispatches so they add no GPU cost.
      * @param sourceBuffer The buffer containing the keys to sort (only 32bit uint or float>=0 are supported).
      * @param numSegments  The number of segments to sort.
      * @param numKeys      A buffer containing the number of keys in each segment of the source buffer (must
@@ -123,6 +133,8 @@ public:
 
     /**
      * Sort a segmented list of keys and associated payload from smallest to largest using indirect execution.
+     * The per-segment key counts are read directly on the GPU and empty segments are given zero sized
+     * dispatches so they add no GPU cost.
      * @param sourceBuffer  The buffer containing the keys to sort (only 32bit uint or float>=0 are
      * supported).
      * @param numSegments   The number of segments to sort.
@@ -176,6 +188,41 @@ private:
     void sortInternal(GfxBuffer const &sourceBuffer, uint maxNumKeys, GfxBuffer const *numKeys = nullptr,
         GfxBuffer const *sourcePayload = nullptr) noexcept;
 
+    /**
+     * Internal sort implementation using a single dispatch per 8bit digit (OneSweep style).
+     * The digit histograms of every pass are built in one read of the keys and prefix summed once,
+     * then each digit pass combines counting, ranking and scattering in a single dispatch that
+     * resolves inter-tile offsets with decoupled lookback. Used in place of the multi-pass pipeline
+     * for non-segmented 32bit sorts when the hardware reports adequate wave support.
+     * @param sourceBuffer  The buffer containing the keys to sort (only 32bit uint or float>=0 are
+     * supported).
+     * @param maxNumKeys    Value containing the number of keys in the source buffer, if using indirect
+     *  execution and exact value is unknown then this should be the maximum possible number of values in the
+     *  source.
+     * @param numKeys       (Optional) If non-null, a buffer containing the number of keys in the source
+     * buffer used for indirect execution. If null then @maxNumKeys is used instead.
+     * @param sourcePayload (Optional) The buffer containing the payload for each key (only 32bit payloads per
+     *  key are supported).
+     */
+    void sortInternalOneSweep(GfxBuffer const &sourceBuffer, uint maxNumKeys,
+        GfxBuffer const *numKeys = nullptr, GfxBuffer const *sourcePayload = nullptr) noexcept;
+
+    /**
+     * Internal sort implementation used to handle 64bit keys.
+     * The keys are sorted as up to 2 stable 32bit sorts from least to most significant word, with the
+     * resulting key ordering carried through the payload channel and applied by a final gather.
+     * @param sourceBuffer  The buffer containing the keys to sort (only 64bit uint is supported).
+     * @param maxNumKeys    Value containing the number of keys in the source buffer, if using indirect
+     *  execution and exact value is unknown then this should be the maximum possible number of values in the
+     *  source.
+     * @param numKeys       (Optional) If non-null, a buffer containing the number of keys in the source
+     * buffer used for indirect execution. If null then @maxNumKeys is used instead.
+     * @param sourcePayload (Optional) The buffer containing the payload for each key (only 32bit payloads per
+     *  key are supported).
+     */
+    void sortInternal64(GfxBuffer const &sourceBuffer, uint maxNumKeys, GfxBuffer const *numKeys = nullptr,
+        GfxBuffer const *sourcePayload = nullptr) noexcept;
+
     /**
      * Internal sort implementation used to handle multiple sort cases.
      * @param sourceBuffer  The buffer containing the keys to sort (only 32bit uint or float>=0 are
@@ -199,10 +246,13 @@ private:
 
     Type      currentType      = Type::Float;
     Operation currentOperation = Operation::Ascending;
+    uint      currentKeyBits   = 32;
+    bool      useOneSweep = false; /**< Single pass per digit backend is supported by the hardware */
 
     GfxBuffer parallelSortCBBuffer;
     GfxBuffer countScatterArgsBuffer;
     GfxBuffer reduceScanArgsBuffer;
+    GfxBuffer scanArgsBuffer;
 
     GfxBuffer scratchBuffer;
     GfxBuffer reducedScratchBuffer;
@@ -210,13 +260,34 @@ private:
     GfxBuffer sourcePongBuffer;
     GfxBuffer payloadPongBuffer;
 
+    GfxBuffer keyScratchBuffer;
+    GfxBuffer keyIndexBuffer;
+    GfxBuffer sourcePong64Buffer;
+
+    GfxBuffer oneSweepCBBuffer;
+    GfxBuffer oneSweepArgsBuffer;
+    GfxBuffer oneSweepHistBuffer;
+    GfxBuffer oneSweepOffsetsBuffer;
+    GfxBuffer oneSweepPassHistBuffer;
+    GfxBuffer oneSweepIndexBuffer;
+
     GfxProgram sortProgram;
     GfxKernel  setupIndirect;
+    GfxKernel  setupIndirectSegmented;
     GfxKernel  count;
     GfxKernel  countReduce;
     GfxKernel  scan;
     GfxKernel  scanAdd;
     GfxKernel  scatter;
     GfxKernel  scatterPayload;
+    GfxKernel  initKeyIndices;
+    GfxKernel  extractKeyWord;
+    GfxKernel  gatherKeys;
+    GfxKernel  gatherPayloads;
+    GfxKernel  oneSweepSetup;
+    GfxKernel  oneSweepHist;
+    GfxKernel  oneSweepScan;
+    GfxKernel  oneSweepBinning;
+    GfxKernel  oneSweepBinningPayload;
 };
 } // namespace Capsaicin
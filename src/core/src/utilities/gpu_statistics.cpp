@@ -0,0 +1,132 @@
+/**********************************************************************
+Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+********************************************************************/
+#include "gpu_statistics.h"
+
+#include <algorithm>
+
+namespace Capsaicin
+{
+GPUStatistics::~GPUStatistics() noexcept
+{
+    terminate();
+}
+
+bool GPUStatistics::initialise(GfxContext const &gfxIn) noexcept
+{
+    gfx = gfxIn;
+    return true;
+}
+
+void GPUStatistics::terminate() noexcept
+{
+    for (GfxBuffer &view : counterViews)
+    {
+        gfxDestroyBuffer(gfx, view);
+    }
+    counterViews.clear();
+    gfxDestroyBuffer(gfx, counterBuffer);
+    counterBuffer = {};
+    readback.terminate();
+    names.clear();
+    clearFlags.clear();
+    values.clear();
+}
+
+uint32_t GPUStatistics::registerCounter(std::string_view const &name, bool clearPerFrame) noexcept
+{
+    for (uint32_t slot = 0; slot < static_cast<uint32_t>(names.size()); ++slot)
+    {
+        if (names[slot] == name)
+        {
+            return slot;
+        }
+    }
+    uint32_t const slot = static_cast<uint32_t>(names.size());
+    names.emplace_back(name);
+    clearFlags.push_back(clearPerFrame);
+    values.push_back(0);
+
+    // Grow the shared counters buffer, preserving any values already live on the GPU
+    GfxBuffer newBuffer = gfxCreateBuffer<uint32_t>(gfx, slot + 1);
+    newBuffer.setName("Capsaicin_GPUStatisticsBuffer");
+    gfxCommandClearBuffer(gfx, newBuffer, 0);
+    if (!!counterBuffer)
+    {
+        gfxCommandCopyBuffer(gfx, newBuffer, 0, counterBuffer, 0, counterBuffer.getSize());
+    }
+    for (GfxBuffer &view : counterViews)
+    {
+        gfxDestroyBuffer(gfx, view);
+    }
+    counterViews.clear();
+    gfxDestroyBuffer(gfx, counterBuffer);
+    counterBuffer = newBuffer;
+    for (uint32_t index = 0; index <= slot; ++index)
+    {
+        counterViews.push_back(gfxCreateBufferRange<uint32_t>(gfx, counterBuffer, index, 1));
+    }
+    readback.initialise(gfx, slot + 1, "Capsaicin_GPUStatisticsReadback");
+    return slot;
+}
+
+GfxBuffer const &GPUStatistics::getCounterBuffer(uint32_t slot) const noexcept
+{
+    return counterViews[slot];
+}
+
+uint32_t GPUStatistics::getValue(uint32_t slot) const noexcept
+{
+    return slot < values.size() ? values[slot] : 0;
+}
+
+uint32_t GPUStatistics::getDelay() const noexcept
+{
+    return readback.getDelay();
+}
+
+std::vector<std::string> const &GPUStatistics::getCounters() const noexcept
+{
+    return names;
+}
+
+void GPUStatistics::update() noexcept
+{
+    if (names.empty())
+    {
+        return;
+    }
+    readback.readback(counterBuffer);
+    if (uint32_t const *data = readback.tryGet(); data != nullptr)
+    {
+        // Counters registered after the slot being polled was written read zero until their own
+        // first copy completes, so only the elements the slot actually holds are refreshed
+        std::copy_n(data, std::min<size_t>(readback.getCount(), values.size()), values.begin());
+    }
+    for (uint32_t slot = 0; slot < static_cast<uint32_t>(clearFlags.size()); ++slot)
+    {
+        if (clearFlags[slot])
+        {
+            gfxCommandClearBuffer(gfx, counterViews[slot], 0);
+        }
+    }
+}
+} // namespace Capsaicin
@@ -0,0 +1,116 @@
+/**********************************************************************
+Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+********************************************************************/
+#pragma once
+
+#include "readback_view.h"
+
+#include <gfx.h>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Capsaicin
+{
+/**
+ * Central non-blocking GPU statistics service.
+ * Techniques and components register named 32bit counters and write them GPU-side through small
+ * buffer views of a single shared counters buffer. Once per frame the framework streams the whole
+ * buffer into a persistently mapped staging ring, so any number of counters costs a single small
+ * copy and consumers poll values that are @getDelay() frames old without ever stalling. This
+ * replaces the per-subsystem staging buffer + pending flag machinery previously duplicated for
+ * each counter and is cheap enough to stay enabled in production telemetry builds.
+ */
+class GPUStatistics
+{
+public:
+    GPUStatistics() noexcept = default;
+
+    ~GPUStatistics() noexcept;
+
+    GPUStatistics(GPUStatistics const &) = delete;
+
+    GPUStatistics &operator=(GPUStatistics const &) = delete;
+
+    /**
+     * Initialise the internal data based on current configuration.
+     * @param gfxIn Active gfx context.
+     * @return True if initialisation succeeded, False otherwise.
+     */
+    bool initialise(GfxContext const &gfxIn) noexcept;
+
+    /** Terminates and cleans up this object. */
+    void terminate() noexcept;
+
+    /**
+     * Register a named counter, or look up the slot of an already registered one.
+     * @param name          Unique name identifying the counter.
+     * @param clearPerFrame (Optional) If True the counter is reset to zero after each frames copy
+     *  so it can be accumulated into with atomic adds every frame. If False (the default) the
+     *  counter keeps its last written value until it is next written.
+     * @return The slot used to access the counter.
+     */
+    uint32_t registerCounter(std::string_view const &name, bool clearPerFrame = false) noexcept;
+
+    /**
+     * Get a single element view of a counter within the shared counters buffer.
+     * The view can be written from a kernel or used as the destination of a buffer copy.
+     * @param slot The slot returned by @registerCounter.
+     * @return The buffer view used for GPU-side writes.
+     */
+    GfxBuffer const &getCounterBuffer(uint32_t slot) const noexcept;
+
+    /**
+     * Get the most recently completed value of a counter without blocking.
+     * @param slot The slot returned by @registerCounter.
+     * @return The value recorded @getDelay() frames ago, zero if none has completed yet.
+     */
+    uint32_t getValue(uint32_t slot) const noexcept;
+
+    /**
+     * Get the number of frames between a counter being written and its value becoming pollable.
+     * @return The number of frames worth of delay.
+     */
+    uint32_t getDelay() const noexcept;
+
+    /**
+     * Get the names of all registered counters indexed by slot (e.g. for GUI or telemetry output).
+     * @return The list of counter names.
+     */
+    std::vector<std::string> const &getCounters() const noexcept;
+
+    /**
+     * Stream the counters into the staging ring and refresh the polled values.
+     * @note Called once per frame by the framework after all techniques have rendered.
+     */
+    void update() noexcept;
+
+private:
+    GfxContext gfx; /**< Cached gfx context */
+
+    std::vector<std::string> names;         /**< Registered counter names indexed by slot */
+    std::vector<bool>        clearFlags;    /**< Per-slot flag for counters reset after each copy */
+    std::vector<uint32_t>    values;        /**< Latest completed value of each counter */
+    std::vector<GfxBuffer>   counterViews;  /**< Single element views into the counters buffer */
+    GfxBuffer                counterBuffer; /**< Shared buffer holding all registered counters */
+    ReadbackView<uint32_t>   readback;      /**< Persistently mapped staging ring */
+};
+} // namespace Capsaicin
@@ -0,0 +1,133 @@
+/**********************************************************************
+Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+********************************************************************/
+#pragma once
+
+#include <gfx.h>
+#include <string>
+
+namespace Capsaicin
+{
+/**
+ * Non-blocking typed GPU readback helper.
+ * Wraps a ring of persistently mapped staging buffers (one per potentially in-flight frame) so
+ * callers can stream a GPU buffer back to the CPU every frame and poll the result a few frames
+ * later without ever stalling the pipeline. This replaces the per-subsystem hand-rolled staging
+ * buffer + sync machinery used for debug stats, metrics and similar readbacks.
+ * Usage: call @readback once per frame with the source buffer, then call @tryGet which returns
+ * the data recorded getDelay() frames ago once it is available (nullptr before that).
+ * @tparam T Generic type parameter of objects stored within the buffer.
+ */
+template<typename T>
+class ReadbackView
+{
+public:
+    /** Defaulted constructor. */
+    ReadbackView() noexcept = default;
+
+    /** Destructor. */
+    inline ~ReadbackView() noexcept { terminate(); }
+
+    /**
+     * Initialise the internal staging ring.
+     * @param context      The gfx context to create the staging buffers with.
+     * @param elementCount Number of elements of type T to read back per frame.
+     * @param name         Debug name prefix for the staging buffers.
+     * @return True if all staging buffers were successfully created.
+     */
+    inline bool initialise(GfxContext const &context, uint32_t elementCount, char const *name) noexcept
+    {
+        terminate();
+        gfx   = context;
+        count = elementCount;
+        for (uint32_t i = 0; i < kGfxConstant_BackBufferCount; ++i)
+        {
+            buffers[i] = gfxCreateBuffer<T>(gfx, elementCount, nullptr, kGfxCpuAccess_Read);
+            std::string bufferName = name;
+            bufferName += std::to_string(i);
+            buffers[i].setName(bufferName.c_str());
+            if (!buffers[i])
+            {
+                return false;
+            }
+        }
+        frameIndex = 0;
+        return true;
+    }
+
+    /**
+     * Record a copy of a GPU buffer into the next staging slot.
+     * @note Call at most once per frame. Only @getCount() elements are copied.
+     * @param source The GPU buffer to read back.
+     */
+    inline void readback(GfxBuffer const &source) noexcept
+    {
+        gfxCommandCopyBuffer(gfx, buffers[frameIndex % kGfxConstant_BackBufferCount], 0, source, 0,
+            static_cast<uint64_t>(count) * sizeof(T));
+        ++frameIndex;
+    }
+
+    /**
+     * Try to get the oldest completed readback without blocking.
+     * The staging ring spans every potentially in-flight frame, so the slot that is about to be
+     * reused is guaranteed to have retired and its persistently mapped data can be read directly.
+     * @return Typed pointer to @getCount() elements, or nullptr if no readback has completed yet.
+     */
+    inline T const *tryGet() const noexcept
+    {
+        if (frameIndex < kGfxConstant_BackBufferCount)
+        {
+            return nullptr; // the oldest slot is either unwritten or may still be in flight
+        }
+        return gfxBufferGetData<T>(gfx, buffers[frameIndex % kGfxConstant_BackBufferCount]);
+    }
+
+    /**
+     * Get the number of frames between @readback and its data becoming available from @tryGet.
+     * @return The number of frames worth of delay.
+     */
+    inline uint32_t getDelay() const noexcept { return kGfxConstant_BackBufferCount; }
+
+    /**
+     * Get the number of elements read back per frame.
+     * @return The element count.
+     */
+    inline uint32_t getCount() const noexcept { return count; }
+
+    /** Destroy the internal staging ring. */
+    inline void terminate() noexcept
+    {
+        for (GfxBuffer &buffer : buffers)
+        {
+            gfxDestroyBuffer(gfx, buffer);
+            buffer = {};
+        }
+        frameIndex = 0;
+        count      = 0;
+    }
+
+private:
+    GfxContext gfx;
+    GfxBuffer  buffers[kGfxConstant_BackBufferCount]; /**< Persistently mapped staging ring */
+    uint32_t   count      = 0;                        /**< Elements read back per frame */
+    uint64_t   frameIndex = 0;                        /**< Number of readbacks recorded so far */
+};
+} // namespace Capsaicin
@@ -0,0 +1,192 @@
+/**********************************************************************
+Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+********************************************************************/
+#include "texture_cache.h"
+
+#include <filesystem>
+#include <fstream>
+
+#define WIN32_LEAN_AND_MEAN
+#include <Windows.h>
+
+namespace Capsaicin
+{
+namespace TextureCache
+{
+namespace
+{
+constexpr uint32_t const kCacheMagic   = 0x43544331u; // 'CTC1'
+constexpr uint32_t const kCacheVersion = 1;
+
+struct CacheHeader
+{
+    uint32_t magic;
+    uint32_t version;
+    uint64_t size;
+};
+
+/** Calculates the cache file path for the given name and key. */
+std::filesystem::path getCachePath(char const *name, uint64_t key) noexcept
+{
+    char buffer[64];
+    snprintf(buffer, sizeof(buffer), "_%016llx.bin", (unsigned long long)key);
+    return std::filesystem::path("cache") / (name + std::string(buffer));
+}
+} // unnamed namespace
+
+View::~View() noexcept
+{
+    if (base_ != nullptr)
+    {
+        UnmapViewOfFile(base_);
+    }
+    if (mapping_ != nullptr)
+    {
+        CloseHandle((HANDLE)mapping_);
+    }
+    if (file_ != nullptr)
+    {
+        CloseHandle((HANDLE)file_);
+    }
+}
+
+View::View(View &&other) noexcept
+{
+    *this = std::move(other);
+}
+
+View &View::operator=(View &&other) noexcept
+{
+    if (this != &other)
+    {
+        this->~View();
+        data           = other.data;
+        size           = other.size;
+        file_          = other.file_;
+        mapping_       = other.mapping_;
+        base_          = other.base_;
+        other.data     = nullptr;
+        other.size     = 0;
+        other.file_    = nullptr;
+        other.mapping_ = nullptr;
+        other.base_    = nullptr;
+    }
+    return *this;
+}
+
+bool Load(char const *name, uint64_t key, View &view) noexcept
+{
+    auto const path = getCachePath(name, key);
+
+    HANDLE const file = CreateFileA(path.string().c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+        OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        return false;
+    }
+
+    LARGE_INTEGER file_size = {};
+    if (!GetFileSizeEx(file, &file_size) || (uint64_t)file_size.QuadPart < sizeof(CacheHeader))
+    {
+        CloseHandle(file);
+        return false;
+    }
+
+    HANDLE const mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (mapping == nullptr)
+    {
+        CloseHandle(file);
+        return false;
+    }
+
+    void const *base = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (base == nullptr)
+    {
+        CloseHandle(mapping);
+        CloseHandle(file);
+        return false;
+    }
+
+    auto const *header = (CacheHeader const *)base;
+    if (header->magic != kCacheMagic || header->version != kCacheVersion
+        || (uint64_t)file_size.QuadPart != sizeof(CacheHeader) + header->size)
+    {
+        UnmapViewOfFile(base);
+        CloseHandle(mapping);
+        CloseHandle(file);
+        return false;
+    }
+
+    view.data     = (uint8_t const *)base + sizeof(CacheHeader);
+    view.size     = header->size;
+    view.file_    = (void *)file;
+    view.mapping_ = (void *)mapping;
+    view.base_    = base;
+    return true;
+}
+
+bool Save(char const *name, uint64_t key, void const *data, uint64_t size) noexcept
+{
+    auto const path = getCachePath(name, key);
+
+    std::error_code ec;
+    std::filesystem::create_directories(path.parent_path(), ec);
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file.is_open())
+    {
+        return false;
+    }
+
+    CacheHeader header = {};
+    header.magic       = kCacheMagic;
+    header.version     = kCacheVersion;
+    header.size        = size;
+
+    file.write((char const *)&header, sizeof(header));
+    file.write((char const *)data, (std::streamsize)size);
+    return file.good();
+}
+
+uint64_t HashFile(char const *path) noexcept
+{
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open())
+    {
+        return 0;
+    }
+
+    // FNV-1a over the file contents
+    uint64_t hash = 0xcbf29ce484222325ull;
+    char     buffer[65536];
+    do
+    {
+        file.read(buffer, sizeof(buffer));
+        for (std::streamsize i = 0; i < file.gcount(); ++i)
+        {
+            hash ^= (uint8_t)buffer[i];
+            hash *= 0x100000001b3ull;
+        }
+    } while (file.good());
+    return hash != 0 ? hash : 1; // reserve zero for "no key"
+}
+} // namespace TextureCache
+} // namespace Capsaicin
@@ -0,0 +1,87 @@
+/**********************************************************************
+Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+********************************************************************/
+#pragma once
+
+#include <cstdint>
+
+namespace Capsaicin
+{
+/**
+ * Binary disk cache for GPU generated texture data.
+ * Allows components that generate textures with expensive one-time GPU passes (BRDF LUT, prefiltered
+ * environment maps) to persist the generated texels to disk and reload them on subsequent runs instead
+ * of regenerating. Cache files are keyed by a caller supplied 64bit key (e.g. a content hash of the
+ * source data) and memory-mapped on load so the texel data can be uploaded without any extra copy.
+ */
+namespace TextureCache
+{
+/** A read-only view over a memory-mapped texture cache file. */
+class View
+{
+    View(View const &)            = delete;
+    View &operator=(View const &) = delete;
+
+public:
+    View() noexcept = default;
+    ~View() noexcept;
+    View(View &&other) noexcept;
+    View &operator=(View &&other) noexcept;
+
+    void const *data = nullptr; /**< Cached texel data (points into the mapped file) */
+    uint64_t    size = 0;       /**< Size of the cached texel data (in bytes) */
+
+private:
+    friend bool Load(char const *name, uint64_t key, View &view) noexcept;
+
+    void       *file_    = nullptr; /**< Win32 handle of the backing file */
+    void       *mapping_ = nullptr; /**< Win32 handle of the file mapping */
+    void const *base_    = nullptr; /**< Base address of the mapped view */
+};
+
+/**
+ * Attempts to memory-map the cache file for the passed in name and key.
+ * @param name      Name identifying the type of cached data (used as the cache file prefix).
+ * @param key       Key identifying the cached contents (e.g. a hash of the source data).
+ * @param [out] view On success, a view over the mapped texel data. The mapping stays valid for the
+ * lifetime of the view.
+ * @returns True if a valid cache file was found and mapped, False otherwise.
+ */
+bool Load(char const *name, uint64_t key, View &view) noexcept;
+
+/**
+ * Writes texel data to the cache file for the passed in name and key.
+ * @param name Name identifying the type of cached data (used as the cache file prefix).
+ * @param key  Key identifying the cached contents (e.g. a hash of the source data).
+ * @param data The texel data to cache.
+ * @param size Size of the texel data (in bytes).
+ * @returns True if the cache file was successfully written, False otherwise.
+ */
+bool Save(char const *name, uint64_t key, void const *data, uint64_t size) noexcept;
+
+/**
+ * Calculates a hash of a files contents suitable for use as a cache key.
+ * @param path Path of the file to hash.
+ * @returns The content hash, or zero if the file could not be read.
+ */
+uint64_t HashFile(char const *path) noexcept;
+} // namespace TextureCache
+} // namespace Capsaicin
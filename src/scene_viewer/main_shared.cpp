@@ -24,8 +24,11 @@ THE SOFTWARE.
 #include "main_shared.h"
 
 #include <CLI/CLI.hpp>
+#include <algorithm>
 #include <chrono>
 #include <cmath>
+#include <filesystem>
+#include <fstream>
 #include <gfx_imgui.h>
 #include <glm/glm.hpp>
 #include <glm/gtc/quaternion.hpp>
@@ -126,6 +129,12 @@ bool CapsaicinMain::run() noexcept
         return false;
     }
 
+    // A declared option sweep runs the benchmark once per value combination instead of a single pass
+    if (benchmarkMode && !benchmarkSweepFile.empty())
+    {
+        return runBenchmarkSweep();
+    }
+
     // Render frames continuously
     while (true)
     {
@@ -147,6 +156,15 @@ bool CapsaicinMain::run() noexcept
         {
             return true;
         }
+        if (benchmarkMode && Capsaicin::GetFrameIndex() > benchmarkModeWarmupFrames)
+        {
+            recordBenchmarkTimings();
+        }
+    }
+
+    if (benchmarkMode)
+    {
+        saveBenchmarkTimings();
     }
 
     if (benchmarkMode && !benchmarkModeSuffix.empty() && Capsaicin::hasOption<bool>("image_metrics_enable")
@@ -351,6 +369,13 @@ bool CapsaicinMain::initialise() noexcept
     app.add_option("--benchmark-suffix", benchmarkModeSuffix, "Suffix to add to any saved filenames")
         ->needs(bench)
         ->capture_default_str();
+    app.add_option("--benchmark-warmup-frames", benchmarkModeWarmupFrames,
+           "Number of initial frames to exclude from benchmark timing statistics")
+        ->needs(bench)
+        ->capture_default_str();
+    app.add_option("--benchmark-sweep", benchmarkSweepFile,
+           "Config file declaring render option value ranges, the benchmark is run once per combination")
+        ->needs(bench);
 
     std::vector<std::string> renderOptions;
     app.add_option("--render-options", renderOptions, "Additional render options");
@@ -469,7 +494,6 @@ bool CapsaicinMain::initialise() noexcept
     // Pass any command line render options
     if (!renderOptions.empty())
     {
-        auto &validOpts = Capsaicin::GetOptions();
         for (auto const &opt : renderOptions)
         {
             auto const splitLoc = opt.find('=');
@@ -478,78 +502,8 @@ bool CapsaicinMain::initialise() noexcept
                 printString("Invalid command line format of '--render-options'", MessageLevel::Error);
                 return false;
             }
-            std::string option = opt.substr(0, splitLoc);
-            std::string value  = opt.substr(splitLoc + 1);
-            if (auto found = validOpts.find(option); found != validOpts.end())
+            if (!setRenderOptionFromString(opt.substr(0, splitLoc), opt.substr(splitLoc + 1)))
             {
-                if (std::holds_alternative<bool>(found->second))
-                {
-                    if (value == "true" || value == "1")
-                    {
-                        Capsaicin::setOption(option, true);
-                    }
-                    else if (value == "false" || value == "0")
-                    {
-                        Capsaicin::setOption(option, false);
-                    }
-                    else
-                    {
-                        printString("Invalid command line value passed for render option '" + option
-                                        + "' expected bool",
-                            MessageLevel::Error);
-                        return false;
-                    }
-                }
-                else if (std::holds_alternative<int32_t>(found->second))
-                {
-                    try
-                    {
-                        const int32_t newValue = std::stoi(value);
-                        Capsaicin::setOption(option, newValue);
-                    }
-                    catch (...)
-                    {
-                        printString("Invalid command line value passed for render option '" + option
-                                        + "' expected integer",
-                            MessageLevel::Error);
-                        return false;
-                    }
-                }
-                else if (std::holds_alternative<uint32_t>(found->second))
-                {
-                    try
-                    {
-                        const uint32_t newValue = std::stoul(value);
-                        Capsaicin::setOption(option, newValue);
-                    }
-                    catch (...)
-                    {
-                        printString("Invalid command line value passed for render option '" + option
-                                        + "' expected unsigned integer",
-                            MessageLevel::Error);
-                        return false;
-                    }
-                }
-                else if (std::holds_alternative<float>(found->second))
-                {
-                    try
-                    {
-                        float const newValue = std::stof(value);
-                        Capsaicin::setOption(option, newValue);
-                    }
-                    catch (...)
-                    {
-                        printString("Invalid command line value passed for render option '" + option
-                                        + "' expected float",
-                            MessageLevel::Error);
-                        return false;
-                    }
-                }
-            }
-            else
-            {
-                printString(
-                    "Invalid command line value passed for '--render-options': " + opt, MessageLevel::Error);
                 return false;
             }
         }
@@ -739,8 +693,9 @@ bool CapsaicinMain::setEnvironmentMap(EnvironmentMap environmentMap) noexcept
 
 bool CapsaicinMain::setRenderer(std::string_view renderer) noexcept
 {
-    // Change render settings based on currently selected renderer
-    if (!Capsaicin::SetRenderer(renderer))
+    // Change render settings based on currently selected renderer. The switch is performed
+    // asynchronously so the current renderer keeps presenting while the new one warms up
+    if (!Capsaicin::SetRendererAsync(renderer))
     {
         return false;
     }
@@ -1363,6 +1318,12 @@ bool CapsaicinMain::renderGUIDetails() noexcept
             rendererString += i;
             rendererString += '\0';
         }
+        bool const rendererLoading = Capsaicin::GetRendererLoading();
+        if (rendererLoading)
+        {
+            // The combo keeps showing the old renderer until the new one has warmed up and swapped in
+            ImGui::BeginDisabled();
+        }
         if (ImGui::Combo("Renderer", &selectedRenderer, rendererString.c_str(), 8))
         {
             if (currentRenderer != selectedRenderer)
@@ -1374,6 +1335,10 @@ bool CapsaicinMain::renderGUIDetails() noexcept
                 }
             }
         }
+        if (rendererLoading)
+        {
+            ImGui::EndDisabled();
+        }
         Capsaicin::RenderGUI(false);
         ImGui::Separator();
     }
@@ -1458,6 +1423,442 @@ void CapsaicinMain::saveFrame() noexcept
     }
 }
 
+void CapsaicinMain::recordBenchmarkTimings() noexcept
+{
+    auto const frame = Capsaicin::GetLastProfileFrame();
+    if (frame.nodes.empty())
+    {
+        return; // no profiling info available
+    }
+
+    auto const record = [this](std::string_view const &name, float gpuTime, float cpuTime) {
+        auto series = std::find_if(benchmarkTimings.begin(), benchmarkTimings.end(),
+            [&name](BenchmarkTimings const &timings) { return timings.name == name; });
+        if (series == benchmarkTimings.end())
+        {
+            series = benchmarkTimings.insert(benchmarkTimings.end(), {std::string(name), {}, {}});
+        }
+        series->gpuTimes.push_back(gpuTime);
+        series->cpuTimes.push_back(cpuTime);
+    };
+
+    float totalGpuTime = 0.0f;
+    for (auto const &node : frame.nodes)
+    {
+        record(node.name, node.gpuTime, node.cpuTime);
+        totalGpuTime += node.gpuTime;
+    }
+    record("Total", totalGpuTime, frame.frameTime);
+}
+
+void CapsaicinMain::saveBenchmarkTimings() noexcept
+{
+    if (benchmarkTimings.empty())
+    {
+        return; // nothing was recorded
+    }
+
+    // Ensure output directory exists, tagged with the benchmark suffix when one is set
+    std::string outDir = "./dump/"s;
+    if (!benchmarkModeSuffix.empty())
+    {
+        outDir += benchmarkModeSuffix;
+        outDir += '/';
+    }
+    {
+        std::error_code ec;
+        std::filesystem::create_directories(outDir, ec);
+    }
+    std::string baseName = getSaveName();
+    baseName.erase(0, strlen("./dump/"));
+
+    struct Stats
+    {
+        float mean;
+        float median;
+        float p95;
+        float p99;
+    };
+
+    auto const calculateStats = [](std::vector<float> samples) -> Stats {
+        std::sort(samples.begin(), samples.end());
+        auto const percentile = [&samples](double fraction) {
+            return samples[std::min(
+                (size_t)((double)(samples.size() - 1) * fraction + 0.5), samples.size() - 1)];
+        };
+        float mean = 0.0f;
+        for (float const sample : samples)
+        {
+            mean += sample;
+        }
+        mean /= (float)samples.size();
+        return {mean, percentile(0.5), percentile(0.95), percentile(0.99)};
+    };
+
+    // Write CSV with one row per technique and timing domain
+    std::string const csvFile = outDir + baseName + "_timings.csv";
+    std::ofstream     csv(csvFile);
+    if (csv.is_open())
+    {
+        csv << "name,domain,samples,mean_ms,median_ms,p95_ms,p99_ms\n";
+        for (auto const &series : benchmarkTimings)
+        {
+            Stats const gpu = calculateStats(series.gpuTimes);
+            Stats const cpu = calculateStats(series.cpuTimes);
+            csv << series.name << ",GPU," << series.gpuTimes.size() << ',' << gpu.mean << ',' << gpu.median
+                << ',' << gpu.p95 << ',' << gpu.p99 << '\n';
+            csv << series.name << ",CPU," << series.cpuTimes.size() << ',' << cpu.mean << ',' << cpu.median
+                << ',' << cpu.p95 << ',' << cpu.p99 << '\n';
+        }
+    }
+    else
+    {
+        GFX_PRINTLN("Error: Failed to write benchmark timings: %s", csvFile.c_str());
+    }
+
+    // Write the same statistics as JSON for the regression tooling
+    std::string const jsonFile = outDir + baseName + "_timings.json";
+    std::ofstream     json(jsonFile);
+    if (json.is_open())
+    {
+        auto const writeStats = [&json](char const *domain, Stats const &stats, size_t samples) {
+            json << "            \"" << domain << "\": {\"samples\": " << samples
+                 << ", \"mean_ms\": " << stats.mean << ", \"median_ms\": " << stats.median
+                 << ", \"p95_ms\": " << stats.p95 << ", \"p99_ms\": " << stats.p99 << '}';
+        };
+        json << "{\n";
+        json << "    \"renderer\": \"" << Capsaicin::GetCurrentRenderer() << "\",\n";
+        json << "    \"suffix\": \"" << benchmarkModeSuffix << "\",\n";
+        json << "    \"frameCount\": " << benchmarkModeFrameCount << ",\n";
+        json << "    \"warmupFrames\": " << benchmarkModeWarmupFrames << ",\n";
+        json << "    \"results\": [\n";
+        for (auto const &series : benchmarkTimings)
+        {
+            json << "        {\n";
+            json << "            \"name\": \"" << series.name << "\",\n";
+            writeStats("gpu", calculateStats(series.gpuTimes), series.gpuTimes.size());
+            json << ",\n";
+            writeStats("cpu", calculateStats(series.cpuTimes), series.cpuTimes.size());
+            json << "\n        }" << (&series != &benchmarkTimings.back() ? ",\n" : "\n");
+        }
+        json << "    ]\n";
+        json << "}\n";
+    }
+    else
+    {
+        GFX_PRINTLN("Error: Failed to write benchmark timings: %s", jsonFile.c_str());
+    }
+}
+
+bool CapsaicinMain::setRenderOptionFromString(std::string const &option, std::string const &value) noexcept
+{
+    auto      &validOpts = Capsaicin::GetOptions();
+    auto const found     = validOpts.find(option);
+    if (found == validOpts.end())
+    {
+        printString("Unknown render option '" + option + '\'', MessageLevel::Error);
+        return false;
+    }
+    if (std::holds_alternative<bool>(found->second))
+    {
+        if (value == "true" || value == "1")
+        {
+            Capsaicin::setOption(option, true);
+        }
+        else if (value == "false" || value == "0")
+        {
+            Capsaicin::setOption(option, false);
+        }
+        else
+        {
+            printString(
+                "Invalid value passed for render option '" + option + "' expected bool", MessageLevel::Error);
+            return false;
+        }
+    }
+    else if (std::holds_alternative<int32_t>(found->second))
+    {
+        try
+        {
+            const int32_t newValue = std::stoi(value);
+            Capsaicin::setOption(option, newValue);
+        }
+        catch (...)
+        {
+            printString("Invalid value passed for render option '" + option + "' expected integer",
+                MessageLevel::Error);
+            return false;
+        }
+    }
+    else if (std::holds_alternative<uint32_t>(found->second))
+    {
+        try
+        {
+            const uint32_t newValue = std::stoul(value);
+            Capsaicin::setOption(option, newValue);
+        }
+        catch (...)
+        {
+            printString("Invalid value passed for render option '" + option + "' expected unsigned integer",
+                MessageLevel::Error);
+            return false;
+        }
+    }
+    else if (std::holds_alternative<float>(found->second))
+    {
+        try
+        {
+            float const newValue = std::stof(value);
+            Capsaicin::setOption(option, newValue);
+        }
+        catch (...)
+        {
+            printString(
+                "Invalid value passed for render option '" + option + "' expected float", MessageLevel::Error);
+            return false;
+        }
+    }
+    return true;
+}
+
+bool CapsaicinMain::loadSweepConfig() noexcept
+{
+    std::ifstream config(benchmarkSweepFile);
+    if (!config.is_open())
+    {
+        printString("Failed to open benchmark sweep config: "s + benchmarkSweepFile, MessageLevel::Error);
+        return false;
+    }
+    auto const trim = [](std::string text) {
+        text.erase(0, text.find_first_not_of(" \t\r"));
+        text.erase(text.find_last_not_of(" \t\r") + 1);
+        return text;
+    };
+    auto const &validOpts = Capsaicin::GetOptions();
+    std::string line;
+    while (std::getline(config, line))
+    {
+        line = trim(line);
+        if (line.empty() || line.front() == '#')
+        {
+            continue; // skip blank lines and comments
+        }
+        auto const splitLoc = line.find('=');
+        if (splitLoc == std::string::npos)
+        {
+            printString("Invalid benchmark sweep config line: "s + line, MessageLevel::Error);
+            return false;
+        }
+        SweepParameter parameter;
+        parameter.name = trim(line.substr(0, splitLoc));
+        if (validOpts.find(parameter.name) == validOpts.end())
+        {
+            printString("Unknown render option in benchmark sweep config '" + parameter.name + '\'',
+                MessageLevel::Error);
+            return false;
+        }
+        std::string values = line.substr(splitLoc + 1);
+        for (size_t start = 0; start <= values.size();)
+        {
+            size_t const end   = std::min(values.find(',', start), values.size());
+            std::string  value = trim(values.substr(start, end - start));
+            if (!value.empty())
+            {
+                parameter.values.push_back(std::move(value));
+            }
+            start = end + 1;
+        }
+        if (parameter.values.empty())
+        {
+            printString(
+                "No values given for benchmark sweep option '" + parameter.name + '\'', MessageLevel::Error);
+            return false;
+        }
+        sweepParameters.push_back(std::move(parameter));
+    }
+    if (sweepParameters.empty())
+    {
+        printString("Benchmark sweep config declares no options: "s + benchmarkSweepFile, MessageLevel::Error);
+        return false;
+    }
+    return true;
+}
+
+bool CapsaicinMain::runBenchmarkSweep() noexcept
+{
+    if (!loadSweepConfig())
+    {
+        return false;
+    }
+    size_t combinationCount = 1;
+    for (auto const &parameter : sweepParameters)
+    {
+        combinationCount *= parameter.values.size();
+    }
+    std::string const baseSuffix = !benchmarkModeSuffix.empty() ? benchmarkModeSuffix : "sweep"s;
+
+    for (size_t combination = 0; combination < combinationCount; ++combination)
+    {
+        // Apply this combination's option values
+        SweepResult result;
+        size_t      stride = 1;
+        for (auto const &parameter : sweepParameters)
+        {
+            std::string const &value = parameter.values[(combination / stride) % parameter.values.size()];
+            if (!setRenderOptionFromString(parameter.name, value))
+            {
+                return false;
+            }
+            result.values.push_back(value);
+            stride *= parameter.values.size();
+        }
+        benchmarkModeSuffix = baseSuffix + '_' + std::to_string(combination);
+        benchmarkTimings.clear();
+
+        // Every combination replays the same animation window so the timings and metrics compare
+        // like for like
+        Capsaicin::RestartPlayback();
+        Capsaicin::SetPaused(false);
+
+        uint32_t const firstFrame = Capsaicin::GetFrameIndex();
+        while (Capsaicin::GetFrameIndex() - firstFrame < benchmarkModeFrameCount)
+        {
+            if (Capsaicin::GetFrameIndex() - firstFrame == benchmarkModeFrameCount - 1)
+            {
+                // Keep the final frame of every combination for visual comparison
+                saveFrame();
+            }
+            if (!renderFrame())
+            {
+                return true; // the window was closed mid-sweep
+            }
+            if (Capsaicin::GetFrameIndex() - firstFrame > benchmarkModeWarmupFrames)
+            {
+                recordBenchmarkTimings();
+            }
+        }
+        saveBenchmarkTimings();
+
+        // Aggregate this run into the results matrix
+        for (auto const &series : benchmarkTimings)
+        {
+            float mean = 0.0f;
+            for (float const sample : series.gpuTimes)
+            {
+                mean += sample;
+            }
+            result.gpuMeans.emplace_back(
+                series.name, mean / (float)std::max<size_t>(series.gpuTimes.size(), 1));
+        }
+        result.metric = finaliseImageMetrics();
+        sweepResults.push_back(std::move(result));
+    }
+
+    saveSweepResults(baseSuffix);
+    return true;
+}
+
+std::string CapsaicinMain::finaliseImageMetrics() noexcept
+{
+    if (!Capsaicin::hasOption<bool>("image_metrics_enable")
+        || !Capsaicin::getOption<bool>("image_metrics_enable")
+        || !Capsaicin::getOption<bool>("image_metrics_save_to_file"))
+    {
+        return "";
+    }
+    // Flush remaining stats then force the metrics file closed, re-enabling for the next run
+    for (uint32_t i = 0; i <= gfxGetBackBufferCount(contextGFX); ++i)
+    {
+        Capsaicin::Render();
+        gfxFrame(contextGFX);
+    }
+    Capsaicin::setOption<bool>("image_metrics_enable", false);
+    Capsaicin::Render();
+    Capsaicin::setOption<bool>("image_metrics_enable", true);
+
+    // Rename metrics file to also contain suffix
+    auto        savePath       = getSaveName();
+    std::string newMetricsFile = savePath + '_' + benchmarkModeSuffix + ".csv";
+    std::remove(newMetricsFile.c_str());
+    std::string metricsFile = savePath + ".csv";
+    if (std::rename(metricsFile.c_str(), newMetricsFile.c_str()) != 0)
+    {
+        printString("Failed to rename image metrics file: "s + metricsFile, MessageLevel::Warning);
+        return "";
+    }
+
+    // Pull the final metric value (last field of the last data row) into the results matrix
+    std::ifstream metrics(newMetricsFile);
+    std::string   line;
+    std::string   lastLine;
+    while (std::getline(metrics, line))
+    {
+        if (!line.empty())
+        {
+            lastLine = line;
+        }
+    }
+    if (auto const separator = lastLine.find_last_of(','); separator != std::string::npos)
+    {
+        return lastLine.substr(separator + 1);
+    }
+    return "";
+}
+
+void CapsaicinMain::saveSweepResults(std::string const &baseSuffix) noexcept
+{
+    if (sweepResults.empty())
+    {
+        return; // nothing was recorded
+    }
+    {
+        std::error_code ec;
+        std::filesystem::create_directories("./dump/", ec);
+    }
+    std::string const csvFile = "./dump/"s + baseSuffix + "_results.csv";
+    std::ofstream     csv(csvFile);
+    if (!csv.is_open())
+    {
+        GFX_PRINTLN("Error: Failed to write benchmark sweep results: %s", csvFile.c_str());
+        return;
+    }
+    // Columns are taken from the first combination; later runs are matched by technique name so a
+    // renderer that adds or removes passes mid-sweep still lines up
+    csv << "combination";
+    for (auto const &parameter : sweepParameters)
+    {
+        csv << ',' << parameter.name;
+    }
+    for (auto const &series : sweepResults.front().gpuMeans)
+    {
+        csv << ',' << series.first << "_gpu_mean_ms";
+    }
+    csv << ",image_metric\n";
+    for (size_t combination = 0; combination < sweepResults.size(); ++combination)
+    {
+        auto const &result = sweepResults[combination];
+        csv << combination;
+        for (auto const &value : result.values)
+        {
+            csv << ',' << value;
+        }
+        for (auto const &column : sweepResults.front().gpuMeans)
+        {
+            auto const series = std::find_if(result.gpuMeans.begin(), result.gpuMeans.end(),
+                [&column](std::pair<std::string, float> const &mean) { return mean.first == column.first; });
+            if (series != result.gpuMeans.end())
+            {
+                csv << ',' << series->second;
+            }
+            else
+            {
+                csv << ',';
+            }
+        }
+        csv << ',' << result.metric << '\n';
+    }
+}
+
 std::string CapsaicinMain::getSaveName() const noexcept
 {
     std::string savePath = "./dump/"s;
@@ -153,6 +153,55 @@ protected:
      */
     void saveFrame() noexcept;
 
+    /** Records the most recent frame's per-technique timings into the benchmark statistics. */
+    void recordBenchmarkTimings() noexcept;
+
+    /**
+     * Write the recorded benchmark timing statistics (mean/median/p95/p99) to CSV and JSON files.
+     * @note Saves to the 'dump' subdirectory, or 'dump/<benchmarkModeSuffix>' when a suffix is set.
+     */
+    void saveBenchmarkTimings() noexcept;
+
+    /**
+     * Set a render option from its textual value, converting to the option's registered type.
+     * @param option The name of the render option.
+     * @param value  The value to set (parsed as bool/int/uint/float to match the option).
+     * @return Boolean signaling if no error occurred.
+     */
+    bool setRenderOptionFromString(std::string const &option, std::string const &value) noexcept;
+
+    /**
+     * Load and parse the benchmark sweep configuration file.
+     * Each non-comment line declares a render option and the comma separated values to sweep, e.g.
+     * `gi10_hash_grid_cache_cell_size = 0.25, 0.5, 1.0`. One benchmark run is performed for every
+     * combination of the declared values.
+     * @return Boolean signaling if no error occurred.
+     */
+    [[nodiscard]] bool loadSweepConfig() noexcept;
+
+    /**
+     * Run the benchmark once per option combination declared in the sweep config.
+     * Every combination replays the same fixed frame rate animation window for
+     * @benchmarkModeFrameCount frames and the per-pass timing statistics plus any image metric
+     * score are collected into a results matrix written alongside the per-run files.
+     * @return Boolean signaling if no error occurred.
+     */
+    [[nodiscard]] bool runBenchmarkSweep() noexcept;
+
+    /**
+     * Finalise the image metrics file for the current benchmark run (when metrics are enabled).
+     * Flushes in-flight frames, forces the metrics file closed, renames it with the current
+     * benchmark suffix and extracts the final metric value.
+     * @return The final metric value as text, empty when metrics are unavailable.
+     */
+    std::string finaliseImageMetrics() noexcept;
+
+    /**
+     * Write the collected sweep results matrix to CSV.
+     * @param baseSuffix The suffix identifying this sweep in the output directory.
+     */
+    void saveSweepResults(std::string const &baseSuffix) noexcept;
+
     /**
      * Get the common base file name based on current capsaicin settings.
      * @return String containing base name.
@@ -177,6 +226,37 @@ protected:
     uint32_t benchmarkModeStartFrame = uint32_t(-1); /**< The first frame to start saving images at in
                                                         benchmark mode (default is just the last frame) */
     std::string benchmarkModeSuffix;                 /**< String appended to any saved files */
+    uint32_t    benchmarkModeWarmupFrames = 0;       /**< Number of initial frames excluded from
+                                                        benchmark timing statistics */
+
+    /** Per-technique timing series recorded during benchmark mode */
+    struct BenchmarkTimings
+    {
+        std::string        name;     /**< The name of the timed component/technique */
+        std::vector<float> gpuTimes; /**< Per-frame GPU durations (ms) */
+        std::vector<float> cpuTimes; /**< Per-frame CPU durations (ms) */
+    };
+
+    std::vector<BenchmarkTimings> benchmarkTimings; /**< Recorded timings per technique plus frame total */
+
+    /** A single render option and the values it sweeps through during a benchmark sweep */
+    struct SweepParameter
+    {
+        std::string              name;   /**< The name of the render option */
+        std::vector<std::string> values; /**< The textual values to sweep through */
+    };
+
+    /** Aggregated results of one sweep combination */
+    struct SweepResult
+    {
+        std::vector<std::string> values; /**< The option values used (one per sweep parameter) */
+        std::vector<std::pair<std::string, float>> gpuMeans; /**< Mean GPU time (ms) per technique */
+        std::string                                metric;   /**< Final image metric score (if any) */
+    };
+
+    std::string                 benchmarkSweepFile; /**< Path of the sweep config (empty disables) */
+    std::vector<SweepParameter> sweepParameters;    /**< The parsed sweep parameters */
+    std::vector<SweepResult>    sweepResults;       /**< Collected results per combination */
     bool        saveAsJPEG = false;                  /**< File type selector for dump frame */
     bool reenableToneMap   = false; /**< Used to re-enable Tonemapping after a frame has been saved to disk */
     bool reDisableRender   = false; /**< Use to render only a single frame at a time */